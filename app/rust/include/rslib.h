@@ -9,9 +9,14 @@ parser_error_t from_bytes_wide(const uint8_t input[64], uint8_t output[32]);
 parser_error_t scalar_multiplication(const uint8_t input[32], constant_key_t key, uint8_t output[32]);
 parser_error_t randomized_secret_from_seed(const uint8_t ask[32], const uint8_t alpha[32], uint8_t output[32]);
 parser_error_t compute_sbar(const uint8_t s[32], uint8_t r[32], uint8_t rsk[32], uint8_t sbar[32]);
+parser_error_t sign_spends_batch(const uint8_t ask[32], const uint8_t sighash[32], const uint8_t *alphas, const uint8_t *rngs, uint8_t count, uint8_t *signatures);
 parser_error_t add_points(const uint8_t hash[32], const uint8_t value[32], const uint8_t scalar[32], uint8_t cv[32]);
 parser_error_t is_valid_diversifier(const uint8_t hash[32]);
+parser_error_t value_commitment_generator(const uint8_t hash[32], uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN]);
+parser_error_t compute_value_commitment(const uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN], uint64_t value, const uint8_t rcv[32], uint8_t cv[32]);
+parser_error_t verify_value_commitments(const value_commitment_item_t *items, uint8_t count);
 void get_pkd(uint32_t zip32_account, const uint8_t *diversifier_ptr, uint8_t *pkd);
 void zip32_child_ask_nsk(uint32_t account, uint8_t *ask, uint8_t *nsk);
 void diversifier_find_valid(uint32_t zip32_account, uint8_t *default_diversifier);
+void diversifier_find_list(uint32_t zip32_account, const uint8_t *start, uint8_t *diversifier_list, uint8_t diversifier_list_len);
 void zip32_xfvk(uint32_t zip32_account, uint8_t *fvk_tag, uint8_t *chain_code, uint8_t *fvk, uint8_t *dk);
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+Generates src/fixed_base_tables.rs, the windowed tables used by
+cryptoops::fixed_base_multiply for the Jubjub generators in constants.rs.
+
+The 252 low bits of the scalar (as AffineNielsPoint::multiply_bits, which
+ignores the top 4 bits of its input) are recoded into 4-bit signed digits in
+-8..=7, 63 windows plus one for the last carry. For every window w and every
+magnitude j in 1..=8 the table holds j * 16^w * G in affine coordinates,
+negative digits negate the entry.
+
+Usage: python3 scripts/gen_fixed_base_tables.py > src/fixed_base_tables.rs
+"""
+
+import sys
+
+# Base field of Jubjub (scalar field of BLS12-381)
+Q = 0x73EDA753299D7D483339D80809A1D80553BDA402FFFE5BFEFFFFFFFF00000001
+# Twisted Edwards parameter d = -(10240/10241)
+D = (-10240 * pow(10241, -1, Q)) % Q
+
+WINDOW_BITS = 4
+WINDOWS = 64
+ENTRIES = 1 << (WINDOW_BITS - 1)
+
+# Affine (u, v) of the generators, same limbs as constants.rs
+GENERATORS = [
+    (
+        "SPENDING_KEY_GENERATOR_TABLE",
+        [0xEC75293D81248452, 0x39F5B03380AF6020, 0xF831C2B19FEC6026, 0x5B389522A9E81532],
+        [0x14B62623A186B4B1, 0x2012D031F624FD52, 0x75DEFECFF1F49EF2, 0x0CBC5F9F1E52E0AB],
+    ),
+    (
+        "VALUE_COMMITMENT_RANDOMNESS_GENERATOR_TABLE",
+        [0xDD93D364CB8CEC7E, 0x91CC3E3835675450, 0xCFA86026B8D99BE9, 0x1C6DA0CE9A5E5FDB],
+        [0x28E5FCE99CE692D0, 0xF94C2DAA360302FE, 0xBC900CD4B8AE1150, 0x555F11F9B720D50B],
+    ),
+]
+
+
+def from_limbs(limbs):
+    return sum(limb << (64 * i) for i, limb in enumerate(limbs))
+
+
+def to_limbs(value):
+    return [(value >> (64 * i)) & 0xFFFFFFFFFFFFFFFF for i in range(4)]
+
+
+def on_curve(point):
+    u, v = point
+    return (-u * u + v * v - 1 - D * u * u * v * v) % Q == 0
+
+
+def add(p, q):
+    u1, v1 = p
+    u2, v2 = q
+    t = D * u1 * u2 * v1 * v2 % Q
+    u3 = (u1 * v2 + v1 * u2) * pow(1 + t, -1, Q) % Q
+    v3 = (v1 * v2 + u1 * u2) * pow(1 - t, -1, Q) % Q
+    return (u3, v3)
+
+
+def fmt_limbs(value):
+    return "[" + ", ".join("0x%016x" % limb for limb in to_limbs(value)) + "]"
+
+
+def emit_table(out, name, base):
+    out.write("#[rustfmt::skip]\n")
+    out.write("pub static %s: FixedBaseTable = [\n" % name)
+    window_base = base
+    for _ in range(WINDOWS):
+        out.write("    [\n")
+        point = window_base
+        for _ in range(ENTRIES):
+            out.write("        affine(%s, %s),\n" % (fmt_limbs(point[0]), fmt_limbs(point[1])))
+            point = add(point, window_base)
+        out.write("    ],\n")
+        # point is now (ENTRIES + 1) * window_base
+        for _ in range((1 << WINDOW_BITS) - ENTRIES - 1):
+            point = add(point, window_base)
+        window_base = point
+    out.write("];\n")
+
+
+def main():
+    out = sys.stdout
+    out.write("// Generated by scripts/gen_fixed_base_tables.py, do not edit.\n")
+    out.write("// Included from constants.rs, entry [w][j - 1] is j * 16^w * G.\n")
+    for name, u, v in GENERATORS:
+        base = (from_limbs(u), from_limbs(v))
+        if not on_curve(base):
+            raise SystemExit("%s: generator is not on the curve" % name)
+        out.write("\n")
+        emit_table(out, name, base)
+
+
+if __name__ == "__main__":
+    main()
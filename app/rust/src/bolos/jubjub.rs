@@ -1,5 +1,5 @@
 use crate::bolos::canary::c_check_app_canary;
-use crate::{bolos, constants};
+use crate::{bolos, constants, cryptoops};
 use jubjub::AffinePoint;
 
 pub fn scalarmult(point: &mut [u8], scalar: &[u8]) {
@@ -17,6 +17,7 @@ pub fn scalarmult(point: &mut [u8], scalar: &[u8]) {
 pub fn scalarmult_spending_base(point: &mut [u8], scalar: &[u8]) {
     let mut scalarbytes = [0u8; 32];
     scalarbytes.copy_from_slice(scalar);
-    let result = constants::SPENDING_KEY_GENERATOR.multiply_bits(&scalarbytes);
+    let result =
+        cryptoops::fixed_base_multiply(&constants::SPENDING_KEY_GENERATOR_TABLE, &scalarbytes);
     point.copy_from_slice(&AffinePoint::from(result).to_bytes());
 }
@@ -65,6 +65,24 @@ pub const VALUE_COMMITMENT_RANDOMNESS_GENERATOR: AffineNielsPoint =
     )
     .to_niels();
 
+/// Scalars are consumed in signed 4-bit windows (digits -8..=7), low 252 bits only
+/// (as AffineNielsPoint::multiply_bits), plus one window for the last carry
+pub const FIXED_BASE_WINDOW_BITS: usize = 4;
+pub const FIXED_BASE_WINDOWS: usize = 64;
+pub const FIXED_BASE_WINDOW_ENTRIES: usize = 1 << (FIXED_BASE_WINDOW_BITS - 1);
+
+/// Entry [w][j - 1] holds j * 16^w * G, negative digits negate it and the zero digit is the
+/// identity, not stored. Affine entries take 64 bytes (32 KiB per table) instead of 96 as Niels.
+pub type FixedBaseTable = [[AffinePoint; FIXED_BASE_WINDOW_ENTRIES]; FIXED_BASE_WINDOWS];
+
+const fn affine(u: [u64; 4], v: [u64; 4]) -> AffinePoint {
+    AffinePoint::from_raw_unchecked(Fq::from_raw(u), Fq::from_raw(v))
+}
+
+// Tables for the generators used on every spend (rk, signature nonce and value commitments),
+// regenerate with scripts/gen_fixed_base_tables.py
+include!("fixed_base_tables.rs");
+
 pub const DIV_SIZE: usize = 11;
 pub const DIV_DEFAULT_LIST_LEN: usize = 4;
 pub const GH_FIRST_BLOCK: &[u8; 64] =
@@ -1,7 +1,9 @@
 use crate::bolos::blake2b;
 use crate::bolos::blake2b::blake2b_expand_seed;
+use crate::constants::{FixedBaseTable, FIXED_BASE_WINDOWS};
 use crate::types::Diversifier;
-use jubjub::{AffinePoint, ExtendedPoint, Fr};
+use jubjub::{AffineNielsPoint, AffinePoint, ExtendedNielsPoint, ExtendedPoint, Fq, Fr};
+use subtle::{Choice, ConditionallySelectable, ConstantTimeEq};
 
 #[inline(always)]
 pub fn prf_expand(sk: &[u8], t: &[u8]) -> [u8; 64] {
@@ -22,6 +24,68 @@ pub fn mult_by_gd(scalar: &[u8; 32], d: &Diversifier) -> [u8; 32] {
     extended_to_bytes(&t)
 }
 
+/// Same result as `G.multiply_bits(scalar)` using the precomputed multiples of G:
+/// one mixed addition per signed 4-bit window instead of a doubling and an addition per bit.
+/// Every entry of a window is scanned and negated digits are selected, not branched on, so
+/// neither the memory access pattern nor the timing depends on the scalar.
+#[inline(never)]
+pub fn fixed_base_multiply(table: &FixedBaseTable, scalar: &[u8; 32]) -> ExtendedPoint {
+    let mut acc = ExtendedPoint::identity();
+    let mut carry = 0u8;
+    for (window, entries) in table.iter().enumerate() {
+        // The last window only takes the carry, the top 4 bits of the scalar are ignored
+        let nibble = if window < FIXED_BASE_WINDOWS - 1 {
+            (scalar[window / 2] >> ((window % 2) * 4)) & 0x0f
+        } else {
+            0
+        };
+        // nibble + carry in 0..=16 becomes digit + 16 * carry with digit in -8..=7
+        let raw = nibble + carry;
+        carry = (raw + 8) >> 4;
+        let digit = raw.wrapping_sub(carry << 4) as i8;
+        let sign = digit >> 7;
+        let magnitude = ((digit ^ sign) - sign) as u8;
+
+        let mut selected = AffinePoint::identity();
+        for (j, entry) in entries.iter().enumerate() {
+            selected.conditional_assign(entry, magnitude.ct_eq(&(j as u8 + 1)));
+        }
+        let negated = -selected;
+        selected.conditional_assign(&negated, Choice::from((sign & 1) as u8));
+        acc += selected.to_niels();
+    }
+    acc
+}
+
+fn scalar_bit_length(scalar: &[u8; 32]) -> usize {
+    for i in (0..32).rev() {
+        if scalar[i] != 0 {
+            return 8 * i + 8 - scalar[i].leading_zeros() as usize;
+        }
+    }
+    0
+}
+
+/// sum(scalars[i] * points[i]) with the doublings shared between all the terms.
+/// Variable time, only for public scalars or one-off random weights.
+#[inline(never)]
+pub fn multiscalar_mul_vartime(
+    points: &[ExtendedNielsPoint],
+    scalars: &[[u8; 32]],
+) -> ExtendedPoint {
+    let top = scalars.iter().map(scalar_bit_length).max().unwrap_or(0);
+    let mut acc = ExtendedPoint::identity();
+    for bit in (0..top).rev() {
+        acc = acc.double();
+        for (point, scalar) in points.iter().zip(scalars.iter()) {
+            if (scalar[bit / 8] >> (bit % 8)) & 1 == 1 {
+                acc += point;
+            }
+        }
+    }
+    acc
+}
+
 #[inline(never)]
 pub fn mul_by_cofactor(p: &mut ExtendedPoint) {
     *p = p.mul_by_cofactor();
@@ -37,6 +101,35 @@ pub fn extended_to_bytes(point: &ExtendedPoint) -> [u8; 32] {
     AffinePoint::from(*point).to_bytes()
 }
 
+/// Affine u || v, cheaper to load than a compressed point as no square root is needed
+#[inline(never)]
+pub fn extended_to_uv_bytes(point: &ExtendedPoint) -> [u8; 64] {
+    let affine = AffinePoint::from(*point);
+    let mut bytes = [0u8; 64];
+    bytes[..32].copy_from_slice(&affine.get_u().to_bytes());
+    bytes[32..].copy_from_slice(&affine.get_v().to_bytes());
+    bytes
+}
+
+#[inline(never)]
+pub fn uv_bytes_to_extended(bytes: &[u8; 64]) -> Option<ExtendedPoint> {
+    let mut u = [0u8; 32];
+    let mut v = [0u8; 32];
+    u.copy_from_slice(&bytes[..32]);
+    v.copy_from_slice(&bytes[32..]);
+
+    let u = Fq::from_bytes(&u);
+    let v = Fq::from_bytes(&v);
+    if u.is_none().into() || v.is_none().into() {
+        return None;
+    }
+    let point = AffinePoint::from_raw_unchecked(u.unwrap(), v.unwrap());
+    if !point.is_on_curve_vartime() {
+        return None;
+    }
+    Some(ExtendedPoint::from(point))
+}
+
 #[inline(never)]
 pub fn bytes_to_extended(m: [u8; 32]) -> ExtendedPoint {
     ExtendedPoint::from(AffinePoint::from_bytes(m).unwrap())
@@ -51,3 +144,93 @@ pub fn add_to_point(point: &mut ExtendedPoint, p: &ExtendedPoint) {
 pub fn niels_multbits(p: &mut ExtendedPoint, b: &[u8; 32]) {
     *p = p.to_niels().multiply_bits(b);
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::constants::{
+        SPENDING_KEY_GENERATOR, SPENDING_KEY_GENERATOR_TABLE,
+        VALUE_COMMITMENT_RANDOMNESS_GENERATOR, VALUE_COMMITMENT_RANDOMNESS_GENERATOR_TABLE,
+    };
+
+    fn test_scalars() -> [[u8; 32]; 8] {
+        let mut counting = [0u8; 32];
+        for (i, b) in counting.iter_mut().enumerate() {
+            *b = (i as u8).wrapping_mul(37).wrapping_add(11);
+        }
+        [
+            [0u8; 32],
+            [0xffu8; 32],
+            Fr::one().to_bytes(),
+            (-Fr::one()).to_bytes(),
+            counting,
+            // rsk from the keps vectors
+            [
+                0x74, 0x0d, 0xf0, 0x6d, 0x1f, 0x77, 0x51, 0x71, 0xde, 0x02, 0xf5, 0x81, 0xae, 0xe3,
+                0x0f, 0xce, 0x6c, 0x05, 0x5e, 0x54, 0xa1, 0xc4, 0x53, 0xe6, 0xf0, 0xf3, 0x88, 0x47,
+                0x10, 0x26, 0xff, 0x05,
+            ],
+            // Negative digits in every window, and the largest positive ones
+            [0x88u8; 32],
+            [0x77u8; 32],
+        ]
+    }
+
+    #[test]
+    fn fixed_base_matches_multiply_bits() {
+        let bases = [
+            (SPENDING_KEY_GENERATOR, &SPENDING_KEY_GENERATOR_TABLE),
+            (
+                VALUE_COMMITMENT_RANDOMNESS_GENERATOR,
+                &VALUE_COMMITMENT_RANDOMNESS_GENERATOR_TABLE,
+            ),
+        ];
+        for (base, table) in bases.iter() {
+            for scalar in test_scalars().iter() {
+                assert_eq!(
+                    extended_to_bytes(&fixed_base_multiply(table, scalar)),
+                    extended_to_bytes(&base.multiply_bits(scalar))
+                );
+            }
+        }
+    }
+
+    #[test]
+    fn multiscalar_matches_separate_multiplications() {
+        let scalars = test_scalars();
+        let points = [
+            SPENDING_KEY_GENERATOR.multiply_bits(&scalars[4]),
+            VALUE_COMMITMENT_RANDOMNESS_GENERATOR.multiply_bits(&scalars[5]),
+            SPENDING_KEY_GENERATOR.multiply_bits(&scalars[2]),
+        ];
+        let weights = [scalars[5], scalars[3], scalars[2]];
+
+        let mut expected = ExtendedPoint::identity();
+        for (point, weight) in points.iter().zip(weights.iter()) {
+            expected += point * Fr::from_bytes(weight).unwrap();
+        }
+
+        let niels = [
+            points[0].to_niels(),
+            points[1].to_niels(),
+            points[2].to_niels(),
+        ];
+        assert_eq!(
+            extended_to_bytes(&multiscalar_mul_vartime(&niels, &weights)),
+            extended_to_bytes(&expected)
+        );
+        assert_eq!(
+            multiscalar_mul_vartime(&niels, &[[0u8; 32]; 3]),
+            ExtendedPoint::identity()
+        );
+    }
+
+    #[test]
+    fn fixed_base_tables_start_at_generator() {
+        let one = Fr::one().to_bytes();
+        assert_eq!(
+            extended_to_bytes(&fixed_base_multiply(&SPENDING_KEY_GENERATOR_TABLE, &one)),
+            extended_to_bytes(&SPENDING_KEY_GENERATOR.multiply_bits(&one))
+        );
+    }
+}
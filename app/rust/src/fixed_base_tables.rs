@@ -0,0 +1,1290 @@
+// Generated by scripts/gen_fixed_base_tables.py, do not edit.
+// Included from constants.rs, entry [w][j - 1] is j * 16^w * G.
+
+#[rustfmt::skip]
+pub static SPENDING_KEY_GENERATOR_TABLE: FixedBaseTable = [
+    [
+        affine([0xec75293d81248452, 0x39f5b03380af6020, 0xf831c2b19fec6026, 0x5b389522a9e81532], [0x14b62623a186b4b1, 0x2012d031f624fd52, 0x75defecff1f49ef2, 0x0cbc5f9f1e52e0ab]),
+        affine([0xee61a4378cea220e, 0xf16dbe9df7a1b347, 0x5efaec3699fd266a, 0x263a8160fc35f2a8], [0x21d72015ac2706b2, 0x4e2b4d7372156676, 0xecbc197161a2c618, 0x1b6dccc06df565cb]),
+        affine([0x1f940d105896e594, 0x7736da007ef85fb2, 0xc0688a417b198a13, 0x270b3b892fb39f73], [0xf03d6317f98b7608, 0x0c3ebaa90af8935b, 0xe4c204c45b94e529, 0x5433602904b63a81]),
+        affine([0xc91dc1aae738f9d3, 0x88c8fb9f6aa33712, 0x909283dee5479fb2, 0x3f6ec1b8b71f63ac], [0x155f9e7954c6650c, 0x0d7e3c6adc3a6c9c, 0x8722c71f635ffdbc, 0x609aba51d8cd09e0]),
+        affine([0x1d4053c502e04b0f, 0x65ec04dff3f1697f, 0x83d58802cd17da63, 0x356de4df41695560], [0x0c71fa97d8613a2f, 0x10d086073863f708, 0xc8ce1c4e78a4620e, 0x05e41bd99ef7e33f]),
+        affine([0x1eebf704378a8819, 0xb3140f9eca29121d, 0x607bbb56dcbb136b, 0x0e91cb4ed7bec540], [0x1680def2956b1750, 0x61eea8502d0a0607, 0x716f97a44b26c953, 0x0a7c294a94079ece]),
+        affine([0x664d1b799171157d, 0x0175483a61b29cf7, 0x2980aa900a5039e2, 0x365d4c9e70f3c254], [0xe382742648f853f9, 0x35eb616ebab792a9, 0xd949bdd5e4147276, 0x2e68c379acd2f556]),
+        affine([0x89db0c11313444bd, 0x2c0adb661dca3e07, 0xce984be97e538f0f, 0x0eb7ad2673e5875f], [0xa96425b3e0e6c4ef, 0xc4317a42b8c2c783, 0xab462ca462982cad, 0x247c80d978f4f46e]),
+    ],
+    [
+        affine([0x7baae27db7b1aee1, 0xe0945a06eb65aa7b, 0x62b14c87b9367fa1, 0x2c048771ffff59e0], [0xfb416b22fb57cc56, 0x4b6c91bde8db9da9, 0x75ac8fb1b1d81eb1, 0x05608ff474f49abb]),
+        affine([0x5b304835f7933582, 0x383ea3f57a03ef8f, 0xb579af2232f604e8, 0x28248568e8f3410e], [0xc3521a04ec88f2f8, 0x37cb627dfac4cc6a, 0x2da8ae86ce09b3c0, 0x35fe8b873c6086f3]),
+        affine([0x4dbfdf578015351b, 0x00b336f75a2cf05d, 0x65e36b80aaef2a7d, 0x3da5559f2a497f76], [0x59c3f5e9640ddd53, 0x8e12dc23d0596509, 0x185efbb382a6ac61, 0x423e73c071b0b293]),
+        affine([0x50a2b1f8f313e5f9, 0x511cd59f9df5fd6c, 0x0bfe35ecbf7fd6ae, 0x4f0474fc347e4785], [0xf52e7aebdf882099, 0x1d6758abfc3a8ec8, 0x0dc2fad76795a43e, 0x227da6d197145574]),
+        affine([0x2400932a567f6a15, 0xdbf1c3cb17e2b979, 0x2ffcc5770c44bc8b, 0x117847cf439deeec], [0xb73c98edc2338c30, 0x617a5e781843c579, 0x5bf43c406d7359dc, 0x110237f293a09b56]),
+        affine([0xdce5725b03687ffe, 0x948bf863cd4af856, 0x7b70ff2437f70740, 0x2f274f5051251f33], [0x68546ed838919097, 0xc3c78eeaaea2d102, 0xdf1b85f445555009, 0x11c3f35f5f790d54]),
+        affine([0xa3d9c9f3a84772a0, 0x1f76621177323537, 0xa1ead993026c1e6b, 0x4592ed900a4166ab], [0xaf064aa44b3ea995, 0xcfa4749c0e5c9d75, 0x75aa9296440f2158, 0x0f8432cd9dfcd78b]),
+        affine([0x5ec69f7fa4ef2199, 0x546a7184cf93a0cf, 0xe257f4ee858a2f1a, 0x05427aa9d65a7be3], [0xdf4677c3af2eb043, 0x42d193184df14268, 0xc4ade303e4c4d8b3, 0x25db8df6e953205c]),
+    ],
+    [
+        affine([0x7b7a5306f473fce8, 0x16069e94872ea2b8, 0xd48fd65242de264e, 0x471154941cf97fd6], [0x9acf73c5cabd6eab, 0x8d97c0da0018ade6, 0x77bfcf6d1e48d7c7, 0x5c3250d049824e33]),
+        affine([0xeedc18187386779d, 0x637513e15f6bc2d1, 0x76e4cb42cd771d59, 0x31c42bc50f89cfb7], [0xd1d364a5b33bc6d0, 0x2961e1ede53fdceb, 0x61b1b3e6bad566be, 0x12d05c1a4f0286fb]),
+        affine([0xa28e64da280a98a4, 0x4a197a113da6ea78, 0x19776ccae173116a, 0x0ac14a13bd433072], [0x2b6a36acaee4b0e2, 0xaddffbe586f87ce3, 0xb9f1ab290a77f048, 0x16c12da01f21254b]),
+        affine([0xcecb53ca2932198e, 0xbb90d671fcdba2f6, 0x033c0853b02bf026, 0x357143d5b6afaea7], [0xa53f3d4e83368004, 0x6ef82c31cc0b9298, 0x7378f4bae8563297, 0x35d63d026fe025ff]),
+        affine([0x973ff00505445631, 0x5cf252ef888ae936, 0x88fcf08ad87e448a, 0x06b18b6c2e2a2077], [0x5d1a4d221ad183d1, 0xaa58418ea2b6bbd5, 0x275a4af0c67ef72e, 0x4a9398d6a28651c2]),
+        affine([0x0ba5284831d60b1e, 0xeb95100d002f8a10, 0x1753be8921878637, 0x171107cce91095a4], [0x0cae9091f3334e1a, 0xe1b5dc7e3db54a28, 0x48a5caf9f6026ae4, 0x0f7c7fc6c11e4ba6]),
+        affine([0xad32097adea28468, 0x3dd005948dad20b4, 0x7ff604be63c2d31c, 0x3e7c874f0959649c], [0x3a4c662a3fd96204, 0xaffd73234668a717, 0x7a42edcc6693a657, 0x6c9b82c1686657d8]),
+        affine([0x8755603efdcb9de2, 0x61c0f9418c8ee356, 0x6dc1c3a09acf356a, 0x6338a6c5f525595f], [0x748eee79933bef37, 0x0d97e8d61d42c1e8, 0x563b92a051369394, 0x2fa2bffc35251298]),
+    ],
+    [
+        affine([0x4d781a4b6413d891, 0x9e42510a89e1b4e9, 0x46c96949a6e8a606, 0x54a7bd2ed6f29884], [0xa71a243a929f8426, 0xb039108fe44784d0, 0x3a40bddcdadb2b61, 0x38908ad534a2e71d]),
+        affine([0x35082d5826eddc0c, 0xec42864e721f3ebe, 0x40b8107e1ec4df0e, 0x0b8439021ab9315b], [0xcca4b5eba2fb2adb, 0x9e92948972b2f50c, 0xeb86be71fdafd379, 0x3b74b51053bcd5b0]),
+        affine([0x07a134a24a40355a, 0x7b8afd2842f9912e, 0xfcbd972f91cb989e, 0x261941f0246f97d1], [0x4af91a6f056bd11c, 0x2911fd801e28fd46, 0x89bc5ce7942da74b, 0x2b7a468f0a49ca54]),
+        affine([0xd319ab5ff658af71, 0xcb32f73f40e3aab1, 0xad888352ffc04baa, 0x28b22a140ccbd5e6], [0x58b42761161569ed, 0x99373d946c9ff4a3, 0x65d88008d475a87a, 0x56bab7ac4d54fd05]),
+        affine([0x194165cce366c903, 0xc59a59dbd9ec32ee, 0x8f92287ca2a8e552, 0x1be7611f7340c5d5], [0x7b5413f4227f4ebe, 0xad0a1c2d764fe68d, 0x447d210a9bcd47a2, 0x732ef172e0c1f3f1]),
+        affine([0xc0609e53ac6e7ab6, 0xc0639f36201b22dc, 0x1f7f619006787aac, 0x2e19f6ff7ce844ec], [0xc888ccd1b4c243e5, 0x7365ecd15b949ea0, 0xe57326ed249ecd89, 0x413490b1eced16c0]),
+        affine([0x34bdd13e3b9b9cf6, 0x73be0158f800f056, 0x8ac7ee95bc8df59c, 0x43da4cab27da8783], [0x709338857684d754, 0x8ded472c6646a8f0, 0xa3387757a964cc6b, 0x2a9c41064d58ccb2]),
+        affine([0xe9bda71dd32aea15, 0x96e49de6b667466d, 0x5e2fe12f0009b445, 0x200bf553e8aaaa7d], [0x842221fd22ec0161, 0xc2191fc71f8737f7, 0xabaa6fdbd954af7d, 0x1acdc5129d59ffef]),
+    ],
+    [
+        affine([0x343bfe799bd0e6c2, 0x332446f8ea366180, 0xdd03ad96cf3c4795, 0x65f9d6d8fdc6f1b4], [0xd40b5d2b127ab39c, 0xe2be12c37c3622f1, 0xb2517ea914bc1424, 0x1fc050f773144676]),
+        affine([0x24416936f79aa6b5, 0xd5269abb37c045ac, 0xa0112be4ac83b52c, 0x3b7d3ec3ceb8178b], [0x9e406ab0021d257e, 0xd2a7d9b54db9954c, 0x51d77ce7fcf8ff0a, 0x55fdbcb4795304f3]),
+        affine([0xe81d821b8e20227d, 0x4c13b945aea7868f, 0x09049d8cb573d33b, 0x48de89677b0f5dfb], [0x12f162423bee87fa, 0x412f4386be4459e4, 0x5bcb813ebfbfe9f6, 0x1da41040fe1fd2c5]),
+        affine([0xc7b6ea7c82d9e028, 0xc876f661fdfaf4d8, 0xdfbd74ac44907f91, 0x6f448cd27c1a582e], [0x01b3ce2aedbb71a6, 0xe16c0f4cf3839ba7, 0x12f54ae2c7261e1b, 0x4210a73ef8051147]),
+        affine([0x662d9dfac4dc18a4, 0xe10fbe25f6289bac, 0x2d07106adc65598a, 0x4e233430c65aa5c6], [0xdf02877690c6a75b, 0xab0df4a5cd17f8fa, 0x6b94d74af786de3d, 0x18b0dd33c7e92218]),
+        affine([0xb87b7123fb1a98bc, 0x917ba69a6ed571b6, 0x0f53f298d4bf25a3, 0x12ba01b3050a389f], [0x9296e6a88ccd1384, 0x5aed30abb276a3c3, 0xa9b55b4df1a1df92, 0x21c2bac212051b6a]),
+        affine([0x1dc5b8e944589b68, 0x75ab22c5253592e0, 0x7076beefdd7dbe49, 0x44b93ae6c90d1b8c], [0x1bde12ee3df5a2b6, 0x5e32fef5d3553f82, 0x370914fe3a4dde37, 0x68a8dd0cff81ba63]),
+        affine([0x843e414d3cb61aa6, 0xcc742ba1d4f07ece, 0xd66297d1d9ab6d94, 0x0aee95b3895787b1], [0xe496925a216378a8, 0x5ee0c64d027fd2cf, 0x25f8a4a94e051740, 0x357e9a10eb5156c6]),
+    ],
+    [
+        affine([0x0689eaddd87caf3b, 0x5465faa64688aca8, 0xc625c4dc2bb03fb3, 0x65ab1ccf77e3b52e], [0x6eec875a7d2e6830, 0xc9843d1028fedd6b, 0xae17e204f4d08af5, 0x5011f966a9048815]),
+        affine([0xe943fe3dd05c0885, 0x3e1ef50113c5a305, 0x098c7e0ac39414ae, 0x0d3bd4d5600fbd35], [0xb83bc869b59483eb, 0xff0201b5d1e4d1d3, 0x200933f81795fb19, 0x6d1de998a7ebdc20]),
+        affine([0x48caae53918062f2, 0x10663fd81375a0b4, 0xe42d6f9bc2094697, 0x5669633cd169b0fb], [0xf1d37c8f58f43f93, 0x8c1b20a8a1f7f8b0, 0xc5c006e23128509f, 0x1fe1d8bdaec8578c]),
+        affine([0x1f17b2ddecf86e03, 0xdecd62c737576582, 0xee6d8e78dcb675c4, 0x2498dd84f21b4521], [0xc1387a77a6b4fc9d, 0xc3545d9138ac9b93, 0x8b399d492ad30298, 0x1e51218e00ecc1d2]),
+        affine([0x9e5ad7067be56b4b, 0x1aef5e9168b49827, 0xfb422b3caca962c1, 0x51f89d0e5d14b950], [0x2be94a6fc81e879a, 0x151ded45aae762c9, 0xd17c4c32fc625124, 0x28ccd14e63786443]),
+        affine([0x15f60b15b2dc91d5, 0x7fb039865ac15712, 0x0d0d1a305c77fb3e, 0x41ec209e60fa8942], [0x27827b504a4b1b08, 0x67fde5d1c696b694, 0x2924ebfd84f4431e, 0x61f41cce2388b84e]),
+        affine([0x861f05f7932615e2, 0x5eae1b6797d2b3ca, 0xcece249530d091f6, 0x71393b3f0f96299c], [0x677f6f113d2c2662, 0x6eaa12698de4566e, 0x822ec2f5b84026ce, 0x0bbcf948dfa6ac0e]),
+        affine([0x02c5814fb28e62ea, 0xda35ed18c41f8aa0, 0x5ab0c4f8fc0100a3, 0x68444ca3172d3667], [0x1656d750c9c266e0, 0x4f9727b522d2d74e, 0xc88cb7742abbf31b, 0x1ef2d11eada1c3a0]),
+    ],
+    [
+        affine([0xa8a6c6575b8dc905, 0xba5bbb9ac03cb6c7, 0xc0bcc5aec6fb36bc, 0x18e285cbcf6d6692], [0xc1533e7b096c7246, 0x288385f631e127ce, 0xbdc36d8f99fc018c, 0x51623d61f4f92b5c]),
+        affine([0xbe7003afca7c2bbb, 0x26be22f0f31566b8, 0x92997bc650937aba, 0x037deeb92b2caa2b], [0x5fd278e3fe14b639, 0x905b0b3365a6699d, 0x4f2277948f340435, 0x0450621291230550]),
+        affine([0xac5ffc1eba0b24f0, 0x37208096e81c09be, 0x99dda4846fab8265, 0x4d13b3c11ee3e81a], [0x1cb67c0b9e1d479b, 0xf7c190cdd1511f72, 0x69e8941ef6eb13a2, 0x03da645554e3dec3]),
+        affine([0xbbee2d933cafb73e, 0x2b99f1d8a2c47523, 0xa7be9712a3088d70, 0x70904888faa7b508], [0x135377be51e82078, 0x14479005374bbc70, 0xfb30342f87152446, 0x6b5365b67639208b]),
+        affine([0x9d79de1889d0e5b3, 0x7bc092089bed8066, 0x9db70a7309343b3b, 0x1d3ea7943547d52e], [0xdb18b07ec0a32da2, 0x41bdbe84f609738b, 0xc801e24539b1fbdd, 0x69703baee6785062]),
+        affine([0x333caee0592868e1, 0x3599d667385015f0, 0x705c54bfd2cb281f, 0x0fdba6f97caaecf5], [0x42f9eb99edc1e7b0, 0x8bb90ba9acb6fbf7, 0xf2ca18d2f3132996, 0x47702de6d1614b43]),
+        affine([0xd47a1a95315eb379, 0x18835b765f8f7c1a, 0xe0945ee22fb9d551, 0x0ce58bd23595dbb8], [0xa93394000e260940, 0xc6f83a222e629de3, 0xa81338fb90862b73, 0x39331752c4cd755e]),
+        affine([0x3ca34835baf9bbeb, 0x1fc6afd41d21c42a, 0xebef8ab3f218ce8c, 0x2ffbd9a578f122d1], [0xd46446e9ba684fa4, 0xaa0eca3dfe0108f8, 0xaeb53b10e9a746d5, 0x6f78dbc8df872391]),
+    ],
+    [
+        affine([0x9b0d199f868f8519, 0x6ece4e8ab479e39c, 0xb1f80bbc8012e74e, 0x0be9cf1f9c609e16], [0xb77a286b643e8ca8, 0xbf6c9a804f7e0a18, 0xea6b9e1a9b3bfe9b, 0x21a81c3d2247f6a5]),
+        affine([0x2f78eea35ece2b32, 0x5d85340b7c0df532, 0x2dc88ff1151c5c24, 0x0cc9f23223e45480], [0x10173cf142711342, 0xd772295732fe9d74, 0x545d47102ddebee6, 0x590ab92ef2cfbf4c]),
+        affine([0x7c5eed5c93a26cc7, 0x4dc18285ba249fea, 0xc11f6b443b306560, 0x73478bc76e7fef95], [0x8ef03cc62542cdce, 0x72a7721a76d95005, 0x60d11b7a1ca55adf, 0x6505d8ffd074cbb5]),
+        affine([0xeb473f2ab01ced6f, 0xf1863e3a9b188cfd, 0x70e1ec0c36065149, 0x03c8d2c566d012af], [0x0799001f1162a7fb, 0xc7125150e6f38ffa, 0xae020aa4ced1ce13, 0x00892e0e3f7dfaa8]),
+        affine([0x53a4c3f17fe27014, 0xe9e99770c90ed3fd, 0xd7275f02e383de4a, 0x1ff5716086189d69], [0xb3eea1781139a0c1, 0xa87b0fddb65c3cd2, 0xf57ffe4dec470dae, 0x1fa43fb1d64869db]),
+        affine([0xa39ec2c1dcbbd8db, 0x8dcdc2e84364859b, 0x5191d86699b41665, 0x52dc658589b1e0c4], [0xeac568a87e6fdfc5, 0x373a1a1c874f194c, 0xda381d6896d59d5b, 0x4750cee063f2c473]),
+        affine([0xdab290f6c2004454, 0x36fb980dc82487ff, 0xf6302355a4990ed3, 0x0545f94e1af1624a], [0x43ddef4e64ea2d98, 0x588831c51164abd3, 0x5f4083c5fcfc649c, 0x020205ceb517a11f]),
+        affine([0xcad7fe6fb131291b, 0x5facfa062f53f772, 0xa1eadc82fcec9531, 0x579750f5eb368f22], [0x862873329a88f484, 0x70d18e2bb69011c1, 0xc64a5f82177116c1, 0x20055cab654367c8]),
+    ],
+    [
+        affine([0xd31b19bfec0096af, 0xa4ca76faf62551f3, 0xa45b552f337c3bb0, 0x6b0424b6c63db4c2], [0x9df8498b80a4fb7b, 0x8683909ac3189056, 0xc6cb4bb093b2d252, 0x571a4b4a23324a55]),
+        affine([0x9a4e0db445d6c451, 0x9b34c98bf0a744cb, 0x593c3ebe945cea2d, 0x4195af93901eb46a], [0xa4d745db7f9916cd, 0x1a3395d275521932, 0x953ebee1264ce246, 0x20aac85f5afeacc9]),
+        affine([0x5c5d344c50b55893, 0x9883eb78d981d937, 0x06998b16cf58a6a1, 0x19c6dad9ed1b82d0], [0xf45368affac86522, 0xce39b2fd44055b3c, 0xe9e662dbf8b6ddaf, 0x1870557c29fd0084]),
+        affine([0x8bb112711bb5cef7, 0xd832442cf9da26ae, 0x11d5d020e21aa013, 0x06123074a41eb00a], [0x817b6e54f948b88b, 0xabe7a96ad60c65ca, 0x88a4459cb224e61d, 0x2d26748c9d25ff3e]),
+        affine([0x78dbbae0dc1b6b31, 0x6eb0c5b415a5711c, 0xf7ae7d3357a220f5, 0x5656b27786f8a6d1], [0xfa1e2fced8ae9bdc, 0x8c16bd33f0543a8b, 0x77ff4a14a4c1e4ae, 0x395f92468ca77d50]),
+        affine([0xa7b7f27c84a126c0, 0x250ed18afefe8b28, 0x7fe35537c5f06e66, 0x604069d2effd4bc8], [0xb84635ec66e19388, 0xba755fac55da0104, 0x4dea00999890f3d7, 0x63d80f63b96522d2]),
+        affine([0x8b6a3e9c704a7757, 0x80c41d1f41101b01, 0x1a0eb269f035158e, 0x360be454abb2ede3], [0x2037e57614566108, 0xbdf2201195d6f035, 0xed89da12d60c348d, 0x22e95f66651683a1]),
+        affine([0x03f61ac6de91cf86, 0x885a193caaa99475, 0xa0d05d781e8c0569, 0x64bc2420081bddf4], [0x4b4f214c47696b50, 0x639e88541dbc9543, 0x67e39a732221fbe8, 0x19eceb4f96da6319]),
+    ],
+    [
+        affine([0x86dfe4cedc50aa76, 0xc6b0e52572f06869, 0x6d3cb42e29274e8d, 0x5eab8fa75476a547], [0xd21fc48a8fe3b554, 0x8d5537d6444bc47a, 0x270adb3ad03b8aa9, 0x5f117f1ddf32f885]),
+        affine([0xeeb91af4ef09305f, 0xa809ce98fa0c1b4e, 0xf9258f8d2eb1289d, 0x0be2bea34eddad56], [0x392441cc9274f7a9, 0xb673f15d6351c310, 0x0c24982c28cfb419, 0x1841fe3eabf5e306]),
+        affine([0x19a69191ad1711bd, 0xd8a091cfb688416c, 0x78c3118e55780004, 0x10788b873d95b2d7], [0xa882ac8b8f92b6ba, 0x5b8797aa15e3fc74, 0xf40ae8609a7bd2a4, 0x0598770026304296]),
+        affine([0xfd3fdae1c72f3247, 0x38b4bbd14a8be930, 0x5f00c0618c738fbf, 0x05e7b3440a381073], [0x65a7fad1017c8f02, 0x7affd3b59c540241, 0x0c2eb6e6d2c0bd42, 0x569a5b667f3506f0]),
+        affine([0xb20073d092b3ae27, 0x12036ce9ab09e71b, 0x4b7cfbbad87da87d, 0x416d5991e23d1dfd], [0x9c457ad64af380e1, 0x21e82dc2eac110d2, 0xc4024ef37a6ba673, 0x3cc1b41d53e82aa0]),
+        affine([0x7a6d843d1d69369d, 0x9bbb6671b48e8735, 0x78365575ebcd81fb, 0x289602f6a53227fd], [0xf4f2176d30209729, 0xf009ab06ebb9fce2, 0x60d5ca5bf908296b, 0x3c12899bff5dec5e]),
+        affine([0x88d863bebd68d328, 0x62384c12da33d291, 0x6467c8e5e68728ae, 0x4dbc22af13e1ab5f], [0x0d5fdc8a465ba129, 0x5289c73d769b3128, 0xe90bec06ae9b81a9, 0x470f7be0335a888f]),
+        affine([0x3b843cf8bb98ebcd, 0x9196ff789da43feb, 0xe03a14d6844b8e2c, 0x467266e6e423847c], [0x634628968012a2e6, 0x3c4921edee29b0ea, 0xad550013770a2504, 0x378d302384ba6016]),
+    ],
+    [
+        affine([0x07d875a296526de6, 0x3899a83e5f915f5e, 0xf358305b7078b369, 0x422d2f7f23b90c46], [0xf24afaa6ce9bba05, 0xe2101c72697011bf, 0xc8329bb90ef60038, 0x4362e3096ac16f48]),
+        affine([0xc693cbace069d6db, 0xe35c8611379cd237, 0xeb09159d654142ac, 0x3cb4151379ebe1a7], [0x9398c0a0d27b65a9, 0x450b6bdf1117c57e, 0x2f0ae37f0a32803e, 0x3012825304832638]),
+        affine([0x7f2a8aa6b3266b99, 0x6fe11a904a1c6d66, 0x4517bd75048cf8bf, 0x3daf47e7271dff13], [0x7b94d9ccdbe7711b, 0xf709a9f76e07b009, 0x013e323c894d0a0a, 0x2aaa983fec107bff]),
+        affine([0xac93ba2354937274, 0xbd7c113c7e4d7c3c, 0x1598466df1597d5a, 0x5347fd7ac180dc23], [0x7c256496443368e6, 0xb5d3c61762b83d46, 0xe5ea25a6d79c5ce7, 0x24416872e2327672]),
+        affine([0x2a602bc44be1058e, 0x466b66794f5ee293, 0x6520d5c32cbd1e87, 0x360501e74e3364af], [0x38ea1f82f9554035, 0x89b3e0f441af2e86, 0x7c7f12268d02f661, 0x310481e7bfb50a00]),
+        affine([0xa4522a9e0a055d88, 0x0ecc745097d1b648, 0x81b83a67640c4f09, 0x08aa2066ac95ce37], [0xa1a2322a7eafc079, 0x1a373d27cbf2efca, 0xbb2e0cf26f8570ac, 0x610f35f948121603]),
+        affine([0x6fc435ebf679d638, 0xc851460dcc748ff7, 0xfe4ea003870aa06a, 0x337ba4684120e752], [0x2508a8f4077147b3, 0x18559254d2e20cdb, 0xc71ff11b114d43eb, 0x5d5f32ea5eabb097]),
+        affine([0xcd918d9233547257, 0xe9291cfac8998227, 0xbf989741f3f2547f, 0x52cd12a99492daf9], [0x73d8587dfd249f78, 0x5c1b376e2333ffb2, 0x0f1b1d15d380ba04, 0x640d85a3afa42b2d]),
+    ],
+    [
+        affine([0xfa19650a195b8a5d, 0x56ddb925e34fe9b5, 0xee8a4acca315aa18, 0x28ec001123787bff], [0xf628728b692953ea, 0x148943daae672eb9, 0xe29ea7bdf8f1c98e, 0x0734fcc37e21b98f]),
+        affine([0x2ccd793995063e5d, 0xfbfda4d7c9ddbcf7, 0x5ccf75f2e0875d7e, 0x1dcaeb562772a020], [0x4bbe58dce2bb32b1, 0xc2b87754caa81f11, 0xea89ee3898a87078, 0x5ff6da9bfb7b8b69]),
+        affine([0x97745e4fe5d80929, 0x4797bcb1ecdd9766, 0x8a05f19378639f66, 0x0ddf1d9d4536a5a8], [0xe5813ae9588443c1, 0xdbc323bab2f7355f, 0x73d3724dc34f0240, 0x54ab4a246477c3c4]),
+        affine([0x855f5b1240c132ca, 0xc0f119812066f814, 0xb7c4c84123b82189, 0x4f7168c97ddc76d7], [0x3857cba8131faa5b, 0xbd465d8fde0320e8, 0xdd0b97aec52f2c4b, 0x1e43b36e1f714741]),
+        affine([0xe59c5d8168c98600, 0x19a2021f40fe21f2, 0x087b6f63c4f9c41f, 0x6ce8b20ef198efb4], [0x8e7fea5642dd6b95, 0xe6d8967b374ccd21, 0xb5851ad00526ac53, 0x2fb1b8b484ced237]),
+        affine([0x826c6e2b529d20cc, 0xb3102156e213d23f, 0x9784d0661dd3f19b, 0x57ba0c87051debc2], [0x22177bbeeb27b943, 0x16a8b55921a767f7, 0x47466d26f54c0ff8, 0x3f836863a29c9d5d]),
+        affine([0x10786b6bd84cd711, 0x966f162812ba3539, 0x5eac3671892e777e, 0x6c266c7f5e65ce35], [0xe914c57daa016478, 0xcadf6247c479449e, 0x7befcb6fc7737c60, 0x6c10385b2fbb2bf4]),
+        affine([0x74a86794e3a68145, 0x198c4e8757992ab0, 0x246966f17efaaac6, 0x3d51b7d7cfb85537], [0xf509b71914d5538a, 0x94f3ce6f0a8934f8, 0x467c62d06d300e5c, 0x113f8e2bba86cdf7]),
+    ],
+    [
+        affine([0xa2ede6cec0403a54, 0xc91aaea1892dedb6, 0x1bf35738747b7a51, 0x244eda8741e84f66], [0x5b4ab588385f4752, 0xa4c41c05faae2157, 0x2033ede8d416e10d, 0x07265bab553b300e]),
+        affine([0xe2a70206c5cebf55, 0x389f7a043992f3e3, 0xc154cc92872b0427, 0x0afed6d9be847cd4], [0xfec46adb73f88f9b, 0xec2fe81cade0ccce, 0x08e02f698f5a6db8, 0x4530cee33fcafe98]),
+        affine([0x384778cb551324ff, 0x6b3434ce0cc0cc34, 0x3809536fc8445c1e, 0x25b6b58938a9023e], [0x3507d76278377d60, 0xf610b77d57f886ae, 0x9fc5a4b6c21f9197, 0x3ee0af08ab1abed3]),
+        affine([0x5d40778e6d049707, 0xe73f33a0fdbca47b, 0xc8c8a51c4dbf5986, 0x3525a97eb0fcff6c], [0x8c0060523fce2768, 0x75cdd77d41280e75, 0x0467afe700a4117c, 0x0195173498e099fb]),
+        affine([0x0d1a87e293c67140, 0xab9c55c4d2746775, 0x8a60b78a8f3cc5d3, 0x154005d8e5daabf8], [0xd81b29ddd6af3b00, 0x5bc4f041b8073637, 0xc0c06047681a8d7e, 0x2f2b66f5d7200c1e]),
+        affine([0x1918a8873d2b2905, 0xd1148d9895a76ce3, 0x9b76df48b9db703f, 0x6367ef05dc004cce], [0xedf3e570708c0450, 0x1f07e9671f060119, 0x30fc73456f0ec373, 0x52892232dfcabc5f]),
+        affine([0x7ae072752334e696, 0x64ef3ec10c5e0bb7, 0xfb7b687ea507736e, 0x6d59ed5c4f0907a3], [0x825816fe3bfe3ce7, 0x86a7bb48c066fa50, 0x045978fb3da95a0b, 0x6f3a3aa665d51eb4]),
+        affine([0x43fa891f362ca99f, 0xd1648a77aa88caf5, 0x827a40da9626a5ef, 0x7341a3135956ee43], [0x99cbaf1b5ad5a71b, 0xbc62aa996624d1bd, 0xe253b8b7ce381772, 0x5ee37ab78acf7b09]),
+    ],
+    [
+        affine([0x912efd73dccf1703, 0x3e08bfa1bd747d28, 0xf536c50651905fff, 0x323011ce6c0e9b96], [0xcfe4a2261eaa8d1c, 0x5e4edb126b5792fa, 0x825a701f0fedd82a, 0x5f6ee7b8dd8ecc15]),
+        affine([0xd14ce4e1c4d0b666, 0xb27a95c2151cd009, 0x525f31bed5188019, 0x51065e5c72d121d2], [0x499a044732b99006, 0x8b578648565ba9d9, 0xbad1bbdbc97ed4c4, 0x58347b76a31af309]),
+        affine([0xec99a8313c36c650, 0x2c19060dddaa9cfd, 0x8e86611ae97b5840, 0x0c89c4a4f58c7eb0], [0x749ae764fd4ae4b9, 0x69099c16e2d21ae8, 0x799be998292d57ee, 0x49c2f13393e282b9]),
+        affine([0xc659ecb08862008f, 0x3ce767d6659dae26, 0x97c40b50e9328c6c, 0x42c30519757162b6], [0x41fdbd71bf17cb60, 0x7e7dface9e425e21, 0x37f5baa0aba70cdb, 0x1592468816a616ef]),
+        affine([0xd482736eaa84c807, 0x494dccb217756cf8, 0xa9a9b3aeb54e8e2e, 0x44bedde0dc60389a], [0x6c336ea0bf9cc039, 0x35b83690bf7dc80d, 0x31fdab9da7565d9f, 0x00ae0693b7b57901]),
+        affine([0xfb562c9bba053b77, 0x3fdbacf2bfafa411, 0x46ff663edfc9e6cd, 0x2acd8cfc2f220389], [0x265a477a453e52ba, 0x95c9726ad28ce8e4, 0x77895f45ec67b6ee, 0x1e00b3c18f1e3249]),
+        affine([0x96c6dc226cf87aac, 0xa2567bfe3bba295c, 0x90b39d536b1ad910, 0x06241d3cfe4f2ab4], [0xdfb9eefe839888bf, 0x762e788fdd1efa04, 0xb94ea7ac1ee07bb6, 0x1ae8d0343bb60795]),
+        affine([0x1e0a8fe964a0a776, 0x52067a4f3a4fef54, 0xb8732ab2f103eb25, 0x10999595f2e513ce], [0xd5426cb5ea144a4f, 0x7b255c79908aa85f, 0x19aa25ad414ab546, 0x5eae912cb0540c3e]),
+    ],
+    [
+        affine([0xf78869ce95ea0c54, 0x85b16d89e720e3c6, 0x42708e6313de1555, 0x085e148b6f9dda67], [0xc5f7abe845927f56, 0x52f47825697179bf, 0xa5ff5a57f9e8de00, 0x2a2e830d5303b18a]),
+        affine([0x8107223ea46af98f, 0xacbf004169cf54c7, 0xd3529dbda28e79c1, 0x18840071ea86ae64], [0xde3cb1a01db63e8d, 0xc3174b2dafb2400d, 0xbce1d7bdca31c3b0, 0x600b6c6682e5940b]),
+        affine([0xaeb1be7a125cd35e, 0xdd5b1d49b1411336, 0x28ed9f7ab5727c3c, 0x15b3619b109f6fa7], [0x85282d8adb8a66f5, 0x1a759db048625968, 0x7e2db15cc1895634, 0x52b8e0063b49b76d]),
+        affine([0x3c2577ae5d097038, 0x3ec1f724b1fb8070, 0x682f74fe5ea6f2d3, 0x0029671616624329], [0x93ae13b4c9cc3314, 0xbcf16b50847c02f4, 0x571f7d80bc452c1b, 0x218784c5210f5378]),
+        affine([0x842bde60f459cc77, 0x8287723a48c5ae72, 0xff4938f1aa289987, 0x3ee816a6a1150d31], [0x9232b7d862ceb9fb, 0x046f6b6894a3c2e8, 0x25f6b476f4ef8387, 0x1d3839622bdd70a1]),
+        affine([0x791eab7d4505b2cd, 0xd0f9a1a50988e347, 0x55665672cf21bd3e, 0x450c775115d6d848], [0xcc0c184e949966a7, 0xc54d5917069afc62, 0xceb3db8dddadd0a7, 0x6851780200b52a56]),
+        affine([0xad4eda77aaaeffc5, 0xd83ab2e7b0acf5cb, 0x2b39501d097f3152, 0x6faa256c043bf4ba], [0xd828ac842305c443, 0x63a531050b35334b, 0xe576233542201396, 0x10f8623cf16d9857]),
+        affine([0xab16ca24924ae1bd, 0x039ed517634db4ed, 0x7f3d6309f7365475, 0x7285a2ad40a54f46], [0x19402b9cdc7ffea2, 0x1b2056df2fc0ace4, 0xcf0f903f0ca2650f, 0x020245f4b20fb695]),
+    ],
+    [
+        affine([0xac29260a4adf99f2, 0x15fa950e01ad110f, 0xcbb88f8b7f7713f4, 0x06059e281bfc5d26], [0x34fe43ebe630a698, 0x77dbe7b9730865d4, 0x30a470300a4da8ae, 0x26955cd491617d49]),
+        affine([0x751e3568c777051d, 0xf48595fb60ffc26f, 0x92ed9837c7c05805, 0x06ec40b6fb52e3b1], [0xeb5d0f05939ec09c, 0xc6e9df0bd8a23588, 0x8d6651e0134c47dc, 0x32844416606f70a8]),
+        affine([0x213e9f0596676d90, 0xb84416ddd4799a65, 0x1bbc10f3fa3c3754, 0x57913931c13049c0], [0xfe52f2d5db15413d, 0xef7368ed01792a72, 0xf7761bb27d1be5c2, 0x54ff5924e0effabe]),
+        affine([0xe4c1953413acf54d, 0xc05797c73c39aca6, 0x3c662aaf8cb47878, 0x4f3e832a6ea58a20], [0x01fbf32c9e1c3ba2, 0xaaedb822e80d291d, 0xd94acb1007d46171, 0x06c80dd998fc5566]),
+        affine([0x4c255014d6d638be, 0xb5cc512fcad6edd5, 0x459caef9eb94ffdc, 0x6d56ce7e4e4916c5], [0xa2af5bdf48597d66, 0x141773c5b41aff06, 0x26d1bf09cd090dfc, 0x404b137fbcff2fde]),
+        affine([0x31a7ccfeb6e91727, 0x2aef16396ede7877, 0xf69a94edfa2bcc33, 0x4ed97ccc657ac04d], [0x07122173d32b4cdc, 0x63846117c0309150, 0x3ed83b853dd2b3c1, 0x30d495f3ffe893a2]),
+        affine([0x966e18951974f012, 0xf2fdff523cba1fc0, 0x247f3119fd16466c, 0x268726212e812da3], [0x5639b0a6fe43bc2c, 0xad3ac52279a4541f, 0x34cc631636069903, 0x64a2883e18ac2ed0]),
+        affine([0x427bb3ba9b45ba7e, 0xc59a34d69090da05, 0xe6bda245e41fd3df, 0x68270cddd0cdb1cb], [0xd39b9835bfb3a393, 0x513a9c890bc1f4cf, 0x8b8fac6534fa78b8, 0x4f73f59d783d148b]),
+    ],
+    [
+        affine([0x1893981be50d09d5, 0x55c303270991e4a6, 0x1283c8c4176260cf, 0x514e2605762b9588], [0x662286b58a59c1b8, 0xd4bcb562c74a044b, 0xa1d0a7f9e3c7eb6d, 0x2bb32e3b4bbc7c48]),
+        affine([0xe789d3306aa902a4, 0x9f037751d0790bcc, 0x4c006a84a59e5ec8, 0x32344021271fef37], [0xc30549e10f750ed5, 0xea23ccfee61d7616, 0x26d0165200d033a4, 0x6adbf6728ee972f0]),
+        affine([0xa7385f44f4da5da7, 0xc714c710905a13f2, 0x6436fea080f6a7b1, 0x1ee64273f1a10aad], [0x3fd5caa8c483a1b6, 0x8df693a87f296ad3, 0x6abf064732700863, 0x48344ea159b3df32]),
+        affine([0xc72b03c2cd1bb783, 0x11a9a64d5810507a, 0x31ec1e18f23718e8, 0x420809151d51fde2], [0x732253f150fdc5e7, 0xd52aba6f1cb874af, 0x6a0e3e7c16216e2d, 0x552f8d6153591abf]),
+        affine([0x2cdd6ca0e077af37, 0x9cfc03251a570204, 0xcafc200061a6e7fd, 0x506cf904c62bd081], [0xc0a0716147a37f77, 0xc76a20a35e6ad226, 0x3d7f1d6987db780e, 0x15c94546bbf63d6d]),
+        affine([0x5ff42e644ebea615, 0x556b713723200060, 0x76d49bb220aaa681, 0x6eddb2abd0ff80c1], [0x5db644c263c3388a, 0x0dbe8a6ddfbe0af4, 0x1e5dbf74967f7f20, 0x36803ce1726b48e2]),
+        affine([0xa0165f313d08ccd1, 0x70fd9538920a2742, 0x9accb2b846c39c9c, 0x243e81d93ccbbd62], [0xff40d9f71abf0490, 0x7c5293cfa86c4124, 0x5c638387ae2dbb5f, 0x11dfddf736ec07da]),
+        affine([0x93b42ef22c5a50f0, 0xfcc063ca91b81802, 0x4f326238c25b7ad4, 0x6dbaa1614aa71c47], [0x38751a58b29bc6bc, 0x26c39e840bc3b095, 0xddc6f2c0e0de8883, 0x23295c74709c9152]),
+    ],
+    [
+        affine([0xbb5f26048d18f2cc, 0xc822cee44c82e737, 0x02245136b7f12ab4, 0x686504580be134dd], [0xeef4470ddc53025a, 0x104eebcd23733aae, 0x334332039064fee3, 0x0ad2db39f60bdb1f]),
+        affine([0xb509bcc03704c7c4, 0xdc5b9efda5c446bf, 0x4f658c8bd90c9fd3, 0x35303f23f3191574], [0xf22939f11612883e, 0x8ee3b44beeb101ef, 0xea3391292524a5cc, 0x182f75f1015093e8]),
+        affine([0xacab8f944dd212ef, 0x4c71b4c4d7c8a8b1, 0x261154c2b9d9e1f1, 0x42944d6fa04ea5e4], [0x9c10970d9384486a, 0xe380695d61cea581, 0x520929f1e67b644d, 0x4f18ea3f29b20307]),
+        affine([0xb999a63f3f00a0c4, 0x4cf454c86ebd216f, 0xfbf270aad76b1579, 0x4d7f62a9c3396c95], [0xbfebd786a4c673df, 0xbf64eee0b44231ed, 0xb32fd7c39def4c82, 0x596e86a74ecc5eb2]),
+        affine([0x236defdee67755b5, 0x4b38a48b2690003a, 0x274cc1bd89d40a77, 0x3bc7a9b67b167daf], [0x4f14408b104b608f, 0x3451f9634fe66d18, 0xec39b08a8018b68f, 0x544fe17f2a61b618]),
+        affine([0x8636db95f51bdc4b, 0x3f2ab26d95d9183b, 0x20a0769c7ad409de, 0x36204c537a8fc2ea], [0x72f4cd9c112f29a3, 0x19f9632a96e28e89, 0xdffc309802d598d5, 0x57e4261efb278097]),
+        affine([0x727ca9d34a9e5ff1, 0x9d03fbd4dac882da, 0x50beb789e9ca1579, 0x1b58c5320c42da6e], [0x0c58c56385214dea, 0x63269f27c7213296, 0x730429116f9dd43b, 0x2d61a8125a0e2969]),
+        affine([0x43d4ff695ef8decd, 0xa47ccfe517105c1f, 0xfa9b01c0b5e0e662, 0x541dfb94c7e643df], [0x98eabcceebe36cc1, 0xbecb2547bc8ca2a2, 0x0af6fd60926b4142, 0x3ab75e4806e7dbb5]),
+    ],
+    [
+        affine([0xab0ec99aa971fc46, 0xd3c146a11ba03dec, 0x49394282430cb433, 0x2f63d9684a942bbf], [0x86903c51c8a45c63, 0x57d1e5d14fd00ab6, 0xe7089b3d99eebd9a, 0x3013ecd583e77255]),
+        affine([0x2e3545655e9b0f88, 0xf8b263ece7bc266a, 0xf5fb2ccb28d99c56, 0x35067231e5f00397], [0x31001794334e73c8, 0x6e7ef6c95a5f9d62, 0x026ea169fb1ad10f, 0x2e4c4eab15362caa]),
+        affine([0xb1135306362dbea0, 0x53010a8c0ffb9226, 0x17152b22c6e3fa6b, 0x7285f281cc8f18f2], [0x33dd52a5e9eef64a, 0x73408efb464a4b1a, 0x0a37d8e38db74d5d, 0x15eace400d795449]),
+        affine([0x1a143d1dd19d36c6, 0xdf4290eda65514f1, 0x765588b550d3a405, 0x15c876315406acd0], [0x48ac874814ce894a, 0x8c744a42b7591f31, 0xdffaeadd06a20f07, 0x1a044c35cee6054d]),
+        affine([0xd46b7bfbfe34648f, 0xfcdaebc52adfd0ed, 0x9d55c13a15719a7a, 0x11a40cbfc9d56a5e], [0x3b4e41001a03d0e0, 0x00a79cc9e68752d7, 0x5df8523126c68161, 0x28731508cca25d33]),
+        affine([0xef17a3c132d82120, 0x55ad6135726b257d, 0xc5fd155d18377443, 0x3c8ee3a54ddc36b9], [0xb18722469c938e67, 0xa55a5dbb0ec6a248, 0x2356d72bad674449, 0x546cb4ec384b6371]),
+        affine([0x834411e468de9f8f, 0x36f4b1104134d8c8, 0xe0e23faa9fe39922, 0x1f79e23025bc206b], [0xf90e4b5109b7be2a, 0x799af90cf9012104, 0x0fde08cdd4e777d4, 0x08d54b1ad9a6641e]),
+        affine([0x42948b129176710c, 0x7e55ce6a30059dad, 0x2e27f0e2b74900bc, 0x0eb04baaf3a5a3f3], [0xca971318ae9ba257, 0x6be5544dd282b1a2, 0xdfebc8e4db641f3e, 0x06ae61c263e3c8af]),
+    ],
+    [
+        affine([0x03b81197c8b1f69a, 0x44b6d6803c67235b, 0x1b7e8fef7ce5f65b, 0x72152975955a0014], [0x9f17b7dc748b0813, 0x94450fe9fe38c4a9, 0xf0dc2e2c7771eb1b, 0x2d9af8e2e757f168]),
+        affine([0x296b6bcae2115c48, 0x37d82ecdf886998f, 0x7c43335f8d5867ad, 0x01059145f07c5393], [0x5072a93f010c3d57, 0x023c60161ab5d59c, 0xad6cd22dfc4aa2f4, 0x4e002cb9c2ea5fab]),
+        affine([0x0e77cc85c5637f7a, 0x34b1d85ce571e2ac, 0x69e191738f621466, 0x38a854afae96912f], [0x6c4587b97cf14431, 0xe42de048d995fc39, 0x29268e8db9361c15, 0x065e9d8d678cb6ab]),
+        affine([0x3a62a922b77866b0, 0xfff4563e88e7e902, 0x95f3ef755cb3f576, 0x65767f5f0a3f7ec7], [0x4b42f0c9a62f9327, 0x45ff1f001bb24459, 0x6301dd34d2c6ee11, 0x379b1bc171645732]),
+        affine([0xe7a7cbdc63e91572, 0x7652eb02cfa84f57, 0x8ea33f5cdc0dba43, 0x2a9fc6ed023da6ec], [0x185c86bd01bd1e29, 0xe5e9565d2b49793a, 0xfed92e52852212eb, 0x14e59cd584217af8]),
+        affine([0x3c41bfef282c3d8e, 0xb698915fe81a8207, 0x39180f9dd00fabff, 0x07a213f144665c40], [0x74f176dc69753fe4, 0x6cf5769e65f3c8ae, 0xabe6059fa44adefb, 0x03dffe9614acfb7c]),
+        affine([0x6fb93937cbf4995a, 0x2faa695f2790f16b, 0xed6be0661b28d632, 0x350e715ecd6a05df], [0xd72d3e5df9ac5505, 0xbfcc19e95ea97d03, 0x9633c1c834cffe47, 0x5c7f8fbcee7b1d8d]),
+        affine([0x97153bd59b140b37, 0x09f349f0648ab882, 0x6862e59ffc21c193, 0x00a64e7448dc2dc6], [0x349504423cb602d9, 0xf3a9a41ba5b13b5c, 0xff4a2cd770e9fdcc, 0x44b1f5b07fd3a338]),
+    ],
+    [
+        affine([0xeaa6a9186989d692, 0x63cb692bd03049d6, 0x450de27977a7ff3e, 0x1cce6a61c21aeda2], [0x0c0752e8ad57c9ca, 0x8e7b82205f186a23, 0x15ebb1f4cc4dc87c, 0x6123a64d7cc8a346]),
+        affine([0xa50d1bc2285423a9, 0x2b31349ac46c85cd, 0xefcb9c588ac6d4e6, 0x6fd1a63276160074], [0xca977b5f692bbd0c, 0xcc00579ecbb906e0, 0x5f2b977a3a42221b, 0x533e980511ae2fcb]),
+        affine([0x49b9ad588ec18b79, 0xc6426b4622c3b044, 0x4704d17b94e115b3, 0x3e217bb0105b5f3a], [0xc7171d467f8bd7c6, 0x81143afc6a16856f, 0xff7780ab71cb9cab, 0x5f9e4fdc4ecf42fb]),
+        affine([0x9fd2429f5209b946, 0x7577e2bcb09d1766, 0xa881908399d66b4d, 0x2419837647595587], [0x384b35dcf5b19817, 0xe654fe3789e49550, 0xdf5bc5d1b2b337cc, 0x5f58f9544ef854c6]),
+        affine([0xeea1899a09ab22a7, 0x2c7e4f60ffd0086d, 0xd4a206ad06a6f839, 0x4582364be2da67a5], [0x3139394afd3fddcc, 0x0ed534fa5dc24d25, 0xb88efb44296b7643, 0x6c378ea2387b32a5]),
+        affine([0x42635d3fac209683, 0xf47dc222c50ac379, 0xf077aa58a63046be, 0x3c2d98478157d6dd], [0x167d870c25f14045, 0xfe468dcfb33c5885, 0xc09a58bfa1aef496, 0x031775d8242650b5]),
+        affine([0xb9a5ec738bb6e020, 0x6b91fd0f5575eb6a, 0x030c525229ad8972, 0x1de3edfe265316c9], [0xc8c7f3dc270b8734, 0x0663fc5f93df7fcb, 0xfe0800488fa020a3, 0x278b2a0c45cc3db8]),
+        affine([0xa2fdda04aaa8fcd8, 0x1918697272bdd4a7, 0x326d085a37733928, 0x2fe010a6cbd6446c], [0x2c277d6b63e904b4, 0xbd51258f8ba3ef96, 0x87b3e39f16412736, 0x695a5a170c2036c4]),
+    ],
+    [
+        affine([0x915bbd8f9c6dd052, 0x76b7c67c5d87f582, 0x3b53458dd56d1774, 0x02267de435517089], [0x52f99f2b5564b386, 0x86d670b80b3b123d, 0x469a9b4f2cf31e30, 0x1f7dd8a2defa3226]),
+        affine([0xdb13b044183f33d7, 0x512085986b06f3bf, 0x2ec3f1c8ad1bde83, 0x040a22e657273c83], [0xbbf4c2c911c1ff8f, 0xd0d6c6ac770438a3, 0xa8a7480a4e40493d, 0x092b34a2ea3a1d48]),
+        affine([0x92eb781140ebac3c, 0x0eabad0ef19e3ba6, 0x593896382bee82a5, 0x6bc00fb595c8250d], [0x5dae154b87575320, 0x0168fef8ca12a213, 0x8417bfbc68d492bf, 0x0d6309deb6e8f8b9]),
+        affine([0x0decda963122d544, 0x003cf1bd6fa0f1a2, 0xb8c2bec23bc356b9, 0x0a7f25c55c850477], [0x9cc8553305d58c36, 0xda356eafeaea4eb9, 0x3060aaad48f1a0b6, 0x2d14d185265b167d]),
+        affine([0xbaac6253b02d6470, 0x128324837cf64c01, 0x5d1090989b1a90ec, 0x35777d400d539dec], [0xf8ebb4a77aea5cef, 0xc258f7e7c38fa01e, 0xf4d0bdcbb751e4a7, 0x56a13d0d82a790f2]),
+        affine([0xe1bf8c9bfd001729, 0xa2fc9348923220e8, 0xb6932515a2482eae, 0x49333addec9e0bd1], [0xfe9fadc614fe7bc6, 0xff420f064fdfd339, 0x5b69d0b4f9659369, 0x0aa5e2e7acd41a44]),
+        affine([0x77377dc84f42efb0, 0x58f02e5924597c02, 0xfcdff2ed7a92f5bd, 0x2b67f0cbda5acd9d], [0x6ca060bbcb024ca3, 0xb86fbf4bfb4f22cd, 0x27913d3450139572, 0x2a5c20cf6d2f2c72]),
+        affine([0xa074c72b17fe3e19, 0xfb1578df2dc02ef2, 0xa960aed8e6ee980c, 0x1f17d2c77f40248f], [0x0ff5fbe9ecc7b9f8, 0x5bb66b540a6454da, 0x21a975d8eb879fb7, 0x21e18040caef178a]),
+    ],
+    [
+        affine([0x0b08871a0aa0b423, 0x985ad9e81cfa2178, 0x88808ecd2f54b4ac, 0x4972ec927d2a3913], [0x16b4ceb41ae772d0, 0x1659d6a695102967, 0x27c299ce200e322c, 0x215d213266bac12c]),
+        affine([0x88d0a8032d2a1c37, 0x36ebc546b9b5bd0e, 0xbebd130716bd3faf, 0x6ca198acc0a2dca0], [0xb047e7ae879e6786, 0xbe8c03aac2a31884, 0xb31ed98d32ad6fd9, 0x3750812fae665f3f]),
+        affine([0xd1c9412b3c1fdc37, 0xe23ec36789b8a1f2, 0x6be02d3ccd14948b, 0x6fda58a141e8c8e5], [0x7b670c4a4fc055de, 0xa69551064a29cda4, 0x389418d86d446e61, 0x319d6a177f8cdaed]),
+        affine([0xc4b164652a1cd923, 0x06c69414d4422d31, 0x3eb03be34255a007, 0x2ce0adb8da499168], [0x7a06ec5bf3906b38, 0xcbcd9c0859a3f435, 0x32f4797be43cf11b, 0x1d0078c02d0685bd]),
+        affine([0x9f41073f91493174, 0x785350e84fbccb3e, 0x8ad3fe3295f8eb54, 0x4fa95283e8bbb4b8], [0xf9f320723bcd1e87, 0x71f4658f73a70bd3, 0xb9638db4645910ec, 0x1d0b35fdc9329626]),
+        affine([0xca228139f25d007b, 0xb6f090268e202378, 0x9a3df33d6bf9e39a, 0x529b4ea2502deb90], [0xf366ab24c24a96c2, 0xad626a3307f9e45f, 0xa586ecf7e8989fca, 0x56ece78474e31fc7]),
+        affine([0x292325cb6c2c9d82, 0xe37c59f3e1210eb7, 0x0b31ffdb30d37dbc, 0x0218622c1316c210], [0xfaf1c37d6c98daba, 0x9c57bddf3600ca4a, 0x726c56267901e1af, 0x56b9d41872d8bc71]),
+        affine([0x11345a762b21962a, 0x0125c0ff625c5823, 0x6f7d6ef4b683cdb8, 0x238ad7760c1dd565], [0x59793c2a7ed243ec, 0x7b0995a32d39f67d, 0xe0feeca05524bec6, 0x645a90c709d886d1]),
+    ],
+    [
+        affine([0x75919ab7d9c63c90, 0x90ef78f09896b1c3, 0x85398ca39896ea00, 0x3aaedb22de65f1e8], [0x9cc6134c89c2eec8, 0x6536c49d0e9885ef, 0xed185a456f462621, 0x6ec034cb992abb75]),
+        affine([0xbc792554dbc1bbee, 0xc9a217ede000816e, 0xccd4f40fdf69f81e, 0x5bf08293b21910e5], [0x2fab7f51e7414a34, 0x05938bf8bfb96e65, 0x0811eb028da1521f, 0x427173fba78959bb]),
+        affine([0xc0a39de417dd3dc9, 0xc58e7f41b94b1989, 0xa939368e9756e943, 0x18ff80ae8313bc19], [0x4c13cfdb3d2ea701, 0x9091a64312d35693, 0x338b0376386d9ceb, 0x56f10a47b7799d66]),
+        affine([0x95f21062cf686335, 0xb49ecd0785969dd4, 0xe74e9e61d4da0b2f, 0x29e0dfc6f853a1a6], [0xffa917b0bffbbed5, 0xc21bb93f6b214733, 0x1d4ac58b75eb8aa6, 0x3c635190add0a1d8]),
+        affine([0x7f2c10387a4c8d36, 0x4c9b9efe09a21082, 0xc0346a72d05f2f10, 0x0619dbf683ddf1e9], [0x0d396aa3f93a07d9, 0x0dfdaffaa1d2303a, 0x80ae8ffac7f7845b, 0x148198672d580367]),
+        affine([0x65a06de8dedada27, 0xda767ac7a613b9af, 0xf8cd99d84a0fd183, 0x6fae00baa978b44d], [0xda34164dade9f471, 0x75b30159cb1a012c, 0x1a5641ac85143964, 0x268414fa82872d06]),
+        affine([0x13b454616f6e5488, 0x2e7d281c5ddbdc62, 0x206b87a4ba4ff8b6, 0x6a3fd1f8beee17fc], [0x2eeabfc107cc59b2, 0x7945da0e8fbaeb82, 0xca71a7e45a322af6, 0x086739c2a98e8a44]),
+        affine([0x4fc25555b09e323d, 0x2e9a1072eba0b5bc, 0xa3da9b6cb0ba0d33, 0x612f794560bb410a], [0xa9c130f2767b03c8, 0x1fb055db794f01b9, 0x5e77044eb8e264aa, 0x45a8dd9c02f2e34e]),
+    ],
+    [
+        affine([0x51229b39aef468b3, 0x7639988a55bb540b, 0x68fc064169e4d20e, 0x670c225e09a4b820], [0x036571282dad42d2, 0xba3a1e4418efbf61, 0x9f1184e3e5e85768, 0x18a5bd47add79c0e]),
+        affine([0x703afb372beec92c, 0x0ab86696d60be3b1, 0xc3323808f123262b, 0x3397eb4e20a5dc36], [0xed0e42d1348d03a1, 0x5ee065ab942e4822, 0x9075751bf5aa63c8, 0x416dfa45ad0647c1]),
+        affine([0xc51a605f1e7e1fb3, 0xadbc2143cba9e803, 0x3e317ea3b2ad3e35, 0x5f86ed22cf99b2f0], [0x13eae7884f8614af, 0xde5996d0ef1e87e3, 0x0b9c44166ef191ab, 0x5dd9f4d3f5841328]),
+        affine([0x64e16120cc940939, 0x108a869bf50abe95, 0xa948c429742dda85, 0x30db8bee32d067f4], [0x45963ce377bd8bcf, 0x80f84f8559c993af, 0xa8218464b367c254, 0x439debca923a5107]),
+        affine([0x76b8b4e3cc39a5f2, 0x647086c966bc0155, 0x360c273f9d5dcccc, 0x116a874fa81e8cdf], [0x6fb0997d623d1cd4, 0xb548efab6c350580, 0xe8ee0f38cd4031f3, 0x1298e931a4adf68e]),
+        affine([0x93c30d4c8c7bc132, 0x0027bd16087ae928, 0x7b9aa0358328b107, 0x557aac88cc2cb1f1], [0xcc9e49333702a233, 0x9fa896b0f1dcf4ec, 0x041dfcb5c0dfff2d, 0x57bc830e18a55ba9]),
+        affine([0xf87e1454f3d94cce, 0x36385f2915dc1de0, 0xa301625a5489b54e, 0x5545f8a82e369779], [0x9930095582f3be51, 0x2c75f9c0832ecd6f, 0x7f8dd34a65366047, 0x1843ba31bcd52f89]),
+        affine([0x63b6457149b94d66, 0x36691d117be56d61, 0x82999ade97fc95d6, 0x03032d1b99dedc8a], [0x3d2cb2f15d500024, 0xc03503c09e390e65, 0x4d3b9be6b8c313db, 0x04207607295c1b0f]),
+    ],
+    [
+        affine([0xd091b662a17c4bf3, 0xbbd1caa7632f6e8f, 0x6b28a64ceb7fd18f, 0x1e5986b67079d8e0], [0x8316884de63cd9c2, 0xbb40007447610ac1, 0x098e7aab94524cd4, 0x45198f38edba5281]),
+        affine([0x35e5b38f95452d02, 0x7ea14d70b55620f0, 0xf31018c80bed2cd2, 0x4e6f5b9e7a46fa55], [0xe4284dd6d384a3b9, 0x1f5afa5ba174a945, 0x9a06d05af2f16b84, 0x39359bb9b3d56166]),
+        affine([0x420c0266654ae729, 0x4e47247f4054be12, 0xbada31e43a69e007, 0x313a5b65157c8ed3], [0xc4a9b53f40c6b0eb, 0x3ce44aa527958e6f, 0xc79240c2e04cad9c, 0x077854fe46d7c02c]),
+        affine([0xedfff2ec724e0a1d, 0xb80b801702b074b8, 0xec42754e36b21961, 0x282aca482e8fc442], [0x75fecc7547897c9d, 0x188d275269aa4a21, 0x2bd73fc7a54e628f, 0x1ad71ffd9ec5677f]),
+        affine([0x7549ec4bf63a9010, 0x2530c07a56e158c1, 0x02639f0a3ab02487, 0x2c1ad84d8789d77f], [0xbe23c9ce75d8511c, 0x7d438529562bc89c, 0xf039287020fe019b, 0x678595c25ebd43ac]),
+        affine([0x06ad48be1bf864d1, 0x10d34921db35aee3, 0xa131559d026cfb72, 0x3922441a53cf3a72], [0x92451c2c5bf42e1c, 0x6d1316ae9b08606c, 0x0810ba4daa9d6ec1, 0x040473d9c89d2ed0]),
+        affine([0xec92c15dd05e1dd6, 0x6cb18de83f0ce137, 0x7230d3120912bd5a, 0x4158460d3f3e08f5], [0x56b1a582381649f9, 0xf70e65a8c8d4f91a, 0x9bc50ba9d6112b21, 0x146769d16890ff98]),
+        affine([0xbe35e6236ee62ec4, 0xd5b38cbde55941df, 0x5cb1c7e6911cabb6, 0x087f83f5d32c3bfb], [0xad1b1401ed51a68b, 0x8db1b03208cea67f, 0x558ae9d1a47f8da7, 0x27d555a4198c91bf]),
+    ],
+    [
+        affine([0xd01d693ee9137bca, 0x5d254a75e902b89d, 0x2877a7678aaa745e, 0x44b12beb91be5645], [0x1444dab949a5da43, 0x697700dee1b4aff9, 0x90f52ee3dc07f5ab, 0x605f0bcdef4571c6]),
+        affine([0x73d1d343b59bb0a7, 0x967ece8c5711a89f, 0x0de769fa3f2862ff, 0x73263900bd88cfab], [0x262d60631792903b, 0x6ca70ce84ed71278, 0xc4d0610e76ecadeb, 0x087538a165e796f5]),
+        affine([0x461faed0e24e48ed, 0x0c876f41a1129b5e, 0x3047546740ccc155, 0x12b5fcb335580745], [0x940ef4fa22dde9ee, 0x98019b9958063acb, 0x84196bbebe2ac378, 0x1f0de38b09f87a59]),
+        affine([0x7e06fab7cd9abd12, 0xd668ab46cfe98d66, 0xecd3c954d7544621, 0x310c72566e4466fe], [0xdca27748862940a1, 0x9ee4c58d8ec8fe40, 0xe3b8ddc078a65762, 0x337b2bf080bcd09f]),
+        affine([0x75640dd6c662da0a, 0x28a964b1be246a5d, 0x788060657639988a, 0x3be08316761d385e], [0x2f0c5661a0917cd8, 0xdd428a03a015fe15, 0xbcf424b8bb060567, 0x5a408e009209698f]),
+        affine([0xdfd6c9949c646a7a, 0x180c2cdbc370120c, 0x6057701bee10be03, 0x320bfe83ea36e172], [0xe57867d1f2b41d3c, 0xf3b59de380721b36, 0x0a1523c441d1cb1e, 0x57193d1d4c2e8d1b]),
+        affine([0xf779681155a7630c, 0xe7b78c2c7d5a18a4, 0x403fa51b517d4423, 0x4fe1cc9e27efc02d], [0x22e1915d3daa40ca, 0x2dd9ec1018ae8ce3, 0x29a0546ace354cf8, 0x0b0098eab2b466c5]),
+        affine([0xb2c58e04a6d5306d, 0xfe37490575c73343, 0x62cacd233eab1113, 0x46c7c49df51f1796], [0xb216eae71fb2fa8d, 0x1390a41e8b839769, 0xe617cfe8839232f5, 0x5d174fbbbdab971f]),
+    ],
+    [
+        affine([0x4988349bac97ce3c, 0x0ea08cf24a7790f6, 0xfa0240e3f8564e18, 0x3cdd7f130838958e], [0xe742da7fe3a908ca, 0xa02ba5d2ded86d0d, 0x019156b0b967c7b9, 0x59bf8fad2abec111]),
+        affine([0x2a977f94b553072f, 0x94131dda7f158724, 0x3a6d120ea219a3fa, 0x1142bfc5f72c2996], [0x3d3ecb05740dcd7e, 0x446360bf12b91fe4, 0x2c395db57f1686ee, 0x320b7f8c5f87a7e5]),
+        affine([0x41fe03db4cb5165f, 0x26a1f66a93750ffd, 0x87628d17b5bc11fd, 0x445b944a5b8f4abd], [0x7729a9b5dceefead, 0x21d0d94c5d2a0b17, 0x9881857eca0ef01b, 0x1491ef2cdea0cbce]),
+        affine([0xf44704eaa210300b, 0xc06f1b086a15fdb6, 0x7fd7abd81df9087f, 0x1caf6b1e9ba343f9], [0x898015a3718d2cf9, 0x18b0f3464c646835, 0xd49cd08b8c9dbf03, 0x1b013d9a3fd3f5ea]),
+        affine([0x4348d4300f69a6e6, 0x389f207615e08d0e, 0x36a50e5ffb006fa6, 0x273a7c86f6623e62], [0x3a0919778a73cded, 0xe310f179babdd74d, 0xe48f273af50ae977, 0x4155cf5fac100c3c]),
+        affine([0x63055b47807e8936, 0x5d88a18305adf978, 0xfd9f87d5a218d2d5, 0x009329923a076afe], [0x42ad846734b3a4f5, 0xad0b9a5f5a93e259, 0xd9971c0414cfccd5, 0x271c51009917c9ae]),
+        affine([0xe6ba582fd13288cc, 0x51fe8dc5250e86af, 0x5a2a27251e4aa4ba, 0x54cfad62c5c9d1bb], [0x97f340ad73a70673, 0xd27f74b8eb69b37e, 0x9d5a6fbc233d1e1a, 0x587716159ed10fe8]),
+        affine([0xe34fd9e651d5fb5f, 0x6671d3f5eae81825, 0x558a0f397f9699df, 0x0a7e2efb47a72258], [0x5c68f36e5feaeef8, 0x7e0935f1c4b75922, 0x6a5598fd3992d079, 0x41c189fd097c6415]),
+    ],
+    [
+        affine([0x7ffec1af44bd286f, 0xb007a2285ba8f19c, 0xa7200f611186438f, 0x7035cdfab64c73f2], [0x326e72150944d06e, 0xa78679c23a1e5824, 0x3a9a03085f0d3b23, 0x0174220aa650b8b3]),
+        affine([0x4d89404fe65ba04f, 0x2c7c3db9e6eb567b, 0xbd7f3dfc7f46e944, 0x22fda5a642959d0d], [0xe6e54f01c51cc8c6, 0x6b76b50c3db44eed, 0xeefa31cd7c3c172a, 0x69967bd7534cf197]),
+        affine([0x704f94577ae04b0f, 0x8605381ea0f58c92, 0x76ca3b267fed9a68, 0x64e1a8f9af301c8c], [0xd313bf4d5846505d, 0x416d558ff6e1a8f0, 0x92c6c286750fa87e, 0x1908876abe26d396]),
+        affine([0x7ae26c5b68d09f01, 0xbabe09b84ba502d2, 0x25df60d84e170a5a, 0x428cd24f68edb423], [0x7bd540126ebbec88, 0xf38443361570b9ae, 0x6ab72b148a793842, 0x49cf13b0e626a53f]),
+        affine([0xda95d2419bc77eb2, 0x7d9fa2ec3615ed80, 0xd00fec6f4373e5df, 0x2dbbf04a50a34c3b], [0x969e8263cf5b7360, 0x852492f9cb9f7521, 0xddf50cf03273023d, 0x0998daa8e5b45696]),
+        affine([0x5e4a1500bca61f2b, 0x96eaf87742f37338, 0xe29147ace28de537, 0x44cecf9a1a8e48bd], [0xba1bb06944472cce, 0x9e9a0969d474b0a4, 0x5a15d00bd6591a7a, 0x1f5ee82ca8503cb6]),
+        affine([0x4a3f891e3ab72a3f, 0x929733c75b68ee66, 0xd1fb099eed826b08, 0x5bc94dcb7cb727e6], [0xc535bc4dde53d040, 0xc51dc381464e54fd, 0x0b5d838e3c18b6dd, 0x1c044da8d369d106]),
+        affine([0x89e274495cb64b86, 0x4717cf6f25b5d52d, 0x7f63f22d98734bde, 0x161253a90801f07a], [0x19a543efcd409c3b, 0x27892faded1d8132, 0x13f99fc430e72b69, 0x310d425ebd00b12e]),
+    ],
+    [
+        affine([0x27419a0c78008760, 0xee20af33918ae80f, 0xb7b81d8409f392fc, 0x33f679500817c11c], [0xd6bd88ec1e34ea78, 0xe09ca28f5fcedb73, 0x8c2493d5078ab422, 0x3c37b8dc31b4f093]),
+        affine([0xa28aaff887f6f2d2, 0xa2a885244ccc5d84, 0x5032f0f00ffc49ae, 0x43ffc35e1eec9bcf], [0xeb879a13af9fecaf, 0xc16cb5b7a8a00bba, 0xa2c07a9f4ecb60ce, 0x1efa079b77b03066]),
+        affine([0xf559da6a11545e0a, 0x3131c98716ce0c96, 0xaf2fbe160bf24f5d, 0x4ffdeda02f6acfab], [0x0e91bc64d4127a44, 0x79f4ad66609e1e57, 0xf652a32174c4cc95, 0x181d9a0e0bd7f230]),
+        affine([0x837b8444643945b2, 0xc90b57d7496cd176, 0xe65b4c790c347cb9, 0x05378d1c7ae2237c], [0xd70ea0df93d9696b, 0x69253ba7e32459a4, 0x71469db9ce9c72ae, 0x090e369c16f1a394]),
+        affine([0x7578fc6396316a61, 0xd8c3a8348efe73df, 0x600c61cd7e37c700, 0x076e15ed3350a1f3], [0x9bd51d9f238b07f7, 0xcc4bf4428815b828, 0x777c4a2a25071789, 0x250eaecf906a3764]),
+        affine([0x53ca86cd3857a9cf, 0xef5db80713b71fcb, 0xe0a3313ac9dfcec2, 0x14407fecd6cede84], [0x8c504b5ec72d3eb7, 0xe0ba4d67fedc3345, 0xc8a0ecdd01e055c7, 0x1e77ac49fd4bb2d4]),
+        affine([0xf1a18cac906667ba, 0xed6c7a866cbde24d, 0x10c6cc749cb89dc8, 0x06a7fd5956359248], [0xe78b72c7be513d46, 0xcc57110b9b3bb4aa, 0xf1e34d130d1827bf, 0x70943b8d4007f99b]),
+        affine([0xacf11a6f0c7c4f8c, 0x3beef7e12e5912be, 0x341f809753cc84e4, 0x72c3f59833a05172], [0xf728f6f02d9eb4b8, 0x64c3a2beaf90fc78, 0x0b693827b0f7d998, 0x589cae160875ce72]),
+    ],
+    [
+        affine([0x2a3b406b2ac43418, 0x3893776bb8a27113, 0x7834573aed183c1b, 0x540e261ab4f30e46], [0x7f429e31f48bb1c1, 0x21a4ea075b007aca, 0x20ec16fc3754f782, 0x14e76b32ceb4e9f3]),
+        affine([0x5d0a31b0b414e775, 0xc356bc1a5d89064b, 0xa335b6649641245b, 0x6a0d10d3136697f2], [0x6d62fa7889b3075c, 0x0c2822d7850a150b, 0x1c46814a32705128, 0x5fc2ce718c8aa0ec]),
+        affine([0x55d45872adb4c78a, 0x7937223043923593, 0x60ad223ccb6d6c09, 0x3d7fd60cbc0125e7], [0x5e4332c0eeb4de8c, 0x63c780fc2a878c10, 0x8c2f288dad2d2c89, 0x57de075ab3180cf3]),
+        affine([0x6408f22c22e99dca, 0xadbdb545b133a7e9, 0x72e8dac0587fbe71, 0x50aefdfd8aa71e20], [0x83d29369601b886a, 0x4791f81aa8e2aa93, 0x8b7c69993322b870, 0x18e7c391e387225c]),
+        affine([0x553e0712ca098d91, 0x21c212d2baca07ad, 0x62809de1811ebef7, 0x52b67b69ae34eaeb], [0xc02d05919d5f01e5, 0x1731be29e99004d0, 0x0e49c3d6367ece27, 0x22a4cd9605f2cd3f]),
+        affine([0xf8cdc4040f94bab3, 0xc9f1b27dc07ef747, 0x87e681ff99b02cf0, 0x0d040bcd7ee648e1], [0x7fd98c60ee6b14a2, 0xb01a4d345e2d8a08, 0x68dc0042e927946a, 0x25be93e64340d1dc]),
+        affine([0xc6a32b93e185f935, 0x8621c8523624596c, 0xbac097aed2221427, 0x100684dcc1e86d9d], [0xe3c66bb2bb1f1c1a, 0x0654267190c0a231, 0x2eed2083e7d7275a, 0x06f5833b00cf0495]),
+        affine([0xb2f678471f108a8b, 0x4a524543bc4253dd, 0xd1b800eb0fe602c1, 0x172a27826d791c2c], [0xeb239534ea955d34, 0x5a4e0cb6b1d6ca80, 0xbbec065a1e579dc4, 0x1813f13ce501248d]),
+    ],
+    [
+        affine([0xf53815c1b3a34cac, 0xf8a6f6594c465807, 0x3c811b02962160d8, 0x0fa3b393ec2f3554], [0xf86f7befec654c9c, 0xf161da4bc202a44b, 0xe1a3c67badb89143, 0x2b5afaa90bede879]),
+        affine([0x804488199f0afa98, 0x23806b4e777e4ee4, 0x42e85aef5d2ffc02, 0x73b9a797728c6813], [0xf97d9568c036352c, 0x9566b9bdd2d4810e, 0x1061b63de311c52e, 0x13b8dec7b98bace3]),
+        affine([0xcae7e1bc87be9a50, 0x112989311f3ef6b5, 0x6be67395a86d98a6, 0x3e6b323e0502d07e], [0x52a7116c9cd997c5, 0xe90525999d36ab04, 0x13d776a5f29cccf0, 0x046feb1662eb52cb]),
+        affine([0xbcbfd7468952d945, 0x918ee5b76ab123f7, 0xb4c4e6f50b6405bb, 0x732885a3b8429392], [0x915ea9bf05197fe0, 0x111dc457f81cc7bd, 0xc1b28e202a31cdc8, 0x51886f442de0860a]),
+        affine([0x52c385ef27e56660, 0x49acb46b251740d1, 0x3f00db85c3fdb0f5, 0x5b26cee36bd32e0e], [0x8daf2ada48cc400d, 0xa8f275796e7b1134, 0x432e7ed2092568b0, 0x356a8e925c135eb6]),
+        affine([0x290d5ef66c750db5, 0xc5710fdfa6d840d3, 0xd0ba07af6d69cc60, 0x24478ab148d853ee], [0xba1039346220b12a, 0xd6dd3bc8d7dfe74e, 0x52da55dd7740174e, 0x47e16123d9e6b053]),
+        affine([0x0c95c6ad96e7bdcd, 0x26f08430b70add01, 0x843952bf0d7d71db, 0x2239eac75a0540e9], [0x16af5f1f533365e4, 0xa7446736aef24088, 0xdea5c9c5356723a2, 0x5cd51646bd0265cc]),
+        affine([0x218fc1720c563f34, 0x050b26b52908d2c0, 0x429f753e92650d7f, 0x657e4bf58de3994b], [0x6e567b6ab5d31ed8, 0xb328929c423e280c, 0x7a3124007a7ffc46, 0x2df4a2bf1630bfe0]),
+    ],
+    [
+        affine([0x2ec7c74b199b9b18, 0x2b9930e7304804a4, 0x91b1c5e05760cf32, 0x29ea2fe6a3ed1126], [0x9107a220238da96a, 0xc4118366e13e7ced, 0xde5c2c81732b438e, 0x3f9340cfcd1f264f]),
+        affine([0xfbffbc6573f5cf05, 0xcc8364ee2871f690, 0x09168e771a26cfe0, 0x6e9479824cd5b973], [0x1b48216248a412e1, 0x5958c93393718ba2, 0xa10715cd3023163d, 0x5d6cb0727a6cffbd]),
+        affine([0xa49a3f53dd4bfab0, 0x2ba1ac66432ecb09, 0x1c9ac7d6a579906d, 0x51bffbf5fe85a0d7], [0x5f6cd81466bc498d, 0xfc641f779d9cef45, 0xc9997097613ebcfe, 0x2166742c3336d381]),
+        affine([0x8f9cdef86f6559d3, 0x15909cfd9e43a335, 0xd7ed5ea15de0af3f, 0x34e01a602cc46e75], [0xe3a8dbe566fe03a0, 0x90c9dee277df2008, 0x8ed748ceedf2d2ac, 0x6dd5a21757b8ab9e]),
+        affine([0x8c3732100216e348, 0xd2b83980c9e8bd1f, 0x2e722850d9f72403, 0x2464d1bf1c341736], [0xb74ee7d023fda9d4, 0xae414404ec952273, 0x53204cb466843e11, 0x71270f9f3a26918e]),
+        affine([0x45581140f3eeb3e8, 0x67001057669ea98c, 0x8fbb007f03efd4b4, 0x6b1a69307586cf38], [0x8763385e82ad15fd, 0xa67bf1ec1c526415, 0xbc135a1ec62a1605, 0x4e9bbf7491379343]),
+        affine([0x1aa1949067c2d797, 0x5617a0925314c37f, 0x95468fce7ab9bf6e, 0x2906d0fc0b5a63ab], [0x76bf658bdf9ed4ac, 0xe98edbfd8b85bdfd, 0x58a9328aefb1a098, 0x18db274e1f63a9d5]),
+        affine([0x674900f7f3871d8d, 0x4764ba51c0a1a080, 0xf43e45cc323eacd8, 0x19387d2016a942d2], [0x71dea61de54a79e6, 0x08020d2da0048b1e, 0xb8f26baa738d94a7, 0x09721c70b3719f59]),
+    ],
+    [
+        affine([0xfab33ad7fbf6a393, 0x2f9865af539baa13, 0x1b8a82894d8f2e2f, 0x2773a669a40721d2], [0x1ddd5e7ebbb6d393, 0xcff1c461d932010a, 0xc80904f8b84f9c37, 0x0b563fe5bd9be548]),
+        affine([0x9bf954ad2fb6a0fc, 0xd629c743a298df11, 0xe8d8387c6be32045, 0x61f1c73affb2c5d8], [0xb2cd57288c9a4147, 0xd9dd62418bd11c7c, 0x86da809839f1dbc8, 0x03245e0e9495602a]),
+        affine([0xce3b6ad35993b6a2, 0x7c666425adf7603d, 0x86c2aa4b18068027, 0x631f17fffbff0f60], [0x2c7d7156c03a291a, 0x39a074593f6fbf06, 0xccb8e8f55bb9511b, 0x6b05b9b9d4bd9968]),
+        affine([0x44f7653a35962119, 0x821e516ec9b2d948, 0xc7c01d028d3a9216, 0x3517427f3ddebf8f], [0x1ad9dd1840bde1d2, 0xf6e1ef2cb9bf3c2c, 0x3aee6496d5b9affe, 0x144fd48ccefd97e1]),
+        affine([0x64078460d5de79d6, 0x88896cf19f63df0d, 0xc422a3972ae8afe7, 0x5625d165fb380051], [0xd51a60dbd2aa326f, 0x3376d417b9d160b4, 0x0613e567627b3fcd, 0x6fcf20e287efc564]),
+        affine([0x694e49fa688fd34d, 0xf4d0216c5b123169, 0x05a4deed8005ec0c, 0x480ea5cab3a7e0de], [0x1a891d2a0e2d04c8, 0xa436dc20f8c414f7, 0xf81a39f95739dbec, 0x6c8328e1dc399480]),
+        affine([0x89acb35862ca06e7, 0x8bbc8591c325e342, 0x09a764058e918859, 0x07053dbac0701628], [0x43dd5de01eccfb7e, 0x02968ff3d5ed87f7, 0x39e64a08c5cc3013, 0x4d3a690af5a85013]),
+        affine([0x0631e0d412ec0c1b, 0x464fd0e8927d46ce, 0xd24b539ddd18c842, 0x460e65da5b71c0ae], [0xda3b8508f61d8daf, 0xe8884223dd32d41d, 0x518712268cd0318f, 0x3a07a9eb5896a717]),
+    ],
+    [
+        affine([0xa24a50a98dc90fee, 0xb3a2af5727145809, 0x6f98bc88c1f9fa57, 0x4f7fc86a219999c7], [0xeef3912faa903c83, 0x0211564432d61054, 0x2e0f5d9db71494bf, 0x6d73c69943ceccdb]),
+        affine([0x289ee47408553f53, 0x3561bb83eb7c3e94, 0xaeab5e07b21e0583, 0x0020b42cb9c6eae2], [0x21a7fda49e378ebb, 0x21048ba87692624c, 0x46a760ca9fac713e, 0x30c949484d73c8e1]),
+        affine([0x5c102dbc2282d32c, 0x2f19dfaf3c91d9ac, 0x8cb9a1ed39038787, 0x5b2acc53f03fa86d], [0x9ba63d97d5e833a2, 0x335d629311f30f51, 0x4b136194b9623df9, 0x015dadf14ff48efb]),
+        affine([0x2877763b45d64c60, 0x49f96d46b12c67a9, 0x7293dc4ae9ed89ac, 0x2e015d45ae219284], [0x423565417979b191, 0x02cbf03a5fe8874b, 0xe2682202e5002aa6, 0x52a290576ee39d6c]),
+        affine([0x5d510500e3a640e0, 0x87349358ea5672b5, 0x113cd6ba01b5c077, 0x3d488515fedc15da], [0x478f8f052659e730, 0xf09bd3859338ce11, 0x8b8f2fef6c78b884, 0x5079f5239a033384]),
+        affine([0xf8334b1053fcf81f, 0x22798a13e6a06d6a, 0x3113385b31fd5cb8, 0x0288e004ec1a4b25], [0xb9bd253946b3e944, 0xdbeaaa064012fc5a, 0x6b26a2504ef57c74, 0x3a6688800f5d06b5]),
+        affine([0x2e6cf7fe5d1073c6, 0xca2f04280228b59c, 0x7a798a70f7b9bc39, 0x5d1412cf774478e1], [0x69bc7086f477038f, 0x8db500fab8935f89, 0x9cab347e80fcc64e, 0x3e61be15988ed325]),
+        affine([0x4116dd09045c974b, 0xa826302a824aa855, 0x255884eaf4a95094, 0x56dcbf95a37531c9], [0x5950f22ae5eae82b, 0x27d3152aef1f8e8f, 0x8e58ef871a330aa1, 0x359557fe3e6a9fe4]),
+    ],
+    [
+        affine([0x3dae56a533eb97e0, 0x5746156c56534d5b, 0x69aa7823ad7da72b, 0x4a52ac5184c16774], [0xd4d1887e95b4eaea, 0x75228c7d6af53fa2, 0x8d987cdd696fcb4f, 0x09fa724d9dc51282]),
+        affine([0x6d8afa6e29c29003, 0x522af00922be8637, 0xd0c55bbc23e1dbc2, 0x6ba09b665a7d99d6], [0x8d6cfcda28e09a88, 0x53a6a0d2b56064b3, 0xb5818849c6e66aa2, 0x448cc131671df9d8]),
+        affine([0x73df3a46bc7a4def, 0xaaf859e417d9772c, 0xae7abd121eda4514, 0x0417b9ece0cd2122], [0xb43f239f804b7335, 0xf42e5693c00a9616, 0x623da7761aeee85a, 0x55ac7b29afa87dfb]),
+        affine([0x2b2f49b42b198fa0, 0x6da39c5d305f60c7, 0x84c483a645a70fab, 0x36d0438eeeb3a95e], [0x74b06bbff513ac23, 0xbd27bd3ff7e52c7b, 0x2385a3dd53127f9e, 0x2846b3a46c074cbd]),
+        affine([0x97f939ff2d14d497, 0x57bf4bb22e40b374, 0xca50684f4827acc0, 0x5b0942bf01b64e94], [0x042991e832c5fbf7, 0x6d72aa24579af29b, 0x3ceb0a6d353d3a9d, 0x4b9f87b6c40c53ad]),
+        affine([0x43b7894cc386e52d, 0xe2b68a25d5bd92a4, 0xbad515388158fb40, 0x3372639ac9ad60dd], [0x61bf172920d01e28, 0x50de9571dcf1bb1f, 0x00f269e061bb0559, 0x4e3e686bd05038e2]),
+        affine([0x9393015274762a87, 0xb48890f058b33039, 0xf5f5d6d7eb438f18, 0x1ed0d333679aa764], [0x9882db40b30cc076, 0x315ab690e8506d70, 0x1efba9acf9cb57ec, 0x548d4ce56912bc5c]),
+        affine([0x057b1bf50b3cba1c, 0xb12d9b72fddb94af, 0x24478bbfd5609092, 0x177fc0d50cbfd7b0], [0x36ff919a1f33f1aa, 0x5fd588aea412ea5c, 0x2385b7471ce57e7d, 0x576848585a949176]),
+    ],
+    [
+        affine([0x3a017dedaa40be26, 0x60ba011756dd0369, 0x5bb3f1028160ad41, 0x6c8efdac48878258], [0x5b02ed4a6143eb50, 0xb3f31fe594c2785d, 0x5c4d362eed31e723, 0x3de7eef460d0a0c4]),
+        affine([0x15756094f61c50c2, 0xb277c90d27edfce8, 0xc1649fa67d4f2ba6, 0x424faa8e92b49bc4], [0xa98a6e33179dd5a4, 0x457853f474c03885, 0xf0bbd325afeb10ec, 0x3b47de9b695cdd3f]),
+        affine([0x83e732445028e97e, 0xf2bfa3400e773e63, 0x3382318275e43162, 0x012d1b30cf4128f2], [0xfe254c53c405d00d, 0x7fc3b1fc7ba017d0, 0x82e71dd4f40c7a2e, 0x144d73bc33dd4553]),
+        affine([0x337d4ec4b1e9caa1, 0xee306f22cb972790, 0xd0be9b5d2e5ed39e, 0x2da300bde0f10116], [0x1a88fa9da9e5527d, 0xb2c9f6a003d432a4, 0x5a8299cb57b7f030, 0x357cea236502c21c]),
+        affine([0x2d70e6ee430bb51e, 0x1888afe4913454e4, 0xa03f4cbe0afbd350, 0x4c59163c8849fda8], [0x52fa279628e14614, 0x47715247f54151b6, 0xb350b4d94f23008b, 0x134d788a6274c1bf]),
+        affine([0xc73c42a4ff581f50, 0x55d8b1597a3b092a, 0xeeb02fb8b05ba56c, 0x5551fed5eefd1aeb], [0xdc5ef3ccab335d25, 0x8346e307cae3877e, 0xbae0f6bc75fb9987, 0x1425da8ee52f33bf]),
+        affine([0xd7bf4d775e25fdec, 0xa723eb026025a59e, 0x04858d041e754856, 0x3c308381c161e57f], [0xcf338c20a341e6c8, 0x2f0e60de124c46aa, 0xe6141aa1b829792e, 0x0f194f116bb80cf3]),
+        affine([0x7194b6107a64548e, 0xa151ca49b12c23e0, 0x917f811128731f66, 0x18fb37fad273a6d8], [0x86d21536a7880524, 0x3e8ef6e46e8d6aba, 0xd935bdafa9e3fa70, 0x448b06b04d2c7e1a]),
+    ],
+    [
+        affine([0xd0ac85ba654f9a1d, 0xe9ead55787d63df3, 0x009d49ecf7f99ced, 0x09ecb16a621917b3], [0x145d4960f35bef77, 0x182005a1da1fd838, 0xeaf6a0cc5e196951, 0x4cb4104faacf0a14]),
+        affine([0x62526cb4dca65e22, 0x4c048d9413e31a5a, 0xfe2f9278fd8f850c, 0x14a835851fe1ac88], [0xa6dd1b96e6c3ba6a, 0xc4091363a1050c5b, 0xd03574e3dd87b820, 0x05626724a85b0c5e]),
+        affine([0xff73367bd5700590, 0x578c4cc9a6ded445, 0x8ecee81aae018e7f, 0x3d350b25c033cf03], [0xc409fdfdf91c82ee, 0xc44615ff7eb436a1, 0xce3546022b889ce0, 0x4690a3646b28aca8]),
+        affine([0x056529a6163f2690, 0xf22ef954a604b3c3, 0x37ac1084630e0750, 0x03a73f6b3e50e78a], [0xd1b3a6ae551d82f6, 0x40ad20f5d06ba2f6, 0xd31d0203caf69f4f, 0x5e9a54d66fca84aa]),
+        affine([0x984d54ef35e5ba3f, 0xb64d70ef09a6e3ee, 0x1334f9593d8f9012, 0x6b9f63f50bcdb9b1], [0xd273cec9342fad6b, 0x5dba6847961d1efd, 0x44e04a86009632bc, 0x1b63ab3649487d77]),
+        affine([0x03ad41dc571e9099, 0xbc3d8b70cd363777, 0xbcd207d601b89ffe, 0x22f1c530f56ff5a9], [0xacbfd737010bdf14, 0x0bae60bdfdee1520, 0x2ce57fc74fc9f3cc, 0x5a67fac048794ca9]),
+        affine([0xfe2d251b4868a906, 0x975a0b05df6c9d8b, 0x1feccb6fd6f0262b, 0x0cc6e8e4c477d851], [0x093d55f68336635c, 0xdcba08852cd90e80, 0xab2c5a44acfcc8a4, 0x04f7c80fcd95859b]),
+        affine([0x6a5d33c9470d101a, 0xe9933430b5afafce, 0xb4ef173ff29d304a, 0x58bd535eda15a707], [0xeef4f44fdd8f606f, 0xa57e1461e85f662e, 0x7c385a387f7feda8, 0x0d12435d8f2a15c5]),
+    ],
+    [
+        affine([0xb4377c2df7cb1a11, 0x47038bfa7e1a8de3, 0xeb67374891edaeca, 0x3f041b12e993b797], [0x7409fe900aed24a3, 0xfec5e5eebed31700, 0xe60ba316b6015d45, 0x6a763f90df78acfd]),
+        affine([0x77547fd0026031c2, 0x5d4165aa58cd4343, 0xe27f1f610b9fb902, 0x66f83212f3e8fd73], [0x9b98944e276b0f43, 0xa84f448805cd2769, 0xc1943070346e4b95, 0x340b3e1a916f9d93]),
+        affine([0xf310e0766f4df6de, 0xd4b9fd6af1554bb6, 0xfd98c8aeacba2902, 0x0a36b427b8aa77c5], [0xe7abc12de012e5c0, 0xb1a391f8a87cb0ee, 0xaaa0ac7e8a4d5e54, 0x3d9d77a19f738b21]),
+        affine([0xa6149bc247b1468d, 0xd5ffb1f91cb56c1f, 0x8aaba0734a73ffba, 0x52b496b2dcf068a8], [0xae8ecd971095c8f4, 0xd665ece2d3e58c6e, 0xeffb6c1bdbcbd908, 0x42e31776677f800b]),
+        affine([0x606d5b9ab560586b, 0x59d5264aecb576a6, 0x50397d9b01044e91, 0x2102a827ce39848c], [0x988fca6ed9260c92, 0x1fea9102dc41e475, 0xfb1baafb65ec5ae8, 0x5e1181e1d30ca708]),
+        affine([0xe3b044a7a3dd719c, 0x4ea6f68ad7e22789, 0xc43d38ab5a011880, 0x58d60826e6601518], [0xe6b9fed84d8ff4cb, 0x66bcbed444fedb51, 0x048bb20a42a1ba25, 0x1353f522c325b0ac]),
+        affine([0x4b633ca53b6c32f5, 0xa5c8ca0b2ca3f317, 0x7e87ea17aa0b3f01, 0x1a4425e1cfde5499], [0x829123b704fc5977, 0xf2d380b6b14509cb, 0xa18de806091dc59e, 0x55f8d515f7812dfe]),
+        affine([0x93c7d35c68a4a9bf, 0xedf159d53cd6cc93, 0xc3c23a087b1c337a, 0x33b963798448d946], [0x58472eec453c409f, 0x2d3bf3b0c155dea2, 0xad0be68f7a62873a, 0x53ab1ee5e32edd13]),
+    ],
+    [
+        affine([0x5a8ea9f317d71746, 0xd2ce7c2a002df5ff, 0xecaf14555e7b32cf, 0x715c56d5ea2a7180], [0xe69c3112d08a908e, 0xcf1d8f67fd4428c2, 0xef7f2f67dfa13416, 0x0b2f740cbc58153a]),
+        affine([0x909d708742d84805, 0xc16a14adffa3cd1a, 0x4aff65ccba458f99, 0x1fee7f3c67bc170f], [0xe1e9c82a95d64932, 0x93edfad81c8d36d7, 0xc4b34b908263eca7, 0x2cfdd94fce7a54d1]),
+        affine([0x88a0b3fefa40ecd1, 0x2f73dc6507d77137, 0x09cb275a342db5f8, 0x0c9f6400155734f0], [0xa6cdb343bcf154de, 0x06db8fda090edf7a, 0x4eb52294ddfccc53, 0x455e4f2f99ec7b0e]),
+        affine([0x0336fb339f9a5fcf, 0xf3c60b59f330bcff, 0x399624692f2e10f9, 0x638cd7ce1b408e1c], [0xccfab0d6c7593ff6, 0x22ca7bfb79db73e7, 0xddf46ffafca369b5, 0x51be38160e931bc5]),
+        affine([0x470d4cf73ccc86e3, 0x7fe4c7a191a1210c, 0xb87372b05cb0c11e, 0x097daad669e10e6f], [0xe17a8cd87e4d3276, 0x19cb415336a4ff0d, 0x911f378644c14379, 0x5bebd7bf355f489c]),
+        affine([0xd03322841ad32674, 0xfe6990c173d626ab, 0xa12fe4a49b28d969, 0x30eaf1aef9a41b0a], [0xe6793e8d668e5018, 0xdf586eb513eb914c, 0xb71601546f0b6691, 0x28d4a790e3e61932]),
+        affine([0x2af979c5cba6721c, 0x4663529cfd95e64c, 0x46ccef087be8776d, 0x531d4c35d6bb6129], [0x0f6c11dce54e0a80, 0x4165dffeba3a7f02, 0x886f6b4b915808ea, 0x28fd9313bf218856]),
+        affine([0x15a3da7c841838df, 0x9407435496234179, 0xe06d755cd47a81b0, 0x4b318b4b5361752c], [0x5b12e8d04918ffb7, 0xb6f0ff124ca33854, 0xa597503f9948cca1, 0x19fd53860808ea1b]),
+    ],
+    [
+        affine([0xb9cc2e974b1c8043, 0x08633122a4290164, 0x22351032a1445276, 0x589c9ccea8a9e31d], [0x8f43bc4d94674863, 0x4e26ac5b751d15a2, 0xf0a5966c0c8e1b59, 0x1fad2e55ab10d4cf]),
+        affine([0x34374ef147d44abf, 0xd83a13b4c17d8a5c, 0x0298a2b82a757f2f, 0x01cebb1486f9cade], [0x66838cf0bbb9bfa2, 0xdc4bec602132ed46, 0x37e5bd8b2cd5b5b5, 0x1e3db845ce44ea8d]),
+        affine([0x9b9ac5b1a6e5c6b9, 0x3c95bcc7509b30a9, 0xb689e8bc702cbe12, 0x218e2008eff1c49b], [0x04bd1c773a189f10, 0xf66d0bf882ce1789, 0x441549f80f5a1a27, 0x1ed29c68efb2eac6]),
+        affine([0x3a2f29fe16105a3c, 0xced4a1a11e231e3b, 0xbf67d959d6ed0ad2, 0x13d8501686a71272], [0x91cf395646acbb7f, 0xf9eb6f3ba2cc202f, 0xd9e276d2e9f8fe2c, 0x276a5766b7563919]),
+        affine([0xf82b108bfdaec44e, 0xc3815f0a7dc1ae4e, 0x6bf96f6ee1287e4e, 0x531097ebc7ded47c], [0xa87f03f0a80b0b6a, 0xc9fa976dd400075b, 0x170cf3caa341e8ff, 0x6644f3c765be54ec]),
+        affine([0xa1f6a835e627cb36, 0x059b94084d02e5bb, 0x86f9f771a79c9c70, 0x1060faed0574926f], [0xb1d7419b599708b5, 0x845008d86c36e2b5, 0xba9e5d8201549179, 0x2e74e539ec4f59bd]),
+        affine([0x3664b6dce8ba44bf, 0x0d6347e386085619, 0xb735f56d6c1cf9b8, 0x2a651c2680dc7d90], [0x2d1acd83e154f829, 0x03fbe2bd523cff9a, 0x363a21e4e113d71a, 0x1956c20aa2e71b0a]),
+        affine([0xbc3c21ee31f65bbb, 0xab50c4c80d83be71, 0x0079af2525333d0e, 0x29fb01f6c9fa4dad], [0xf036b026e82dc40c, 0x15c12e0c7859b0c2, 0x7eab229ed5558ee0, 0x487463fe25957526]),
+    ],
+    [
+        affine([0xf5940e226157c638, 0xcb9007886240fea0, 0xcccebf9059164d2a, 0x1de0fe8b4e0b911a], [0x24116f4e442741dc, 0xcd809aee93b86865, 0xed28bf071bf3e233, 0x6cdc1ca9e386fad5]),
+        affine([0x2ea6135ba06f9dd5, 0x567367333d6f6ea3, 0x57e9ee264902d9ec, 0x522dd952e2099565], [0xcdd3fccaf2b9ec4b, 0x4544055cec137de3, 0x57bbb4183d108479, 0x38d664deedff725e]),
+        affine([0xa5e2783fd29c1284, 0xe0a18ba633a0675a, 0x4cd57d6f8708c9a3, 0x023cbb26036f2cae], [0xc94f77c365a59571, 0xae84d838d82b6245, 0xd5d7229e52888324, 0x18d26148ca7ac481]),
+        affine([0xd9fa2a7745ef54fe, 0x64b2efa0ac196ae4, 0x646fc2b3c6314149, 0x2a37098fad45dcda], [0xde8bc9d658f68ab8, 0x3ef3e75880f6f8ac, 0xd7722b28295d841a, 0x48217a9db6c73d1f]),
+        affine([0x41a67d6d582474a6, 0xb8ff80a32d17c988, 0x3486244d1d78b3f1, 0x4944df477d601974], [0xce7df34419e7ca16, 0xd5ba505740fae3a9, 0x326187b380ebd616, 0x0f56c27e6067f9f5]),
+        affine([0x38625fcc21196001, 0xf9f03040a84fad38, 0x9339733f4a780a23, 0x1cad0e1bf8a45f8c], [0x53cf0141e8f580d9, 0x80bb6e666fa26fc5, 0x192156c71cb75c99, 0x6db6a8f21548f612]),
+        affine([0x9cc8856813771bac, 0x336d24076ef6e851, 0x8aa33d8d24bd66eb, 0x6d76932aa6f568cd], [0x5c9ba3ed3fa26c1a, 0x504ecd8bbc88d6df, 0x933da827324d9ba7, 0x27e9a524052f8865]),
+        affine([0x84dea9a1391e55f5, 0xbe23e357d4acb77e, 0x6013b2d7c82d12cb, 0x450c6ccdb163e139], [0x5f0e49d5ce2498b2, 0xb63a4f0e310a19ba, 0x6f63f0178465ea36, 0x18a4641d05a0e69b]),
+    ],
+    [
+        affine([0x7109eb0e2f4595f1, 0x94354ba3d31cc417, 0x254bc3e556bea691, 0x71ffc3bea945f71c], [0x5cd2fb08e48395b1, 0xadbbe8dad162abae, 0xa6df4cb0e6454830, 0x3bcfef37bac3062e]),
+        affine([0xc884c30e251106ad, 0x9cb64a40f0531da4, 0x2035f93043cae53d, 0x500d62ce6d876cad], [0xfdf2c9273777a996, 0xb739ea0184d5361c, 0x733a65fc0fdfa1c6, 0x37da2ac597665560]),
+        affine([0x6fac55057a30fcaa, 0xdc52cc48ec97f56d, 0xca899cafc5eccb8b, 0x15bbfd776ad80e08], [0x28ad5698f909ed7c, 0x2600763391520b66, 0xe43c8ad1e70a2eb8, 0x2a2b8d5ee9ffb16d]),
+        affine([0x1c1e0d5ec951790b, 0xf2c400590c8691c9, 0x036971eefceffa64, 0x50d14f7c965c8ab1], [0x662412328ac1626b, 0x9764c2c07578e5d3, 0xfdbf2c7284e20720, 0x2ff3f481843677f1]),
+        affine([0x72bf85186292259b, 0x10c98dac246a932a, 0x1c23a9325381d431, 0x31fd35b9cca88906], [0xd6317b0028e0a2b1, 0x0bec043c0dde3775, 0x7d2e74f7c3527578, 0x45f682cc7214a14d]),
+        affine([0x161a0036b1455b96, 0x6b269fc0dcae7ec4, 0x60b9e45197320dde, 0x518836c5803f5dbe], [0xa24b8613b5b80da1, 0x24c7250bfa38df1e, 0xad82be4c06c5a5e2, 0x47fd15c8669835fc]),
+        affine([0xb5224e93fd4690bc, 0xd9778ce3106542cb, 0x804c5b7e30d5d52c, 0x73b16c66875af1a8], [0xc004b277d2b82da8, 0xa896f1db949c284f, 0x4dfc7236aee9dd1e, 0x729273f77045db50]),
+        affine([0x03234a5dffa3bf3b, 0x96cce275f6d0d8fc, 0xb6d6d1e84b96a5a4, 0x37b837464454d3e5], [0x3ee5d61799caad48, 0x261098bd2fc3cf09, 0x6e9082bfd087897f, 0x6be8ccce8d42f7f9]),
+    ],
+    [
+        affine([0xb0bb503190656af8, 0xc5cf9b7e4a749340, 0x6be4f187cb0f8d96, 0x60f715feae92849f], [0xbdde7772d022014a, 0x754a3ef90ac287ec, 0x96ad37f38beb8aea, 0x058de7442a7fcc26]),
+        affine([0x32ebb85728912eec, 0x2226875144d833e2, 0x3ec2f5596e8f1115, 0x6689c45959ba998a], [0x725ae23ef2cfbb5a, 0x692f52ac1f394bc4, 0x2405172f5b18e201, 0x02f7663b69069eb7]),
+        affine([0xa1287ef0c6d90be9, 0x33e70c697d06a7de, 0x6ef7dfa5b3993d88, 0x5c4ecef1dba684df], [0xcfc94890a3998733, 0x6aa2aa38b9c370d3, 0x500913fccdc18fbc, 0x47523eea6c097a3b]),
+        affine([0x4cac99b673472b4c, 0x13f4a576d487d931, 0x918b1a03feee0a58, 0x6575379ec6888400], [0x87add26c624ceaf9, 0xbde6d788d8b80186, 0x444d5b939a646f2a, 0x0c66b53152825980]),
+        affine([0xb89b434e10a29726, 0xf20c915c6640785a, 0x5f00ae3b90fe9b1e, 0x3bb23b12a4c5743a], [0x06d181f1961f8973, 0xdc4109101838ffb4, 0x88704a507ee16fbb, 0x49790f257c6d6d23]),
+        affine([0x0a407a144636945d, 0xc92a5258c199507d, 0x08538e0cb3e1faee, 0x6cba6aa3d4016b85], [0xf9419605713ee613, 0x47ffec7dad18dad4, 0x3854b1a6a5277c4d, 0x26e8b1b241f12ecc]),
+        affine([0x342cb233c3556151, 0xb4d66106a604524e, 0x50a7b6cb2903d4d2, 0x6ae36b4905039c3d], [0xc1e9bf7fcd1bf70e, 0x63b247e09792525f, 0x48256ca181f247bd, 0x049debe95ac900e0]),
+        affine([0x32646195901fe998, 0x0228462a849ecd40, 0x94aeb393d4608e43, 0x284ed4173e779fe8], [0xa938ff2badedee21, 0xe7cec6f1426cac36, 0x2a11b13c75ea507d, 0x29cdb3693710ed67]),
+    ],
+    [
+        affine([0x2fd6faf2dd03c291, 0x40fec1eb26ddd6b5, 0xef06a9041eaaaa21, 0x264d4765046ce290], [0x791718aa3c754c41, 0xac3d63f4cb6d7098, 0xf30286e243b604af, 0x5a76e21519f4a32e]),
+        affine([0x1282c22474b17f97, 0x35eb2c755555ac02, 0x736169097e0643b2, 0x0c139af9f60e40ba], [0xb0c673b57207a1ce, 0x0d0d32454a17d384, 0x4868a6c5a271c625, 0x2057eb43a78b6332]),
+        affine([0x523925d69067dd23, 0x4361b1c015efbaac, 0x1a5bc3249ee4c336, 0x6627fbd5bd66948a], [0x813fae7ce72b499c, 0xcc0f0d8e17172972, 0x635831dd13bb18b2, 0x0892819dd98536a3]),
+        affine([0xc63f5ece3f3d6bb1, 0x8840bc6b8d277f4e, 0x2ddaf16625b5391e, 0x3120d82793b9fd6c], [0x36e0bc0b47a138e2, 0x2b33fe6cfc9ad4e3, 0x377ef3a6af46e243, 0x56aec818bbc792fe]),
+        affine([0xcf2935240beb5163, 0xef54b65658e16cb4, 0x870f348e9cb8e290, 0x5654a8cc3b8ce512], [0xa062385ea98d2c67, 0x8472333a1bbefd61, 0x29704ff63e486855, 0x58297d54438b3e0d]),
+        affine([0x29946202e9d07b76, 0x3edf14e3753df6ae, 0xb53ee7029bc2bbdb, 0x4a3d1cf9d261a2e8], [0xca24457e39924733, 0x540a1a670e17642f, 0x5ee8ac1caf2dcc0c, 0x470ef58da62a5333]),
+        affine([0x8d81eba614c4d396, 0xf166065916edd0d1, 0xb964d27f289fc717, 0x68312fcd1740ad03], [0xedfdf860fc152696, 0x7f3904f1ef6c5f0b, 0xdd25a5cd2f8ff05c, 0x3d8ec63fa013f8d1]),
+        affine([0x67853fbfebdbf05b, 0x83605f43c16c2246, 0xac76703349a1ddc4, 0x5e00975ac01497ad], [0x38d865d19321e492, 0x326d5662874caaef, 0xe8fee51e5db346b6, 0x57b312b3374c6774]),
+    ],
+    [
+        affine([0xcd8dad865c5aeaf9, 0x4fad81ff877525b6, 0x0116c9a6ea971d40, 0x51c705bcdb103b17], [0x1e3b6db2412c656e, 0x6b924de4da502bf6, 0xd176166ff8d64c49, 0x5428943e288abcc0]),
+        affine([0xd77854754722234b, 0xac6ce28d5a442518, 0x0aa3314522034639, 0x1c429b314678f297], [0xff51a635c8aa4644, 0x36900e6143d5feda, 0xf7c9f45a55b21243, 0x6e0997616ba9fd66]),
+        affine([0xdb4ded1804ba21a6, 0x31aaea6d834b393a, 0x32b98790dc41534d, 0x25d7cfa727178e9b], [0xa6562863669c1fca, 0xfa0cbb277c847e5b, 0x9e9efd6c43f0be9a, 0x6b17dfa3c3ae54f8]),
+        affine([0x929de61893a2f1c9, 0xe0b582b0e9078610, 0x2d60ffdbdd3cd69a, 0x46db9e2cda3fd82a], [0x2cf15d007f5526bc, 0xc84a5eadfc6527d2, 0xc658935276c08f3c, 0x0a6c919542fc3f96]),
+        affine([0xb9021dc747922490, 0x161a3bd960464732, 0xf62a5cd7562ee7f0, 0x65e8f098c74970ff], [0xc4661a6a81d1f2f2, 0x54bb0b1815ad414c, 0xd41d04f878607391, 0x310d7944053dbd2a]),
+        affine([0xbbb71b5a1e46227a, 0xb0ffc70a21684ed4, 0xe500457af64f7837, 0x14e7c36e88360557], [0xb431d06cc93eaac4, 0x6b32293f921187e1, 0xdf0542b384ae9d44, 0x6e2718b6bd039b30]),
+        affine([0x57fae8c4fff924a9, 0x83335c20ce0b5dd1, 0x95da1805b7830350, 0x4ea71f390ae85dc8], [0x43a781cbe1de1552, 0x0c8189bb54052137, 0x6dbd1b62014c886b, 0x72c4770240956cb7]),
+        affine([0xcf88dcbdcf7ef672, 0x23dbbdeba1db6e38, 0x01d7cf84a17afb3d, 0x0edaa8d3aac30464], [0x332fb73634c4b037, 0xdf09ef7e3d0edab9, 0xff2d9ba4a6f21645, 0x00de52fe389e104d]),
+    ],
+    [
+        affine([0xd7c86f9bac999b10, 0xa0808fb3f688f6a7, 0x2111fc2e02b88623, 0x3821eea87b9f34a4], [0x6cecb743a1fec3c5, 0x7edd9a2a784becc2, 0xe0cb79c2bb0cc0a9, 0x33d9ed22ac0bc89c]),
+        affine([0x0413b5ab2c407568, 0x1d4b742bcf6fc3b2, 0x53eb6f2c071f76f5, 0x33eda14b8e1ce201], [0x2decfd2f277b4dda, 0xe454a978478ab281, 0x99ac4b8a3de02f12, 0x1229a713ef40b0b9]),
+        affine([0x69f6e6a69c184e57, 0x197aa2d8420448fe, 0x735350ddfb668910, 0x309b5e9314cca729], [0x1c7cac960da98fc6, 0xa58e9f4ce9874574, 0x649e5e218c41047a, 0x25b39e8a94369d06]),
+        affine([0x193034baa5810fa8, 0x4792d7ef100e7335, 0xf731b39dfa3d30e4, 0x039f335496b8ec11], [0x4f8adec1f1f4ddc8, 0x9bc99e3e091ee0e8, 0x7a8cf0b5bed19ec2, 0x2e25071d3fe83284]),
+        affine([0xe45ad27a8e990556, 0x301e652a5bd1bb71, 0x2aa97165d8f87aa0, 0x1727d0409e6b593e], [0x417292373ff82122, 0xf17f64da850ef7a4, 0xdcab06607424518a, 0x56c0cfeacc809b1d]),
+        affine([0x6fdece931bbf6c2d, 0x487325c5660100db, 0x81cfb2bf6a030106, 0x2333b3c85973e718], [0xc3cef35a81ea357a, 0x5faaaeb0d31137ab, 0xec844cb8c1346b1f, 0x6db8ca5af3e6e237]),
+        affine([0xe5dc65cf2db5d4ad, 0x6ecc4fc4dbe1e1c4, 0x854ef1c34451ac74, 0x66472a0c80fafe4a], [0xc2b06f211760482e, 0x2ea16c8a6325a17b, 0x7ff521fbe35a7096, 0x73b340cc7a991690]),
+        affine([0x74d0f3bfeb768c2d, 0x9a372e78eef3f355, 0xb4d54216e03c021a, 0x6babe7134063e6c1], [0xf53d88ddbb486503, 0x752d18ac8c2f3eb7, 0xba96100974b24dbe, 0x418320530cc1b9ac]),
+    ],
+    [
+        affine([0xb10c7936b1dbc362, 0xb4f10caa5122d8b8, 0x91bfd9744239c574, 0x2ff424c7cf3d0dc7], [0xe522fb2132ecda75, 0x8f0dd5caa04c5bb1, 0x3d4c9cd8ad3f3753, 0x0acc069a3d0bb4b2]),
+        affine([0xbfdb1d64c7e24b26, 0x716220d6e1eb8e4f, 0xea3665bbf1203cc8, 0x72e926c98ac59bbf], [0xfa2726107fba7185, 0x8a338eb4001e43c8, 0x5f7f7ead402c2ce5, 0x71966358f9ef64e4]),
+        affine([0xd579c13e9cc9da4f, 0x910ed1875955b3b0, 0x02e715962e5d056f, 0x67c126451c47ab49], [0x1b47f938238cf235, 0x879e09e9c6de4d31, 0x8c056fc3d1360d61, 0x4e74bbf01bac7b14]),
+        affine([0xcb725709074837bd, 0xb6ca32f78cd7133a, 0x97bbd6a5f85eeaaa, 0x6248c48f5d4049f5], [0x2578fa7054a05e49, 0xdf7ec0c8b514a0ab, 0x747643758ee4b06d, 0x717e27bb8fb414e7]),
+        affine([0x1d3002f6d1bb12b7, 0x70706fdf875be0c3, 0xc0695ddd892e148c, 0x07046dde3deec9e0], [0x51004953d0a94105, 0x7fd237944b7508b3, 0xd735e0d0c678f5e7, 0x4e6e9f804e191330]),
+        affine([0xf6c45bc6aee224a1, 0xf09f494c3b4fdab7, 0x19c7d9f5ffb39c3f, 0x2376e0bf22d3f03a], [0x525724ece9be868a, 0xb3d77f6dd9b65131, 0x8e3ec728899e78d6, 0x108fa623ac2f39e7]),
+        affine([0xcb8fce055c6ad17b, 0x4c7b2783ff374c65, 0xf1c28cd8b395c84a, 0x7249cfce9802f960], [0xb8d65d662ef73250, 0xcbb220677fcfce52, 0x0b7671f4c6592296, 0x5402ea96e7ee18c9]),
+        affine([0xca76f5e1aa3e62c6, 0x9d2b9b3286f43a32, 0x8475ef5f415a6086, 0x255b44dac83ec66d], [0x959b2b59f0a1c4d4, 0x8dc4186cc54cb2cc, 0x692bea4b4e3386ae, 0x084ad5066a8d7f49]),
+    ],
+    [
+        affine([0x6504db1b68fb64dc, 0x332a24896574dbd1, 0xf6bc85119dc41cc3, 0x3dd6477d9af58c01], [0x8e9b276e28458c9b, 0xc96f65c1f2d46a0e, 0x8c017868ba5ed5fe, 0x39a3a29c23169ecb]),
+        affine([0xcbd23e7d7e4c1412, 0xc3276855772d94aa, 0x14ce37f790509ca5, 0x264e2413ebde295d], [0x6248e4ce48076c25, 0x430aa919e29e2289, 0xe00012c936ff12cf, 0x5a2bc53ea3f7b26c]),
+        affine([0x0543cc817d372134, 0xdc196554886e9681, 0x84e5d0e1f50d2a5c, 0x127a6ad993fe6f4d], [0x70431c4aa7553285, 0x19581654b565b4c3, 0x3508708e3346f851, 0x6ba998d6dd42372f]),
+        affine([0x9b857a452b5c9c81, 0x8644dde52ceb25ec, 0x3d118cc6d9c17504, 0x397e9ba4c060f7bb], [0x1d8362b93ae22890, 0xd2499e4a40ed9c24, 0xd05ff404ab4fa279, 0x5b796dfb93ca78fa]),
+        affine([0xbe542b5b09e769d9, 0x245ba76c4dc8efab, 0x11e1d2f6d9ab2246, 0x508980ed8d46a4e1], [0xfe221d6eb8e8402b, 0xe9afdc3c1f9773b4, 0x8be9f9767746f459, 0x158a62c7b84feefc]),
+        affine([0xb58be0a298cd310e, 0x05f2192cf4c89ba3, 0x50330c3575b3eb6a, 0x4e622439a81a1acc], [0x3947e0e0fc7320fc, 0x4fab00aaa39ba21a, 0x93cf9fb1fe59db70, 0x3cda523132d6cf22]),
+        affine([0x409b37485aa8a75c, 0xc777e134f0a7950d, 0x1d941772666338b5, 0x68aea6d3dff3eba2], [0xa76306f00a1c637b, 0xecea46a9a03e13a5, 0x534d5c39e58f1b2d, 0x5ef507f786ef6453]),
+        affine([0x2a0e4afe10d5e07c, 0xb5672ecb7ccecc10, 0x9ae34c184166494c, 0x3341154330559018], [0x3f9f08a694a7ab86, 0x2c79afc21c21ce67, 0x8c41981505201a00, 0x620c0e29762aed71]),
+    ],
+    [
+        affine([0xf35ff8efa7ff4425, 0x97b59ab9e2b6e31e, 0xa301c560f4f69b0a, 0x3efba7cf6bfab756], [0x2e4c50e9c6b6fb93, 0x7d554df71055dadb, 0xfb676d8c19a1fd62, 0x21daeaef9394e27f]),
+        affine([0xe226d4fa13433fb4, 0x9245f7597b82104a, 0xab97258ceee2e2a7, 0x6918db1f0f455a42], [0x1d877a047b7ab211, 0x3e5c2fed5069f5d2, 0xd3e33af950e2513d, 0x6bdf7b7ec2ab254d]),
+        affine([0x548451da6a9598dc, 0x823aa8c69931fd2d, 0x2301445cd7194e44, 0x5635f13e680a267f], [0xcd6dae1a20875ac8, 0xcb2745cefab2d251, 0xa1ce6df684b7a2c0, 0x69c8c20e5f6d385c]),
+        affine([0xd6fc09e01970b9cd, 0x1f0ca2aefd8c881d, 0xf5b77f2e6536f1be, 0x03a0ead1b28f5fc6], [0x0b9ddb563e9f6399, 0x1e4e777205ec2c07, 0x53bb7b1ecd352a2f, 0x23e3a2505f49e909]),
+        affine([0x1dd2b4e1595241a4, 0x4dc7dbcf6a6fd852, 0xa9e3aff34f37b33e, 0x54e65ba40b78371f], [0x5a2980115262c2bf, 0x71d6b621249d2f7c, 0x692a20bf4d168e89, 0x3fdf71e93503c4b5]),
+        affine([0x7274ea1b023a9eec, 0x3a473e0114753b9d, 0x494b6ffa99e46ec2, 0x68289486d6eec656], [0xe983fbb06e861de4, 0x6a8a7994d53340e4, 0xabfa7f45b659f2cd, 0x38b8ffed2fcf9be9]),
+        affine([0x349bc02305eac0da, 0x6afca043d90e991f, 0x412fdac5fb96c208, 0x4355b15998085c24], [0x050bc12081aa9075, 0x8cbc1fe9e75c132a, 0xa39746e61d9b12e6, 0x6b3b83771f8a6952]),
+        affine([0xfb8440b01b321786, 0x6c0da11cc5caa489, 0x09b09fafae85a69d, 0x3c9234802fd1f879], [0xf304a25d65144843, 0x23a8fa425196bbb2, 0x3e2c4176c7ce59de, 0x635c17422c263d6f]),
+    ],
+    [
+        affine([0xc9324d4afd1fb826, 0x565484020eaf5489, 0x97a7614d9b4e26a6, 0x14b0887940ff2aca], [0x975f0ee21dad53fc, 0xf336d4e6c5e0d9bd, 0x21d087f0ea60aa32, 0x3e70a7e0cd275246]),
+        affine([0x13d523220d44dc61, 0xf61c96e0d0572e52, 0xab2a354a9235d308, 0x15508879f8828c0a], [0xe109afa4b698d495, 0x71ae49153b86a0ca, 0xd5fcff16adaf0677, 0x4ba275fbd20cbfd3]),
+        affine([0x3b72ebf44946c9f6, 0x221dbc261face37f, 0x482451454b8aadc5, 0x1cefab29db995679], [0x908b483cf268f158, 0x8289545999e92123, 0xd802637816a93912, 0x3f08eac717319499]),
+        affine([0xbd801bb2754f09e1, 0x94980a2b0c387716, 0x5311f69eaae5511c, 0x33844dc283541695], [0x9ff4b2c0969f7360, 0x715f6b677c8e955b, 0xf18dd55d6bc461f9, 0x410837b0d7a2b6a5]),
+        affine([0x79602c0102e39456, 0xb3644df53374316a, 0xf97276bd508c8d6f, 0x0a99b0ff7d6bc677], [0x31b037b742fa13ff, 0xb5398eba16b5d15e, 0x51a4bdfb4d5ae88b, 0x139f97a04186a6d2]),
+        affine([0x1603fc88e556a412, 0x39070c2fee0d4136, 0x13b753d92146ae93, 0x0680db68de86ab7e], [0x5484acaa096d8ad9, 0xf18d9600d16bb65f, 0x39262ab40293109c, 0x4e7ff12e709808a0]),
+        affine([0xa778f32732df7efe, 0x8057eaf9ad85076f, 0xbba6977e4e90989c, 0x21f88eb81bf105bb], [0xdbcd5d2d7dd1a9f6, 0x6d0172416f6ffb6b, 0x2233d5e72290d9c6, 0x4a3dea73fc68f3ab]),
+        affine([0xe42d95c5477a3967, 0x43d0b65e69f7c144, 0x00261fadca254247, 0x40d65729d767405b], [0x6b7d0369e8065eae, 0xe3ab2eb4f06afd60, 0xa199b0d105ec1f5a, 0x5bee4addfa541d13]),
+    ],
+    [
+        affine([0x4c71c17e46c9d0c9, 0x5d21edc507f0b4cd, 0x37460799c668ad26, 0x7096aa2459c77495], [0x6651978cdf12fdea, 0x4cc74532f87628ca, 0x5dcb0b1a72f01ff0, 0x2f60db1c65673180]),
+        affine([0x971089b6acc2a689, 0x2f1899fa440453c3, 0x6c3866a92acbdf3c, 0x0bc890d2ea406a42], [0xe2f08ab7c40b5b14, 0xae612648bf242586, 0x93a385115c9e8260, 0x13588d8ae2c4e7c6]),
+        affine([0x30aea39d347e3944, 0xb0320d4ee0773bc2, 0x642b62703c55317a, 0x230a1dbfbced273c], [0xb87d53b0480e7108, 0xa33ae67391185c68, 0x5ddc47217301a0cf, 0x15a29831017f2605]),
+        affine([0x8af8fde31e9053b8, 0x54822da652951ac4, 0x1ebd2c28497957ff, 0x3da6c58bc714e36f], [0xfae15f7c226f6f29, 0xa781c2aefa92e53b, 0x777c190d4e436f29, 0x6b106054d7f02a9e]),
+        affine([0xfb483a5e91e956ba, 0x2e73bc6a743a76de, 0xf642ccf6cec6f3bd, 0x5e794a05d167ac2c], [0x57446aabbd263cb4, 0x2d7c361a9a6f7f2b, 0x50bf11e5dd41df83, 0x2a498b26461c7bb3]),
+        affine([0x8e66fd7ecacd906b, 0xd9eb861e7536ce3d, 0xa2ed300642e80afd, 0x5b76e83a8d1385bf], [0xb5a7c93bb9522ed0, 0x5f8df8feb5861aa9, 0x8ab378b6d8661d40, 0x5a8f9dbe3226d6fb]),
+        affine([0x347e023b951f25e3, 0x87a4845581225813, 0x2a93207a77fa9cc8, 0x02f61f63fce76a5a], [0x881d04f65e4b90de, 0xd1eae865937a4abb, 0x5c34cf7c62b2dc4d, 0x16703c66cb423d1e]),
+        affine([0xe6b0249253c00b68, 0x9e559cbdc9add758, 0x814087e797aea481, 0x52df7af7f6a035aa], [0xe59ac2c38a3062f9, 0x0609eab53e483af0, 0x42e3c10978742974, 0x1986e2e3d7c53c4d]),
+    ],
+    [
+        affine([0x6eb58f8187ef7930, 0xc5b658ee39cf3c74, 0x4b2ab88a75e299d8, 0x3e7ce01c252cffd9], [0xe430fef1425d4fc6, 0xe3bd7ff5fa14ad15, 0x7711a765bf4b6fa5, 0x268d3ff440066f84]),
+        affine([0x7fd8c26273ce5816, 0x52ca7579b7b31b94, 0x4c1f2c77a19ee6a6, 0x4da5daa667c2dc4d], [0xd3d31b10d2acdd33, 0x005741abadb8fb54, 0xfe5a3cb017a7f8c6, 0x728c044fbe1dc7b7]),
+        affine([0xe18a03704f9fb6f1, 0x4f72a8cd5b5c1dfe, 0x923cc951fec3f4c5, 0x0bc5e6ab666d99b4], [0xad8b3e3b5e22220d, 0xc1281cbe47b7d04c, 0xa4e84a56c1214e03, 0x5cc3a8e1374d46c2]),
+        affine([0x6dd4c1b728bdb54c, 0x00921d05c3c0520a, 0x209b3f78d3023889, 0x3d5756ffe93a53a8], [0xb398ce1c8dc63a47, 0xd9f6ea246aa01479, 0x7d9d2d896886df34, 0x6e92b6dc246706b8]),
+        affine([0xe0bf2f0b0c9a9fe0, 0x994dff1dc951b1c6, 0xbda6a0f13e8eab74, 0x2a1906fe9dc82296], [0x55ea6ce5a93e4128, 0x406a1ea05aa7dd48, 0xe20569fcdba6c163, 0x5c8c43cb1d7013ae]),
+        affine([0xf31820df54312252, 0x4745e6562e203b9b, 0x130d7e6085dba720, 0x734ea12c5093e866], [0x4fd80f9726a3363e, 0x9c343245400447c0, 0x394609e103a7b879, 0x238e0571b6839d9a]),
+        affine([0x22cff0f8183b9a43, 0xd3df8e7cd1ff589a, 0xbc644ff16f3348a2, 0x696767e253734f29], [0x629d14c7fca37b9f, 0xaede014a63a97401, 0xe53c37d1537deead, 0x2dd4ea1b816781dd]),
+        affine([0x7e43626f1cc70a58, 0x0712b334a38d95b2, 0x8f2d2c6896082cab, 0x0270c4bd37429316], [0x3253a15d837ad198, 0xbf489755d3cbd5f4, 0x55ae15f2d2d5358f, 0x396d8d11e6a1be1c]),
+    ],
+    [
+        affine([0xde5665e23e314039, 0x941714e9ee1409a7, 0x81e3e10e1baa3b3b, 0x57440354a0344202], [0xdfba988f0eb68a8e, 0xbf20332c2c3c7054, 0x4f003789194aaa44, 0x51769874fb2f79b4]),
+        affine([0xb31e86d44416f4e7, 0xbb836086dbcd41f6, 0xd8830304088dad0a, 0x2ee282ac7237a527], [0xa0a455c6414880a8, 0x1d907a486c16fd38, 0x65fc3aa7ef805017, 0x11a06e19d425dcb4]),
+        affine([0x6334952154c6d6eb, 0x7608b70398f7833b, 0xf559b51e3f2ad5ac, 0x46e52f0cb0a659df], [0x6eb9ed189da0e450, 0xb0a86bf58a731da2, 0xb269518bda4ffa95, 0x1c13b83f8d484a52]),
+        affine([0x50f7cd5236da63a6, 0x3c9b54f18d5fa940, 0xdb969a5032cd78a6, 0x50916feb2a9a6b2c], [0x59687ae77d6aeaf9, 0x929968dda6e41278, 0x6a344e2c89a2e093, 0x2507d7aab29c2a07]),
+        affine([0xbb6c91e52afcd250, 0xd7f99eb99f4f1270, 0x05c1e1155633cd05, 0x41e2ff085fe9ffc2], [0x57a639a13a46bd0e, 0x46f6b9b31743f020, 0x35dae575a9558481, 0x1f3ee53e00cca480]),
+        affine([0x3a24ce45ab8fcbf2, 0xd82014ca03ad74cb, 0x0281e9e1b62ec678, 0x0a79075d1ea77e9a], [0xba42af85bc3230b8, 0x70cc1b5e2b2dc43b, 0xb3440ac423e483d9, 0x3f3ddff36cd8829e]),
+        affine([0x71efc3975be0ea25, 0xe9bd053a91e1cf3f, 0x8b1bab95d37eff16, 0x5427db171c77eb00], [0xf3845023671b8521, 0xfcd62030bada77db, 0xd0c544354c928602, 0x61f3e71b5da34f51]),
+        affine([0x2b43c7c5b4fc6641, 0x2604978373cef2d0, 0x8d4c20298c9a0e10, 0x32f9238dc842b68f], [0xedc09b44cd203e63, 0x0edf183a2bec0973, 0xfcbe12495907c7c4, 0x1191d13acc0f9223]),
+    ],
+    [
+        affine([0x23dcf2a52ae0baea, 0x00a1f974cb70477b, 0x26b501d293926616, 0x3fdfdf312e23f76c], [0x920046af452bf7c4, 0x08ed6e430272ddad, 0x4433757cfb3618b9, 0x246a64ffd9702bbb]),
+        affine([0xe78a1d290678c387, 0xc3587a9f65603d48, 0x8049bd5434a49844, 0x5b9555f01bb0fd23], [0x1fa3fee6465d932b, 0x7fdf84a082775c84, 0x42cc1e68a2a0c2bc, 0x4c0d50659ef4984e]),
+        affine([0x0deca2980ef4f672, 0x3cd6ab8f0b4b5da9, 0x417fc086f86d7cac, 0x29b0dc08c143004f], [0x4e7bd09293203a16, 0xbe93e46e86471c96, 0xce7847a1d5ccb058, 0x5a1e0a374b49df18]),
+        affine([0xd7c30e844ea6d181, 0xeb881001b8b5bfb8, 0x8a3510a060465b16, 0x159759c0b8501ae7], [0x066b7c8d3b901818, 0x2667edf222861622, 0x00e46465f554522b, 0x23af1071af7f8005]),
+        affine([0xbdeb56a14147b167, 0xc6545c6b40aa025b, 0x256a82a6949783cf, 0x030db5952d42955e], [0x4310752127a3fbf1, 0x53878372f12c7fea, 0xb9a3a0148534c21e, 0x583bbc32a6fc23cc]),
+        affine([0xf7c36bf74094bee7, 0x6208ec2a36e0e221, 0x1adbf5c2848c32d4, 0x2259c364d86d944f], [0x538c08021d1d567c, 0xf56a596b4f83a5b8, 0x10184d7996929bdf, 0x09170bb87b796ded]),
+        affine([0xd1b989670cb01ae6, 0x2f40a0533379491b, 0x1923be75a4f619ad, 0x2e4312eca4e50df6], [0x4ccf1e5b55bdc157, 0x345025bbe246ed5a, 0x2a98018b94c6a928, 0x21ded3c6b076dbae]),
+        affine([0x7738f2ceaf99f466, 0xad0ee64ced877cba, 0x3eb41073e3d944c6, 0x2a332f98c96aad8f], [0x8d4fe2b2e6e00ed2, 0x76222f3588ac4dbd, 0x328aa1dfb5b6cd93, 0x4635fe2a70d7e918]),
+    ],
+    [
+        affine([0x504f05b3916fa3f7, 0xb070d9445fbe52e4, 0xc312ba2e3e037755, 0x1036b0dc0863ce49], [0xf08030b0720a2ea0, 0x11484c77aa8414e2, 0xc60b9baf594ba0d1, 0x09ee524c8bf3db9a]),
+        affine([0xcc81db861f5ab29d, 0xe408bda650874fdd, 0x85017b2b85980271, 0x3404e2698019965a], [0xb45d5a51a000a74c, 0x4939eef3c814f971, 0x4435dabdb6a62052, 0x69dd5754497f020c]),
+        affine([0x1eb78dc878242060, 0x63a83871c381f09c, 0x6295bbc73525589b, 0x0d231a14e4c891b8], [0x60649f0123e27d9b, 0x6a7d95bf3cd8dbce, 0x85b5c0dde4ceb644, 0x0bf2ea2842784770]),
+        affine([0x5bddaabcfceeb8de, 0x65b69f545f37b746, 0x8d81cd56992297f6, 0x0305db47b7110b8b], [0x74bb080883e4aa47, 0x4599b770f1863f31, 0xb1bd86b7caf347ab, 0x1868c7334b6defb3]),
+        affine([0x57b343e478da8b8b, 0x995c0b0fa1ebb80a, 0xbc0227eb1dd1f3db, 0x4208c731e226cbd4], [0x9758b1df964632e3, 0x1aad9c7a3d609158, 0x955d57055b2703a2, 0x57b70a54b3bed081]),
+        affine([0x651f951a51aa8fa0, 0x925a136dc535b44e, 0xa12012045acdb3c8, 0x286bfd9c6aa7dbaa], [0xe7fb9644183e9e01, 0x26a3a6248305c021, 0x732ff92d8fc23e49, 0x1f6833bb6bb1a34e]),
+        affine([0x3abfb3e98a829154, 0xf4ac3a7766e34518, 0xcc9157fc208f5845, 0x4951a4b378ab3dfc], [0x4a94ea75c1a5c1c3, 0x50a21a4110afc9f0, 0x5b2e31a14b5ea695, 0x6e573a5c7a23940d]),
+        affine([0xdd5a0bb4fe347e6e, 0x479e2e021f71dc69, 0x9f9993c1136f5f9e, 0x16759c5c9a18c02f], [0x916803bb102e4c73, 0xc277aaa0040b28a9, 0xada83b0152316fae, 0x47758a912e36b1a7]),
+    ],
+    [
+        affine([0x8740ee89e4632395, 0x8a904f98bcd74b64, 0xd16ac85e40097b0f, 0x02b2164ebe8aa778], [0x35d8fabf2454571f, 0xe9576973807de737, 0x6f6760824493fe77, 0x5f628b2181dfd59e]),
+        affine([0xac8d7c13d4117680, 0x12787c3313c32ca7, 0x640521e891705915, 0x1f1cddd2e787ca68], [0x30625887ee099632, 0xa277ff377dd3e663, 0xebb18bf6c36caa58, 0x0d08a5cdfe77084a]),
+        affine([0xf6051a4a41fae6aa, 0xfb63fbe260f1b5b1, 0x55d5cecbe12e8c1b, 0x08a46417786c0754], [0x929bf9da90f31638, 0x58680f42c08cec8b, 0x7f535dbd3b1836e1, 0x468ac405e6ee19bd]),
+        affine([0xe973356ba12e9c96, 0xd61460576cb2de39, 0xfc8cc2abbf033a41, 0x690272dec30bf6b4], [0xbceefbc2c69e63a8, 0x1b9934c527e5a7e7, 0x24c1b3cc93ce6639, 0x4171c920a556be6f]),
+        affine([0x0d5dfdab8f71333f, 0xe87589e71ac53c8a, 0xbb6e28d458a62f85, 0x35d81ddd4092aca1], [0x450067f53edafb05, 0x1c33bcbf3cac1340, 0xc767b3448164ad8c, 0x527f13828a8756da]),
+        affine([0x087e786de7177be1, 0x0dbb5d77a1b94951, 0xae58c8dc79e4777f, 0x1d4ae594791888b5], [0xa8dd3102f61aae13, 0xb068a25ae124307b, 0x73ab83360e2e1bb2, 0x5ffabb98b1b076bb]),
+        affine([0x02815e414d7f1f53, 0x6e71ed491595404f, 0x7fa70a356ae85d61, 0x54e149169afca010], [0x379994191ff1f5f2, 0x64d2c44e189feedf, 0x5824f0c27774fa1b, 0x2ce169936de77275]),
+        affine([0xf363b127e335b5a4, 0x1504f2236a1442b4, 0xfb17a76c2009aa12, 0x4a779ac3a1115a26], [0x57eeadc0667cef66, 0x863c43343bc325e5, 0xf18c9dd096f053d0, 0x16223cbf5c8e7941]),
+    ],
+    [
+        affine([0xb1983e6533a13852, 0xca357b153d17ef3c, 0x70beaf1f3cc7cbb4, 0x4f5b547396a60f7c], [0x46c7779a6ab4d18d, 0x056dc811c9d8f384, 0x7305a6b09a86fed0, 0x1fe2715760fad997]),
+        affine([0xd2878af2fa5851f5, 0xfce8df470f025ad0, 0x5aae0fa9653910c8, 0x422d0a0b6960184d], [0x35a43a97c2c5dca3, 0x60e9cb5f70cdf55b, 0xaa92706427cd5182, 0x6a21242051ea40b6]),
+        affine([0x20c96bbaa2b638a1, 0xc4a82409a24d8076, 0xf707ea215245a9e9, 0x1163d74d2e90345d], [0x2bf06d441fa45b4b, 0x69c9468ffe4b1d56, 0xa85631c0422b1fd1, 0x3ba4500852312017]),
+        affine([0x10ce226a5670d7f5, 0xf46f2019176ab1c7, 0x8c4a64812c97fe0a, 0x2e2ade01b500239d], [0x0b5d4379ffb0b9c7, 0x95f7c4d0945b574f, 0x26469e3f44c5e5af, 0x57130d74b169aab8]),
+        affine([0xde9ccdc2657162a7, 0xc24726085127632e, 0xf2e0d9c628d76e5d, 0x713757fc9fc0bdf7], [0x2a5c8f169c4f0b00, 0xb0df2679f92f6ea6, 0xc3e347e1a10aad9d, 0x3e46e6f30cc3fdf6]),
+        affine([0x0ad789ba0c5be104, 0x8b672e1e4d3c9961, 0xe295988e8ca4b9fa, 0x22fa74e43d802970], [0x1840fca4d63f29bb, 0xc97be9d3477cbfb6, 0x5db8cdad429e55f1, 0x68186de0926d0cef]),
+        affine([0x21a157e7bb286224, 0x396439113c6203ad, 0x0524988c186b8c53, 0x5402fe01c4c8a3fc], [0xe58e3f93104b839c, 0xbf965cd87b76e46b, 0x5056ab22ee066363, 0x6ca2eb55ad854e08]),
+        affine([0x8c9395bbc05d777f, 0xd67cd269ada04f53, 0x52499b9939306623, 0x29307caaf542b449], [0xe6de93e3dae2fbf0, 0xa5e9eb44ab7fc304, 0x5f9ceef24b5e26ac, 0x3afce381b541cb15]),
+    ],
+    [
+        affine([0x60595d3ff3c35cb9, 0x5da1870430024f1b, 0x875408b282075fd0, 0x2cf58e0e07d382c9], [0xc4e48a24d6b9d083, 0x72f1ad987e1daf3a, 0x558c133ea7c1ee73, 0x3b416a00b73b7d2a]),
+        affine([0x4f29dd50b2374bd8, 0x7f71ca5096e0902b, 0x47be5c57438f1296, 0x025b19cc73c0ecf4], [0x8148a2a7df37407e, 0xa960c0ce239b7ecb, 0x9ae80eaa384edde9, 0x13d70693c0fbde9d]),
+        affine([0x65fd81024b7bc14f, 0xcce3138bf621ebef, 0x75ed68592a362b06, 0x34aca28c9fc5beca], [0xb31701ca0f08c6bc, 0x58a962c11a5c7426, 0x62c1ab69c81102bc, 0x29299c006caa32b9]),
+        affine([0x67ce3a04e5f9175d, 0xcb7a8f057dcfc53e, 0x485162e21046cb15, 0x4707f99150ef47f4], [0x6f0b98b124baab49, 0xc4ba25c260dd95b3, 0x1f96eaadf1ef69b6, 0x6b1c1d0f871b5f94]),
+        affine([0xec47470e42dbc268, 0xfd6144b3481b5554, 0x3825fb2b31dda676, 0x409c8e4476e3c95b], [0x2c6de7dd30b419fa, 0xa68e6e91c2bc5a56, 0x6d6f5ce6edcb98cc, 0x2401b66ec9f2526b]),
+        affine([0x953d972e7ca33b97, 0x7fb526af1adfc0c1, 0x9f3c53deb533ce78, 0x60f8a65b76fc3f79], [0x6705bf2b6739fe61, 0xd82c3b42dab9ce85, 0xadfac46e38126377, 0x122670c9953431a3]),
+        affine([0xc3e60e29655877ae, 0x1706bdcdb537c22c, 0x7d6de93e1988afc7, 0x570dac5708b8e83b], [0xec7c416694aded7a, 0x343ffb09ea27ef2c, 0x5eff8c17311a9663, 0x42bc18b100b1a890]),
+        affine([0x8006fbbd359172fb, 0xb237c4fb221a78b4, 0xbe1757bc21fbf1ff, 0x105c84f2049ad1aa], [0xa39f4cf84aa4a435, 0x0c17d9d05fee788c, 0x68c88f358a95d418, 0x441a31e4a329ff3c]),
+    ],
+    [
+        affine([0xfa7cb43bb5205bcc, 0xf3910b7ffeee3122, 0x1d65c2e24c15a7b8, 0x082bd2a10f0ed3f1], [0xec9b7b13de9cfa1b, 0xfc2c4962ffbe038c, 0x9115d0070105c901, 0x1fb4c3410cfcb5d6]),
+        affine([0x0f1964efdc15da91, 0xd954a92914705939, 0xd8b64b8790d2d87a, 0x3c112cd23bc01f63], [0xfefa6a3f45639b8a, 0x58a1f1d5a679e87f, 0xa2fc36aa235a9fed, 0x4bf207b78f07c447]),
+        affine([0xcb84587118c36829, 0xa415fc52af37a913, 0x386ed9d3e5cfe7dd, 0x63f6d52c5c7425c6], [0x620b10f2e217ac19, 0x1c22c4348d7dcd92, 0xa3ddca420b0b9c24, 0x0a7336f910d7fb81]),
+        affine([0xc53851b906092306, 0x613f32c4abf64758, 0x132e015d6b83e9d7, 0x14ad3f14a7b2afa8], [0xd62fb7eac5fe54ec, 0xf00f5b6e9a4dee12, 0x3046838336944805, 0x40a3d1c087db9681]),
+        affine([0x67412840c9b37622, 0x29d78e16222c4580, 0x0689c2780752d39e, 0x5ddd0e1a4e4b3e0b], [0x1cd961f848092ffb, 0x6a33620ab37ededc, 0x2f9d0107888f3ac7, 0x219b1555d33e5a8f]),
+        affine([0x71c812eabf7271f9, 0xc2567569ec82d5de, 0xdc472b5421001a25, 0x190b90724501593e], [0xacd62ca6c57b1e43, 0xa275e472e471cd6d, 0x4c0e113e0c000f7c, 0x6a22668928b6735e]),
+        affine([0xcc1d77da62a52225, 0xda1ef86f9e1d5278, 0xf2967e3ed67d81e8, 0x1e75fe71e4c7e33a], [0x1a5c66e82561d515, 0x2766645ec96ee7ba, 0x83302586bd4260e1, 0x2e3fd7927931c51f]),
+        affine([0x4cb644cd3f220efa, 0xb4b6f9b91f1ca3f0, 0x05f0987dc40b504f, 0x228586d34f18106e], [0x264cc2771c52d322, 0x799680538ae4a8c3, 0x4041a15a2330e3db, 0x729beade05950249]),
+    ],
+    [
+        affine([0x43626d84361e4f43, 0xe6991d78cc1c751b, 0x19e2f335304e6b97, 0x6ad2e15c34a1ad13], [0x5cf6e68874fc4f2d, 0x7a46ab7f447b1cc3, 0x77e030604e8dcaa2, 0x5f482d78db1dbf64]),
+        affine([0x255c70b08ea48c9f, 0xc4db2a46561f5e98, 0x39bd8e7b5cbd13cc, 0x2d4c9d66906e0dc0], [0x1660d13e62b9cf60, 0x20544fb3c7097ac0, 0x9bd311fbf14a9293, 0x0a63439d7a11331a]),
+        affine([0x0544c9a97c737bcc, 0xca1f84dc3d347128, 0x2f09579b14a00799, 0x5b8e885ab1d4ebc9], [0xfc861e234915f995, 0x495ee8d8d62c1569, 0xf42ecc0ac2d69ac6, 0x3664df1ea923a0c2]),
+        affine([0x8b2b6e11135afbfd, 0x85c7f7699b612e9f, 0x4f20212b755e881f, 0x5094e7f63b1f9900], [0x6280398e6d9433f0, 0x0d745fbd210bcad5, 0x34508c6c26051d84, 0x60be461d8aa8c303]),
+        affine([0xb203056b13031e24, 0x4c9c7c671c14dc75, 0x5c1a16e7cfbf1916, 0x59f7f11d375828d5], [0xafcb180f5418dbe8, 0x760fdba4f2648b3b, 0xf82e7068a099a15a, 0x245c22ccfdf9dfd6]),
+        affine([0xdc6399c35d747556, 0xb3a5238bba1d5ba6, 0xc1ec99fe01614417, 0x1bf7e4aa6162196f], [0xcf7d98017f15d35b, 0xc82a39be93d7dff7, 0x6ab1d07b1ddccf92, 0x6bedecde58dcdbde]),
+        affine([0x657250fc95c7d08a, 0x3abe6aab1fb96a95, 0xcfd153882f60943f, 0x6070a1529e2f7df5], [0xd5feda54f3cc1b1f, 0xc492c45eb366b247, 0x944da13e1a25f34e, 0x314b261ef49cb80e]),
+        affine([0xbde59730c48626e1, 0xafa1b48b194573d0, 0xfdb126f5bc5ba55d, 0x7191e5d5d77584a4], [0xf0432b19a1ef8e00, 0x3d576e1cb7f7594f, 0xc6d95df2fe8a6b2b, 0x65f1cc51a36db07a]),
+    ],
+    [
+        affine([0x5e61ae9ad7ef62f0, 0x9491aff8b2066a8f, 0x7c2e71b728a0416e, 0x22fbf3b4baefa5e4], [0x3ac3f56cfa4d3394, 0x8d5c47e26199ebb3, 0xf2b906e2307719da, 0x31fa223146d0e6df]),
+        affine([0x0e4ba96d18bfdfd9, 0xe2748d932526d612, 0xc588d2ff8130bbe4, 0x52c8cb95f327f68b], [0x7aa203ad543c4dd0, 0x79e7f09286f1203c, 0x18dca6d6726e9585, 0x0427855eb75ef6db]),
+        affine([0xca719b442cd51823, 0x098f93c666364ae7, 0xdef5b8708ededd8a, 0x3486cabfd0e24354], [0x353907e2c17dde77, 0x266d8ca2f1c239ac, 0x2a914d7671769232, 0x028e1e63143d4a2a]),
+        affine([0xc1204811987991c7, 0xf3ff894814520606, 0x23e602187ddff823, 0x5baf0483ee392622], [0xd4f21d092161fb0f, 0xac45dcd59a8c2d65, 0x44f0f44f8f9ddd10, 0x1067651874c8fa99]),
+        affine([0x76ec81f412bda9ca, 0x03246cd1e5e52f71, 0x8ecce49c90721211, 0x580455538abec6c7], [0x525dd7d9895cae76, 0x52e77122eaa7c9a0, 0x711dcffdbcf7d3b1, 0x63aa6f0664c4ded8]),
+        affine([0xbd9a1715432e8736, 0x7a65e19b97ab728f, 0x2468c02f9bf2cf38, 0x6be22ce43d8abbb6], [0xb78d90fe6083e1f4, 0x9e73ac4aed649b01, 0xb0a396d6007003ba, 0x3441f540bd16aff8]),
+        affine([0x6a97d4b91670eb85, 0xa392ff5fbf84f452, 0xdd4aeae4c37dd580, 0x345412310f7154df], [0xd78f65b25457f157, 0x852a6911f61aa382, 0x664431dd7e30bb99, 0x3cba50b1bd7d705f]),
+        affine([0xc123397c68ac1d52, 0x8932a77eff8de01a, 0x84a754641daac590, 0x40fe1d51ee2196ca], [0xb7da2d81e6ed6ffa, 0xdfa943f6fbadb320, 0x7d9d1513250e73ba, 0x313bac348d5bd949]),
+    ],
+    [
+        affine([0x5193fe7eadff8e7e, 0x7b004a68b40063b5, 0x6a1dab61a3182ee3, 0x6ac095e498b8d624], [0xfb68413c231b0de9, 0xd97bfb9b53d302e0, 0xb5bba6b8aee33a9c, 0x105b55b90b051831]),
+        affine([0xc26a9ad674a3148f, 0x2dfeb4cc882a9965, 0xf8570094f6d542b9, 0x6582b42234405af1], [0x08da3d5a602499ff, 0x64af8704ecb4abad, 0xe976e5a705af0de4, 0x423f8bc21a596030]),
+        affine([0xc5bb69ded8d17715, 0x735d96f0bd50cf9c, 0x0d489f0e8479a2c4, 0x730510c0a12368b4], [0xc721520685478d0d, 0xc11b9033ad360111, 0x8ec28e838b70eebc, 0x023cc2dfb019019e]),
+        affine([0xd8d89dcdcd149f4e, 0x8ddab471e8cec225, 0xfd0af80a64e1aff7, 0x654a071675fcbdd4], [0xeac903bdac9cdeb3, 0xfe87f93c26077d80, 0x8d9d4d34fbf0e468, 0x13edbfa60225381d]),
+        affine([0xd798a2d370083f8f, 0xd44c1986c8a5d11e, 0xfb2865f47cff4dae, 0x37d444a262c54aba], [0x3bc4afbeae19751a, 0x16f0e9c1baa3fd7f, 0x21f01474db791edd, 0x163ac9e8f04b69ab]),
+        affine([0x9073844844ac01d2, 0x158851e6f6ab12a6, 0x14ea297a79a38857, 0x3733c7518b70e1a6], [0x65facd2a667c0d36, 0xd4c69144c7206eab, 0x46f65ccc619653ef, 0x37efac1b9268cf07]),
+        affine([0xfd61880508f90d6a, 0x397e1cd9d624cd5b, 0x8492fe563e062c89, 0x47dfcd95359179c2], [0x87f0df7658cc2fa4, 0x3cbc3215d5ea14d7, 0xd10c334c75c07ef4, 0x2da9e5716d38d46b]),
+        affine([0x5af230b0d32902ee, 0x59f2ad4875f039cd, 0x49efaf7c810bb1dd, 0x14827fceb71c5ca6], [0x07c57854de2b8f4b, 0xe38b115e1ccd824c, 0x599f94a718e6adaf, 0x63b6eb1d671c2033]),
+    ],
+    [
+        affine([0x38a20d1a00c2a441, 0xbbd49b809e6fd1a5, 0x3f64a0191276f064, 0x6a8a8750f7588409], [0xb51071fe1b6dfa2f, 0x3d7be2b6d5ce325b, 0xfb6b53b4bdfcf9f5, 0x410a4466130c607c]),
+        affine([0x4eac00cac95891aa, 0xe2c87765ded07b4d, 0xe3914e56d4421174, 0x68f49cae49570f1e], [0x5ca5367bc37b04a1, 0x40a85897edd957ad, 0xb49f51f7821135e8, 0x3f6198cfc6aa54c6]),
+        affine([0x00be7e5cffb47d96, 0x335825a14e47f77b, 0x85b8740e2b5f8e2b, 0x23bf7da63e10686b], [0x55f9925883b34b41, 0xef781f68c59a1b17, 0xcd92851618b2b941, 0x3a12c63e6d3b13cc]),
+        affine([0x655ba262781f0467, 0x6c8b2c7adbd11fcb, 0xc5e7be65ee2a22bf, 0x236158ef44531cab], [0x9e89b854b09fe87a, 0x001864138f1ea973, 0x55da2121fd427162, 0x1dbd1d1c8c9ddf97]),
+        affine([0x41a8f3eac9875b44, 0xef0d1ed4765298d0, 0x5039e51dcb487704, 0x4f420bdab2f5c180], [0xe5c524bb5a6736f0, 0x4016c925706df3b8, 0x970b7b3b45a51acc, 0x53da05cb180c2913]),
+        affine([0x2c07a2e236e20889, 0x8ed9fbe763383b71, 0x4ff16ac31e1475a2, 0x189cc2f25a289538], [0x4e1eddafc6322b4b, 0x6de6e0144b22f098, 0xa26650c55ca3abc5, 0x46a5021629e4fbb9]),
+        affine([0x8e50113d6df045db, 0x526895b4b3a785a7, 0x8209be5fec063bce, 0x451b5d793173b703], [0x37223ef213e9ae6a, 0x4dd1ca90ba1be049, 0x9db26d735bbd2a02, 0x0214a0843b146625]),
+        affine([0xb2cca430d1aa52a1, 0xb9e9184e9d31fe2d, 0x3ee5750123cb9a97, 0x4da41f82395eb6b4], [0x1ca09b6aa6e2b612, 0x939263d47d005af2, 0xfd16053b0c91f4d0, 0x38c95f94c10fea1a]),
+    ],
+];
+
+#[rustfmt::skip]
+pub static VALUE_COMMITMENT_RANDOMNESS_GENERATOR_TABLE: FixedBaseTable = [
+    [
+        affine([0xdd93d364cb8cec7e, 0x91cc3e3835675450, 0xcfa86026b8d99be9, 0x1c6da0ce9a5e5fdb], [0x28e5fce99ce692d0, 0xf94c2daa360302fe, 0xbc900cd4b8ae1150, 0x555f11f9b720d50b]),
+        affine([0xa82c8e1644f3bc3e, 0x9183cd70756667df, 0xdfe3be3bce6b6585, 0x5e6c116432f9304e], [0x2efc72d83ea3d571, 0xac486a2855327dde, 0xf7154ac7ce955231, 0x648e3c362fa74a8b]),
+        affine([0x1e768a6557323668, 0xd2a92aec1d67cc32, 0xcc6aa4f505d550b6, 0x2e9b166328245f41], [0x737fe4a9b1751b8a, 0x53a34607ab5e18ca, 0xfd706744742e656a, 0x02b4bf18526b202b]),
+        affine([0x0c0fae1524ab73d7, 0x6626dc96460e0b24, 0xfb279857259916dc, 0x0617cf08dd31ab57], [0x579d60fde22837e2, 0xea6582577d346af8, 0x9a39f23b90546a91, 0x0fda8a0e32125e37]),
+        affine([0x3076a2fc42aa26ba, 0xe9a3250f9e29c993, 0x08b1c696bcfe667f, 0x2894f12bf5edda1b], [0x507dc456c1290fe0, 0x159652b740af026a, 0x47ba166066ad1997, 0x36f4b36d8fa308e6]),
+        affine([0x4176b647dea7d965, 0x9428bc5f1022f637, 0x5564f749386fc350, 0x737617bfa0680959], [0x76464c423a02b72f, 0x794396cdef1db5f2, 0x6e4d403e434c1cb2, 0x02e385939d8027bb]),
+        affine([0xabd2dfbf299633cb, 0x5e63caf9754ad785, 0x3e9181ca7e2e4234, 0x6cac1f6dc9458de5], [0x6ddbe2c17847cf65, 0x371d3e55fc473314, 0xb88138fd859ba587, 0x64aab5880566c220]),
+        affine([0xb111a4ccb3be9156, 0x9df0bdec3184306e, 0x444615f355ead7e7, 0x064ee65b9f75b2f4], [0x93942f14f0ee220e, 0x19a5bf7857e4ba98, 0x9dce83746235fd9d, 0x64e3bac637aff6ee]),
+    ],
+    [
+        affine([0x9d4055064e978a70, 0x0cc07ff6a930a293, 0x209d265103b6cba5, 0x14d4cd03e1050770], [0x2507190411296b68, 0xc103d315792d2b65, 0xf7113811f2b14b80, 0x46d2e01140f4c3e9]),
+        affine([0x5265f7c794a3092d, 0x3ce03df474b33c12, 0x925e988075da6bb6, 0x533face44971c33e], [0x0246c5c00ddd08d9, 0x52801e9fec08c0fd, 0x86ce6cfb83796430, 0x6afe233dcc833203]),
+        affine([0x4c8057dd64fee9c4, 0x843f3c33f9f8fed7, 0x65ca35a2b92860cb, 0x24cff698c58b1365], [0x37a0987fa1a604ca, 0xd9b3d4b1a20ae3c5, 0xb7fced5ca49c5218, 0x1d8f53a03b04ab8f]),
+        affine([0x50ae69beb6effe83, 0x538aaf146eb86517, 0x90c928313bd3f6f4, 0x5b3f750414f0fe86], [0xe306b32ff8e30c8e, 0x84d48aa4964035a9, 0x18959d88e03b6692, 0x0fbd2beeee21d7fa]),
+        affine([0x4f1fa34b7fe9406b, 0xe8176a2007de3b0c, 0xf0abb5443d505bcf, 0x39ad16f44bcefb6f], [0xea7582beac9c3166, 0x1279694bb1ca0b57, 0x698f334acbe0738a, 0x0d8de00d90f79796]),
+        affine([0x41a634e1ba12d8ad, 0xe999d4dc37f7176f, 0xddf6661288cb0832, 0x5736f6d7d42e46c6], [0xd818a226b9f375ef, 0xadd7ee04958a10aa, 0xf60612437792a56b, 0x0c8ed51233fafa92]),
+        affine([0x1155f591d09e1974, 0x90a74d19bc1e7701, 0x6e049e7568e41314, 0x18d3375763ef075f], [0xd6158c3838f1581d, 0xe24b31486205c3aa, 0x1bfc1bb45fa8b418, 0x642c22e73484578a]),
+        affine([0xc28885e060503641, 0xc7742c905eb12a6e, 0x70dad3409dd5c453, 0x3665d778f987fbf2], [0xccacab8dfc94212f, 0xdbe942dbd19a231b, 0xd74098473996a1db, 0x185be84c45c63218]),
+    ],
+    [
+        affine([0x9b7f1e45dce22bfb, 0x07d8f7bdbc02dd5d, 0xb2ff8d1c10b0973d, 0x6ef8a3d5e9670935], [0x45bccf9028f9dbc4, 0xcdc24bf8a7ff3b9a, 0xf78152429a84ea3e, 0x5956c0e3223f814e]),
+        affine([0x8579561a14ee01a1, 0x6893e9db9256296f, 0x43460b754272f3eb, 0x33da08aec71acf22], [0xaafc6c6997a3f297, 0xfe90a58237afc293, 0xe6ad1bcb32a9beb0, 0x25835c8b4c6b19c1]),
+        affine([0xeeda01672350f238, 0x9dc755567eaf8f9d, 0x33c81ad28b33995a, 0x250109c84a9eb01c], [0x51a495c7d70311c6, 0x53b26a0d62c64bac, 0x4236d2c2b5964840, 0x62da9cc219c5bb95]),
+        affine([0xccfa0d7108631197, 0x385edc220e17aa37, 0xc8943ede1cd30e0e, 0x003e2559cd25e577], [0xf5f35ad024b55eee, 0x6d1617e644ad780c, 0x3ccbff2fed6573e9, 0x32cacf0d0ce50b13]),
+        affine([0x5e1a97c2c9954a91, 0x6f1da90f7297022f, 0xb59de78b340c246f, 0x2a3769ad426d5398], [0xe4d0d71172d14ad7, 0x0d21ff357e4da784, 0xa5e260851c9b2d0f, 0x01e78d29e92e0986]),
+        affine([0x76c3733a86ad6ef3, 0x7b7b7eeb3fc498ec, 0x8f445a7c855a0813, 0x654983cf8416bf94], [0x8b9b45311be9153c, 0x2e4b38c88780484f, 0x538e4f81b07efe03, 0x46d6ad923fa87996]),
+        affine([0x3b45edb9260240b3, 0x1e795d8a1f5a5b98, 0xfade12c67bad92c3, 0x2096027cbef742ae], [0x9882139d101bfda6, 0xe62a37c7e30e972c, 0x54a30dd710f1e5c1, 0x410f7e173e4ff7e2]),
+        affine([0x63067cfb7738a039, 0xfb92699aaf67db90, 0xb903e891dfa94dac, 0x524c7c58df60e6cd], [0x9e26478add07d8b9, 0x49bdf8055cf16dde, 0x7366ca5fcffb1b38, 0x1637f86adfe2cd12]),
+    ],
+    [
+        affine([0x459d0e4437a3ecd3, 0x610e36179c5eb312, 0xc58a47a9816ee53f, 0x5f68490e126511aa], [0xc6373e258ed17f91, 0x583f756cf08087d5, 0x593aea776c823105, 0x6628271a6e8507fb]),
+        affine([0xb16ba23ca23d6f67, 0x1bbdaa0b99a884ab, 0x88b1e7ee923ce4a2, 0x37ec73adda9b3015], [0x2c102d3603ef2c89, 0x07774d794fc55b2b, 0xcfc22765169d7b49, 0x508832fe535447d4]),
+        affine([0xfab06c72c4f33e08, 0x81d67a88b4d78720, 0x9907ba6d05c4e256, 0x59e30f5c2b9e93d7], [0xc4bdefb6b2f6043a, 0x45b9ca7dfd38d546, 0x39a0433b00563be5, 0x6213f6b7e3db46e8]),
+        affine([0x5d0dced75d5255c6, 0x6e1ecc5cb263975b, 0x054246f6ccc6d00b, 0x396adba483ab068a], [0xa5a5cedf95cba59d, 0xcdf801848ad7b15e, 0x024dd42ac68b6e2d, 0x111f0e88c54765a2]),
+        affine([0x135697814c9baad6, 0x22782cdf72a40ea6, 0x71cba2e449ecd992, 0x03bf6f3ec7b8ed5c], [0x5e52fc7d9a73e2ce, 0xec7bb92a87d4fa36, 0x2f08dd6ba9519a83, 0x336a3e8987c7135b]),
+        affine([0x3d6ed56a852da2eb, 0x2b92ba0c7fab9c3e, 0x0b88baff2604f037, 0x55ff969d16828369], [0xb08e5407c1570385, 0xa42bbec9c7c5f948, 0xc5e7069f7a4cea22, 0x4d6bf301dbb3564a]),
+        affine([0xb9b7be99eb95c731, 0xc9107275aab8c56f, 0x3efaa3946177fe93, 0x3183a6c191dd429a], [0xab86330af0baf4d0, 0xaeafa4565fdde290, 0x3bd4feb076911478, 0x3230171c81a3509e]),
+        affine([0xf161daa56a928519, 0xb62acc674f34960f, 0x2760dd1e8d20921f, 0x3ea3c9fe53b88953], [0xb69070d38fda9462, 0x81428e199050d0bc, 0xcfca3aa5aa9fe9ff, 0x43f6dcffc84d81f9]),
+    ],
+    [
+        affine([0x6f24cef5bd0ef79c, 0x3d0d5ce0085245bf, 0xd2d8269c3b5215fb, 0x694d218fbd7102b1], [0xe2bfe236583434c9, 0x8f98550ff9f9163f, 0x4b31e4481acc5caf, 0x40fe1f371f90716b]),
+        affine([0x0276e33418986890, 0x4fe6c9647df45e8c, 0xb0eee35dfe42d893, 0x2973ec471bde1786], [0x3a16373b23f8dc08, 0xf1395e5932278f5f, 0x79ecb4a6a909bdfb, 0x3b4b9d7d995348f5]),
+        affine([0x3d8b16ece66ac38f, 0x7fc51e50f7b025c0, 0x1ce58ab76524f7cc, 0x02c684c0ea8c10d4], [0x24b54d7769ca69ea, 0x4595c8c1a275793e, 0x524951dc8044f838, 0x3956dfde3a7a94e0]),
+        affine([0xa7e05ccb50d3a96d, 0xe406fac8ebbac831, 0x89fe19f8baf1986f, 0x08a9ef5b363a3a1f], [0xcbb4f24759a426f1, 0x4ed86af9f4e886bb, 0x72437844191eb002, 0x35faac1e0804692d]),
+        affine([0x91f47377380f0f48, 0x26fabe31a7f782de, 0xb9424826b9af9de7, 0x0914242dd69f0b18], [0x0fd6a98ba9d8eaf5, 0x3f5af616004175a7, 0xc0fc18f934b971f4, 0x175f596e29ac9608]),
+        affine([0xb6172f7347f91cce, 0x63c562fa386fbf69, 0x0a1fe62345717b5a, 0x3c6b4b2876dfc41d], [0x09fdf84836c30b61, 0x02c64796a1950908, 0x0a8567a26f985347, 0x1116eefd04985c2c]),
+        affine([0xdc00869e968cb775, 0x897a7cb00ad9bf41, 0xd69ef79fb2bbe68e, 0x582fd126b4b512ae], [0xf68b9bc879c2474a, 0xed03e68a739e5e03, 0xbca6173707134488, 0x41b3c29a27703ac0]),
+        affine([0x0767b864f3addd82, 0x5bc9ebe922e62943, 0xf05b3bf14445dc5a, 0x21645ae37db7e1df], [0x1a282a30674bda7d, 0xe9e9d6084fc7486a, 0x182387e3310a49a1, 0x4acc259e78df3c5d]),
+    ],
+    [
+        affine([0x2df4933c24f3b255, 0x97e45d41f3a46fc2, 0x20e0e823765a3b57, 0x403e4073977fa09a], [0x9c4d50b944e079ec, 0x72a5338a59c858f3, 0x6ff422c72c4f0401, 0x597a37a0862d1fa5]),
+        affine([0xce6844de5d085f85, 0x6fb19fe7e839d3b4, 0xc99e9141c028b197, 0x66068116d94a9647], [0x8e03035771a1a628, 0xac2798077ee56766, 0xbc70713341ffab13, 0x6aefef65bcb6245c]),
+        affine([0x3c24b02b3c82fb06, 0xdf260c00faedea1e, 0xc3c7726ad467f186, 0x6c49a84524ea4b67], [0x3ac4447d07ec7a5e, 0x05e20578fbb49824, 0x60d9cd31a8655eb0, 0x73e6a9c4977e3469]),
+        affine([0xc471519f8c618ca5, 0xfa2c1ad69c506059, 0xd748b045c8081590, 0x2f1be4f4651a27ba], [0x410b5066ed2b205b, 0x7d4a451f77b29fe4, 0x50838862c01b89a2, 0x13b0e6f9375b840d]),
+        affine([0xe66d1f2426396383, 0xfb26a362987c8485, 0xc0f0f1655276d151, 0x009bc95244076576], [0xe6daab1e6154d1c2, 0xc5cf421a2568ee52, 0x995030878fdd2c37, 0x378816f86713d79c]),
+        affine([0xefa8c66492026447, 0x63e18e674bdccab8, 0x47014fe363a61b31, 0x30b8e3ae2a1433f4], [0xbbd2b46cfab2425b, 0x2c495417879e1772, 0xf16437860729195d, 0x70f69caa12909004]),
+        affine([0x9487609344532c70, 0x7d8229b33246a8a6, 0xacf973a6c915c275, 0x3b5470e7146de099], [0xb36940da5f43254e, 0x37e36ea72544bd84, 0xd9ce1d28dfe489a1, 0x0dfb55b7d6e1c6e7]),
+        affine([0x9e29eda5c4bb5d89, 0x24d6f18ca81c819a, 0x41f927ef2316a1d4, 0x51896e536bcd94ac], [0xee3e5b7d54f9b215, 0x53a035b55e75ea67, 0x2efa668f334167be, 0x20cbb1d9738339eb]),
+    ],
+    [
+        affine([0xfe876557ce60650f, 0x3d9f49d4e9c03f29, 0x8294a01e5221a1c4, 0x07b246c0802963d0], [0x2367b2ceec5e3611, 0xfdd156645fd647ff, 0xeb05f636dd7504f2, 0x4039388d8e71875f]),
+        affine([0x7198e0409c20fca2, 0x8689978571cc71dc, 0x1bfc7269cc6cdc7a, 0x5acdd9c0ba87552b], [0x5d590bfb39852a25, 0x58a3cd30fce6f5f4, 0x3121273f7a94ede8, 0x1b22ab50a195a33c]),
+        affine([0xce069f112d756748, 0x0b6822169efc7e25, 0x6d12c1e44bc75012, 0x6af09770262c6dfa], [0xbdc14e4b06e2d074, 0x006d9b3aa2f0e3d2, 0x7783ea4a1c498954, 0x026948c79284d81f]),
+        affine([0xc84d7cb4cfa74518, 0xb9d654c09f531d90, 0xa972dfc3442dd009, 0x4dd3f4c993d73761], [0xc235246de7bc1628, 0x07abd3c52769ba3b, 0x50dd1fc589e16d4d, 0x11b7ed9c972831fe]),
+        affine([0x6d125bae7de42542, 0xb2f3ba364e919d00, 0xdf45ee12f9dd2554, 0x3255b5058556b73c], [0x6bafe4c455875424, 0x3e288f9eeb244f72, 0x457a0e7dd002c35a, 0x0b88da0753801bb0]),
+        affine([0xc39ffc5a434423ce, 0x56b8407fcc5efdfb, 0xf6cbb4360efb51dd, 0x2763d0c0dcf7b22b], [0x54f1fccb6d30793a, 0xc09a0aeddacdec85, 0xd4823db609f0ccd8, 0x2461ff779d201425]),
+        affine([0x51ddb7e403739e03, 0x9538d30f33d813ac, 0x7833bff5d19c2641, 0x21d4434e50d036c3], [0xddf27109c353e8bd, 0x3b161d93786347fa, 0xb75a313b3962e1be, 0x079928a31cfb6bbf]),
+        affine([0x41da9712b496f1ac, 0x5f4e3e3611c0c334, 0x8b9fa01b0f21eeee, 0x3f6f0c174fc75f7e], [0x2e201bfba747c6c3, 0xd73cdb431161d01c, 0xe8b26ba33b8cb183, 0x372ebbce6e7e8693]),
+    ],
+    [
+        affine([0x14864c80b9ff34fa, 0xe8f40619ad447c71, 0xa84aa9c481c654c7, 0x34ccc3d51ac94153], [0xc1f73ea0f6e07f04, 0x75c718c66ff84726, 0xd86a9a6db74b64f6, 0x10cbc631a0963977]),
+        affine([0x4a21a79ab1d055b7, 0x370dd93c9541a93d, 0x1fcb58d2e3861a57, 0x1a3da1f98dcc0a3f], [0xb442ababba563ea6, 0x1fb89869b0f231c3, 0x86100c7407c80e1d, 0x2ba29c0cb9965cb6]),
+        affine([0x9ebc8764a99b0dd4, 0x075b519729a879e2, 0x02cc7c47b395a3ca, 0x6e34a0a6482bef3e], [0x448e5c2aa02e9114, 0xfe5284081b91ce86, 0xe91b71a025d8c900, 0x727dae0a43e3a10e]),
+        affine([0xa35781bec53aa3c4, 0x86a310111badbfd2, 0x07d8bc3af866129f, 0x3c18e0c8450cb9a8], [0x39bb4553412e5932, 0x4bfb98d2524faefe, 0x889b9e4946822e25, 0x02f0f4d195dc15dd]),
+        affine([0x552604a9a7600240, 0x85bec93c3e4b1f6b, 0x0d511b2d45419a43, 0x6e388fdfda379f55], [0x7be5b63fb15f05d3, 0x4d6cee16240a68b9, 0x8868016a58b7b581, 0x20bf2f05647fa910]),
+        affine([0x70c57f9d8ae8e5d1, 0x1a6d9312e90cc5ca, 0x3aa411852cec986c, 0x706ea9b79cf4f707], [0x945854af37565e6a, 0x629d8f2406c6644a, 0xc0caffd98946105c, 0x31469973286bc2c3]),
+        affine([0x3bc8927ca02af9b5, 0x903096f2a1cea94f, 0x320bc6dfece94986, 0x46085a7246bd50f9], [0xf35d86654dbc6408, 0xa11cb264ffe192e2, 0xb8a2a2fa17ddc926, 0x409b5854fc4a255c]),
+        affine([0x396d2180c0746704, 0xe43c8f5b5d319216, 0x4bfb04cc2cca78fc, 0x2ab6c86ea2dd9e59], [0x9c8d364a79652dce, 0xb410a38ab3f360f1, 0x75eca56009059d4c, 0x361d7e46981cddea]),
+    ],
+    [
+        affine([0x44bd2c5a449163d4, 0xec38fe471f78c2af, 0xe5b3edbfc76a6eeb, 0x448d3ec119c0cd4b], [0xb6c588a9fe360e22, 0xe327168c2ffabf35, 0xcc9003693a8b3c08, 0x02fa42320059a394]),
+        affine([0xbba60c9405e214c5, 0xf5542c0533274697, 0xb207690cd8215967, 0x4c1ea38214f38851], [0x22e65d5293ec37f7, 0x4295e9fd02bac854, 0x3f63d367328c0c85, 0x5746dcadc14d9c09]),
+        affine([0xde8ebb31e1345a51, 0xfb3870df717b5622, 0xbdab31c9280f052e, 0x3016101557a903d2], [0x41afd0cc98151488, 0xbc4dd5315f3e4148, 0xe6843ee68b75deb3, 0x431c367fb58f5554]),
+        affine([0x73cc01128be97ba7, 0x15bacbfd72377ef7, 0x456adc16e7ab85c0, 0x281b865b88b1973a], [0xdd9a2e977a37a0ee, 0x736b56a480b40380, 0x2ffcc95f73001e01, 0x0f7695ee9f16cf3d]),
+        affine([0x794a3a7da64432a5, 0xc7c31c1b579e298b, 0x1c044fe43cc0534d, 0x1ce667bef9a1b3c9], [0x2ad2bf13995be5bd, 0x0494de0b552ed0ec, 0x680a5bec9c1fec5e, 0x42e6bdddba195795]),
+        affine([0x3e7ed779f1f3e80f, 0x902e797d068f2073, 0x78e576e6192e6a7e, 0x1269dc627fd912a0], [0xd00716e85fbacca7, 0x04b7cca9eb719e20, 0x6aee7a206a48024e, 0x191e88ce5bc6f33e]),
+        affine([0xf8c4dae086d735d2, 0xb9c4e159be2e3f86, 0x977fc1507e322fea, 0x115cef61e4c08f44], [0x09ee3c5643f1da4d, 0x06f959cfcdf028fc, 0xbc63fdb7859d14ca, 0x081f3c1deb58d469]),
+        affine([0x94a0fd65f9d6c85d, 0xa644655b06286fc5, 0x311ac370c27fd159, 0x49fbd62149163a2f], [0x7281c1aa95eb7b18, 0x412976576a7dc70c, 0xd1cb4990950765c2, 0x1f3540b523a2c3c0]),
+    ],
+    [
+        affine([0xc376f7a56c19fbcc, 0x00112f6c54150dac, 0x9539bf1a349de012, 0x46d8800938cd701a], [0xb01336115fe6d33f, 0xecd647e395499854, 0xbec9aba8af95b9d0, 0x1c9c7c332438efcd]),
+        affine([0x00cfda9caf312fdb, 0xba6f93a1c74c1ddc, 0x7e94c7ea8fa43689, 0x1696220b7482e192], [0xb4faa4d150345cf3, 0x82df4bc7ae574e18, 0x0457c121c342b086, 0x56a77c7fb564d2e5]),
+        affine([0xed98ab8874fd2c9f, 0x7dcf39f6cfe9a446, 0xc3626b2bd48a6b1a, 0x2cb4f8b7f81ad8d3], [0xd19b64c01a179044, 0x4387209b031cbf58, 0xe798462db6b67607, 0x0775bd0d2242d2db]),
+        affine([0x9ff7e1efa7b9170c, 0x644b1bcdf19f113c, 0xe87c3c95c42ed38b, 0x63a7c156cc7bc6e4], [0x9b93a33591b71e2f, 0x2c25522c8bb0229f, 0x020c2d94e6a198db, 0x0e1878b77cb5d879]),
+        affine([0xdae987a3d386c4e6, 0x6207ea94d0933a60, 0xe8e3942b1025a393, 0x680060925a5aa20b], [0xaadebc07c766479b, 0x952999e580a51ded, 0x9600566490563f99, 0x262b0af94f90a43a]),
+        affine([0x581ce323c59f690c, 0x53758eb53fcc2b64, 0x763ac7101fc75b74, 0x3aea6f2150d70d10], [0x504f4b947645fe6f, 0x59b0753a87e87d2a, 0xe1546322e2f6912a, 0x18208085faf18914]),
+        affine([0xd4d76b14b341b5c0, 0x9fb7e21fa6872f32, 0xb8036b94dd3207a2, 0x4a2c869aa37dd3dd], [0x1680b333e965fef7, 0x502e1d1a08f56696, 0xd1396d82f6037087, 0x53779d157253c22e]),
+        affine([0x30387b3589238a88, 0xc822828cf704c8fd, 0x5385e7d60156bfa1, 0x5b25345434d3d11c], [0x102b7a0737560508, 0xce9c1594b3f814ea, 0xb7d2d375486e7746, 0x6238e3231d3781b4]),
+    ],
+    [
+        affine([0x261f88a7ea3efca3, 0x778c3b3d102cc841, 0x0f25e772e33a0ebb, 0x47a0bbe50ec165ab], [0xf1356244dc24b10c, 0x02ebe8eab5c197b2, 0x304ec2e935e61a24, 0x0ab86c03fa67311e]),
+        affine([0xc18b5be37e836ce4, 0x51b01e9cf3b8f8f5, 0x73ebc223dfc2ffc4, 0x5783a4a6cf22e596], [0x9714af31e36540f0, 0x8789d3386cdb189b, 0x3757fa8273e36845, 0x04422f366cf3e092]),
+        affine([0x3372843c425cb071, 0x036e38f2dce8b168, 0x85a1ec0f4ae52ce1, 0x3e65c20e6817684e], [0xeedbca9c48118f16, 0x9a701f2c77cf45e8, 0x636f040457aed86d, 0x566bc77b40973e68]),
+        affine([0x187ed44c17cbcc27, 0x69f3e2f0f0788fe9, 0x640c38a46dbe9bf3, 0x4447ac295385f488], [0xc37de3679f2e6d8f, 0xe0e084c1c98c91e7, 0xe6e6ab0b87ae5312, 0x29c3d1cbe87b7abc]),
+        affine([0x54677d262a6deb4e, 0x2281e995a30d7baa, 0x6d9a10fa254c418f, 0x70d5c9908fa5e150], [0x774646a637d5af31, 0x0bfc06bc3a8b273b, 0x9c492583169ce363, 0x58aea0bd7c787ae2]),
+        affine([0x0db81845eb5d9fd0, 0xf5f826bffb77c831, 0xf076d345709de4df, 0x02595ef8bd35ab42], [0x6cdac75ddc6f58a1, 0xbeabbce464b4a759, 0xc8f7831b9cb61c89, 0x6004d43303f533bd]),
+        affine([0xa126ff121c5e8897, 0xf515637cb17e6318, 0xd9c89cea89ced826, 0x5cd01b069c339ff4], [0xeb09b6cf626921ae, 0xd02c091addca2691, 0xbfdce6ac39916622, 0x0cb45e6fd7028472]),
+        affine([0x136c502a37f025f3, 0x46a9e08c36c2c8a7, 0xa70e3e2529839d7d, 0x3312f9340192aeb5], [0x9ee009f104b967a5, 0xf49e17a8c089628e, 0x441034a462c7c36e, 0x48facaf4393ce53b]),
+    ],
+    [
+        affine([0x318704c52cc9c84f, 0x489e29932b35e199, 0x06f3f9ec15bcefc0, 0x730b9977ae3f92eb], [0x2fcbfba4c8d01a31, 0x75949fc8140b673f, 0xe08f86f6a9bd31bd, 0x11a5dd8425d47752]),
+        affine([0x678131d55750d4e8, 0x67898eff5f7f2ca3, 0x11c65ae6c46c2a3e, 0x5d9bb065633eb77a], [0x61c64d87cefd85df, 0xae95344304cbfc4e, 0xaa8d9e911405aec0, 0x3982a66cce1fc8cb]),
+        affine([0x71c0f82c17f61c34, 0x81ab33c792842139, 0x25963bb2aa892e82, 0x508be50cf42ff1ac], [0xfbb7dbefd845ef94, 0xb116d40347225397, 0x81d6f968995ca7fe, 0x3696b0e9b251e45a]),
+        affine([0x715259c342a35617, 0xb7a8c056e71437e9, 0x72100e135c5c42a7, 0x6bc3eca17dc01ff2], [0x52d8ce09195944d5, 0xd86c11544f78020a, 0x1f6ac16ac5b08858, 0x4818f7bad2ffe5f3]),
+        affine([0x839bd0c3c2f7268e, 0x5a9f9aa1c8537ceb, 0x007297ce8dc29a84, 0x3f6180251284606e], [0xec964455d3f5fac5, 0xd90d206087e1d0f7, 0x8c247d701e5628b4, 0x6b17e51e2b268c2e]),
+        affine([0xa43ffeb0b157577f, 0x215c310f16f0b9c2, 0x38d987f26cd3da41, 0x73a3907c43a02c3e], [0x7baed7254677301f, 0xa891cceb15f068e3, 0x03b0f7cc0311d507, 0x55ed979f50770b76]),
+        affine([0x3014394544d0676c, 0x0a42f71156cb323c, 0xde2ecc4b9c4ed54d, 0x5fd9efeed52c0467], [0x1f812bd7f3bb4555, 0xafd144577ec92ac5, 0x4dfeae2b422da669, 0x56122034b2462683]),
+        affine([0x42d09ddfdcf43237, 0xf5986927b92d988c, 0x089325bd714ca5a8, 0x3df2922316c510fb], [0x0b9578e723562550, 0x023b098984d02628, 0xfb7ef9cd78c322d5, 0x225496c19c49aa50]),
+    ],
+    [
+        affine([0x92dc426ba0a6e053, 0x058b46fcdac40b33, 0xabc3bb8377651a56, 0x444e43370aa9ba88], [0x8fce8959c154f89d, 0x84c0fe1773f79bc8, 0x1e0a4423e9c95240, 0x2641bb1940ead382]),
+        affine([0x7f31443e09440134, 0xf623a0d0e3d678ab, 0x766dbfd27595fe6f, 0x06c86b823e734de0], [0x1cdf19a0bd244714, 0x2be7917519482da8, 0x3fc863668ad8b0fb, 0x6767c4007a7c659c]),
+        affine([0x6788ca983c64fca8, 0x52b7bf335d0f8c4c, 0x464bb35b06ab3278, 0x6877cc2784f34537], [0xa9f4adf441e95903, 0xf0ed581783268e88, 0xf252e3e1416e9549, 0x18b330bb73062eb5]),
+        affine([0x90a2cc71da88694d, 0x5cacc376055b6332, 0x5b6941b00978dbce, 0x552f755ffbdd7934], [0xafdfdc4303b6f50b, 0x8a8b4bc85f2a172f, 0x7df694ecf6623082, 0x6bd49e9164134b91]),
+        affine([0xccf7b04d692b53d9, 0xc558a0c96c91422b, 0x0069da013bbef4a6, 0x10608ba9f9af5b3f], [0x5ac1446d835f8c09, 0xf64afa365f477566, 0x87bcb691e0f1b182, 0x5bef016ee78fe95c]),
+        affine([0x895dcbb70d4cb6aa, 0xddaffea6a56e11c5, 0x44bf784d33805332, 0x5c5a22696174e468], [0xde3f7b9269e4cebd, 0x72aca22c7ab9853f, 0x8a02f070db02d45d, 0x0d55de50d75cfd60]),
+        affine([0x0137bfbc9c910aa5, 0x164fb8603b93c288, 0xa294e82d53a008f7, 0x6eedc32f05f5e925], [0x07bf52ca6de68bc7, 0xc20d2f021684ed51, 0xa2b633c0bad6c85b, 0x41259f12f096f8f6]),
+        affine([0x1a7f2ac889260222, 0xcd709fbb68e4d9cc, 0x0d645dfc37c9cf8b, 0x50ff376fd82a7108], [0x3e940e036c16a4dd, 0xe9450f017abfa8d4, 0xc12586f855a8cea8, 0x35ba3a38fdadd03b]),
+    ],
+    [
+        affine([0xbd90c5f2f07bcc08, 0x13b9a0dde2a7945b, 0x6be2129e757731b1, 0x4b26142d4e3bbc2a], [0xd7ba3af5ebe77637, 0x93bdcd06160a54d0, 0x191c4ef8338ad4b6, 0x2c939b85c96abe9e]),
+        affine([0x6ab94f3a8221ed8c, 0xbacf825838a94cb1, 0xcf043fe6eae654c3, 0x663f2997d9ea65e2], [0xdbaac6baa802c3dc, 0x32721ba4bc33433d, 0x248df6f719726ab8, 0x5a599507232ec36f]),
+        affine([0x582f3344fb95810f, 0xe6de7f7df7fd1139, 0x5a131443794dc33e, 0x6a30fc48717e4315], [0x411a2258e7fead80, 0xd5f4217449c65e03, 0x0a24408e316d34eb, 0x173b71133acc14d9]),
+        affine([0xe36f969fc7d98038, 0x38c41d6612954d28, 0x5bf3e41a99ebdb4e, 0x5a3e3350ef15acdb], [0x00a517df905d6dd3, 0x2b0bbece3becd819, 0xf28e53d853bb8ae4, 0x1915d5c712d166c6]),
+        affine([0xbfe45c0b6c5f943a, 0x3897736ec45c8423, 0x5bcd554e86c560e9, 0x662ad8836661a26e], [0x5ad06ce5139f51b0, 0x4747abb229ca5f2f, 0x6186adaf2548a411, 0x382488298fe7d57d]),
+        affine([0x10b3512b9ccaec3a, 0x31575a5274d29b1e, 0xe42061ae0fd34a83, 0x07f5512af60862da], [0x9df93490cebd1c28, 0x8ace4ad01d6e2727, 0xe309e7a372957432, 0x59a01d1b306d8d8b]),
+        affine([0xd8152a988a44da05, 0x756be2182ec31cc5, 0x6458a63aa7099a1c, 0x39be75671f1fcc35], [0x9808a71ab70ca3b5, 0x0bdc9f7d7aa7c35d, 0x314e367adaa05a52, 0x4f7ff15a9ae75e74]),
+        affine([0x79d758e4131e865f, 0x921e606f324cae48, 0x7b9c80876025fb60, 0x236bc62d2bf5917a], [0x933f244cff2e84e5, 0x2122e81ae78284fb, 0x89844dde48b4655b, 0x00aa258b30b1863b]),
+    ],
+    [
+        affine([0xb37ba63b1e4d52da, 0x64e477fbc8242fdc, 0x70f2ba5a744d3ba8, 0x203ca434e27cdaa2], [0x546b7a248a94ca84, 0xf1ce8989d6283b43, 0x8964e30f3fba406c, 0x36fcbb572a71e6b3]),
+        affine([0xcd1da694a7b249bd, 0x2a68a9587b280944, 0x75d08bd175817237, 0x232ff79bd7576301], [0xb76f4c65f0abb903, 0x67feac5c6c5cc7c2, 0x90f0237b59bca6a6, 0x05400eaf73e40161]),
+        affine([0xca0437ed73070b72, 0x2ce8c44b4de1cba8, 0x38aee7039b643aab, 0x04cd52ba0aa5d744], [0x5ffb645005b676ce, 0xe212066a11e9e815, 0xb90fd7822dcb5c87, 0x33784758d3f109b5]),
+        affine([0xbe34d673a7600b2f, 0xd890c08a6b2db4ee, 0xe57601e6e067275e, 0x66fded03f3c7e57a], [0xad0557dad804eba9, 0x84689b7015c5781a, 0xf791de31f2b5f17d, 0x21a06a141cc2c32a]),
+        affine([0xe6cf65cfbc38af1a, 0xaadfab26e9cb3de9, 0x949dff49b9c9eec7, 0x1cfbb8cb12ca8b03], [0xe0686a919d260671, 0x62110f1ea8afbf39, 0xe82461df2f177a6a, 0x5af4b71f291b85ad]),
+        affine([0x3c0ba261ba72cd96, 0x39583477fd1b1c77, 0xcb581a2a763086cb, 0x6a4b984ef21eb9d6], [0xa178a9330e0f0d98, 0x3663d4203ac260fe, 0xc674af0e4d7e146d, 0x258b36ba2e6346b7]),
+        affine([0x68057a53f85abb4e, 0xc79511fb6145d2c3, 0x26c35bf33c411b13, 0x2499ab9050bfdf93], [0xe324fe9248d97e60, 0xb7f82aa274c3579a, 0x1177c2e1d73618f7, 0x36abb2fbd0cc4f5e]),
+        affine([0x6ba7e1fabf6ee7cb, 0x6044ca7dd3f27e0d, 0xb5b180629e73878b, 0x5361074bb28e381e], [0x80c0482b8c94029f, 0xbf65c35b36561915, 0xe2c9d705610cfb4c, 0x3d9e130f5de92cd4]),
+    ],
+    [
+        affine([0x49049e2566306f3a, 0x93e0d3c92d3fac2d, 0xd44de0c7c96b9f28, 0x134dbc33ec1c2238], [0x5df63be9f2b71097, 0xd000f624f57af2ba, 0x823251ca8d006507, 0x6da0ad7af66e75b8]),
+        affine([0x76b261af27f58a52, 0xa0c85c6391cb32aa, 0x209dbcd567e80bd7, 0x4567f8dee2a2b4fd], [0xd7e81c561382f51a, 0x2414aacb94e1718d, 0xe8bf4318cf9e67b9, 0x2b767b5d77e12281]),
+        affine([0x3dbde072aaa71b60, 0xbd4a4fd6bdf0f8f3, 0xfcff71d83e806e9f, 0x1942481cce6be71e], [0xc938d3c31d2c39d1, 0x76b5f63d57397bb7, 0x19bbaa09a439206f, 0x605f1cc7a6ca30e0]),
+        affine([0x73d388ee8fc76596, 0x446b46cb24aece75, 0x64828b90316fa580, 0x12b85994bbf5c62d], [0x916f3f64e39994fa, 0x4b85ddd63fcdaacb, 0x366cf74dc932c511, 0x2f07ece3a2970fb8]),
+        affine([0x298662fefa181f5e, 0xcaa5af3ba57d920f, 0x2735760196db1e98, 0x65d5b8a5f736ecf8], [0x2723d407ab87afc2, 0x008bd0bf77baece1, 0x4ea9594f7389da2e, 0x1e52af58aff13b2e]),
+        affine([0x17a6ee800fde1923, 0x532f787a63c859ae, 0x119613aff75be836, 0x546017baaadbab14], [0x120789a43409a47a, 0x58ca67a5f5283235, 0xa91c3db561ad4e35, 0x3da692288630de4d]),
+        affine([0x548e14d277889b01, 0x1a3a04dc6536e809, 0xd7cfd8b9fd0038e7, 0x05af7b5330bf9b92], [0x2883b03a8fd01274, 0xcd35f8c06a92b458, 0x045b94a6951a412b, 0x73a4a9013f103add]),
+        affine([0x38918976df3a6ed2, 0xb021ef0d08c7f119, 0xca8692f5f881703c, 0x4dd93a8c806a2e64], [0x453933593dca7eae, 0xe829d460af21ce59, 0x62e800c974cd86ff, 0x085560f0233f19c5]),
+    ],
+    [
+        affine([0x6f6a6f8da1f61454, 0xf9f3adaac24c6556, 0x07d607240e3e4430, 0x3c554ed28cc27630], [0x2bbb5a9000ab47c4, 0xcb3393fbf53cd008, 0x589b478c5a24928f, 0x6fb3fac429dfb9ec]),
+        affine([0x0b928e5ac5d8bde5, 0x77b2f35779f5d887, 0x7578e3234bb80bfe, 0x03643ce27b26ff2a], [0xfe62530324b04fcd, 0x2f9316ab43e5d4cd, 0xa1ab73f3ba185c1e, 0x504b1eac67bc7d59]),
+        affine([0xdcf9a48fe15617bf, 0x56762b2732e06e3b, 0x716d3c0219a0af54, 0x3659c8e53e06b9cd], [0xc56f10ba49a39390, 0x88d0fc3a1abf9305, 0xc059734defc4dab1, 0x200bfbda68f3a3e2]),
+        affine([0xe10c1756fbc10396, 0xc63cd324995a69d9, 0x6e2b7ed703e3a9ff, 0x4e7c9c6e98c38fc1], [0x5af128929c8acdea, 0xd74111cc5bf31bd3, 0x168898e887d3e0f5, 0x6eba98ab41a775b9]),
+        affine([0xbd35da94ae4601c9, 0x34d33139ad4ce696, 0xd14cc6abe94192a9, 0x51f2f0a937d3405f], [0x30388a82313d2e83, 0x771db22e5dd8850a, 0x3ecb7b455d2a4fca, 0x285edd82776b437c]),
+        affine([0x4496d4ddbbf7b34d, 0x76637857232348ea, 0x0e59e3e076c83f92, 0x2c7b94d7aabea55b], [0xdda124ae89803d05, 0xf20914d7a52ddf05, 0x656e5c12116edf87, 0x097ab8129fd614ee]),
+        affine([0x93e8f4f494ec5e7b, 0xc658c3f0b72c6647, 0x2478faae2a88636e, 0x6ffe61c1fc523dcb], [0xb9077d0f22b7e5b5, 0x7c0d55d38b0f7e31, 0x7a45c3f246533767, 0x4d280a0f3d5739e3]),
+        affine([0xe0334d46526cb7c9, 0x1d86669e7c2215cc, 0x7f3603604837eca0, 0x37dec18dcc153a94], [0x19537990381bc71b, 0x33a635f69ae21fe9, 0xed703b9f8f820e20, 0x295b59b91e4bf994]),
+    ],
+    [
+        affine([0x132474258948d933, 0x966feb1db13443e7, 0x63a31851c9789254, 0x130e87f2a55c398c], [0x8e700e30d77235fe, 0xf8fb301608865833, 0x6f4a690573f04da6, 0x10505ff51f8d01fd]),
+        affine([0x8c22281eabe8deac, 0x3ed1ce8864368f4e, 0x0cb2f1fcb696275d, 0x4d35d5e8aacaaf7c], [0x977da85ac8cf4ef1, 0x40b39ac7aaf03be6, 0xe8a151ab2f667ea7, 0x71c79cebee1c8e00]),
+        affine([0xe25b5eccc0813d94, 0x93dab3affa59adb0, 0x6e74ad6dd4a2d409, 0x71dee3fcc8fa0326], [0xeb4e46c7f2612127, 0xb7972522b613eefa, 0x9977ad87112d858b, 0x638e92f656df014c]),
+        affine([0x46d7b7a7326e2dd5, 0x4f9c40bdaa000709, 0x381bba5df40268dc, 0x41de9d2258455b17], [0xf0dd39f5896fdaed, 0x2cf818759797b684, 0xf89f1572b3eae183, 0x07174838d60a7d20]),
+        affine([0x35459eb1cbfa19fa, 0xc6d9f0134e4a4aad, 0x183df02742d7b05c, 0x59166524cf24a08a], [0x7e2b0dbfef31db6d, 0xc3324b87235cec03, 0x5ee07adffb9d6262, 0x53892617d616f7a3]),
+        affine([0xf86da2caa339f479, 0x1bfb82098738af5c, 0x07c18f16c87e2f04, 0x6939c19bea79f5ad], [0xd7038d523e0ee5f5, 0x6bc29f1d505d1c25, 0xdfe37ecf664475c4, 0x3c5b95934a69af66]),
+        affine([0x4bef03c4cb15dcd6, 0xb051355e11e02bbd, 0x315d98f9fbf3f1a0, 0x1d9cb16e67ec01d5], [0x74c4d4c36360b11c, 0xf2943b012b931abe, 0x0718f5d3368d37f8, 0x1c0701a8f909fd93]),
+        affine([0x3da2c5327735ede4, 0x33b9cf6fdda2353d, 0x827c02a44dbea3b4, 0x334f43fcd0196efb], [0x8e63ff257f954be5, 0x91a8970e4924dc9e, 0xcec5be7ece7ca271, 0x44c498df84e3ac89]),
+    ],
+    [
+        affine([0x2e85de2944499b16, 0x09584bef1df8dbd4, 0x0407920c09252a3b, 0x2539131557656a8d], [0xb0b001bf6db630bf, 0xf050314b64fcb24a, 0x57ef3de0dd61b081, 0x6d2dc073e1c8826e]),
+        affine([0x24fd293c71b8cfc4, 0xca8df1eeec0073eb, 0xc8dcc71de7eff8d0, 0x0306a49463cb3342], [0xaff12f67a21bc59f, 0xc58918a1910a1b3c, 0xcfdd0e0b7fa0dcef, 0x3f1559257bbb8963]),
+        affine([0xad50370117bf0e94, 0xc87c1268c649998a, 0x0157908e130af66d, 0x711720e039f29510], [0xdb3016f9f6860879, 0x9da15b9717636a67, 0x67ba9a7cf73665c3, 0x1121f62b600be79f]),
+        affine([0xf14f41b05ade3fd2, 0xec809b61d5b26616, 0x11ae016e556afe9e, 0x37a5affcca51b225], [0x0da700a3d15b82b5, 0x8fc42aa4387e500e, 0xadfe6aeb92dd31d7, 0x12479a0e89d700ca]),
+        affine([0xa9d2ad814d2a9a10, 0xc77f859aaefc1a72, 0x2588e3218a8e095d, 0x6c15c0e127e4c73a], [0xfc8a583ce4563b13, 0x80959bd1ac79e606, 0x707260c22df95f61, 0x1f91fade57067e9f]),
+        affine([0xfb3a9c82202c23ac, 0xf53d5a5efceaa4ce, 0x1500a903441ca870, 0x0fbd0d0429dcfa6f], [0xbb619bc4c5afba12, 0xcdfe191461add1a8, 0xf7cf02df6eb912b9, 0x5dc02730231ef814]),
+        affine([0xb2d5707194a67993, 0xe154a20df17fbbe8, 0x5f545df8d3a1609b, 0x479842ebf5cd64f9], [0x0ca9c0e2d564fe58, 0x34215e2f1bd4ed38, 0xed0599195caed0f8, 0x0caf25fb931b31a5]),
+        affine([0x8104068e737e8a7a, 0x1f3b248b5f0e0a75, 0x3c512d49360d4ee9, 0x0cebbad815502f84], [0x439df8799096f763, 0x2ef512a135a50095, 0xdfefe7015a786647, 0x07325081aa19a807]),
+    ],
+    [
+        affine([0xb1d4f32e52a3adcc, 0xbd49006954c78252, 0x642d0c9e01e6a851, 0x499e1182b00dc744], [0x0dfe2d6a591a9bb0, 0xf21adbb288486f78, 0xcae000b52dbf691d, 0x0c2b85dbd8a85ed0]),
+        affine([0x1dcafbbc5ec0df8a, 0x7f2348ebcdac188e, 0xa57795f6f5e72eaf, 0x05ad3b531dffcf60], [0xd61381ad3f317d96, 0x6ba5880867bfa04b, 0x426e1cf52f574bf9, 0x243ba32e419e9125]),
+        affine([0x49508f175df0827d, 0x8ac8d3a06bf8504f, 0xc279a597f73f11b5, 0x57b781a16b6c8662], [0x910f3e08c08a30c8, 0x8e881f10e3860d83, 0xd1a0ee303160895d, 0x13604b61855a0c39]),
+        affine([0x1325b3a6187155bc, 0xf445e13659c35c10, 0xb56a35c10c5d26f0, 0x023d1467f898ed33], [0xfd2c00820594e0f2, 0x8e9763663c9e6171, 0x48d5f8d549d4ce2b, 0x5f63ecfc0f2af3ea]),
+        affine([0x6100b7618cd7882d, 0x14f75c303649827f, 0xc12298a6937c0d14, 0x15ded3cfdb94a0a0], [0x69105ec39c41ace0, 0xa6a93c3e9a669d2a, 0x7c291fb3e7bdbef1, 0x052c9185f7cdfc20]),
+        affine([0x9656d7a0fb394665, 0xf20f65577c5dd355, 0x7cd288c4aa4643f4, 0x0b0c98f4ad0d95d5], [0x36ccc0fd1e644a79, 0x4e5783b3ce4261c2, 0xf9a88e967fdd9fde, 0x4849d1357e419a81]),
+        affine([0x6500ae5318d1a90c, 0x84127d3ada0bb240, 0x02e3cb2cfe1e1490, 0x132ab3528a5cb698], [0x5b7c63e7edd8e45a, 0xbc4d8914f335d9da, 0x0ff5c9aa462ccafc, 0x4a32bb995a4f412a]),
+        affine([0xf84f4e91a88eda9e, 0xefd1bfed1f9a113e, 0x42d6dec461f47d63, 0x6848fbfab9038950], [0x6f26732ca7758086, 0x8ea0f94d4b7e64cf, 0xe0ad59e2cb981c53, 0x2462105081d84e04]),
+    ],
+    [
+        affine([0x67e5be4c7dd1121d, 0x3afa60b2f4763f17, 0x899a01c0627f4874, 0x5d39e47b045ebbd4], [0xba1454fd7fbc83bd, 0x97faa06e32a75dc1, 0x90ca7ee35304965e, 0x00135128d9ec4b47]),
+        affine([0x7adeab3ac21a47ac, 0xb752683d5945c1ef, 0x6c2463e5e5dee56b, 0x73b645104cb7372e], [0x984dff669e2c71ee, 0xc9fbdd6b4e6b698c, 0x014cfe3cbe32b220, 0x5f809c3494ae3476]),
+        affine([0xc9cbbb1f50cbf925, 0x6213d6c4433c04e7, 0x88240b441da82b4b, 0x5b6efbcf55e7933f], [0xaf746cc8b3e32cf5, 0x84719654b75a7f33, 0x6f10b8c803af1ac5, 0x08ef49ff35a764c5]),
+        affine([0xbe7d25c13375655a, 0xd513d40f014564f3, 0x8d3ef9b6f44ddb3a, 0x1b2397b1dea7a421], [0x56691558685cae4b, 0x1d16ec1d9d4d8e16, 0x789506f65da51dcf, 0x5707d2f9a2764e33]),
+        affine([0x7831f2e0540d156a, 0x084b7cf12a1193ee, 0xbf3233be4b9ce43c, 0x250b7730a441cace], [0x4a1df6f68e87b1a1, 0x86210bf9d767dd87, 0x3960ffc8a23405a3, 0x5e6f9cff6774efd4]),
+        affine([0xb81a0edd4bf3a10a, 0x5ff41657de023a2e, 0xaf9e077c1262b183, 0x6a167c4121f120fa], [0x528d5dab749e9408, 0xbf571356425700eb, 0x1179df70965c6453, 0x2bf2fd2c2963174b]),
+        affine([0x4da2b76ba515c36f, 0x6028d303374a5e26, 0x6bdad0c4741e2821, 0x2563615446223e54], [0xde1e95fc2c77a4b0, 0x64f3279c613ac4b5, 0xc47cfb7ae1558b1c, 0x0977cef056c61201]),
+        affine([0xf4296b2e1913dcea, 0xccd217e033a63f10, 0xad6f6490e2d8b42f, 0x666b42a072a6adf6], [0x1ce4145d8639e876, 0x701ec300fdce29ee, 0x9c1361a99a640856, 0x2c7acebd0467263e]),
+    ],
+    [
+        affine([0xb052ec649a34b614, 0x4f70f91871ce5c6d, 0xeaab41c77d1ac1bd, 0x626ab37f5c68e91d], [0x9b260b955cfd28b6, 0x43097c34962fbfce, 0x0cbbafe1e32ccb8a, 0x6f19ec1be3362f9a]),
+        affine([0x64f642176fb213f5, 0x0f0dcbb40c14943c, 0x5fd9c42be1616de1, 0x275ffec354fb609b], [0x6686e01ed51235d8, 0x2d0391f5c6f4a47a, 0x5ce74c9ef164c3b3, 0x593ebd404d5965ba]),
+        affine([0xf108674767526c56, 0xab4d26e4c649393a, 0x492abdcea4f794f0, 0x283c07ac245ea5d3], [0x4fe06c0c74a757a3, 0x9cdec9689b03fe2a, 0x1ec30e893a629920, 0x1b4c7f1d85697b29]),
+        affine([0xe8765097a8cff5c4, 0x07125d7cc4f86be4, 0x78ece7bc3a46d5ca, 0x66a5a4e01b143c66], [0xa187cdc4358b821d, 0x5a648b8096ac45c4, 0x54cfb5b7a3ffa556, 0x197965647905e6d5]),
+        affine([0x7d5fbdd5bf8c059f, 0x77f31940702520a3, 0xc44439b000912cbd, 0x040c68b601ffaed4], [0xa7098117f5573f4c, 0x90174abd434aa256, 0xbd04437d006a8ec7, 0x249f00eab653197e]),
+        affine([0x3730dc410bc70aae, 0xc1a8aab79a771a76, 0x42685ade210c0da0, 0x6a38e1b5e23fe3ac], [0x6859b818c765381e, 0x6d0189d857e8aee3, 0xdcac7f3ef9cd598b, 0x15c4df666f91f3a1]),
+        affine([0x1c9864e05409b707, 0x9f3bbc049153ef22, 0x32dbefc105410964, 0x3a4a01d6887f1353], [0xa75f50f2de8139b0, 0x85a60d75c7808ee1, 0x002d3374bb829ea6, 0x6e46e5c2e8e41072]),
+        affine([0x84703ab3195f6723, 0x8c9d3ff880548e86, 0x3a1ceb4673c98561, 0x69f5fe54b0c099d5], [0x9b67c3b00c45505f, 0x3ad36ee101dfddf8, 0xfd7b2fa4ea9e2b90, 0x333361af08057e39]),
+    ],
+    [
+        affine([0x7a82710170c79df5, 0x8b4b796896ba23c4, 0x654ee90e9f55dc1d, 0x02febcc0f8a288a9], [0x9c7dc79bd0817120, 0x779af21932581be2, 0x193c15cc0208ef23, 0x62b473fa371fcea3]),
+        affine([0x9272719ecdb27c04, 0x17bb302f3c648266, 0x99c2cc43fbd59d51, 0x232a36c71691a30a], [0xd2550c4383a3b0eb, 0xd761112cc8203d59, 0x56179b3486b13b49, 0x06cf8a9c8ea3ad17]),
+        affine([0xe9dbab0da7efc8a2, 0xb43fc4790cd983dc, 0x4824da8e23dea046, 0x4ec543fee987215f], [0x724933d1ae5ebd57, 0xc7ae5efeea763a5d, 0xb55c6703c98b707a, 0x72ab0f859cc1bdb7]),
+        affine([0xdac9154b37d97642, 0x19726747334ced27, 0xe889993e7a2827f8, 0x5c214479c33122d5], [0x6335ec7d0e5a4692, 0x00f0aec44c5db92b, 0x3c327005382f47ed, 0x0c05a824404ab83a]),
+        affine([0x224f4c366bf7348e, 0xe76e8e6c21d1fc83, 0xf52aeb97e718f0e8, 0x0af64a9b290adbe5], [0xb311b7b34e4756c1, 0xd93ae0ff0808205d, 0x95e72354b1d9d2c3, 0x2f487ee8d0ada5d6]),
+        affine([0x387ea095bfb2ad46, 0x8f7d1de443ed8907, 0x582b23b1f3a8da87, 0x3f4995346249671c], [0xa458eadd43c01a11, 0x107fe2cbcc89a6b4, 0xae5d0d7546d8ea9a, 0x2973bb0a1597220a]),
+        affine([0xa9e69b59f55bfad3, 0x1d8255dc1ac62159, 0xfe7615a0c2f3e5a8, 0x3341ee92ee83200c], [0x88f125d77f13c9b2, 0x60820b5e0fe3281d, 0xb7f416f7668cc9aa, 0x54e74b38dd5a51df]),
+        affine([0x5349350b2e34a281, 0x586ed49664fa2538, 0xa97755f3ed1984ce, 0x6f55ebbbd189c49e], [0xfdad6c328b23a0b3, 0x983ce63988fa51e6, 0x9140798edcaac034, 0x295ba762a256d570]),
+    ],
+    [
+        affine([0xc236905200913fc8, 0xe0ed6d8506961567, 0xed30709ad8a30d7b, 0x6d8a32cd2aeed24d], [0x89a98a2bb4cd5c7d, 0xb4c99d9d6dc8103b, 0x875fe1fad84e98d2, 0x1bf555c083db727f]),
+        affine([0x71aae642a5fbb3a7, 0x32a211d85c2dca8d, 0xb94c5f2beb5aaf8f, 0x09b11bcd356c116a], [0xc74d0af3078c39c6, 0x8d2f7e138ab03718, 0xc62a232f71b60a18, 0x662a234f5b4cff29]),
+        affine([0x010612c1a4677710, 0xf0e26c9e3c66ea72, 0xd68b290836a4f21b, 0x02c98506538b65cf], [0xb0a98c7452541f8d, 0xad51cee111c264b4, 0x42dd198dc8349a2f, 0x4054db73da45bb45]),
+        affine([0xdb62c4b9e0e200c0, 0xd58dab9cce7d5d10, 0x18b7dd3a3e3d2dd0, 0x7027ae37a45ba860], [0x3accb2b0c8c1c375, 0x22df9a683c7de318, 0xb03ce226ae51209a, 0x727d1663365aae31]),
+        affine([0x14a847b336376fb2, 0x90b1f68da580b458, 0xcc1e7f2a2a578536, 0x33a0b7e44d5baa8f], [0xbcf8116ac84af253, 0x3456a694005f3a10, 0x093d5832311ac3e0, 0x59ba4bb9fe6b97e0]),
+        affine([0x1402720e92ac6db3, 0x3b4e096742b53ee0, 0x498e83c74af89122, 0x50e0874dfb410ab6], [0x530b090a6495be3a, 0xa00309dd859c3e05, 0x9268f9500c0e1dc9, 0x15f181606764bf97]),
+        affine([0x5d9c0c72b900d8d9, 0xab515d523d217abc, 0x4e90e5fc915651bd, 0x2f4e8ad192dbb119], [0x30642166098cf59e, 0x53019eb980820215, 0xbc5315adf78e05fa, 0x2c68ab407e264b38]),
+        affine([0xb59b9d02c97f534d, 0xeb6b574dcbe8bebb, 0xd5a06b302e07974b, 0x03bc5a0afb9aa8fd], [0xac1b1d9eedb795ba, 0xcff22202041bf059, 0x9c9e333bb1e527e1, 0x18530c93f8bfdef6]),
+    ],
+    [
+        affine([0x17cedca713946b89, 0x574547394fc5ecb1, 0x023c743fd90ce787, 0x176ec1b7a8fc0cd1], [0x89876a5fe1acc176, 0x2ffd8b86360ddda3, 0x5f3eb6cab53e3157, 0x62ac23ba0ef8ca95]),
+        affine([0xa7aa4467d43b81cc, 0xc5a47d8b446aef83, 0x50d2e4e1e3185a82, 0x082f6947cbf53bbd], [0x0dce1b01f335b75d, 0xbe9359b89ec74377, 0x9ea94906244d3748, 0x0856e929d762de76]),
+        affine([0xad8d48a80d24bf82, 0x5fec60aaf8f8626a, 0x01b42c74f20c6d39, 0x0d6323c4004c8f58], [0xdd4788ff41662c09, 0x0eb9877c35f1a5a9, 0xea67004b589e0384, 0x0ed9b163179cf753]),
+        affine([0x1ce14ada37158c56, 0x85db98840599939b, 0x0ad0f4b1c9ef7307, 0x4c123315454689f5], [0x045f8320e749283e, 0x2e74c17d2c29436a, 0xbb051526f28565f2, 0x1f1767d5aa8832aa]),
+        affine([0x51591be3ebd163d1, 0xe9ecce4a5f0f1a4c, 0xf6e39ba37350940f, 0x3173256026ca34cc], [0xd0bd21dceea216b3, 0x36c9f209a6fa151b, 0x80977c329d1cf3cb, 0x6d6f3a1e68ebe9dd]),
+        affine([0xd84509ef58c28e9a, 0xdada0ee157d964c3, 0x2c7080d6c84f7c4d, 0x1e896b2dc26fc4fa], [0xe07103db5fafb1c3, 0x5b639b2e864ed375, 0xb9e6e95aae598f69, 0x2971037fe167dfc1]),
+        affine([0x4aa84fd49bbd2bf1, 0x565d87bffcc2e1c3, 0xef7e895f4b2f3b42, 0x15bca1b1b0dff5bf], [0xafa0109207126bf6, 0x9573eb7d0355eb96, 0x473880d0caddba99, 0x5e01dcadd7550e4c]),
+        affine([0x7b2a7232dbdf3e99, 0xe150e82c65cc443e, 0x57ea984a1d01c652, 0x1a9db3f78068488c], [0x873101f3cc203602, 0x24fb749881c28b92, 0x7e03aa919f14bdea, 0x0dbaa43f12a5681f]),
+    ],
+    [
+        affine([0xaf4694dcf847a63a, 0x1b601f685fbf587b, 0xa3711001a9cfc8e4, 0x4c988a7484bace25], [0x34b9da9f5a030a45, 0x878ff05e47efbce8, 0xe8cbcae033871ed0, 0x10188758ded1ea03]),
+        affine([0x3e61464b80ace105, 0xebd03186cc5dbd1b, 0x34b370bb2d075cb6, 0x1284e5d252e60b7a], [0xdc3778db8265911e, 0x53c68526b3d64760, 0x77d8ae07b7a10fad, 0x21f9907f1ff3935e]),
+        affine([0xd790f8f5c4469dbb, 0x55b5ce9f8a069d70, 0x8404edaca133ec07, 0x4e905b3b8b873e8c], [0xfcdb7e5c5cbc5cff, 0x13a7858e2ec49a5e, 0x5f231ab5a66f142b, 0x3fa2551a16ef969c]),
+        affine([0x306fd5167beffccd, 0x7e7e1fa5d5624101, 0x3cddb42a70366b65, 0x266d37fbc8cd28ac], [0x580b95058d2a724b, 0x72d564292e35a8bd, 0x99197374fd8cd34a, 0x01c2d77caa21c3df]),
+        affine([0x45664ab09d0c33eb, 0xd2bd83935fee69cb, 0x54b52536832c1004, 0x284bd82a3172028d], [0xb9ba1f8f655c9552, 0x6312f8fa3ca54b7f, 0x1e4f182eea055c95, 0x620f888edaa01adc]),
+        affine([0x1c2b0ccb6ca9a9a8, 0xbea78ab0105fdf45, 0xa3c67a2caa934198, 0x10e8ad51233a957a], [0x83694d7cc5a17773, 0xb95e9fa56ccf6092, 0xd54dad0b9e82399b, 0x416d68ee82e8c027]),
+        affine([0x6895b0788a7436df, 0x2225b19deecad3be, 0x852510422483242b, 0x6845fb2af027f783], [0x70034d1295ac9ae4, 0xd748c0c8845ad4b1, 0xeca2caf8bc53f2de, 0x4f320c450253fa5d]),
+        affine([0xb6364746d5cc599f, 0x818640a6ef4b6254, 0xc472f1d6addbd0b9, 0x1dfd1db08026bd0a], [0xadfa7ca61ee7c09e, 0x29bf38f157dc75df, 0xb51596f51a62bfff, 0x279029ae793b04dc]),
+    ],
+    [
+        affine([0x9547cd77e97f84d7, 0xeb98abb6a3999aa2, 0x343906f766e3f4f2, 0x433b331ef13225b1], [0x7c2a0a766df4e266, 0x6b333c7601b3f6bb, 0xfa5db0f5e6b5a949, 0x325daacd97e5b321]),
+        affine([0x775602e21970c096, 0x891f5f0e7a2f154a, 0x300d650ddbd277c3, 0x49f33f9468e272fe], [0x7d880e938d088916, 0xe9d1ee2bf71d7645, 0x44a1bb8c22a090ce, 0x064db17ae23cbe7e]),
+        affine([0x0724b76e1fae39fc, 0xc98d38194abe3f15, 0x24e096a5f88a6cca, 0x29ef529b467e914c], [0x2fe747d849050154, 0x2f612c8b88611b06, 0xa7f1f7e2eb203243, 0x21caf56f92440e94]),
+        affine([0x8cc967de562648d3, 0x1dfc28f840f2bfce, 0xc3c68d1b28780016, 0x22e757ee95dcdc00], [0xc38611c051f1fae1, 0xcd7272509c1b6d76, 0x57f11324c4a4fcf6, 0x47e50cfff87c7a1d]),
+        affine([0x121b03dc728b686c, 0xcc8aeebd0bd3ca11, 0x15081803ae0a270d, 0x66291392307b44d3], [0xf74822cb726b58a0, 0x1d6f6e9917559aba, 0x8c6504a084c85aa4, 0x023808d3ac3db524]),
+        affine([0x466c3f28803cc9d7, 0x27eb9e2fd286d0a5, 0x4bd5dad8ec96ac3a, 0x28c922c3f4b50b0a], [0x07f485210ed2bd01, 0x5554372c48482ec2, 0xf80cbd87186a22a9, 0x328e9a73b0d39474]),
+        affine([0x9db6fe215de61b30, 0xcea733699d48454b, 0x7dfc7939b49f7029, 0x5939c9eeadfa8583], [0xb1b10bd8ca3072fe, 0x9ba60adee2f0c7bc, 0x992881462f3924ff, 0x52ae6ff0b8412d28]),
+        affine([0x8c728e0744bcb16b, 0x8e1dd4521b9eebf0, 0xa3a18c45d2088cb8, 0x0d934d41681ce28d], [0xf2f468f5a2521eb0, 0xcec11ab54da4e810, 0x552bb7b1675f00c4, 0x6309d6f951baf5c0]),
+    ],
+    [
+        affine([0x63be4d8857724d88, 0x73f3ad930eb3251d, 0x0bfe6b1d12093176, 0x5130daf56a94b0ac], [0x900a21f28aa2698a, 0x1d014670214ece2e, 0x11c5fce40f912f78, 0x43c2a92388bec1ba]),
+        affine([0x6dfe7511c2272ba7, 0xc4aedf7cc331b023, 0xc6665762a96e28e0, 0x4fdf1fa4a9c25abb], [0x0b27d74e876db03e, 0x19ce75ad341dbd81, 0x7eedc5dc2c460e52, 0x4f44cac4fee1a1b9]),
+        affine([0x715a561457ad3217, 0xcda73ba43abcc0e1, 0xb7ad2bd374f3ff42, 0x2a671bb36f576d45], [0x36ad3478ce59df16, 0x8fa3e3bc5537595f, 0xe9fcb68627755f40, 0x45d6f6cf2224ef6d]),
+        affine([0xea501bd2bfd303b0, 0xf8e969c8e81c13fd, 0x65554d711fe69f5a, 0x1e1da79b5f48e095], [0x1791e5e0a36c5181, 0xd257415b6e1b5a90, 0x85b48d7b963dffb4, 0x23864bf9b71b1edb]),
+        affine([0x454b65d95238d3a2, 0x59384e7aa62fbfd0, 0x272e147cacec8c05, 0x2fc9d6b3290ed917], [0x999b045aae4ed0a7, 0x6fc6f1c31ec01723, 0x10d91dc545807435, 0x47582a6e7c2ebe21]),
+        affine([0x8e0f714c60412711, 0x9be77e1b8566a914, 0x446aca445e502f58, 0x68678f7b032ceef4], [0xacfba2a33467481f, 0xded52ea8895b11df, 0x524d639ad12c8110, 0x3c002752c24f2fc7]),
+        affine([0xe62e5bb684df5a4e, 0x07a54e60c5d04b28, 0xeefbb5ab20088e0d, 0x3c2f8dd920d6904c], [0xd4b586f09ca5b3fc, 0xe3fa3eae365d2466, 0x0945858659c659ba, 0x0cc74ccbc6c63ebb]),
+        affine([0xb75f58feed3ece64, 0xa2e4632abe3c43c3, 0x0a6c12a1db3cf1dd, 0x2cf47507241634be], [0x48380d7f37a91f62, 0x9351e666fa19edc9, 0xdc82c73be7ee97da, 0x52a11695b920e093]),
+    ],
+    [
+        affine([0x9906a9711c5bda60, 0x7bec45b9e7965c9c, 0x531a4f21c6d29466, 0x27524aa705844d38], [0x603b30f11beb6602, 0xc417415eb4b8bd73, 0xd1de671f1c42b98b, 0x04e0f6850a599c6c]),
+        affine([0x85d461efeb109b7c, 0x4a822358b44d8176, 0x0e12954e204e2c5c, 0x47f4a266fc181e31], [0x94cfd78ce816c7f4, 0xb185d2385c60549c, 0x76db7d42c12553e8, 0x26bf0d2ac44afd05]),
+        affine([0x54ede453d235865c, 0xbef3a2173913d05b, 0x7f3033c1f7215b31, 0x65e07e0f62e22670], [0xa045b9c6bee7a2af, 0xc4a86c4695e56b4d, 0x45b3b35bbd32c58b, 0x41247ec2b95ebd03]),
+        affine([0x60467857f20d8d4f, 0x38b35f90ddd66fe9, 0xb2388f353508efe1, 0x700a3881a9518e45], [0xe10352a0b73511d9, 0x4744af410676725c, 0x63a8e783ad025aca, 0x4fcc624f555a6478]),
+        affine([0x3381974b5638a85c, 0x4e12351fde7e2b95, 0xd34bcf95259b466b, 0x649fb5907417a9ff], [0x4d531f547fa12bfc, 0xba548c61a8c3ea46, 0x904bcd9256b9c1a8, 0x6edb6d5879fcb83e]),
+        affine([0x8eaac76579ae62ab, 0x3d4eee79a31a69b8, 0x26125f3b50185f84, 0x21d645e7cfa5e7df], [0x9f56a467daf0de29, 0xc31ed341b99f8311, 0x5e176edd113c39c4, 0x37efdf4222bb2a60]),
+        affine([0x1ac2192e596f5d97, 0x7db6f7fb326398ef, 0x5fc1493c99733404, 0x66f778cf7671b831], [0xf8e5520826db3c70, 0x5b9b7ae44b61a22c, 0x54af9b24a6dd60ec, 0x0b5f8ec5b177479e]),
+        affine([0x7302f280fc2eab1e, 0x6d323cf1707f401e, 0x81f81916724fe95c, 0x4321305ea0e002a5], [0x93961f1f0b5ea8eb, 0xbd11a1e7c8ce12f6, 0x925a60edb60cc200, 0x2adaa3e3f9baf7f9]),
+    ],
+    [
+        affine([0x7613611bbba67d63, 0xf8b8ac6a36ef6cb7, 0x5f31d01f0f20dc78, 0x1bc6737e146df5af], [0x43c013af27e1caff, 0x2b09db4d793a8657, 0xbeb4b1b53c25ea46, 0x3f5531baee22f557]),
+        affine([0xac2ca33cc97b3383, 0xab797b7afb6c2c42, 0x6a2133d4213f837e, 0x67ef70e06c63736b], [0xdc477477e2818155, 0xa688c3dda0e79ce4, 0xcce252ef584a252e, 0x273cbfdc11111890]),
+        affine([0x1eee2bec4d314733, 0x4788d9cee9c7ae31, 0x05cb4d9d48a1072f, 0x3a9e0f00fce6f407], [0x9ce8f9527777f4bf, 0x1c1caac683d05465, 0xbf033ba319d6d671, 0x38fcdf3e8a713033]),
+        affine([0xbc612b432d11dfa4, 0xd2f47b0584e69ed1, 0xb405ced91bb25039, 0x1d5eee9c38e53150], [0x8877b405b78e2365, 0x1d3cd1725c1db21a, 0x3f7897f26886b815, 0x6a8b3dd50f9b771b]),
+        affine([0xc9d909005e90302a, 0xead283879d2bbb73, 0xae107b8f82df182b, 0x02e80de903c9764f], [0xbca9cdda7f403436, 0x87312faa8c4c42c4, 0xabcefba0727295b0, 0x5a143783499a918d]),
+        affine([0x7ce96e6dc867a229, 0x50271e4992efa4ec, 0x942c8bfcd2cacc0f, 0x12aff5afd858bedc], [0x0d33d83b3db5e7e0, 0x7d3433f3733770be, 0x2f95d8a76a5939fd, 0x4e63cc9362cd66c0]),
+        affine([0x8b6b1425d5c7a539, 0x3ecacaffa26914a1, 0x84470e9b4c4dd081, 0x5d6cac7a0329297b], [0x2d4765942e2d62dc, 0x558a5455b04e9e73, 0x087371de36f66f7c, 0x5f94e97421a03e70]),
+        affine([0x0d6667c978e8aea6, 0x4a1947b246697f66, 0xb634cac1a47daedd, 0x5173e88302dba9e3], [0xb55aba1ae376236c, 0x7c0a374580013214, 0x0f218d1d972dd040, 0x3355e67739e4da29]),
+    ],
+    [
+        affine([0x4b52893010440dcf, 0x6df963d63691698f, 0xd0a79b15f053e69a, 0x16c3978c018850c6], [0xb85368a1e9b105a0, 0xe7af97bdc6d8d758, 0x2b429eb1a730c139, 0x278b88065a56e59d]),
+        affine([0x093725477c8cf4d1, 0x7d29337f0274c003, 0x7141a38b35fa6db5, 0x2ff02fe0988faeb5], [0x45a2b76ceaff3b33, 0xce951ad15617853b, 0xff27fb9cb1deb47c, 0x12666eebfa99f53b]),
+        affine([0xbdebfcf2493aad7d, 0x66639790c961010c, 0x13229a43b32490ca, 0x6d7824f3a72842cf], [0xf71133ec9ab8ceef, 0x5436a1187f143577, 0xe508eeed3c8fb767, 0x6c0fe98343a73b27]),
+        affine([0x7b197013197c5ad3, 0xce3e2e7e6edfc2d8, 0x5a9804c3f1a0f0cc, 0x10fc121f3ab0dcba], [0x9fd6cf56a84f020f, 0x3b39330dfb4965a5, 0xcff6d4367757d9c1, 0x35745c6e1aa3443e]),
+        affine([0xe0e15d85b5283e2a, 0x5df56a8266498b9b, 0x16f9439e04906906, 0x1ccbdca6822fff5e], [0x95d44f903d34ebe8, 0x6ce99ff0f65c8413, 0xee68a3d5721bb5b1, 0x6003dec5d1fecddf]),
+        affine([0x19b6e3b5fae1f666, 0x5a193c074a994966, 0xf1913cad8a30b04e, 0x3c8ac61cf3decdba], [0x2dcfc586f5cf9d7c, 0xccf61b22e8aa9412, 0x76a2a52a24c75b88, 0x391d3c009ed436d0]),
+        affine([0x054164df35a581aa, 0x518bd1f10978811d, 0xe8e4c2f81e55cb21, 0x1692c30d516f6977], [0x35067b6036f95795, 0x6f1c5248a5a53bf2, 0x8ce403e588b0fb21, 0x4eb311a5833cad73]),
+        affine([0x1bbf7f57ad8b0228, 0xd5d4f66fd643f8e4, 0x50a4ee2c2a810f2d, 0x40a5210d6a80f5d1], [0x831c976586ea5793, 0x2e080758300f0d71, 0x2037f56df824b918, 0x06a40b015306dc9d]),
+    ],
+    [
+        affine([0xf414e17e067548b2, 0x4fbd4e8653148a34, 0x673b031c1add404c, 0x35217a50354986d9], [0xcf8faabc5b8f8408, 0xf0191f435d50d891, 0x58022c818008338d, 0x1bccb9b25acf05bb]),
+        affine([0x42819e8c37406dca, 0xa964a254e81ff4c3, 0x5268292fea1cee4a, 0x2156d9fbb7e3e518], [0xa11aa1458a0a13af, 0xb783a10e283b726f, 0x5013b6d829bdbdeb, 0x4bcb074db49670f3]),
+        affine([0xe462540b0e8c0e67, 0x8fd4a1b900b8b961, 0x6b1c26642d1141e5, 0x5ea40ddf0d0a1981], [0x96423cb468448d45, 0x9de2f87d87e40ffe, 0xb57f47f734429946, 0x595bcad9b911ebc6]),
+        affine([0x5b0b4521f7c0d15e, 0xd08e4f9b4ad59bae, 0x46ce10ed0e7106e4, 0x215d091bb6ef942c], [0xf9d936f2b7ac5d9f, 0x5c9ddc311946e205, 0x4fc7a307062fab41, 0x4cf762af34a6ee7a]),
+        affine([0x9e562d26e4d0fbc6, 0xb22ea6c790a1d29f, 0x63f1f2f49a79117d, 0x157337a740bf021e], [0xf8ed04953d9b4367, 0x074e80956ca5a60a, 0x832dbae93b3a6b7f, 0x12d9ba871deaecc0]),
+        affine([0xf3161616d2b30bde, 0x43de0436c95aa814, 0xce02a1ede3582ddc, 0x400c3db5a9af1e03], [0x530d2cc83a1ff173, 0x62c57e18d1a4fb1d, 0x72d22b24d37f74db, 0x5a2e13f0a0714024]),
+        affine([0x5db5693a68779813, 0xa2b235caef3985b1, 0x1e0d100d6abdbcab, 0x31f09b3a4b4b668c], [0x124ff0bd5b453a60, 0x36dfde6b28acb796, 0xb197342eb06499af, 0x20a90015b7cbaee9]),
+        affine([0xb090e45a8d7dab64, 0x0a494c786577bc23, 0x50a33abbfcbe15be, 0x49827c29391059de], [0x2ce70bba5e1066e3, 0x506c8053986a6b96, 0x75a2f672d37d6cfc, 0x57033cbcad0881da]),
+    ],
+    [
+        affine([0x4a8287e6b7077098, 0x9f8a004a92842884, 0x7cd37572cc9fafb5, 0x5ec4009b0237c670], [0xce15ec685d2170ad, 0x8fad91b423512bf9, 0xfa533fdb91efa13d, 0x33695930d18649b2]),
+        affine([0x3d1b426af56805fd, 0x5b727e5d4c8698e3, 0x8d3b3c601e28b7cb, 0x71ae260213054c8a], [0xddf769cdc89eec71, 0x3d289d950a8894dc, 0x381fe94bed2b350b, 0x4aaf3eabe17b2320]),
+        affine([0xfce0f9dfbd5998e2, 0xe237ee5a97c3bd69, 0x56923703ced4b18b, 0x295e93a6022c3a68], [0xafbb1ac980ecd410, 0xa081b18b00afa38c, 0x2d07edb74e1d9398, 0x2fd05b914ef8b8c2]),
+        affine([0x951bfb61f140f62d, 0xeda70e5d6ff83296, 0x85d9abedfc7bd6ff, 0x2c77fb87ae95bdcd], [0xaceea0ce85932689, 0x993d142351a5fc24, 0x671932f457396b9a, 0x30580f02a2a3f0e4]),
+        affine([0x09b7834c920baa7b, 0x9f4c0cbc8556d9da, 0x6f540226fba6673d, 0x644c36d4cff5cbef], [0x85f48c5fee3c48c3, 0xe9e0ca8f7c40fc1c, 0x42791bed8c4739f9, 0x31c1dedc218ee8b7]),
+        affine([0x615f9bc01f441e8a, 0xecd63b4b94ba552d, 0xb4093e77dd13eec8, 0x077fa17f3cee6630], [0x6c4aa9b81587f888, 0x198834f665d81314, 0x8979f2478ce71e69, 0x41812c48271f8fe7]),
+        affine([0x603fbc5eb3a578e9, 0x57622f3aa89e8ed6, 0xa36b7fbd0ba39b1a, 0x250afdb5b30c6d2a], [0x504fc63db3124d5f, 0xd9edd39790a2e359, 0xf10056cc2d8d0f55, 0x02b423f36678b287]),
+        affine([0x1b3055e6811046ef, 0xee09543d76bce97e, 0x67ec7210c1f4a984, 0x69341bf28b412a14], [0xd89765f8a1addaac, 0xd80f2e94352e2f6b, 0xe7febc9df7c1bd88, 0x1c27d30d6f02f174]),
+    ],
+    [
+        affine([0x7d86d5775ccdbf8a, 0xba08b74671cd1d40, 0x06c5f3567e209624, 0x4ef7b27073948c3b], [0xaef8d2fa131e8a47, 0x6cd145bcdc9b1d5a, 0x5bdcb173eff956e0, 0x30717e242f2d8ab8]),
+        affine([0x1cd0a5f4f0442c71, 0x593ece506cf02ea9, 0xff0d1bdf9dd3b27c, 0x4c3074648880637b], [0x8fe2aad421026683, 0xee04d78678f568ad, 0x10b812336200b608, 0x0b20d0cc931185c2]),
+        affine([0x813b6137edb1a066, 0x2253a54d3dd08244, 0x6ba70a283f026a7e, 0x478afd804fa9e578], [0xb935205ed405520f, 0x9878f5d0c51686c7, 0xc0a2bac087eea2e0, 0x5c3c10bbc50f47cc]),
+        affine([0x63d0f786809ed18a, 0xce1a20007038ef9f, 0x7c0be3ddadcfec5d, 0x1b189b8f8b2539f9], [0x282fc77c2df82949, 0xc43cdca7dbf997f6, 0xd2bccb37f38794c3, 0x4776bf127082c972]),
+        affine([0x892eeab482d1e141, 0x285e78951c9d12c9, 0x8b0131febc8e15ef, 0x586dcdaf12c8da4d], [0x548764fa48718551, 0x0da858b0c94d174f, 0x2b3f44c60767941d, 0x0859b7ec7460263c]),
+        affine([0xc99ceec0938ff8f9, 0xdccc0505618388cb, 0xde211555f1085b16, 0x5200ebebf28eb67a], [0xcdc3d669fa288a2f, 0xae3e49aea647d215, 0xdd323bae085a70b4, 0x504b0ec0b030f35f]),
+        affine([0x37fb5d83e42b9b44, 0xf973f36815d1c717, 0x00de8800c87c62c2, 0x0a599794fd65eefd], [0x4ac5dea0a058e91b, 0xf9ac17dbda20783f, 0x16bdff59162eb4c6, 0x24a38092c2ede296]),
+        affine([0xe19ce3bb65ad4658, 0xa9b9027c1fc09e12, 0xed409351e205820e, 0x4c796e895df1c0c6], [0x31b8b0fad88c7821, 0x5064823dd6b2552c, 0xf34bade7f7b2b368, 0x001045aba61846ea]),
+    ],
+    [
+        affine([0xfa0e04b02fc7d0dc, 0x1d19d26d7f28d7fc, 0x3aed55e2c651f4fc, 0x70dab4e6c6e146d4], [0x7bb8bfb938401b51, 0xb5ea2894e3ebe4f4, 0x77b30984fc57a105, 0x17c21ca031e08821]),
+        affine([0x6a611b4c99351242, 0x3f693a147b05fa90, 0x81172d812655e3d1, 0x1c0f722a0ba98430], [0x39adae143a3ebc31, 0x8434228d0a7e67dd, 0x963d0214ae47640d, 0x4f37dbd05a079437]),
+        affine([0x9278cf4fa115fd9c, 0x92db62f0320c56a9, 0xbb7322884b0bce56, 0x1e70db3db0158a79], [0xdafa4578d55a1a73, 0x7311886ab53c1646, 0x348c5480e4b60e95, 0x71564496ffd11d0c]),
+        affine([0xa145baaf1b97b583, 0x823eb1e18bf09b5e, 0xa2a9e9b96a53b7e4, 0x05e0d3bd88904cb9], [0xa254f0b75bae1e66, 0xf00e6aa268d47736, 0xc18bfa5983b3df4e, 0x3d49a2d521a26482]),
+        affine([0x8165ee3ee981a8f8, 0x43b7c0f079a7407e, 0x0bb87f2dc5469798, 0x37f71bf838338210], [0x5a2559fece49c153, 0xf8fa93b539e7462a, 0x908e0be436bd185f, 0x24849a610d568b39]),
+        affine([0x25fa6a99eff7a5c3, 0x006e94da32c63e5e, 0x2eb7d32a21fb9cb0, 0x3de9de082899379a], [0xd53c9bf179dd04f3, 0xb431ba292a905a95, 0x5c8f1c439d2adf18, 0x70d98b8462936e96]),
+        affine([0xc09e5ba9db407fd7, 0xe45c66da1263d716, 0x0c3be9a8b4c27693, 0x689af2cfcf651c2b], [0x6828078eb3fb9a80, 0x1d0ecb2261feea24, 0x7a69034e3a033820, 0x3c279567ff9fead5]),
+        affine([0x931aaeeef8f4fdff, 0x4dba9fdea1cb3d85, 0x11d0c69cf7b8c580, 0x31ef794751d505f7], [0x639f5187f8330a38, 0xb7f6ce6253fd6161, 0x23ffdf21ffb02d36, 0x1a57820601f879e0]),
+    ],
+    [
+        affine([0x0f47c8aa7eef499e, 0x1cc982571605f139, 0x68bd07870d840d03, 0x158a15a934563a9b], [0x52c38345b749d8b5, 0x368e734aca8085de, 0x9722e210a7283e12, 0x12568ba5c837472e]),
+        affine([0x4be18a4ead525467, 0x64158e8b1b5bb07f, 0x76c297e315f2b5fd, 0x336105fce4fac5c3], [0xc1881e755fdf48f0, 0x724d09de5747c98e, 0x0e3b58f952e9ce9d, 0x1f4e255c5960f9ef]),
+        affine([0x6742b60105667184, 0xf9eb3afc8b846b63, 0xdb9f9edf0fc25393, 0x223400d3b91179be], [0x4079dee52ae90e01, 0xbe45ab0e5568f91f, 0x8af504bdb3093235, 0x59d2cd16f07de133]),
+        affine([0xbc64099562a92d53, 0x666675ca1470a685, 0xd82dac848494465c, 0x0f68926e5e5a92ff], [0xe342662c497732f5, 0x4b70cfa6ef42c3e4, 0x7747e94269953600, 0x4108a7fdea0f16ee]),
+        affine([0xa166418097fa1d8e, 0x9b1949424fb37e6e, 0xe646bec4d878511a, 0x5f3fa1b4dfad7a6c], [0x591e86a23b6b9167, 0x135255ecdc3a03d5, 0x5a122b7eb5a194f4, 0x4887f5aac7387d1b]),
+        affine([0xc792ed10bd1f6444, 0xe9d5e4e26d367d50, 0xd0daef39348c7884, 0x012cafe874b1bb4a], [0xe1a05c33785c9a53, 0x8ae6ab62689c53d4, 0xa080ad98ab9d636a, 0x5aec3609057f2655]),
+        affine([0x50132d67c5e01363, 0x5e53c6aaab4d2b65, 0x375f00cae16d3f91, 0x50a7921614cc20ea], [0xda2e4f445deb90db, 0xd183430f9178a9e7, 0xd870444d0f7e6945, 0x153a5a4a055bb481]),
+        affine([0x22fa5d82b0f12c3a, 0xa22600e4f9bdd1ce, 0xfb18dcaa8b8922e7, 0x4c02bc1464535e44], [0x47020c96a8b148ac, 0xdf43d6304642e1ed, 0xaa9e225aaac480c2, 0x00cf3af84efc83ff]),
+    ],
+    [
+        affine([0x1e771a2e56d69d78, 0xf0717102c37278ba, 0x76b864c1833d77cb, 0x3950ca0753605bc0], [0xa63871196cc3f357, 0xceec789c47ce411e, 0x03b485d677962088, 0x10c29d6b080e7fb4]),
+        affine([0xde45af21222cd38d, 0xae522c6f5aa137ee, 0xcda4ab52cc45f7af, 0x28dc49cd56a89a49], [0x3ee367c36fad79bc, 0x7f7e692511d6cf2f, 0x01cb5082fe5dffa6, 0x3e436de44ad72a72]),
+        affine([0x3e078465e9d2b474, 0xc300ca6d5509790a, 0x67ce4b4e12641d8e, 0x2e56a4303952a3bb], [0xfa7ef00322e50703, 0x3f06e75f93ff124e, 0x39ac9181d58a13f1, 0x63d33feb0b5dfa83]),
+        affine([0xc6f4ee4486656856, 0x44f8c1e84152d9a6, 0x848551e2fc39f055, 0x61dda1bc55cf17b3], [0x73baf6a1bf1646c7, 0xed18a818a58a4934, 0x4114ad289a972baa, 0x2ec86473cad549b3]),
+        affine([0xc97fd5eb35336c27, 0x594adb68516a726b, 0x637c71f74c6dde1e, 0x2e99357927b04ee6], [0x2eada996c8a1e6be, 0x4b7e05317d8cf793, 0xeda2e2d2b7e1dd17, 0x1368b58262d58db7]),
+        affine([0x68f21f5be30f969d, 0xc2967b133453086c, 0x23f16f9b4572e11c, 0x220662ea4f13e12d], [0x5d8ac51474afeaf8, 0x966e4b165260f062, 0x93a94367a3a85ca6, 0x54342330520ab87c]),
+        affine([0x573ac2c04d167184, 0x4182517dc19ec116, 0x9bf07ed419a04b8d, 0x21d466bdc9f466d7], [0xc333f4ca01987098, 0xcd0d5f3fcc26fa91, 0xc6da699d4d104898, 0x1a14fae197159702]),
+        affine([0xbeb72811c2bd863b, 0xcd231a0ac1c2c665, 0x9fb1b4da6ba27ed3, 0x0608c7a4bcb3f662], [0x48ba8b4c8ae6cbd6, 0xf7d072a623a36fc7, 0xf64f14dec379625e, 0x64808ea8a1324fc1]),
+    ],
+    [
+        affine([0x8a4f93f5be883e77, 0x9718fb5f2b915325, 0x8ab366a254f99400, 0x19a2e11324ee40f9], [0x0c0fddac2bbda762, 0x341e2b55679c8041, 0x75c7ca966366932d, 0x44461c6e56aa72a5]),
+        affine([0x1a357a5765b35d6c, 0x8f48bbc1601729b3, 0xae24dbf1f4dc8039, 0x5dff8931e5f6acae], [0x755bbf94aeb67444, 0xd733525d8fdc8659, 0xd459f57a0a33d72b, 0x4a0b7269adaeb533]),
+        affine([0x41b8bc5d82447b8c, 0x730c4cd6bd9b7297, 0xbb418c8af934b4ea, 0x288e15f458e6b05e], [0x4341dea27f2c395a, 0x2d81d99dc193a610, 0x56064c0323c79e83, 0x47e9e3b8c30b1c4b]),
+        affine([0x9ee0e1212c2f2d5c, 0x865ce895ea0d1b74, 0x44e881f0d9620ce4, 0x44a0a627113ee577], [0x06213c03a2dcf85e, 0x5a20e33d175172de, 0x34cebf2fa0d2807e, 0x557a1e8ebc7ec830]),
+        affine([0xc7e81e0a634a2ee6, 0xfb23cdeb8d0c56ec, 0xe8fc5c7be8d97477, 0x5cb62e92ad2a4cd2], [0xf42bde3946fb6296, 0xb45b0f2f64f4c275, 0x16db94cbc4c70471, 0x24863c6fdbb30d33]),
+        affine([0x0c2685f22056074e, 0x918cb8eb25547e1a, 0x9275802a0a50bf11, 0x4443c95f7e7f9d40], [0xf9e67f0e8121ddf4, 0xa75ffaae27712522, 0x7f2233bee0b283ef, 0x6f978c179a716933]),
+        affine([0x77ded539733f9745, 0x0ac8accfb0a299e1, 0x3a8780a8062a6f78, 0x6dc3f9526b6a7c93], [0x0881eb59ded25b2c, 0x8872d4edde484a36, 0x6e06343aad2a2040, 0x181495ea0d3a851c]),
+        affine([0xcf204b9a5d85efbc, 0xc5ddb6e4925a7b63, 0x89d910686dbcf356, 0x0ce8c9882f60115e], [0xa7fbb6e10105882b, 0xa9242fe6dd932358, 0x3831fd88bac7ff18, 0x23c7efcbc53a6cec]),
+    ],
+    [
+        affine([0x0e696be3ec3afe1e, 0xae41baa0cd26acf6, 0x38fa49723698a7fb, 0x5c33c5fc6246332e], [0x27900cace8db37c3, 0x49bbec1a544089f0, 0x6e702032868b8ace, 0x25daaf03127ace2c]),
+        affine([0x64d8bc22b5408d78, 0x5ed70ba3c5af9822, 0xb1d1889403a49d4b, 0x1c70e102c935ff1c], [0x234f79682a32e37d, 0x2e74ee6a4aedbd2b, 0xac341c1e3eb86475, 0x282ea927fdab1ecf]),
+        affine([0x0fd77ccf97bfb575, 0xf44d66520c075021, 0xca2f5b4f544d8c3e, 0x09057f9e8a3869ce], [0x31453349b22e1631, 0x5787cbe10b1f0dd4, 0x9df0978f8c6ffd3a, 0x670809df48999dee]),
+        affine([0x1a67cc5d38d53960, 0x7d5a6aefb4866d4c, 0x5c283b37675817f3, 0x241589c1742d8132], [0x999af253ab8aaa8a, 0x7e789e8d65e530f9, 0xbd037b148ae1042b, 0x2bd57b1c8ceccd89]),
+        affine([0x5eb2dc1ed522b993, 0xfd08e81122060f3e, 0x44640dad3dd9614c, 0x337c7344e92e73e5], [0x2b4a9f6e3eba5798, 0x6562490465cf3e55, 0x4ba48197c2c0a7de, 0x3362dafc1d504218]),
+        affine([0x289c1d7154ab8aec, 0xfc210b5892e0d97a, 0xf9336c1f6fe46c8d, 0x45f7d4b9ff181094], [0x5d457f4d692bd09e, 0xbab7cafb3cb8853a, 0x98a7f421549dbc4e, 0x009aad77e0627520]),
+        affine([0x8005acdce1bd4ad0, 0x7203737756e08e16, 0x1f74a12fe11355ff, 0x041ab0f23606ebd8], [0x10cc4583ceab7d56, 0xa5c35cbf671cfcb2, 0x3b8e3c8cd1ad457d, 0x290d121f390ccc2f]),
+        affine([0x1fcab7fc83b2c69b, 0xe252fb3f8d094eb4, 0x30ba54aaf79936a2, 0x05fd1e85aaeb08b3], [0xdf2c33f06f2c4a75, 0x7783defeba46bd5b, 0x2275e5996f235114, 0x3565b01fca900ab7]),
+    ],
+    [
+        affine([0x136b9d8e761a3002, 0xd84590410a8405c6, 0x2cb096b2f581732d, 0x636e94ee9edc1b4f], [0x7d1dfa9b24cd5577, 0xdbf5ef61febb3457, 0x3e010ef773c2f217, 0x267e6b64ee7ac259]),
+        affine([0x3b534317f41d096f, 0x4097f733f316ab2c, 0x94093216c02c3bee, 0x4c2bf1c9c730b3dd], [0xfcc3a5c9cae3d0c6, 0x9535ce5aeba1c292, 0x58250b25223b194a, 0x34772dcf415b240c]),
+        affine([0x0ab485eccdc0599b, 0x897eef25d23879df, 0x34ca1964ea7883d3, 0x05da2f4a571007e9], [0x78263e40676c5237, 0xb345c96faf9ce1cd, 0x2de7fba9871b0ef3, 0x5374cc82748f36f7]),
+        affine([0x10df5ba84a46966a, 0x0f771c571b512f4b, 0x200851e14eadc317, 0x0b03931924eef3d4], [0x6459444593f270ef, 0xd102c0f5981a394b, 0x1d0dbabe061dc21e, 0x48fe2ba1b55467ea]),
+        affine([0x4f930314bf047f23, 0x758dc9685616c844, 0xc7096c9cef226770, 0x3311486f3d66a960], [0x362601b9648fd2f1, 0x411d772a61bea9fc, 0x7abfbd17ea53be2e, 0x5870a27019022ca9]),
+        affine([0x7d0909093456020d, 0x622476403eb064a2, 0x431d1456144a5ce3, 0x086cb0eab5a157e3], [0x3147678434811909, 0x14dd1b1033212488, 0x9dfbb971fe0bc527, 0x36828d4308117bc6]),
+        affine([0xb93a7efdd07cf9f8, 0x3cb4ee2e047805f0, 0x002f111067f6e428, 0x47a0cb83a085ede5], [0x85e52986cd70a937, 0x187b4997f58857bd, 0x6a8c6ac1bfc056f6, 0x6591442335def71f]),
+        affine([0x6561c615932f75a2, 0x5c83456e34e07021, 0x90d1a195ee7e0617, 0x42eceed52c1697e2], [0x8e4444adfa0eac9f, 0xce7f0e67dc42c2d6, 0x9b73178f8cae616f, 0x195ca8341bbdcfa1]),
+    ],
+    [
+        affine([0x8f5852b3e7862eb9, 0x0a69bc8850a9f350, 0xdd6b1e696391016f, 0x4c410bf8a0093a3f], [0xf34c8c2226438920, 0xbfd36dc177c1cc50, 0x4b7db3e860b02081, 0x433fe27828c3fd88]),
+        affine([0x5d1b2c5be3e12653, 0xc8ade5f3f64ded61, 0xc88a652285587bff, 0x0c342d9acbcbf9cd], [0x05944a92d3012e95, 0x6d84e2bc1975a042, 0x1046918c9cc1e4c5, 0x4834105bf3a701a7]),
+        affine([0xc896a0c6f22f85d1, 0x7bc921c550d9924c, 0x758289d5469ee56e, 0x267d8f518398e4a5], [0x5ea6ad48390dec91, 0x39c43c3b519480d6, 0xb8cebd9f2d6c0692, 0x0c19e8c52d927d83]),
+        affine([0x000fcd9572b25370, 0x688810f95f9d7c36, 0x5ba01f85851ad19c, 0x45acfc10f6c79cc7], [0xc7ef21feacebf674, 0x206125b3e7be35d7, 0xf13e74ceb27d2c8b, 0x3f36ec7b909820e0]),
+        affine([0xe7eaf9afd4b34b83, 0xa2712550fe22733c, 0x32645ba294c942dc, 0x006a8f15b7a521e6], [0x614595ed26505470, 0x57c7d86f8e484d50, 0x3490f8dfbd2351fe, 0x2de2c70d1c5f3a64]),
+        affine([0xaeec074744b14e62, 0x7b8ab5a527231ab2, 0xbca5664c566d7a45, 0x676b6db9838dd3ce], [0x71d193fff84c58e1, 0x34e58a468568a616, 0xa93364df801c3fc9, 0x248b7d07e8d676e4]),
+        affine([0xedecd96006bca3ca, 0x37b4aac0b194d3de, 0x5aaccbae0ea2fe73, 0x61902c6a3e5a57fd], [0x868bc618d79f578e, 0x365ec11cf93c6904, 0x7d2260c5761285c1, 0x0ee9e77248a5d1b4]),
+        affine([0xccf024a9c189d49c, 0x238a30cbaeb29aa0, 0x8c1a69f9f11c26a1, 0x4830cb2463f2ab37], [0x871875912bf62d8c, 0x5c22191d1b6ac52c, 0x34081ac01b085137, 0x2fce6038ce2a13c0]),
+    ],
+    [
+        affine([0xbae8c46386fdafa8, 0x4a01a1d8321a6414, 0x1a99fdba96d16d7f, 0x4d9b5525924bc4b2], [0x5a7bfd709f25eb1b, 0x8ec3676f3db58644, 0xe2a1e5e7e0facab4, 0x1548f1aa347e5e23]),
+        affine([0x3d7370b9d63d590e, 0x8d0c1dd2b37302dd, 0x22b4764492ce9544, 0x123369b2968a784e], [0x02a5a54e22761db6, 0x09e5d184cdf2e8dd, 0x0356473d6d4dc473, 0x4f8d5d7c60050a5d]),
+        affine([0x870a2bf4177bc858, 0xb5b46099b4983d2c, 0x6172249ef5d306e7, 0x1aad69a5d644c14f], [0xc0adecc4377e59bc, 0xbc1f7f6693bd0ddc, 0x7496d064c7766b33, 0x4e5416d2ce4c439b]),
+        affine([0x42bd37ea587c94b9, 0x5968776646f57197, 0x64e50e14a55795bd, 0x3f6aacd314b5f8cd], [0x4c0055a0abe0e0c7, 0x877e72fa04a81437, 0x2725d38d74954469, 0x730f7fa7d949bf65]),
+        affine([0x56e6420ec31fd2b2, 0x219e2f64e6bb26e7, 0xa85c38fdf40e430e, 0x30b5970b82666bd8], [0x0b5cc7fc8d0042b6, 0xb9e233cd83408850, 0xb6e640b8ed86f5e0, 0x3a4579a8c4e4d310]),
+        affine([0x43abdd031c1198ef, 0xdfd87b899f237ecb, 0xa5ea5289e4ce2b2f, 0x58c96601c81fe254], [0x42b8334b52d7aa6f, 0xa909526ac2a3ad35, 0x623b46d849583e4c, 0x61ff6cd7a05b61da]),
+        affine([0x775855a5bfc9a7e7, 0x51c5659a184114ef, 0xdd32da9498aa74c3, 0x093e1db0b12d6095], [0x7b37cd915b9fb6c9, 0x03875b6c5ebbc9f0, 0x161ef9755189034c, 0x46f39d46c1b95329]),
+        affine([0x4856d952ffe6654d, 0x9d4730cc572d55a5, 0x1c0fa6ad56f2fa57, 0x596468f02766bcae], [0x6c0ad698766af4e5, 0x9921154634dfe424, 0x2b855e9a4b59161a, 0x590790f08d55b5fa]),
+    ],
+    [
+        affine([0xb229cf4abefdcd26, 0x12a76e2667df541e, 0x55ae3f81af1bcbe3, 0x3050409ba004912d], [0x12017012177403b8, 0xe154f7827a17959a, 0x3c5a297809509cef, 0x2337fbb0af1d687d]),
+        affine([0x095406990dc90a35, 0xc21c4645a9ef3a36, 0x18a4a1c3aa3521ef, 0x4cbba6a00a5878c3], [0x76eb37324be8831f, 0x65723d73afc6d922, 0xbf744a28ecf2e2b4, 0x621da91ec4769b64]),
+        affine([0x49467281d7bfee1b, 0xb6875464321b9818, 0x581dff7bee8365f9, 0x5ddf7e5528d6b6c6], [0xa8b5d988c2f2f640, 0x33fdf836d1b7b073, 0x0c031cc8aaf25a25, 0x322624e3f05c88d7]),
+        affine([0xada2a3207c62c132, 0x2b4ddecfb5889481, 0xf3216a74f5bf8428, 0x14a9b2eb6fc37cf4], [0x05a1d8e458d7d81f, 0x60a4724052096927, 0xee131fdd493f204a, 0x2b12f0bb013263fb]),
+        affine([0xfd29df3d754d831a, 0x927232e220de6983, 0x7bd1e72740512e51, 0x496f8a2e7d737a5b], [0x17e266fb07a7f255, 0x11ff41dae32111ee, 0x58bdd64fcfb0b1ad, 0x4192a90a88d18725]),
+        affine([0xe9068e1989824d2a, 0x7fe7e4a373fb72dc, 0xc351bae69baba496, 0x64eb06ba4f822675], [0xe8748ec10273b8d2, 0x0cd54f93fef4ccd4, 0x79b73702322591fd, 0x499ff706d634bbc9]),
+        affine([0x97534b46c499cdd4, 0x5e5eb329ae6b1aa9, 0xa5d11bf993c9b012, 0x35d782eb9fd0d7c9], [0x0ac14197e547ae4d, 0x0302315bfaa6003a, 0x653989295753a0db, 0x5916cebb91487194]),
+        affine([0x2b3aa1b7fd7bc5cd, 0xea438cf270863116, 0xdf28a16afed4565c, 0x48f3cbe2684cea76], [0x4db1b3761f25bbab, 0xe0c6154881eeaeaf, 0x365cca6bbcb389d9, 0x35f94f3c5c90a94c]),
+    ],
+    [
+        affine([0x4ecb3d5f45146e04, 0x4aa7c09dcd09d906, 0x7dca9eafb8cacf73, 0x0c455d9e1b6925c0], [0x976f63d23dea17b4, 0x17c6d3926e5e6a89, 0x90fa24a4687bd2e9, 0x7359b30320d563f0]),
+        affine([0xdaa23ffe2c863f93, 0x1aa374e82bac26b9, 0xd1d92e009cc5a2ab, 0x31d503798181b22c], [0x3fa013fd312651f4, 0x359bd20579939ed7, 0x3c0379f993cc09bf, 0x4c4f631eb9d4560f]),
+        affine([0xe8b4ada437d4bb2c, 0xafcddbb9c74cf0f7, 0x5b2c60a260e31bab, 0x0a75a85c32fa754f], [0x96e32cce442d5f45, 0x2b31b65ae9197d3d, 0x7c381db450121645, 0x31631643d451ac17]),
+        affine([0xa0ef3b0356c0d774, 0xc27ebcd6d2416351, 0x8ff0cf8ac4e9bc20, 0x10aa791923285cf7], [0x5a6516c875862090, 0x042690547125cef1, 0xfb52eb35cf9f08bb, 0x506580a8afab519a]),
+        affine([0x61f5a6fd86d9b021, 0xe60cdeb18a76eb5a, 0xb32b8a5120ac0a07, 0x17a81bcd13477ad9], [0xddc2ece81746d627, 0x9f9f529d06ad348b, 0x8ca2fa1d9db260cf, 0x51af4e85ee6116cd]),
+        affine([0x5e02b80c823151d2, 0x84124762ed33e612, 0xc561ec4d82e6ebf4, 0x6a1377b1fa0515a4], [0x5cf2f3642bbdc025, 0xe55360c91d0b83b0, 0x65449cb6b529e469, 0x29863e01506db4d7]),
+        affine([0x21cc2755dfa7ccf8, 0x02ecd890a9b46e3b, 0x6573f6f1295b0d15, 0x13dc6521bb2fef61], [0x98e749aaeb364a9d, 0xa269ea562ee6899f, 0xa9b35c2cc1df0ac3, 0x0032a4af67a7d08f]),
+        affine([0xe50fbe4c5385843c, 0x3059c80a476f83d7, 0xe0285d5108a9279c, 0x352279440e56a203], [0xc6bb9bfdfffaece2, 0x1d81fc36b50b4866, 0xf9d023eb505992f7, 0x05246e392635d869]),
+    ],
+    [
+        affine([0x053372fb14a81cdc, 0xfc90db934a680b68, 0xfa636f75b543fe5d, 0x358d34a87b5bce89], [0x0091453133561e18, 0xa93f5254ab3728d1, 0xe91c0eb0c6d2af23, 0x47181eb487848c43]),
+        affine([0x949f7d09e5fa5eea, 0x318946b5d529932c, 0xfd61afe2e35d0352, 0x25098758cd88c4cf], [0x0e5e9d0f55c1b644, 0xf856998c022a2f07, 0x29f4f3fa99b7e905, 0x71e04767657dc650]),
+        affine([0x1922e875935080e3, 0xde3e4d264beabd06, 0x25ec76e410afa1bd, 0x1fe373c543b2d07d], [0x075c482280d6f24f, 0xade720616419162c, 0x274538e54afbdf0e, 0x22e97ee8b67dbd28]),
+        affine([0x976663cfe515e53d, 0x6eaac70d8469984d, 0x9357b2256e9adbd9, 0x299e7b39562e0edd], [0x1418af7fc983a15b, 0x108cd38a8f7c9314, 0xdb2c372b6a1e8b27, 0x652ea3c8228f9f10]),
+        affine([0x431dc6a8d8f4e763, 0xa7de6165af628cf5, 0xc032a623f4383140, 0x21a7b5264af558c7], [0xcec6d7667d324ccd, 0x868705f9f73f98af, 0x854710d519b0673a, 0x019c81749d72ff36]),
+        affine([0x4baa937ff5550e05, 0x397d6529b9cc569c, 0x57bb55381b175855, 0x3a32b152c6573101], [0x035029e64ad47c22, 0xf731f1df7a56a705, 0xab2ef4d778e05757, 0x2f67ca348f394ca5]),
+        affine([0x3c8b25e5e60fb9c7, 0x17e68e4b9a9bc647, 0x47d41c4c70e8da08, 0x10e0fc0eb6b6b56c], [0x18dae37959641df4, 0x636bc403521417c5, 0x1aa99f5dc3a53050, 0x5f287471110f5298]),
+        affine([0xb160dbd516f491cf, 0x64aa0e1e992322ff, 0xc5681f2615bce1d7, 0x65502e3871b5c2b0], [0x7c44f4938abcc470, 0x9b6c48f0f75d995a, 0xa1fc5a99f18eddcd, 0x13c6d25393803164]),
+    ],
+    [
+        affine([0xd3fee5d340a6053f, 0x80e05c6d83c38eb6, 0xf0c3860a9c19db0d, 0x6e536839190e8cdf], [0x4044886a51d00166, 0xc30ad65e9b76c714, 0xb2c4037f7752e891, 0x1d38a8f6696ba20b]),
+        affine([0x19eaff208218a021, 0xeb0fbb3ffc4cb47f, 0x4446560a80557bf2, 0x257037484b824059], [0xab0d5a22cdb5315b, 0x0fcced6530000218, 0x1ae41ea50af47ab4, 0x48d736f988091a99]),
+        affine([0xdbfd046f0a0eed34, 0xd03cefcb369b7813, 0x0b17f7bf7aa95363, 0x0d62b03b1b6b9c82], [0x49be8fb341af4e01, 0xccf6f40488c7ec2f, 0x3735c8d53cd1542e, 0x1fd1c01a15aaa300]),
+        affine([0x1d82ecf3a6bb6545, 0xfba304d8069343b9, 0xdffacf008e6bbf09, 0x26f882209eb41fb2], [0xfe2da5864a281993, 0xfed4e9b6eef20b25, 0x31a99cf1a0938920, 0x5faf6de9d0c11f90]),
+        affine([0x88b859bc31e32d0f, 0x551f9c55baa473e1, 0x744c8215023f9418, 0x1610bbcdc9ba14bc], [0x33b829517a08f2ce, 0x2c5b6b684e4f5827, 0xc7ecb62a94572130, 0x4f914465e0f5c87a]),
+        affine([0x4fde950830da9865, 0x0683cae055d0a890, 0x97c93fb5fa55cdfd, 0x0ae227d6b2cca572], [0xc83d9b55c8eea32e, 0xaf3f2bd6e712cca5, 0x8497eaab257e6903, 0x1e87e84ec08f9ae0]),
+        affine([0x5fa003a4c9e8de5f, 0xe7dc26a1830807e2, 0x15e47b18c6a67d0f, 0x680789884e311617], [0x1aee3faa4949d4dc, 0xda2e559f0e31e439, 0x9aef5cf5ef95db7d, 0x46c154942f97de6f]),
+        affine([0x5bbcc25c82c6ff15, 0x1917d69754a5d16c, 0x0c0db761e2421376, 0x44649cf96e992ea5], [0x4fc80dda885ba409, 0x3320e5d7b19610a2, 0x46f81524f91a78a1, 0x4f803a6234bc4023]),
+    ],
+    [
+        affine([0x218a35495cfe7382, 0xd4393ed02216c5d1, 0x5000d7d3cdba625f, 0x5cf01d0f3a175e25], [0x26f2e4a8d5a5e280, 0xc70c79b841783ba6, 0x14bb1483b9881859, 0x631d7e49b094fb86]),
+        affine([0xdcb7b55149c094de, 0xdb2c31a060752bdc, 0xd163d3030b346d72, 0x06bf6411d7b29610], [0xf2df737f34f038c1, 0x57b8eae45635a94d, 0x2cdd85a57662bc15, 0x277c6e726afecf15]),
+        affine([0xaa2d6eb08555d218, 0xe5ac3f5b4638a92c, 0xaf3c7c55eaaa40ea, 0x418193258ce5396e], [0x00e851c99efc631a, 0xd0a9f4f435be6cb0, 0x79e9919d5151ef0a, 0x3d6c4fa54a0922f8]),
+        affine([0x1938c516222fc109, 0x82f8a5f8b878abd1, 0xb8901d34784eefba, 0x026b876d4f619e65], [0xec932f265b3375d3, 0x5665ecd60177b448, 0x426a455f560164ce, 0x1575d18b16a12552]),
+        affine([0x4f7e1fd31cb8594a, 0xaa985242204c1d8c, 0xed589cedbbf5f9f8, 0x3a066fd4f636bb9d], [0x4eb49778fd984931, 0xa1906296b71771a8, 0x62dc4dff84c063e2, 0x22a8e8a544d36551]),
+        affine([0x850b1d543f641ddc, 0x9ac5af483caf7092, 0x7f87a936a6c4b78e, 0x092ea8c8cd295402], [0xf0ebefabf3643ec4, 0x0289638703dc4e7e, 0xb530b9e0ed39cd9a, 0x34c631a01116227c]),
+        affine([0xf7191bdcec19e3ba, 0xd9a365b34e58af4e, 0x5d13339c0f798dd0, 0x63cff70ee7aa87a2], [0x62312dc9cd810d42, 0x99030256b0f17821, 0x64b8e317dc979ebf, 0x6f7a329e89689967]),
+        affine([0x1fb0cbb256fd273e, 0xf30372ed86db4077, 0x165ad9546885f596, 0x50675877074011c1], [0xeac0b4f7077edd01, 0xc250f5d3ba763e7f, 0x0b9e83d60b10ef78, 0x2fa4a3d3456e8ba2]),
+    ],
+    [
+        affine([0x1061080f493467d5, 0x974d0bb47f2f4f4d, 0x99e623f9015d70cc, 0x341b0c5b4a318f69], [0x5236820d4c151b30, 0x8bbdfab441f69006, 0xdb7ccb232ac9a65d, 0x20c8f25f6afefa0b]),
+        affine([0x8c2a4e874b7bd4f8, 0xdc20ec612fc91d11, 0x3bd08969552323c0, 0x638779ccfc153c98], [0x688002a2ce201cba, 0xd5b7ab5dc9614ccb, 0x57fac0ba3b330d83, 0x2a31f06d7fc6190e]),
+        affine([0x1a6d1c9afbda6dd1, 0xe22c8e2d3ba26700, 0x4b22c6a90ab886a3, 0x5a08b176f4503cfc], [0x75cfcb618de523b8, 0x9a7a888d2e6634ad, 0x63e4e68381f4fb45, 0x6b09a45e39b372f0]),
+        affine([0xed977df77d0a8bbd, 0x01991dc0d13b0604, 0x8a1e049917b7c514, 0x24ef81df87d50de2], [0x2ab25122c7a2d4a5, 0xa68b6e6f80252f95, 0x26487c68abe6a9fb, 0x3e9c05da156206dc]),
+        affine([0x36c1165687e6a934, 0x4b2bab6cc4b78601, 0x0ea31d797e45e7de, 0x2f7e08d2c909fd7b], [0xea782f152115a4b1, 0x83da31f23a373ff4, 0x77215e557a4759ac, 0x242f7eac7b31d542]),
+        affine([0xfd7c77faf5b26f15, 0x1b1387367a10a189, 0x39d7f21d3a46bd7c, 0x49ea7cdca534dddb], [0x40784bc6cdc189e4, 0x595f07efa24ced88, 0x173d67338fb6262e, 0x59bcf5cd2470b126]),
+        affine([0xf6ad9d38677c3232, 0x588c281f4950e7f1, 0xea79ee9b5eb7978f, 0x4aefae4efdf09acb], [0xf7dd2780e182f8c5, 0xf28b30163efaf52f, 0xadc05ed1e1f50a2b, 0x2588831e9042eb1c]),
+        affine([0x6799d69cec6f68f4, 0x5d1f52f633901f8d, 0x797a34ae98c13c3b, 0x6ee4391cd743c212], [0xd42daff1876dbf33, 0xf7c15c37e9f10f97, 0xf4746d1a42885bf6, 0x169132439de2ac4a]),
+    ],
+    [
+        affine([0x47e4ac6e3ad2a51e, 0xc133e8e431bd42e4, 0xe6c1233158987963, 0x12eba4202e67f2b3], [0x263bc7ea1f26ab2a, 0x5ed99479463c7839, 0xe14f13d5a84df759, 0x3d96863e35cb3374]),
+        affine([0x546b1cf1f503de83, 0x9e8e01fed458980c, 0x40601dd170dee774, 0x61352273e49bf5e4], [0x261440bca7d26420, 0xb5a03f37775df7c3, 0x65df4bac2d5daec9, 0x37fbf689cc13bc31]),
+        affine([0x0cc82e7d44d1fe69, 0x63a8d0b68b0cbfe1, 0x402a4d3461e7f3be, 0x6aaddb071c543c16], [0xa88ce0746e790d89, 0x6ece17b6772cbdae, 0x3ad592ad8570eb0d, 0x6a7cb0fb59f62d4f]),
+        affine([0x798136033cdfc514, 0xf735cffe6d7059c8, 0x836371ac73950895, 0x565181c4c42cb999], [0x30c7dd6816ca9c3c, 0xd48e83b0a857cc2a, 0x87ac5f93f7470364, 0x12f8c78def106e2e]),
+        affine([0xec239ca9429c1cb0, 0x4f8f5e3bf04ec459, 0xafeb35121c88a5f6, 0x1e98cd4af3bcf1ff], [0xa52678463516a750, 0xacfc586298d7bb43, 0x88eeee7e3490a258, 0x4e6728241efc6e47]),
+        affine([0xbe4658ed6f5f0e2a, 0x92a0c8b99e105a9e, 0x15309e145d401ca8, 0x42b6dc2d85847ac1], [0x76b62c1253e9d0ee, 0xdaa5e5685020021e, 0xe93197542aae2bc0, 0x100a1588eabded70]),
+        affine([0x9f112adf5f014c40, 0x8a1636f3fe03cc23, 0x912e4933b8e75174, 0x474dadae4e357199], [0x1000da930ade08c4, 0x5c1c13618e11db76, 0xa863084e3710bc8b, 0x11d8798145ceb0cd]),
+        affine([0xd14a0f4327c46e3b, 0xa6f0844baddf74a4, 0xca626ec086c323e9, 0x59abd61cd78e7953], [0xfb340299354f0ed2, 0x2147fbd85af12c1d, 0x90cbc2e58f1398bd, 0x0b66eb5935e4340e]),
+    ],
+    [
+        affine([0xb6f33d8408fc55e9, 0x0022c8d9e1b96434, 0xfa4d3df7fce8e951, 0x1ff29cfb55f16ce1], [0x0aafc46a9be092f7, 0x584c73580fc1915e, 0x6dc7274e0e7c9166, 0x095db7f5d81d1b7f]),
+        affine([0xad0ca97f59815910, 0x2a67ff917df7a9f3, 0xd79041d7bb9d0556, 0x60f515b6f4110a48], [0x63b7a2e68ac49d12, 0x50f120d343cabf0c, 0x9128d551c93e4d74, 0x22db65b9649ccc24]),
+        affine([0xd0793063e3566a38, 0x86696674d7c97835, 0x99d6abc813abaf81, 0x4257db6d22e3efff], [0xdba86d7aa2647e46, 0x7da006ba03d06c24, 0xcbf8876b99a7cd41, 0x39f838c472a821c6]),
+        affine([0x2a85f1c87e2026c0, 0x9ce8fb0999269eb4, 0x94b9c300791c3389, 0x0bd6632041ec9681], [0xda5f1d2c357bacaa, 0xdd03f1ac55be967f, 0xd4e0557e9d4fe84d, 0x563706e670e0254c]),
+        affine([0x80d491a2cbd22fc2, 0xf93e131638931340, 0xa569c2c9c003cad0, 0x14f2b3a6cb0a04f4], [0x7be58bfc9222c702, 0xbbc1e76da6e866bc, 0x8938b9680d225035, 0x56aef93d0022f3ca]),
+        affine([0x789fc74370ed0b55, 0x0ea98717db3cae1e, 0x4ba7c85a98f26bb6, 0x4b4be8bf203e96b5], [0x4624b9be4b229790, 0x10c289afa4d58649, 0xb6d8c07b0b4d0cf4, 0x6930f05e9d1c9370]),
+        affine([0xcca17976c447d827, 0xc3fe1874b0cea8fc, 0x83fbfcc75ef0098b, 0x61d2b5ce9d9560f8], [0x95943e5a799e0674, 0x8e8e41f6d731b4d0, 0x5286506b1725b99b, 0x5d04691b5c23a5dd]),
+        affine([0x405489124a64dd24, 0x823b762e8b90750a, 0x52f8fb4db2424524, 0x18a5c990d6f9e8b4], [0xc908dccc9b573ca8, 0x63dfea814bd91fb4, 0xdf7f6bd3d24222ac, 0x387901204813f7f8]),
+    ],
+    [
+        affine([0x14a7265f5d6ab5ec, 0x8be29bb87562b28b, 0xf648f921aa0dab69, 0x26a010848bed6a46], [0xad66f765dddfcb58, 0x537b90434da7a50a, 0x0ff545e5f32a3ac8, 0x4e63ea6d68f35553]),
+        affine([0x132f95c168d874ff, 0xab217806032a446c, 0xe533fbd86f689886, 0x5b268cc28eb46630], [0x34a2409f52465096, 0x0a77206d7d3375a5, 0x6e7b57e2d1d286f0, 0x2d15199088bb8abf]),
+        affine([0xf4bc8c5e79f74311, 0x456b7cd67caf1dee, 0x4918bb012a09a63a, 0x22a3f75b0af80c6c], [0x4a04158e4b989f8d, 0x5dc09dee304ebbd0, 0x8101a01bc5fb25e7, 0x1707cfb8de3e37a1]),
+        affine([0xd4238ec570f31bae, 0xd9e9b920fb662301, 0x93b09d0be4a4378b, 0x63236f7314dd8a97], [0x4480e0165a35544b, 0x810916852fb28933, 0x14491f2ed490ca66, 0x17bcbce01561cd24]),
+        affine([0x5d9452e21043ea57, 0x8d706879671bf859, 0xcf17e5545fc5013a, 0x68cfb7b386929205], [0xc2bb121a36e7438c, 0xfe7f237720dece4e, 0xb2c3e836185dd395, 0x641738d5f0a3e80c]),
+        affine([0xe910725442bd1553, 0xdb9c01880f0b6b1c, 0x28338a1eeffecfba, 0x6d6c6f7de40ed114], [0xf15a28abb83acc4e, 0xeffe53cdd02cbbe9, 0x829ac1bed7b6dd7e, 0x2bf3735e76cb555c]),
+        affine([0xe652a7aa139a7008, 0xfc12ca6e85e269e0, 0x807bc2dbefd1f8c3, 0x2277726a51cfd5a6], [0x986f6a182237ec1f, 0xf2fbefa7b42419e6, 0x4e8591d8c3729ba7, 0x37402918912b288b]),
+        affine([0x5147e9cd86e96ab3, 0x8ea5e79a0618e011, 0x8cdfe3cae92f4485, 0x3ddb2428a38e0f8d], [0xba770c826788dcb0, 0x3b898d11d49e7a61, 0x43209e53f00727e0, 0x5f5849413fb60f11]),
+    ],
+    [
+        affine([0x29b0f7e3db3d6f27, 0xaf39a02595b7ab6d, 0x67024395dddb46d1, 0x6eda1abae2a669f7], [0x8e986b18ed214ff4, 0x9c2f228131261ba8, 0x4d7cc740920280aa, 0x01feb00ecb83ff18]),
+        affine([0x2fe1c57e06503ef7, 0x41c9538033d1cb18, 0x898204f8cc9583e9, 0x3273dea50e19b44d], [0x5663714ae1f88ff3, 0x459cbe2ffb7aa0aa, 0x138b14166ff508fc, 0x56ba3a35403d7e76]),
+        affine([0x862986053ebb7afb, 0x959ba3f846c8000e, 0xcf32b62d2d3609bc, 0x21a1890ab1a13044], [0x65a386bf354ce483, 0xe5225c4e56052621, 0xad0d90990c3fd242, 0x05abf7204755c72a]),
+        affine([0x156f937c61771962, 0x9fffd20ce0f97638, 0xc628f6ccdc843323, 0x439d87ea2b707937], [0xe8ad25d5f3e36cdf, 0x91ef95d817fe9802, 0x30c6e0204d29a4e5, 0x20e2557876f44f89]),
+        affine([0x53caaa9c6709ac3a, 0x8eb67a1fe090c5a7, 0x63acdab768dda00e, 0x0cd8026901c74fa8], [0x0773899fc16d579b, 0x77b0f5c21b4b5e27, 0xb678e6676a0d9b51, 0x455e7894d0c3e023]),
+        affine([0xe68771da6836ab2a, 0x515a2f810550cc20, 0x0a85db0e0c1b0a80, 0x2104a152a6602367], [0x78b10d70d7accba7, 0x143391f3adeecb66, 0x0c7e6473c181b5e7, 0x4e28b1bd6d224b84]),
+        affine([0xe8e29be95cfeb816, 0x5ef9843072fbdf98, 0x9dd931ed9e528b86, 0x095de82b0703897c], [0x6a8bc2a66ad076b6, 0xd19689bbafa28896, 0x8417df0a8d003291, 0x6e6731bcc4ce526b]),
+        affine([0x6634503466d92296, 0xa5684c0766eea491, 0xd23c567bef8e1751, 0x050546d6c2b275de], [0x8e689ad4f0d097cd, 0xe49246b5ad13dfec, 0x67f87f923dac455a, 0x7209e0527329f74f]),
+    ],
+    [
+        affine([0x7e4e36d6a7776c01, 0xe964772c1c16776f, 0xdb0c1cc96d0d6f9c, 0x393d40552ccc2980], [0xb06e81a8f3cb07fc, 0x27e046caf9605bf3, 0x2f97deb17937c8dc, 0x57e3b7341fb8a387]),
+        affine([0x74776cb7340983ba, 0x11cbc88161a3eec1, 0x22f8f3e950e964d7, 0x662b3609d9b1353d], [0x7876b91f0ddc6ffd, 0xd93f45d36f6fc8bc, 0x417393e350dec921, 0x1ac19b36257514d5]),
+        affine([0x43ae73212eec3575, 0xb35350093b5099c0, 0x677063480fc02844, 0x2dd4101482abd460], [0xf63607190ba6ae93, 0x92d23cd86e898578, 0x4fbf29a95a7407cd, 0x213faec3a32f9cf6]),
+        affine([0xb92af2821c329f7e, 0x388a25c83896935d, 0x6e9b5366c89ebdc7, 0x5811700200aa4d78], [0x93e7ede2dd8b8f6b, 0xe229f0af29378485, 0x0e27e59b762430bd, 0x5f59f7311204e118]),
+        affine([0x1d4735aef2df0e15, 0x2277ea5c17dd674d, 0x730d674972f64a5a, 0x03e016706703b3d4], [0x87e4c4302168ec88, 0x0f573e407f183c00, 0xbf59ac3fb7357c8b, 0x3d8e72b0d4ef4f2d]),
+        affine([0xfdeecc7b8609e004, 0x3be6ff10cafb36ba, 0x6392418ace63ea2b, 0x6e4fa4afebe30ee3], [0x9d130170f803ae7e, 0x0528f60e2d56905a, 0x77d155a697c95b13, 0x5e763b6e67f81e15]),
+        affine([0xcfcfc95390ab608d, 0x838d5a1aa8cd52dd, 0xd71e0cdaa1b26d25, 0x61552634a0baba5e], [0xa2b559b3ccce6f5a, 0x89541cf85172dbd9, 0xd04bf5fceb518fb7, 0x04e3e0c53c5bc2d0]),
+        affine([0xede6a9278f71f68b, 0x6d6972f7e8e845e7, 0xe3f0d4ae763765c3, 0x05f1344bc7cfd83c], [0x12f83b83a18a5938, 0x801849b1e224be4a, 0x832a9a959de0eae2, 0x186aa8a2c4c5f032]),
+    ],
+    [
+        affine([0x84f097625468edb0, 0x054facf11b516311, 0xb6de04c381840e78, 0x28e7976791817e04], [0xd0dbd2dcf0a04873, 0xf16348151097f916, 0x38b144f1d53712bc, 0x318fb36a8c28eae2]),
+        affine([0xde7d3f960b8a2fa8, 0xe319f50e275a9421, 0x6408e4bf9ab3018d, 0x6f4ac4abb5067380], [0x6c584d297135989f, 0x090d12fdc7440789, 0xcbd3f987bab9ec7d, 0x27f482577f8091bc]),
+        affine([0x2e713e6a0cfe8c51, 0x211e282f38da69f8, 0xc2785d3acfa4a331, 0x1cda9e40418ba307], [0xc71c91e50beb9856, 0xd43664e3fc5a2984, 0xd44a79eb5c222683, 0x10b65dae4f52037b]),
+        affine([0xdbb2a1cf8c95228d, 0x0ef643cfbb46e4ca, 0x100da942868834a8, 0x527ba624501060df], [0x6046a367781f25e0, 0x8137ab3894dd952e, 0x901033273943b42e, 0x00553c86aa3d48f9]),
+        affine([0x98eab5ae2dacb37e, 0x992a633c3d85cebc, 0xd029a630cb0236b8, 0x30c62fdbaa552be0], [0xd08267fdfcaff409, 0xd0609ee74056bd1f, 0x31ad0f289e8a4be9, 0x650a6cc6e2203e9c]),
+        affine([0xdec1e2cf5c4e4969, 0xe9e92b51be24fb3a, 0xcda2c4dd819f12df, 0x10358ba5b2721b76], [0xc3527810760d5042, 0xe608f7c52d8970cf, 0x72036b5d5711648a, 0x3c06baa7dfca3459]),
+        affine([0x38e49c9ccc0bddcb, 0x2113c5131a227461, 0x3bd19949f9fa8149, 0x0547de75ad2dcdec], [0xb78f715f79781290, 0x04aacfc9030ad3cd, 0x8b2222b6d15bd364, 0x15407386f4f33520]),
+        affine([0x8deff8fdc8da7462, 0xea4025d14e938cd1, 0xc6fd0ff41b9a14ec, 0x0c3795a0bd3b9ef0], [0x3e9bc68c0b7352b7, 0x6a719412aee33c5f, 0xd618b595c954f8ac, 0x61feb7312b5a251a]),
+    ],
+    [
+        affine([0x63834a342b9d6274, 0xdcb67f847357b8c0, 0xd0319d5e4b8b17b0, 0x36b4f3948851df3a], [0x4e94b81cbae89d50, 0x390ecd231a64d04a, 0xfe25df113e0a56f7, 0x27aa2d509f653269]),
+        affine([0xcf61a5a0612248e1, 0x7b1cfaf05a8b60c3, 0xa70b5ca20afd2df2, 0x3edfbbdedde57553], [0xc1c8503ca0bcb579, 0xb3f08256d8f2ca97, 0xdb1b7ed81406aed4, 0x2ac47ac3dd4840a7]),
+        affine([0xf08a693022edba16, 0xd77f3aebaf1e6e1f, 0x023965742007235c, 0x10f09d4a005904d0], [0x42835b035fd57100, 0x269bf83e2afbf21e, 0x46a483bc77aed3c9, 0x594620092f4e6c2a]),
+        affine([0x3f981160a24d35e2, 0x7b2790cfaea2b2eb, 0x4a5c19be30f6f853, 0x0b80ca6976529e21], [0xdda96037d4afe671, 0x3a4afeade712597b, 0x1854f279b7e5da98, 0x20242dab2c6aaa47]),
+        affine([0xee34dc8a384a6803, 0x01d613ff09f467a4, 0x15218ee9d6b76bf7, 0x60f187b366a3bda2], [0xac13a0fa318dd7aa, 0xb17c878ab1054b2b, 0xb526981cf32cc235, 0x34495e1d4dd1a5cb]),
+        affine([0xf50d9f94ac197c6c, 0x58023a359af7e5bc, 0xf05d09b7bdc5d206, 0x39d9c666ae79a61e], [0xf86aa053a6ef091c, 0x963d4fe1d9685860, 0xaf95bcad16e07539, 0x6651774e559a4cd0]),
+        affine([0xc88ee12ccfc24c0c, 0xd52467bac2372b11, 0x586239b51a5b0377, 0x1ff2494b7fa93411], [0xbf4520aefad76ad0, 0x151c8d557ec2f1f9, 0x0093a0a38c758950, 0x5d19cb0936c6a867]),
+        affine([0x5ad37fe258f79c65, 0x30dcef3f3ef65ab3, 0x4ddf6bc0b21ac2fc, 0x0f1aa223f61a575c], [0xdb6e2f2aea5d9c21, 0xd6785cf97ec71995, 0x3b11c3ede841d725, 0x46780c167be18b4d]),
+    ],
+    [
+        affine([0x36e91db11fe954a8, 0xca574a544531f4de, 0x2eabde89f02ca1b9, 0x66ed9832a6bfda92], [0xb492b8b3faf443d9, 0x2769e36c2b1da439, 0x1f64b7364ec002bf, 0x3aff289c011095e5]),
+        affine([0x07c25d7dde794439, 0x0b65f6bae4618a0a, 0x4da33fdbb0b36ae4, 0x1396d28c0b74fda1], [0xdee5fc181c42e37c, 0x8e3cee8fa32e86e7, 0x624c50e1af213479, 0x033178437749f862]),
+        affine([0x34994ace015df7d4, 0xd4b0a0c7730a8cb5, 0x53592c3cc7a8f69f, 0x69b5866a46714b5f], [0xccc2bd0034ac5f80, 0xe24d572853f75dec, 0xa753dc40f238e28f, 0x3c376e2ba60b58f7]),
+        affine([0x4999244b79a7848e, 0xca32f6a8073d7fca, 0x95d5a6e4838257b3, 0x32e4dea56ed7a2be], [0xb8790e2be000cb79, 0x164d2bbb0a6cec5c, 0x9dd2cc2d77a78808, 0x4592de42f9a91c51]),
+        affine([0x626b92f42cd540a6, 0x9ffdc8aef1c7771d, 0xee8a53ea8adad92f, 0x3eb664523a302a09], [0x90e7434ff95c3fdd, 0xa687829c5876e766, 0xab8dfbec19833364, 0x126e6d0ca3fc7771]),
+        affine([0xfc6a33dd01732b2d, 0x61c16367bd66f44b, 0xff71eebecba806d1, 0x418c77821275e25f], [0xeacf9f4461f48cd3, 0xedeab121d6db2226, 0x7281052aa68ac42e, 0x252338e9b725fcbb]),
+        affine([0xcf0d56128ecdd625, 0xac8123122f9c8993, 0xfcdb6c1b79bd1f75, 0x3a55d3d7b2b606c7], [0x35de9d0a9b0e058d, 0xd871a31fb38f8d3f, 0xce943f29deeeef63, 0x6bec350e66fe937f]),
+        affine([0x6bd7d7c2e47707b0, 0xe45784987566424f, 0xb0d7b55b49223546, 0x716938a7b140bd34], [0xbf2b570e10d4b420, 0x8de5ce1faf263816, 0x76fed304bf62fefd, 0x67287bf23b6f5e11]),
+    ],
+    [
+        affine([0x614211bfd4524583, 0x2729770e0244288e, 0x4760e662fb1d5c86, 0x03176e2fa7a74eed], [0x360c08d721112106, 0xf56756265d311cf1, 0xa39af28f936d3dc4, 0x525cac85ede22130]),
+        affine([0x15773cf6cd0c5a98, 0xe4b985ada019f634, 0x04c2eea8a91e2fb7, 0x4e0c1bdac7ed8e57], [0xf8e86102c8ab2fe4, 0x929591a62f79b4c2, 0x6c3c22ac48321930, 0x07e146556163d860]),
+        affine([0xc4e83e11fd075dcb, 0x994dce208c17af08, 0xe73209983370279d, 0x4561c49ee49cbe0d], [0x9dba3a407e735e0e, 0x75673c074ab432c1, 0x02c2076160b0be24, 0x41f692d29ee80e1a]),
+        affine([0xad643cb76a27d014, 0x302f9183eb720246, 0xc651fcd8e736cf4d, 0x0c288ea743305a9e], [0xb4116a7109737386, 0xd0982c9934773fd8, 0xc8a732c4d75e7f65, 0x0c98e07290127d70]),
+        affine([0x748d23efafda9a4e, 0x3aa7730f0f6a23e8, 0xe69d1fca7d6ab2ca, 0x3c4ec6f0bfc45e47], [0xac8ae96151ee3c76, 0xfaaa15a0a6003c32, 0x4023a27e8845cb3f, 0x525fd7dc25b40222]),
+        affine([0xed15747374a2e2f9, 0x12f4b8ecd2ca2558, 0x5fd188213e2407d2, 0x5fb401b39b2b52fe], [0xdb75ec2ab0813ca7, 0x8dfc145ae6cc285e, 0xe5293a12a513f749, 0x47fbaed9a4db6583]),
+        affine([0x252df66a29b5d665, 0x8e0c9e99c4fcb64f, 0x0eef2e55e59c4f16, 0x5c0f092c472a0fc7], [0x1d2cfced2a432c20, 0x6febad6144ebe562, 0x9fae296617449c9c, 0x2ec8693a0fb27074]),
+        affine([0x7868578d4e841b54, 0x3dc9d840be28809c, 0xb6417c0fd48447f1, 0x47cfe9c82d925917], [0x02292b6b7eecd30b, 0x1df2782303023c44, 0x7f29d3b78c803324, 0x646ff6fa233f44fc]),
+    ],
+    [
+        affine([0xfae195354f48d567, 0x7e2fe0187f6898d4, 0xec8c08d4801d0bf7, 0x582adafd694a9631], [0x1bc5ad65b541adfe, 0x3153674660502d07, 0x5929405fe41ff155, 0x357c1fb042706850]),
+        affine([0xe47a2e12fadfd9b9, 0x46d247aa51a8c625, 0xec5978a17037f7d3, 0x1e73c344926564e5], [0xbe7c84e11c2b67cb, 0x1c002f6de694a0b2, 0x961d8f9528ec76cf, 0x37162e13b0c3dd63]),
+        affine([0x742f5d70a6b31f75, 0xc08a6848ca9c8b4d, 0x3d50f565ce1f258e, 0x1191ac64ee6c83e5], [0x443d863c5d9a9f8b, 0x2c811f7683f31234, 0xaf726c230a7f3672, 0x1a93917e993ebb86]),
+        affine([0xaddd08d1d3cb86e5, 0x9026c7678f46d2c8, 0x4dccf5ace20d2d0f, 0x44bfdd9770a66d99], [0x3e1c0c39667b8741, 0x89ddffe6cd479a68, 0x9c6ef1c02ac20c34, 0x51d06b206325fe8b]),
+        affine([0xb31c0f1485dc447b, 0xeeefbdf348084f79, 0x67f5b1694731a610, 0x5d591f649d815432], [0x0458b6eb42774709, 0x370943edbf47c90a, 0xeb9cde09201ac239, 0x6d9cdf571c305689]),
+        affine([0x6bb218b7406edb3a, 0x396fd803a4be7f2e, 0x986decd99ec48bcc, 0x41484a2de5565ab5], [0x2e5e4548e5363bce, 0xa64d696813f75640, 0xe0818d3d9fa4145b, 0x1a43ac8c5d08ccdd]),
+        affine([0x66a013ee89714a8b, 0x649aaf52de72f16d, 0x840d3b6e47aa7ca2, 0x10e9f0da4f081f58], [0x2bace60f7fbc10ec, 0x7c5c7623b17b8589, 0xa1f5f48bf52cd1ee, 0x4b8f53b9d0e2e817]),
+        affine([0x80909e5919cbc4e0, 0x000a4f68ad390b6c, 0xf2d27ba67690167d, 0x5a30851e2381e872], [0xff62fb0aec37cfc2, 0x81af9106332894bc, 0x779527dea9549ab4, 0x48e22d5bb641ee1d]),
+    ],
+    [
+        affine([0xb39bdbfa4f589206, 0x7c2e975057fc8479, 0x0f7525c463d4d01c, 0x5d0d2523a49f8247], [0xe6780445360b3f17, 0x57fd247fb0e98ae6, 0xf8b866e0675b919d, 0x5a57f045f60e16f6]),
+        affine([0xf3e1f345610cf6a1, 0x34ba5cff50e02cbb, 0xd158641ffdf62082, 0x3d3282402e81cb79], [0xeb50317523914eba, 0x85ef49ae2b273f78, 0xef7a852296eb9464, 0x6c6689e4c78c884d]),
+        affine([0x3803eb63c20e3b4d, 0x9978dad1b056f869, 0x938e042e46d812a1, 0x159b92cc8c194898], [0x95dd02c3a246c9a1, 0x8312b01785c420f3, 0x5bc08d18471808a2, 0x675920211f7f4d6c]),
+        affine([0xf806d5f5f384de71, 0x09192f27023d239a, 0x80c6462262585ff0, 0x4430c38def97fcc6], [0xe5a68ce06dc6b9f6, 0x1e9aa76444636489, 0xb6e691660e606b14, 0x65253199d1f2a333]),
+        affine([0x0a1666ff26e1f0a9, 0x8d203dba49516883, 0x58e34fed1df2bd2c, 0x5425063bb05db184], [0x4f876104e144604f, 0xb55274d89e884081, 0x67c30916fda4e2ce, 0x12a1d1a87a1b985e]),
+        affine([0x3bb43daa6941396a, 0xdb25ea9c8bdcc430, 0x509d3c27ea0683d5, 0x565d41421dc1d49a], [0xccb6cc6b4fce4fc3, 0x73a14f72253f0a4a, 0xa26212a2151639d4, 0x2fb9614c2ce2f10c]),
+        affine([0x3588713f3bf6c6ae, 0xd05ef9ae4e83e0b1, 0xc0d947ea773e8afb, 0x0b36210131552bfb], [0x6c47bfe6df942280, 0x196091eb7767fe7d, 0xb084bff75b0678fb, 0x6d61e82581f3c9a4]),
+        affine([0x5dcdbaa286820236, 0x1ebc1bb92d41fcd5, 0x60609e7bd86e8307, 0x2afb74fbd1d3f9e1], [0x611b779895fcd6aa, 0x52f2add2cff5c41a, 0xeb9f48d7a21e3ae0, 0x46d479a3f4163307]),
+    ],
+    [
+        affine([0x29308b7e2c3d26a4, 0x2a5e2bdecb063066, 0xfd56fadcc41e4d23, 0x120f00483957eb2b], [0x12ccaf10c271f35b, 0xc2676c034ad8a476, 0x8f587d0ef4139094, 0x53a890581599177a]),
+        affine([0x28cc4320b10f5272, 0xbba14acfe38ee190, 0xb0641a5e09361cca, 0x26bda2e2e9f2fb2c], [0x5f99fb98f0112e75, 0x5163ed892d7d0384, 0xb1fa9b3014aebb13, 0x26eb22947dea9a58]),
+        affine([0xc0182d5d03cc0373, 0x1757133212d6d738, 0xe6ca9b00aee30077, 0x18a41489ab5fa61b], [0x2ebb3a9ec752965f, 0x6d42131526f599cd, 0x9860e90682363ca0, 0x54092a77d0bcb4fc]),
+        affine([0x2d2bab0e4ec5827e, 0xcf0cb3d93c85b4d5, 0xdb993643ee9dc894, 0x38d4e29fbf030113], [0x79a57f46b8903c9c, 0xfeaa4e93823d2b06, 0x2cea1ada80495513, 0x17d818b27ccd3e81]),
+        affine([0x4b38df5a9ceb0e8d, 0x576dad61ceb488fb, 0xa240385dfe81f5c5, 0x4d3ab25b40d94e2b], [0x80d1699fe05ab081, 0x7e794c38cf5c2f88, 0x95eafa37b1889960, 0x380daa1ea1e12a63]),
+        affine([0x3fd75d767f78a20c, 0x7766548ebe1aa0d0, 0xced149a9bc3e8807, 0x5e88f70c64d9de0e], [0xc65264dc6151b707, 0x3144f6889d362b94, 0xe987366e3dd03f93, 0x7218f2ea052021b7]),
+        affine([0x9026ff68f03ae5da, 0x5b6543e7b190d8ea, 0x6a27e4661f337f43, 0x2b9f46a7a20e995d], [0xc99afdff83964072, 0x2d1f6d6a33d64bd3, 0xd44321b5f157eb2e, 0x08aace8c3de04e5f]),
+        affine([0xaac923750c1ee7f6, 0xa5e184d8a9a57ad2, 0xaa4e1c72d60248a5, 0x5919946802d0979f], [0x91938becd0f302b4, 0x789e4e92096dc0d6, 0xb436529d06c4536f, 0x71b79d3054994617]),
+    ],
+    [
+        affine([0x79a53307baae6ec5, 0x2235360aa612a82f, 0x5bf7c109b6e4395f, 0x66cc57167a770252], [0xde9665df4274b224, 0xbd646d2d28fc205c, 0xb74d3bc703ae827d, 0x5c5b0c6ed234c617]),
+        affine([0xc8febcbf712677a6, 0xe01a4d933dcd2002, 0x2d0244d9ebe2489d, 0x4fa166cf911569f8], [0x3c6d3a2c0c1fe969, 0xb7f91c42714eefe8, 0x772386ef6f68140e, 0x3275dd336ec45564]),
+        affine([0x4b9aaa04dd1a75c1, 0xe8ba008fe9952189, 0xa70ec099c92c4fa3, 0x5dd8e28d08c30f1e], [0x020c16de15e5081a, 0x031b4e28ab8cf72c, 0x618c0118b195bb80, 0x72762e1b857616cf]),
+        affine([0x0777ea1309efeb1f, 0x926caeac47bb5e69, 0x572d52bc1eef0252, 0x4d0bea78c411a604], [0xb9498efcc3d5a7a2, 0x56f1b3238654efe9, 0x801432c7b2bfd1f6, 0x47d55b937c35c26a]),
+        affine([0xfe52063a9ec6f851, 0x35124dd6d065e96d, 0x43f35f1555cedfdd, 0x28924053c9c2c742], [0x52cc8c7e2f6b81db, 0xa0dc5fa953420265, 0xc56e146f74e65d09, 0x56243c0ee336ae56]),
+        affine([0x7c9156e3a579d63b, 0x27838927fb79dd8e, 0x74634b5daf0f5d06, 0x6d35953e3138fc4d], [0x2134800873dadb80, 0xcccff990d9ca5fb2, 0x970e42a72e74f316, 0x46e88b7c44063ccd]),
+        affine([0xa1521423d278254a, 0xf8ee1eaea78517f3, 0x17deef84eac3e6b1, 0x3459cad2e91a7fa5], [0x1618569f95dab637, 0x783cb3b54aa63477, 0xa7839af50a008f52, 0x1f6a4f7e29a9bae3]),
+        affine([0x8de93d22cf121550, 0x04a11e5fbeac34c8, 0xc578fd89186e67ed, 0x132bfdd12de8811b], [0x8397325f44dd6598, 0x6a01d9bfe2139259, 0x7b01d9177f9e0a90, 0x218297199e17c69e]),
+    ],
+    [
+        affine([0x10f6a1927a59833b, 0x29677214f6313b7b, 0x13ebd56c94cbaf6b, 0x2f21b61605ea09a5], [0x98c77abd6dc3bfc8, 0x039ba2341fb01276, 0x364665b74b0a5239, 0x3ca44c8708a9def7]),
+        affine([0xe156925377e91b4a, 0x68b37155e6af098b, 0xb9e1cd02aeae76c0, 0x2e0376331b42264d], [0xdf94ba1429b4e1e7, 0x8724a6866223c027, 0xbf89bf6c4884ef5d, 0x40bd965402f5cfe0]),
+        affine([0xb162011f2e43d6b5, 0x535e13d000a5dc5f, 0x6f15d90a9411cef5, 0x5475cbff2d12cf55], [0xae08e32b9c70cec2, 0x1c158cec4df1a2a1, 0x584105ba0e6ca582, 0x3b5affcabf83d8ba]),
+        affine([0x851939be9368bf82, 0x947cf4ee3494a575, 0xaf14704167e6982b, 0x0a1f1c1ffc0a9c33], [0x20ff511d8d5de8a4, 0x2f603de29c607c61, 0xa382582b4f70ac92, 0x1fa720037b4d1a8b]),
+        affine([0x5db5618464de5f18, 0x5f1728b15193f597, 0x55f1ec7d41272196, 0x602545c8da0a11df], [0x177f2a3be8f91e43, 0xf4a35f2de2a162bd, 0xc5d72e37ae1b465b, 0x6e003344a6d6cbc5]),
+        affine([0x57ec08aa35b27c87, 0x1fb177ffd613e2f0, 0x27c961653e1326e5, 0x0becec230d78020e], [0x4a84714608825bae, 0xfe7719e07e5b5743, 0x20e7921072ca0878, 0x3036d19d7555dbfb]),
+        affine([0x9a0183ac7db08dbf, 0x0d7290b1ebafaae5, 0x7dcd34e3aab239d0, 0x3adbc93be6e68757], [0x19759d3500d1be70, 0x98a86db4a37b2c7d, 0x5eea33767c00df88, 0x061cbd302a2b74ec]),
+        affine([0xa39b20cda8c65b30, 0x2266bc37b40e5321, 0xd1926755062ffa36, 0x4c8574b4321ae034], [0x72a1e6bf1cea004d, 0xb24f59f6478f1eec, 0x04ec6f9f014f47f4, 0x0c8a77d33c4051dd]),
+    ],
+    [
+        affine([0xe588a89e967b9d3c, 0x282dd148e9a033b7, 0x21e19b8b45d77c88, 0x22d35bfa7b056bec], [0xe3f994ab6f829b69, 0xdce03bb7bb780566, 0xb27356ab896ef7f5, 0x508812d885f31dbc]),
+        affine([0x8c31743b3ec63a9e, 0xc4d7bfe5038cafc9, 0x03a908069a1e19d7, 0x3079cf113ea97a7a], [0x7483a4e26e2bb5ee, 0xb6bae987a25dcc02, 0x3e944f45c894c68e, 0x4912dbf0ebbdc5bd]),
+        affine([0x6d6620b70832d69b, 0xa4c24bb587a85a2a, 0x0ef814ea9da556b2, 0x662f86c0c319bf76], [0xb4a00a36b6b01755, 0x9ce453a997e260a6, 0xc34daf327fbf5a2f, 0x60607b838b44965d]),
+        affine([0xf4b914db5d1fe564, 0x920787b86e624467, 0xeabbad7d3e6c8fdb, 0x10a44094bdc1979f], [0xe45520ff2754251f, 0x2d49e3c61f861315, 0x3dbec941aa68fe05, 0x70fef2cddcbc0a46]),
+        affine([0xe18d61075743efb7, 0xc19bc758b840faba, 0xefd75d21b629268a, 0x0a783811b049c935], [0xed4f699cb4f06d18, 0x6b01af8b3e2c3ba8, 0xa11bcc12c4a8686a, 0x1488cd0b57ffd7f4]),
+        affine([0x9a4c8dbdc04a153e, 0xd7f652fb8cfbeef4, 0x4435e8d0fadfdfe0, 0x14be9f88c331c770], [0x2f5bdb82cbba86a3, 0xae44009878a80213, 0x469344790801092a, 0x310d0695cd0ecda6]),
+        affine([0x3b9d3a0ed2f3acd5, 0x90f9a52e55fc05d0, 0xf64903f20fb52b77, 0x532ab5793e04e8a0], [0x49266361b866345f, 0x98cb5537f6b8b21c, 0x3fc2bbfe60d7f20f, 0x2ed7f8dd7efb6a7f]),
+        affine([0x8d178e5b981434c5, 0x31193d05596b210e, 0x36da052214232bc0, 0x20a88c1e97e4f6aa], [0xb2022491c0a1a2e1, 0xc54d4e39ca3ac77b, 0xe2803af5e527108d, 0x0ff67dba841bc74d]),
+    ],
+    [
+        affine([0x48a8c5b846762890, 0x8b7b62af42e45493, 0x32dc49699ad1ecb6, 0x24c77b8d9305e5a1], [0x28d9633a8ceea8c3, 0x474ff7161d7821ea, 0x0fc78e2ddd100615, 0x39f299435bc68617]),
+        affine([0xdd9498fe1a628179, 0x950b4c914408b756, 0xad49f22a77744704, 0x222cb6121b65fbec], [0x1e600d8df39e8c37, 0x58d3c1f712497032, 0x7393af516c7ea50e, 0x51841da2ae3d4133]),
+        affine([0x5b93181620ac69b1, 0x6ea6078ec547335d, 0x046a3139050ade26, 0x582663ece44ed7ad], [0x78ad51c8da9b439d, 0xc6b73f5ef5528baf, 0x646aa407cc565a97, 0x5743d5036209307a]),
+        affine([0xef767f3c85c1a3da, 0x7096c0e7b5a0e774, 0xc6eeaedc773a5739, 0x4d93efddc88eb9de], [0xbd33e6d8bfbc036c, 0x816d95d2e173b1c2, 0x8e537d602bd399dc, 0x4d9cda346a074a8a]),
+        affine([0xed24a102e26ab21d, 0xec3a2baf408ce062, 0x32189bbce5f4844a, 0x68eb65b3c4ee2405], [0x65ea6c90484890ac, 0x901627e01c76ad1b, 0xabf18c3c06bfcb4c, 0x224a8610ccf4e0a7]),
+        affine([0x1a8b86c22d9f5fa2, 0x9079a814d46dead6, 0xcd9295beeb6d0b6e, 0x652c7183a788f7f7], [0xfe03a946fa73e175, 0x176ce68e3342ddc3, 0x4ddf38621fc1680a, 0x13c1acac2ea827f5]),
+        affine([0xbe342fac8c4ce915, 0x06ddc7c71c3a90e6, 0x8bce245f0e65d3bc, 0x32e8cf47191c1b96], [0x033a083d607fd81c, 0xa5481840c3d1dcfc, 0xb1fee0a30b7ed15f, 0x27a79fbd31cb374d]),
+        affine([0x37a9cb04a57d5337, 0xcddf721a3c5ce06e, 0x6b6dcbe8cab9ca53, 0x33db02b4637336d5], [0xca70aa05e52a7c4c, 0x5565c2d5a4598c63, 0xb7619a60d2d9c1f9, 0x26b936ff6ac4244a]),
+    ],
+];
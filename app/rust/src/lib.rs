@@ -36,7 +36,7 @@ use aes::cipher::{
 };
 use aes::Aes256;
 use binary_ff1::BinaryFF1;
-use jubjub::{AffinePoint, ExtendedPoint, Fr};
+use jubjub::{AffinePoint, ExtendedNielsPoint, ExtendedPoint, Fr};
 
 fn debug(_msg: &str) {}
 
@@ -55,6 +55,22 @@ pub enum ConstantKey {
     ValueCommitmentRandomnessGenerator,
 }
 
+// Mirrors value_commitment_item_t from keys_def.h
+#[repr(C)]
+pub struct ValueCommitmentItem {
+    generator: [u8; 64],
+    rcv: [u8; 32],
+    cv: [u8; 32],
+    weight: [u8; 16],
+    value: u64,
+}
+
+// Terms handed to a single multi-scalar multiplication, bounds the stack use
+const VALUE_COMMITMENT_CHUNK: usize = 4;
+
+// Randomness T of a RedJubjub signature, RNG_LEN in keys_def.h
+const SIGNATURE_RNG_LEN: usize = 80;
+
 #[no_mangle]
 pub extern "C" fn from_bytes_wide(input: &[u8; 64], output: &mut [u8; 32]) -> ParserError {
     let result = Fr::from_bytes_wide(input).to_bytes();
@@ -68,15 +84,20 @@ pub extern "C" fn scalar_multiplication(
     key: ConstantKey,
     output: *mut [u8; 32],
 ) -> ParserError {
-    let key_point = match key {
-        ConstantKey::SpendingKeyGenerator => constants::SPENDING_KEY_GENERATOR,
-        ConstantKey::ProofGenerationKeyGenerator => constants::PROVING_KEY_BASE,
-        ConstantKey::ValueCommitmentRandomnessGenerator => {
-            constants::VALUE_COMMITMENT_RANDOMNESS_GENERATOR
+    let extended_point = match key {
+        ConstantKey::SpendingKeyGenerator => {
+            cryptoops::fixed_base_multiply(&constants::SPENDING_KEY_GENERATOR_TABLE, input)
         }
+        // Only used to derive nk, once per account, not worth the table space
+        ConstantKey::ProofGenerationKeyGenerator => {
+            constants::PROVING_KEY_BASE.multiply_bits(input)
+        }
+        ConstantKey::ValueCommitmentRandomnessGenerator => cryptoops::fixed_base_multiply(
+            &constants::VALUE_COMMITMENT_RANDOMNESS_GENERATOR_TABLE,
+            input,
+        ),
     };
 
-    let extended_point = key_point.multiply_bits(input);
     let result = AffinePoint::from(&extended_point);
 
     unsafe {
@@ -87,6 +108,120 @@ pub extern "C" fn scalar_multiplication(
     ParserError::ParserOk
 }
 
+/// Decompresses the hash of an asset identifier and clears the cofactor, the result is
+/// stored as affine u || v so later commitments skip the square root.
+/// Fails like is_valid_diversifier for hashes that are not a point or of small order.
+#[no_mangle]
+pub extern "C" fn value_commitment_generator(
+    hash: &[u8; 32],
+    generator: &mut [u8; 64],
+) -> ParserError {
+    let point = AffinePoint::from_bytes(*hash);
+    if point.is_none().into() {
+        return ParserError::ParserUnexpectedError;
+    }
+    let point = point.unwrap().mul_by_cofactor();
+    if point == ExtendedPoint::identity() {
+        return ParserError::ParserUnexpectedError;
+    }
+
+    generator.copy_from_slice(&cryptoops::extended_to_uv_bytes(&point));
+    ParserError::ParserOk
+}
+
+/// cv = value * G + rcv * H, G from value_commitment_generator
+#[no_mangle]
+pub extern "C" fn compute_value_commitment(
+    generator: &[u8; 64],
+    value: u64,
+    rcv: &[u8; 32],
+    cv: &mut [u8; 32],
+) -> ParserError {
+    let generator = match cryptoops::uv_bytes_to_extended(generator) {
+        Some(generator) => generator,
+        None => return ParserError::ParserUnexpectedError,
+    };
+
+    // The value is public, only rcv needs the constant time multiplication
+    let mut value_bytes = [0u8; 32];
+    value_bytes[..8].copy_from_slice(&value.to_le_bytes());
+    let point = cryptoops::multiscalar_mul_vartime(&[generator.to_niels()], &[value_bytes])
+        + cryptoops::fixed_base_multiply(
+            &constants::VALUE_COMMITMENT_RANDOMNESS_GENERATOR_TABLE,
+            rcv,
+        );
+
+    cv.copy_from_slice(&cryptoops::extended_to_bytes(&point));
+    ParserError::ParserOk
+}
+
+/// Checks sum(w_i * cv_i) == sum(w_i * v_i * G_i) + sum(w_i * rcv_i) * H for the whole batch,
+/// which holds for random weights only if every cv_i == v_i * G_i + rcv_i * H.
+/// Weights cannot catch small order offsets (two cv_i shifted by the order 2 point cancel out),
+/// so every cv_i must be in the prime order subgroup, as honest commitments are.
+#[no_mangle]
+pub extern "C" fn verify_value_commitments(
+    items: *const ValueCommitmentItem,
+    count: u8,
+) -> ParserError {
+    if items.is_null() {
+        return ParserError::ParserUnexpectedError;
+    }
+    let items = unsafe { core::slice::from_raw_parts(items, count as usize) };
+
+    let mut lhs = ExtendedPoint::identity();
+    let mut rhs = ExtendedPoint::identity();
+    let mut rcv_sum = Fr::from(0u64);
+    for chunk in items.chunks(VALUE_COMMITMENT_CHUNK) {
+        let mut points = [ExtendedNielsPoint::identity(); VALUE_COMMITMENT_CHUNK];
+        let mut scalars = [[0u8; 32]; VALUE_COMMITMENT_CHUNK];
+
+        // sum(w_i * cv_i)
+        for (i, item) in chunk.iter().enumerate() {
+            let cv = AffinePoint::from_bytes(item.cv);
+            if cv.is_none().into() {
+                return ParserError::ParserUnexpectedError;
+            }
+            let cv = ExtendedPoint::from(cv.unwrap());
+            if !bool::from(cv.is_torsion_free()) {
+                return ParserError::ParserUnexpectedError;
+            }
+            points[i] = cv.to_niels();
+            scalars[i][..16].copy_from_slice(&item.weight);
+        }
+        lhs += cryptoops::multiscalar_mul_vartime(&points[..chunk.len()], &scalars[..chunk.len()]);
+
+        // sum(w_i * v_i * G_i), the rcv terms all share H and are added up as scalars
+        for (i, item) in chunk.iter().enumerate() {
+            let generator = match cryptoops::uv_bytes_to_extended(&item.generator) {
+                Some(generator) => generator,
+                None => return ParserError::ParserUnexpectedError,
+            };
+            let rcv = Fr::from_bytes(&item.rcv);
+            if rcv.is_none().into() {
+                return ParserError::ParserUnexpectedError;
+            }
+            // Weights are below 2^128, always canonical
+            let weight = Fr::from_bytes(&scalars[i]).unwrap();
+
+            points[i] = generator.to_niels();
+            scalars[i] = (weight * Fr::from(item.value)).to_bytes();
+            rcv_sum += weight * rcv.unwrap();
+        }
+        rhs += cryptoops::multiscalar_mul_vartime(&points[..chunk.len()], &scalars[..chunk.len()]);
+    }
+    rhs += cryptoops::fixed_base_multiply(
+        &constants::VALUE_COMMITMENT_RANDOMNESS_GENERATOR_TABLE,
+        &rcv_sum.to_bytes(),
+    );
+
+    if lhs == rhs {
+        ParserError::ParserOk
+    } else {
+        ParserError::ParserUnexpectedError
+    }
+}
+
 #[no_mangle]
 pub extern "C" fn is_valid_diversifier(hash: &[u8; 32]) -> ParserError {
     let u = AffinePoint::from_bytes(*hash);
@@ -158,6 +293,64 @@ pub extern "C" fn compute_sbar(
     ParserError::ParserOk
 }
 
+/// RedJubjub spend authorization signatures rbar || sbar, one per alpha, all over the same sighash.
+/// ask is decoded once and rsk, r and s stay field elements from one step to the next; the signed
+/// message rk || sighash is kept in a single buffer where only rk changes between spends.
+#[no_mangle]
+pub extern "C" fn sign_spends_batch(
+    ask: &[u8; 32],
+    sighash: &[u8; 32],
+    alphas: *const [u8; 32],
+    rngs: *const [u8; SIGNATURE_RNG_LEN],
+    count: u8,
+    signatures: *mut [u8; 64],
+) -> ParserError {
+    if alphas.is_null() || rngs.is_null() || signatures.is_null() {
+        return ParserError::ParserUnexpectedError;
+    }
+    let alphas = unsafe { core::slice::from_raw_parts(alphas, count as usize) };
+    let rngs = unsafe { core::slice::from_raw_parts(rngs, count as usize) };
+    let signatures = unsafe { core::slice::from_raw_parts_mut(signatures, count as usize) };
+
+    let ask = Fr::from_bytes(ask);
+    if ask.is_none().into() {
+        return ParserError::ParserUnexpectedError;
+    }
+    let ask = ask.unwrap();
+
+    let mut message = [0u8; 64];
+    message[32..].copy_from_slice(sighash);
+
+    for ((alpha, rng), signature) in alphas.iter().zip(rngs.iter()).zip(signatures.iter_mut()) {
+        bolos::heartbeat();
+
+        let alpha = Fr::from_bytes(alpha);
+        if alpha.is_none().into() {
+            return ParserError::ParserUnexpectedError;
+        }
+        let rsk = ask + alpha.unwrap();
+        let rk = cryptoops::fixed_base_multiply(
+            &constants::SPENDING_KEY_GENERATOR_TABLE,
+            &rsk.to_bytes(),
+        );
+        message[..32].copy_from_slice(&cryptoops::extended_to_bytes(&rk));
+
+        // r = H*(T || M), rbar = r * G, s = H*(rbar || M), sbar = r + s * rsk
+        let r = Fr::from_bytes_wide(&bolos::blake2b::blake2b_redjubjub(rng, &message));
+        let rbar = cryptoops::extended_to_bytes(&cryptoops::fixed_base_multiply(
+            &constants::SPENDING_KEY_GENERATOR_TABLE,
+            &r.to_bytes(),
+        ));
+        let s = Fr::from_bytes_wide(&bolos::blake2b::blake2b_redjubjub(&rbar, &message));
+        let sbar = r + s * rsk;
+
+        signature[..32].copy_from_slice(&rbar);
+        signature[32..].copy_from_slice(&sbar.to_bytes());
+    }
+
+    ParserError::ParserOk
+}
+
 #[no_mangle]
 pub extern "C" fn add_points(
     hash: &[u8; 32],
@@ -196,26 +389,157 @@ fn panic(_info: &PanicInfo) -> ! {
 
 #[cfg(test)]
 mod tests {
-    // use curve25519_dalek::constants::RISTRETTO_BASEPOINT_POINT;
-    // use curve25519_dalek::edwards::EdwardsPoint;
-    // use curve25519_dalek::scalar::Scalar;
-    // use log::{debug, info};
-    // use schnorrkel::{context::*, Keypair, PublicKey, SecretKey, Signature};
-
-    // use crate::*;
-    // use core::ops::Mul;
-
-    // fn init_logging() {
-    //     let _ = env_logger::builder().is_test(true).try_init();
-    // }
-
-    // fn ristretto_scalarmult(sk: &[u8], pk: &mut [u8]) {
-    //     let mut seckey = [0u8; 32];
-    //     seckey.copy_from_slice(&sk[0..32]);
-    //     let pubkey = RISTRETTO_BASEPOINT_POINT
-    //         .mul(Scalar::from_bits(seckey))
-    //         .compress()
-    //         .0;
-    //     pk.copy_from_slice(&pubkey);
-    // }
+    use super::*;
+    use blake2s_simd::Params as Blake2sParams;
+
+    // Dummy note identifier
+    const IDENTIFIER: [u8; 32] = [
+        156, 229, 191, 54, 209, 138, 169, 235, 234, 174, 120, 186, 142, 34, 183, 118, 64, 243, 100,
+        134, 234, 27, 248, 27, 36, 245, 9, 146, 30, 110, 203, 169,
+    ];
+
+    fn generator_hash() -> [u8; 32] {
+        let mut hash = [0u8; 32];
+        hash.copy_from_slice(
+            Blake2sParams::new()
+                .hash_length(32)
+                .personal(b"MASP__v_")
+                .hash(&IDENTIFIER)
+                .as_bytes(),
+        );
+        hash
+    }
+
+    #[test]
+    fn value_commitment_matches_add_points() {
+        let hash = generator_hash();
+        let mut generator = [0u8; 64];
+        assert!(matches!(
+            value_commitment_generator(&hash, &mut generator),
+            ParserError::ParserOk
+        ));
+
+        let rcv = Fr::from(0x1234_5678_9abc_def0u64).to_bytes();
+        for value in [0u64, 1, 1_000_000, u64::MAX] {
+            let mut value_bytes = [0u8; 32];
+            value_bytes[..8].copy_from_slice(&value.to_le_bytes());
+            let mut scalar = [0u8; 32];
+            scalar_multiplication(
+                &rcv,
+                ConstantKey::ValueCommitmentRandomnessGenerator,
+                &mut scalar,
+            );
+            let mut expected = [0u8; 32];
+            add_points(&hash, &value_bytes, &scalar, &mut expected);
+
+            let mut cv = [0u8; 32];
+            assert!(matches!(
+                compute_value_commitment(&generator, value, &rcv, &mut cv),
+                ParserError::ParserOk
+            ));
+            assert_eq!(cv, expected);
+        }
+    }
+
+    fn unhex<const N: usize>(hex: &str) -> [u8; N] {
+        let mut out = [0u8; N];
+        for (i, byte) in out.iter_mut().enumerate() {
+            *byte = u8::from_str_radix(&hex[2 * i..2 * i + 2], 16).unwrap();
+        }
+        out
+    }
+
+    // spend_sig_internal vectors from tests/keps.cpp
+    #[test]
+    fn sign_spends_batch_matches_vectors() {
+        let ask = unhex::<32>("0cd47b62dea686adfd1e96f6503216cdf133e575221400fd65eeaa378f3d450b");
+        let alpha = unhex::<32>("1f666be29fde619463f42658f1d161a77b0caddf7febbaef33b511756b9d3709");
+        let sighash =
+            unhex::<32>("69475d2b9988040d4e76b4dde81954ab54afc54affc6f48e93a618dbc0c21015");
+        let rng = unhex::<80>(
+            "05734daa7328fa0c91a33d78b9c256c06d79b4b38fa01658d6e3c39781464323d166c95227c2fe5e\
+             121e87f7d5d82f712bf0f7a3fa23585543201936370b4562ae3a6604e1870c67cf232bc48fbe39ba",
+        );
+        let expected = unhex::<64>(
+            "d7fbecb584e158c90a02d5ff5914ec729f86f119cee9ed03d1c3af438b30e333\
+             9ea71021df2d6f1f8240350026cacf2e36ffeb6dbc2d8202de782a8fdc27b40a",
+        );
+
+        let alphas = [alpha; 2];
+        let rngs = [rng; 2];
+        let mut signatures = [[0u8; 64]; 2];
+        assert!(matches!(
+            sign_spends_batch(
+                &ask,
+                &sighash,
+                alphas.as_ptr(),
+                rngs.as_ptr(),
+                2,
+                signatures.as_mut_ptr()
+            ),
+            ParserError::ParserOk
+        ));
+        assert_eq!(signatures[0], expected);
+        assert_eq!(signatures[1], expected);
+    }
+
+    #[test]
+    fn value_commitment_generator_rejects_identity() {
+        let mut identity = [0u8; 32];
+        identity[0] = 1;
+        let mut generator = [0u8; 64];
+        assert!(matches!(
+            value_commitment_generator(&identity, &mut generator),
+            ParserError::ParserUnexpectedError
+        ));
+    }
+
+    // Order 2 point (0, -1)
+    const TORSION_POINT: [u8; 32] = [
+        0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5b, 0xfe, 0xff, 0x02, 0xa4, 0xbd,
+        0x53, 0x05, 0xd8, 0xa1, 0x09, 0x08, 0xd8, 0x39, 0x33, 0x48, 0x7d, 0x9d, 0x29, 0x53, 0xa7,
+        0xed, 0x73,
+    ];
+
+    #[test]
+    fn value_commitments_reject_small_order_offsets() {
+        let mut generator = [0u8; 64];
+        assert!(matches!(
+            value_commitment_generator(&generator_hash(), &mut generator),
+            ParserError::ParserOk
+        ));
+        let torsion = ExtendedPoint::from(AffinePoint::from_bytes(TORSION_POINT).unwrap());
+        assert!(bool::from(torsion.is_small_order()));
+
+        let mut items: [ValueCommitmentItem; 2] = core::array::from_fn(|i| {
+            let rcv = Fr::from(0x1000 + i as u64).to_bytes();
+            let value = 1000 * i as u64 + 7;
+            let mut cv = [0u8; 32];
+            compute_value_commitment(&generator, value, &rcv, &mut cv);
+            let mut weight = [0u8; 16];
+            weight[0] = 2 * i as u8 + 1;
+            ValueCommitmentItem {
+                generator,
+                rcv,
+                cv,
+                weight,
+                value,
+            }
+        });
+        assert!(matches!(
+            verify_value_commitments(items.as_ptr(), 2),
+            ParserError::ParserOk
+        ));
+
+        // With odd weights the two offsets add up to the identity, only the subgroup check
+        // rejects them
+        for item in items.iter_mut() {
+            let cv = ExtendedPoint::from(AffinePoint::from_bytes(item.cv).unwrap());
+            item.cv = cryptoops::extended_to_bytes(&(cv + torsion));
+        }
+        assert!(matches!(
+            verify_value_commitments(items.as_ptr(), 2),
+            ParserError::ParserUnexpectedError
+        ));
+    }
 }
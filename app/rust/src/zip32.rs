@@ -185,33 +185,52 @@ pub fn zip32_sapling_derive(
 
 #[inline(never)]
 pub fn diversifier_find_valid(dk: &DkBytes, start: &Diversifier) -> Diversifier {
-    let mut div_list = [0u8; DIV_SIZE * DIV_DEFAULT_LIST_LEN];
-    let mut div_out = diversifier_zero();
-
-    let mut cur_div = diversifier_zero();
-    cur_div.copy_from_slice(start);
-
-    let mut found = false;
-    while !found {
-        // we get some small list
-        diversifier_get_list(dk, &mut cur_div, &mut div_list);
+    let mut div_out = [diversifier_zero(); 1];
+    diversifier_find_valid_list(dk, start, &mut div_out);
+    div_out[0]
+}
 
-        for i in 0..DIV_DEFAULT_LIST_LEN {
-            let tmp = &div_list[i * DIV_SIZE..(i + 1) * DIV_SIZE]
-                .try_into()
-                .unwrap();
+// Fills `out` with the first valid diversifiers found from `start` on.
+// The FF1 instance is built once and candidates are encrypted a block at a time,
+// the group hash checks of a block stop as soon as `out` is full.
+#[inline(never)]
+pub fn diversifier_find_valid_list(dk: &DkBytes, start: &Diversifier, out: &mut [Diversifier]) {
+    let mut scratch = [0u8; 12];
+    let cipher = AesBOLOS::new(dk);
+    let mut ff1 = BinaryFF1::new(&cipher, DIV_SIZE, &[], &mut scratch).unwrap();
+
+    let mut cur_div = *start;
+    let mut block = [diversifier_zero(); DIV_DEFAULT_LIST_LEN];
+    let mut found = 0;
+    while found < out.len() {
+        for d in block.iter_mut() {
+            *d = cur_div;
+            ff1.encrypt(d).unwrap();
+            diversifier_increment(&mut cur_div);
+        }
 
-            if diversifier_is_valid(tmp) {
-                div_out.copy_from_slice(tmp);
-                found = true;
-                break;
+        for d in block.iter() {
+            if diversifier_group_hash_light(d) {
+                out[found] = *d;
+                found += 1;
+                if found == out.len() {
+                    break;
+                }
             }
         }
 
         crate::bolos::heartbeat();
     }
+}
 
-    div_out
+fn diversifier_increment(d: &mut Diversifier) {
+    for k in 0..DIV_SIZE {
+        d[k] = d[k].wrapping_add(1);
+        if d[k] != 0 {
+            // No overflow
+            break;
+        }
+    }
 }
 
 #[inline(never)]
@@ -277,3 +296,56 @@ pub fn pkd_default(ivk: &IvkBytes, d: &Diversifier) -> [u8; 32] {
 
     extended_to_bytes(&y)
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    // Candidate (little-endian counter) a diversifier was encrypted from
+    fn diversifier_index(dk: &DkBytes, d: &Diversifier) -> Diversifier {
+        let mut scratch = [0u8; 12];
+        let cipher = AesBOLOS::new(dk);
+        let mut ff1 = BinaryFF1::new(&cipher, DIV_SIZE, &[], &mut scratch).unwrap();
+        let mut index = *d;
+        ff1.decrypt(&mut index).unwrap();
+        index
+    }
+
+    fn index_value(index: &Diversifier) -> u128 {
+        let mut bytes = [0u8; 16];
+        bytes[..DIV_SIZE].copy_from_slice(index);
+        u128::from_le_bytes(bytes)
+    }
+
+    #[test]
+    fn diversifier_list_matches_single_search() {
+        let dk: DkBytes = [0x42; 32];
+        let mut start = diversifier_zero();
+        start[0] = 7;
+
+        // Spans several candidate blocks
+        let mut list = [diversifier_zero(); 3 * DIV_DEFAULT_LIST_LEN + 1];
+        diversifier_find_valid_list(&dk, &start, &mut list);
+
+        assert_eq!(list[0], diversifier_find_valid(&dk, &start));
+
+        let mut previous = None;
+        for (i, d) in list.iter().enumerate() {
+            assert!(diversifier_group_hash_light(d));
+
+            let mut index = diversifier_index(&dk, d);
+            let value = index_value(&index);
+            assert!(value >= index_value(&start));
+            if let Some(previous) = previous {
+                assert!(value > previous);
+            }
+            previous = Some(value);
+
+            // No valid diversifier is skipped between two entries
+            if i + 1 < list.len() {
+                diversifier_increment(&mut index);
+                assert_eq!(list[i + 1], diversifier_find_valid(&dk, &index));
+            }
+        }
+    }
+}
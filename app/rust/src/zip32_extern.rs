@@ -60,6 +60,27 @@ pub extern "C" fn diversifier_find_valid(zip32_account: u32, div_ptr: *mut Diver
     div_out.copy_from_slice(&zip32::diversifier_find_valid(&dk, &start));
 }
 
+// Finds the first `div_list_len` valid diversifiers with a single key derivation
+#[no_mangle]
+pub extern "C" fn diversifier_find_list(
+    zip32_account: u32,
+    start_ptr: *const Diversifier,
+    div_list_ptr: *mut Diversifier,
+    div_list_len: u8,
+) {
+    if start_ptr.is_null() || div_list_ptr.is_null() || div_list_len == 0 {
+        return;
+    }
+    let path = [ZIP32_PURPOSE, ZIP32_COIN_TYPE, zip32_account];
+    let start = unsafe { &*start_ptr };
+    let div_list = unsafe { core::slice::from_raw_parts_mut(div_list_ptr, div_list_len as usize) };
+
+    let key_bundle = zip32_sapling_derive(&path).0;
+    let dk = key_bundle.dk();
+
+    zip32::diversifier_find_valid_list(&dk, start, div_list);
+}
+
 #[no_mangle]
 pub extern "C" fn zip32_ivk(account: u32, ivk_ptr: *mut IvkBytes) {
     let path = [ZIP32_PURPOSE, ZIP32_COIN_TYPE, account];
@@ -0,0 +1,109 @@
+#!/usr/bin/env python3
+"""
+Generates app/src/token_registry.h from tokens.json.
+
+Every token address is bech32m-decoded into its raw 21-byte form (prefix byte
+followed by the 20-byte hash) and each network table is sorted by those bytes,
+so readToken can binary search the address it parsed without encoding it.
+
+A network is a json entry with the HRP its addresses are encoded with and its
+list of tokens; symbols are written with the trailing space used on screen.
+
+Usage: python3 app/scripts/gen_token_registry.py > app/src/token_registry.h
+"""
+
+import json
+import os
+import sys
+
+CHARSET = "qpzry9x8gf2tvdw0s3jn54khce6mua7l"
+BECH32M_CONST = 0x2BC830A3
+ADDRESS_LEN_BYTES = 21
+
+TOKENS_JSON = os.path.join(os.path.dirname(os.path.abspath(__file__)), "tokens.json")
+
+
+def polymod(values):
+    generator = [0x3B6A57B2, 0x26508E6D, 0x1EA119FA, 0x3D4233DD, 0x2A1462B3]
+    chk = 1
+    for value in values:
+        top = chk >> 25
+        chk = (chk & 0x1FFFFFF) << 5 ^ value
+        for i in range(5):
+            chk ^= generator[i] if ((top >> i) & 1) else 0
+    return chk
+
+
+def hrp_expand(hrp):
+    return [ord(x) >> 5 for x in hrp] + [0] + [ord(x) & 31 for x in hrp]
+
+
+def convert_bits(data, from_bits, to_bits):
+    acc = 0
+    bits = 0
+    out = []
+    for value in data:
+        acc = (acc << from_bits) | value
+        bits += from_bits
+        while bits >= to_bits:
+            bits -= to_bits
+            out.append((acc >> bits) & ((1 << to_bits) - 1))
+    if bits >= from_bits or ((acc << (to_bits - bits)) & ((1 << to_bits) - 1)):
+        raise ValueError("invalid padding")
+    return out
+
+
+def decode_address(address, hrp):
+    pos = address.rfind("1")
+    if address.lower() != address or address[:pos] != hrp:
+        raise ValueError("%s: expected hrp %s" % (address, hrp))
+    data = [CHARSET.find(c) for c in address[pos + 1:]]
+    if -1 in data or len(data) < 6:
+        raise ValueError("%s: invalid characters" % address)
+    if polymod(hrp_expand(hrp) + data) != BECH32M_CONST:
+        raise ValueError("%s: invalid bech32m checksum" % address)
+    raw = convert_bits(data[:-6], 5, 8)
+    if len(raw) != ADDRESS_LEN_BYTES:
+        raise ValueError("%s: expected %d bytes" % (address, ADDRESS_LEN_BYTES))
+    return bytes(raw)
+
+
+def emit_network(out, name, network):
+    entries = []
+    for token in network["tokens"]:
+        symbol = token["symbol"]
+        if not symbol or '"' in symbol or '\\' in symbol:
+            raise ValueError("%s: invalid symbol" % symbol)
+        entries.append((decode_address(token["address"], network["hrp"]), symbol, token["address"]))
+    entries.sort()
+    for prev, cur in zip(entries, entries[1:]):
+        if prev[0] == cur[0]:
+            raise ValueError("%s: duplicated address" % cur[2])
+
+    out.write("\n")
+    if not entries:
+        out.write("static const token_registry_t token_registry_%s = {NULL, 0};\n" % name)
+        return
+    out.write("static const tokens_t tokens_%s[] = {\n" % name)
+    for raw, symbol, address in entries:
+        out.write("    // %s\n" % address)
+        out.write("    {{%s}, \"%s \"},\n" % (", ".join("0x%02x" % b for b in raw), symbol))
+    out.write("};\n\n")
+    out.write("static const token_registry_t token_registry_%s = {tokens_%s, %d};\n" % (name, name, len(entries)))
+
+
+def main():
+    with open(TOKENS_JSON) as f:
+        networks = json.load(f)
+
+    out = sys.stdout
+    out.write("// Generated by app/scripts/gen_token_registry.py from app/scripts/tokens.json, do not edit.\n")
+    out.write("// Entries are sorted by their raw address bytes.\n")
+    out.write("#pragma once\n\n")
+    out.write('#include "parser_txdef.h"\n')
+    for name, network in networks.items():
+        emit_network(out, name, network)
+
+
+if __name__ == "__main__":
+    main()
@@ -48,7 +48,16 @@ __Z_INLINE void extractHDPath(uint32_t rx, uint32_t offset) {
         THROW(APDU_CODE_WRONG_LENGTH);
     }
 
+#if defined(COMPILE_MASP)
+    const uint32_t previousAccount = hdPath[2];
+#endif
     memcpy(hdPath, G_io_apdu_buffer + offset, sizeof(uint32_t) * hdPathLen);
+#if defined(COMPILE_MASP)
+    // Derived keys must not outlive a change of account
+    if (hdPath[2] != previousAccount) {
+        crypto_clearKeysCache();
+    }
+#endif
 
     for (int i = 0; i < hdPathLen; i++) {
         if ((hdPath[i] & 0x80000000) != 0x80000000) {
@@ -68,6 +77,7 @@ __Z_INLINE bool process_chunk(__Z_UNUSED volatile uint32_t *tx, uint32_t rx) {
         case P1_INIT:
             tx_initialize();
             tx_reset();
+            tx_parse_reset();
             extractHDPath(rx, OFFSET_DATA);
             tx_initialized = true;
             return false;
@@ -80,6 +90,7 @@ __Z_INLINE bool process_chunk(__Z_UNUSED volatile uint32_t *tx, uint32_t rx) {
                 tx_initialized = false;
                 THROW(APDU_CODE_OUTPUT_BUFFER_TOO_SMALL);
             }
+            tx_parse_chunk();
             return false;
         case P1_LAST:
             if (!tx_initialized) {
@@ -211,9 +222,33 @@ __Z_INLINE void handleComputeMaspRand(__Z_UNUSED volatile uint32_t *flags, volat
     THROW(APDU_CODE_OK);
 }
 
+__Z_INLINE void handleComputeMaspRandBatch(__Z_UNUSED volatile uint32_t *flags, volatile uint32_t *tx, __Z_UNUSED uint32_t rx) {
+    *tx = 0;
+    const uint8_t type = G_io_apdu_buffer[OFFSET_P1];
+    const uint8_t count = G_io_apdu_buffer[OFFSET_P2];
+    const uint8_t maxCount = type == convert ? MAX_RAND_BATCH_CONVERTS : MAX_RAND_BATCH_PAIRS;
+    if (type > convert || count == 0 || count > maxCount) {
+        THROW(APDU_CODE_INVALIDP1P2);
+    }
+
+    zxerr_t zxerr = app_fill_randomness_batch((masp_type_e) type, count);
+    if (zxerr != zxerr_ok) {
+        transaction_reset();
+        *tx = 0;
+        THROW(APDU_CODE_DATA_INVALID);
+    }
+    *tx = cmdResponseLen;
+    THROW(APDU_CODE_OK);
+}
+
 __Z_INLINE void handleExtractSpendSign(__Z_UNUSED volatile uint32_t *flags, volatile uint32_t *tx, __Z_UNUSED uint32_t rx) {
     *tx = 0;
-    zxerr_t zxerr = app_fill_spend_sig();
+    // P1 = 1 packs as many signatures as fit in the response
+    const uint8_t multiple = G_io_apdu_buffer[OFFSET_P1];
+    if (multiple > 1) {
+        THROW(APDU_CODE_INVALIDP1P2);
+    }
+    zxerr_t zxerr = app_fill_spend_sig(multiple == 1);
     
     if (zxerr != zxerr_ok) {
         *tx = 0;
@@ -226,6 +261,7 @@ __Z_INLINE void handleExtractSpendSign(__Z_UNUSED volatile uint32_t *flags, vola
 __Z_INLINE void handleCleanRandomnessBuffers(__Z_UNUSED volatile uint32_t *flags, volatile uint32_t *tx, __Z_UNUSED uint32_t rx) {
     *tx = 0;
     transaction_reset();
+    crypto_clearKeysCache();
     THROW(APDU_CODE_OK);
 }
 
@@ -323,6 +359,12 @@ void handleApdu(volatile uint32_t *flags, volatile uint32_t *tx, uint32_t rx) {
                     break;
                 }
 
+                case INS_GET_RAND_BATCH: {
+                    CHECK_PIN_VALIDATED()
+                    handleComputeMaspRandBatch(flags, tx, rx);
+                    break;
+                }
+
                 case INS_SIGN_MASP_SPENDS: {
                     CHECK_PIN_VALIDATED()
                     handleSignMaspSpends(flags, tx, rx);
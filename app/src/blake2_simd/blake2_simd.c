@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+#include "blake2_simd.h"
+#include "host_thread_local.h"
+
+#if defined(BLAKE2_SIMD_AVAILABLE)
+static HOST_THREAD_LOCAL blake2_backend_e currentBackend = BLAKE2_BACKEND_REF;
+static HOST_THREAD_LOCAL bool backendDetected = false;
+
+bool blake2_backend_supported(blake2_backend_e backend) {
+    __builtin_cpu_init();
+    switch (backend) {
+        case BLAKE2_BACKEND_REF:
+            return true;
+        case BLAKE2_BACKEND_SSE41:
+            return __builtin_cpu_supports("sse4.1");
+        case BLAKE2_BACKEND_AVX2:
+            return __builtin_cpu_supports("avx2");
+        default:
+            return false;
+    }
+}
+
+blake2_backend_e blake2_backend_get(void) {
+    if (!backendDetected) {
+        if (blake2_backend_supported(BLAKE2_BACKEND_AVX2)) {
+            currentBackend = BLAKE2_BACKEND_AVX2;
+        } else if (blake2_backend_supported(BLAKE2_BACKEND_SSE41)) {
+            currentBackend = BLAKE2_BACKEND_SSE41;
+        }
+        backendDetected = true;
+    }
+    return currentBackend;
+}
+
+bool blake2_backend_set(blake2_backend_e backend) {
+    if (!blake2_backend_supported(backend)) {
+        return false;
+    }
+    currentBackend = backend;
+    backendDetected = true;
+    return true;
+}
+#else
+bool blake2_backend_supported(blake2_backend_e backend) {
+    return backend == BLAKE2_BACKEND_REF;
+}
+
+blake2_backend_e blake2_backend_get(void) {
+    return BLAKE2_BACKEND_REF;
+}
+
+bool blake2_backend_set(blake2_backend_e backend) {
+    return backend == BLAKE2_BACKEND_REF;
+}
+#endif
+
+const char *blake2_backend_name(blake2_backend_e backend) {
+    switch (backend) {
+        case BLAKE2_BACKEND_REF:
+            return "ref";
+        case BLAKE2_BACKEND_SSE41:
+            return "sse41";
+        case BLAKE2_BACKEND_AVX2:
+            return "avx2";
+        default:
+            return "unknown";
+    }
+}
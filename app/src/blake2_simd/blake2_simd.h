@@ -0,0 +1,55 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Vectorised BLAKE2 compression for host builds on x86. The blake2s_*/blake2b_* API keeps the
+// reference implementation as fallback and dispatches here when the CPU supports it.
+#if !defined(LEDGER_SPECIFIC) && (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define BLAKE2_SIMD_AVAILABLE
+#endif
+
+typedef enum {
+    BLAKE2_BACKEND_REF = 0,
+    BLAKE2_BACKEND_SSE41,
+    BLAKE2_BACKEND_AVX2,
+} blake2_backend_e;
+
+// Backend in use, picked from CPUID on first call
+blake2_backend_e blake2_backend_get(void);
+// Forces a backend, returns false and keeps the current one if the CPU does not support it
+bool blake2_backend_set(blake2_backend_e backend);
+bool blake2_backend_supported(blake2_backend_e backend);
+const char *blake2_backend_name(blake2_backend_e backend);
+
+#if defined(BLAKE2_SIMD_AVAILABLE)
+void blake2s_compress_sse41(uint32_t h[8], const uint32_t t[2], const uint32_t f[2], const uint8_t block[64]);
+void blake2b_compress_sse41(uint64_t h[8], const uint64_t t[2], const uint64_t f[2], const uint8_t block[128]);
+void blake2b_compress_avx2(uint64_t h[8], const uint64_t t[2], const uint64_t f[2], const uint8_t block[128]);
+// Compresses one non-final block for each of four independent states in lockstep. Pointers may repeat
+// a scratch state when fewer lanes have data.
+void blake2b_compress_avx2_x4(uint64_t *const h[4], const uint64_t *const t[4], const uint8_t *const blocks[4]);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,154 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+#include "blake2_simd.h"
+
+#if defined(BLAKE2_SIMD_AVAILABLE)
+#include <immintrin.h>
+#include <string.h>
+#include "blake2b_simd_common.h"
+
+#define TARGET_AVX2 __attribute__((target("avx2")))
+
+#define ROTR64_32(x) _mm256_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+#define ROTR64_24(x) _mm256_shuffle_epi8((x), r24)
+#define ROTR64_16(x) _mm256_shuffle_epi8((x), r16)
+#define ROTR64_63(x) _mm256_xor_si256(_mm256_srli_epi64((x), 63), _mm256_add_epi64((x), (x)))
+
+// A whole row of four 64-bit words fits in one register
+#define G1(row1, row2, row3, row4, buf)                              \
+    do {                                                             \
+        row1 = _mm256_add_epi64(_mm256_add_epi64(row1, buf), row2);  \
+        row4 = ROTR64_32(_mm256_xor_si256(row4, row1));              \
+        row3 = _mm256_add_epi64(row3, row4);                         \
+        row2 = ROTR64_24(_mm256_xor_si256(row2, row3));              \
+    } while (0)
+
+#define G2(row1, row2, row3, row4, buf)                              \
+    do {                                                             \
+        row1 = _mm256_add_epi64(_mm256_add_epi64(row1, buf), row2);  \
+        row4 = ROTR64_16(_mm256_xor_si256(row4, row1));              \
+        row3 = _mm256_add_epi64(row3, row4);                         \
+        row2 = ROTR64_63(_mm256_xor_si256(row2, row3));              \
+    } while (0)
+
+#define LOAD_MSG(a, b, c, d) \
+    _mm256_set_epi64x((long long)m[s[d]], (long long)m[s[c]], (long long)m[s[b]], (long long)m[s[a]])
+
+TARGET_AVX2
+void blake2b_compress_avx2(uint64_t h[8], const uint64_t t[2], const uint64_t f[2], const uint8_t block[128]) {
+    const __m256i r16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                         2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+    const __m256i r24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                         3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+
+    uint64_t m[16];
+    memcpy(m, block, sizeof(m));
+
+    const __m256i h0 = _mm256_loadu_si256((const __m256i *)(const void *)&h[0]);
+    const __m256i h1 = _mm256_loadu_si256((const __m256i *)(const void *)&h[4]);
+    __m256i row1 = h0;
+    __m256i row2 = h1;
+    __m256i row3 = _mm256_loadu_si256((const __m256i *)(const void *)&blake2b_simd_IV[0]);
+    __m256i row4 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(const void *)&blake2b_simd_IV[4]),
+                                    _mm256_set_epi64x((long long)f[1], (long long)f[0], (long long)t[1], (long long)t[0]));
+
+    for (uint8_t r = 0; r < 12; r++) {
+        const uint8_t *s = blake2b_simd_sigma[r];
+
+        G1(row1, row2, row3, row4, LOAD_MSG(0, 2, 4, 6));
+        G2(row1, row2, row3, row4, LOAD_MSG(1, 3, 5, 7));
+
+        // Diagonalize
+        row2 = _mm256_permute4x64_epi64(row2, _MM_SHUFFLE(0, 3, 2, 1));
+        row3 = _mm256_permute4x64_epi64(row3, _MM_SHUFFLE(1, 0, 3, 2));
+        row4 = _mm256_permute4x64_epi64(row4, _MM_SHUFFLE(2, 1, 0, 3));
+
+        G1(row1, row2, row3, row4, LOAD_MSG(8, 10, 12, 14));
+        G2(row1, row2, row3, row4, LOAD_MSG(9, 11, 13, 15));
+
+        // Undiagonalize
+        row2 = _mm256_permute4x64_epi64(row2, _MM_SHUFFLE(2, 1, 0, 3));
+        row3 = _mm256_permute4x64_epi64(row3, _MM_SHUFFLE(1, 0, 3, 2));
+        row4 = _mm256_permute4x64_epi64(row4, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+
+    _mm256_storeu_si256((__m256i *)(void *)&h[0], _mm256_xor_si256(h0, _mm256_xor_si256(row1, row3)));
+    _mm256_storeu_si256((__m256i *)(void *)&h[4], _mm256_xor_si256(h1, _mm256_xor_si256(row2, row4)));
+}
+
+// Four independent states, one per 64-bit lane: v[i] holds word i of every state
+#define GX4(a, b, c, d, x, y)                                    \
+    do {                                                         \
+        a = _mm256_add_epi64(_mm256_add_epi64(a, b), x);         \
+        d = ROTR64_32(_mm256_xor_si256(d, a));                   \
+        c = _mm256_add_epi64(c, d);                              \
+        b = ROTR64_24(_mm256_xor_si256(b, c));                   \
+        a = _mm256_add_epi64(_mm256_add_epi64(a, b), y);         \
+        d = ROTR64_16(_mm256_xor_si256(d, a));                   \
+        c = _mm256_add_epi64(c, d);                              \
+        b = ROTR64_63(_mm256_xor_si256(b, c));                   \
+    } while (0)
+
+static inline uint64_t loadWord(const uint8_t *block, uint8_t index) {
+    uint64_t word;
+    memcpy(&word, block + sizeof(word) * index, sizeof(word));
+    return word;
+}
+
+TARGET_AVX2
+void blake2b_compress_avx2_x4(uint64_t *const h[4], const uint64_t *const t[4], const uint8_t *const blocks[4]) {
+    const __m256i r16 = _mm256_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9,
+                                         2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+    const __m256i r24 = _mm256_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10,
+                                         3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+
+    __m256i m[16];
+    for (uint8_t i = 0; i < 16; i++) {
+        m[i] = _mm256_set_epi64x((long long)loadWord(blocks[3], i), (long long)loadWord(blocks[2], i),
+                                 (long long)loadWord(blocks[1], i), (long long)loadWord(blocks[0], i));
+    }
+
+    __m256i v[16];
+    for (uint8_t i = 0; i < 8; i++) {
+        v[i] = _mm256_set_epi64x((long long)h[3][i], (long long)h[2][i], (long long)h[1][i], (long long)h[0][i]);
+        v[i + 8] = _mm256_set1_epi64x((long long)blake2b_simd_IV[i]);
+    }
+    v[12] = _mm256_xor_si256(v[12], _mm256_set_epi64x((long long)t[3][0], (long long)t[2][0],
+                                                      (long long)t[1][0], (long long)t[0][0]));
+    v[13] = _mm256_xor_si256(v[13], _mm256_set_epi64x((long long)t[3][1], (long long)t[2][1],
+                                                      (long long)t[1][1], (long long)t[0][1]));
+
+    for (uint8_t r = 0; r < 12; r++) {
+        const uint8_t *s = blake2b_simd_sigma[r];
+        GX4(v[0], v[4], v[8], v[12], m[s[0]], m[s[1]]);
+        GX4(v[1], v[5], v[9], v[13], m[s[2]], m[s[3]]);
+        GX4(v[2], v[6], v[10], v[14], m[s[4]], m[s[5]]);
+        GX4(v[3], v[7], v[11], v[15], m[s[6]], m[s[7]]);
+        GX4(v[0], v[5], v[10], v[15], m[s[8]], m[s[9]]);
+        GX4(v[1], v[6], v[11], v[12], m[s[10]], m[s[11]]);
+        GX4(v[2], v[7], v[8], v[13], m[s[12]], m[s[13]]);
+        GX4(v[3], v[4], v[9], v[14], m[s[14]], m[s[15]]);
+    }
+
+    for (uint8_t i = 0; i < 8; i++) {
+        uint64_t words[4];
+        _mm256_storeu_si256((__m256i *)(void *)words, _mm256_xor_si256(v[i], v[i + 8]));
+        for (uint8_t lane = 0; lane < 4; lane++) {
+            h[lane][i] ^= words[lane];
+        }
+    }
+}
+#endif
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+// Host build of deps/blake2 BLAKE2b with runtime selected compression. The reference source is
+// compiled here unchanged, only its streaming entry points are renamed so the ones below can
+// route full blocks to the vectorised kernels.
+#if !defined(LEDGER_SPECIFIC)
+#define blake2b_update blake2b_update_ref
+#define blake2b_final blake2b_final_ref
+#include "blake2b-ref.c"
+#undef blake2b_update
+#undef blake2b_final
+
+#include "blake2_simd.h"
+
+int blake2b_update(blake2b_state *S, const void *pin, size_t inlen);
+int blake2b_final(blake2b_state *S, void *out, size_t outlen);
+
+static void blake2b_compress_dispatch(blake2b_state *S, const uint8_t block[BLAKE2B_BLOCKBYTES]) {
+#if defined(BLAKE2_SIMD_AVAILABLE)
+    switch (blake2_backend_get()) {
+        case BLAKE2_BACKEND_AVX2:
+            blake2b_compress_avx2(S->h, S->t, S->f, block);
+            return;
+        case BLAKE2_BACKEND_SSE41:
+            blake2b_compress_sse41(S->h, S->t, S->f, block);
+            return;
+        default:
+            break;
+    }
+#endif
+    blake2b_compress(S, block);
+}
+
+int blake2b_update(blake2b_state *S, const void *pin, size_t inlen) {
+    const uint8_t *in = (const uint8_t *)pin;
+    if (inlen == 0) {
+        return 0;
+    }
+
+    const size_t left = S->buflen;
+    const size_t fill = BLAKE2B_BLOCKBYTES - left;
+    if (inlen > fill) {
+        S->buflen = 0;
+        memcpy(S->buf + left, in, fill);
+        blake2b_increment_counter(S, BLAKE2B_BLOCKBYTES);
+        blake2b_compress_dispatch(S, S->buf);
+        in += fill;
+        inlen -= fill;
+        // The last block is kept buffered for blake2b_final
+        while (inlen > BLAKE2B_BLOCKBYTES) {
+            blake2b_increment_counter(S, BLAKE2B_BLOCKBYTES);
+            blake2b_compress_dispatch(S, in);
+            in += BLAKE2B_BLOCKBYTES;
+            inlen -= BLAKE2B_BLOCKBYTES;
+        }
+    }
+    memcpy(S->buf + S->buflen, in, inlen);
+    S->buflen += inlen;
+    return 0;
+}
+
+int blake2b_final(blake2b_state *S, void *out, size_t outlen) {
+    uint8_t buffer[BLAKE2B_OUTBYTES] = {0};
+
+    if (out == NULL || outlen < S->outlen || blake2b_is_lastblock(S)) {
+        return -1;
+    }
+
+    blake2b_increment_counter(S, S->buflen);
+    blake2b_set_lastblock(S);
+    memset(S->buf + S->buflen, 0, BLAKE2B_BLOCKBYTES - S->buflen);
+    blake2b_compress_dispatch(S, S->buf);
+
+    for (size_t i = 0; i < 8; ++i) {
+        store64(buffer + sizeof(S->h[i]) * i, S->h[i]);
+    }
+
+    memcpy(out, buffer, S->outlen);
+    secure_zero_memory(buffer, sizeof(buffer));
+    return 0;
+}
+#endif
@@ -0,0 +1,120 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+#include "blake2_simd.h"
+
+#if defined(BLAKE2_SIMD_AVAILABLE)
+#include <immintrin.h>
+#include <string.h>
+#include "blake2b_simd_common.h"
+
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+
+#define ROTR64_32(x) _mm_shuffle_epi32((x), _MM_SHUFFLE(2, 3, 0, 1))
+#define ROTR64_24(x) _mm_shuffle_epi8((x), r24)
+#define ROTR64_16(x) _mm_shuffle_epi8((x), r16)
+#define ROTR64_63(x) _mm_xor_si128(_mm_srli_epi64((x), 63), _mm_add_epi64((x), (x)))
+
+// A row of four 64-bit words is split in a low and a high register
+#define G1(row1l, row2l, row3l, row4l, row1h, row2h, row3h, row4h, bufl, bufh) \
+    do {                                                                        \
+        row1l = _mm_add_epi64(_mm_add_epi64(row1l, bufl), row2l);               \
+        row1h = _mm_add_epi64(_mm_add_epi64(row1h, bufh), row2h);               \
+        row4l = ROTR64_32(_mm_xor_si128(row4l, row1l));                         \
+        row4h = ROTR64_32(_mm_xor_si128(row4h, row1h));                         \
+        row3l = _mm_add_epi64(row3l, row4l);                                    \
+        row3h = _mm_add_epi64(row3h, row4h);                                    \
+        row2l = ROTR64_24(_mm_xor_si128(row2l, row3l));                         \
+        row2h = ROTR64_24(_mm_xor_si128(row2h, row3h));                         \
+    } while (0)
+
+#define G2(row1l, row2l, row3l, row4l, row1h, row2h, row3h, row4h, bufl, bufh) \
+    do {                                                                        \
+        row1l = _mm_add_epi64(_mm_add_epi64(row1l, bufl), row2l);               \
+        row1h = _mm_add_epi64(_mm_add_epi64(row1h, bufh), row2h);               \
+        row4l = ROTR64_16(_mm_xor_si128(row4l, row1l));                         \
+        row4h = ROTR64_16(_mm_xor_si128(row4h, row1h));                         \
+        row3l = _mm_add_epi64(row3l, row4l);                                    \
+        row3h = _mm_add_epi64(row3h, row4h);                                    \
+        row2l = ROTR64_63(_mm_xor_si128(row2l, row3l));                         \
+        row2h = ROTR64_63(_mm_xor_si128(row2h, row3h));                         \
+    } while (0)
+
+#define LOAD_MSG(a, b) _mm_set_epi64x((long long)m[s[b]], (long long)m[s[a]])
+
+TARGET_SSE41
+void blake2b_compress_sse41(uint64_t h[8], const uint64_t t[2], const uint64_t f[2], const uint8_t block[128]) {
+    const __m128i r16 = _mm_setr_epi8(2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9);
+    const __m128i r24 = _mm_setr_epi8(3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10);
+
+    uint64_t m[16];
+    memcpy(m, block, sizeof(m));
+
+    __m128i row1l = _mm_loadu_si128((const __m128i *)(const void *)&h[0]);
+    __m128i row1h = _mm_loadu_si128((const __m128i *)(const void *)&h[2]);
+    __m128i row2l = _mm_loadu_si128((const __m128i *)(const void *)&h[4]);
+    __m128i row2h = _mm_loadu_si128((const __m128i *)(const void *)&h[6]);
+    __m128i row3l = _mm_loadu_si128((const __m128i *)(const void *)&blake2b_simd_IV[0]);
+    __m128i row3h = _mm_loadu_si128((const __m128i *)(const void *)&blake2b_simd_IV[2]);
+    __m128i row4l = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(const void *)&blake2b_simd_IV[4]),
+                                  _mm_loadu_si128((const __m128i *)(const void *)t));
+    __m128i row4h = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(const void *)&blake2b_simd_IV[6]),
+                                  _mm_loadu_si128((const __m128i *)(const void *)f));
+    __m128i tmp0;
+    __m128i tmp1;
+
+    for (uint8_t r = 0; r < 12; r++) {
+        const uint8_t *s = blake2b_simd_sigma[r];
+
+        G1(row1l, row2l, row3l, row4l, row1h, row2h, row3h, row4h, LOAD_MSG(0, 2), LOAD_MSG(4, 6));
+        G2(row1l, row2l, row3l, row4l, row1h, row2h, row3h, row4h, LOAD_MSG(1, 3), LOAD_MSG(5, 7));
+
+        // Diagonalize
+        tmp0 = _mm_alignr_epi8(row2h, row2l, 8);
+        tmp1 = _mm_alignr_epi8(row2l, row2h, 8);
+        row2l = tmp0;
+        row2h = tmp1;
+        tmp0 = row3l;
+        row3l = row3h;
+        row3h = tmp0;
+        tmp0 = _mm_alignr_epi8(row4h, row4l, 8);
+        tmp1 = _mm_alignr_epi8(row4l, row4h, 8);
+        row4l = tmp1;
+        row4h = tmp0;
+
+        G1(row1l, row2l, row3l, row4l, row1h, row2h, row3h, row4h, LOAD_MSG(8, 10), LOAD_MSG(12, 14));
+        G2(row1l, row2l, row3l, row4l, row1h, row2h, row3h, row4h, LOAD_MSG(9, 11), LOAD_MSG(13, 15));
+
+        // Undiagonalize
+        tmp0 = _mm_alignr_epi8(row2l, row2h, 8);
+        tmp1 = _mm_alignr_epi8(row2h, row2l, 8);
+        row2l = tmp0;
+        row2h = tmp1;
+        tmp0 = row3l;
+        row3l = row3h;
+        row3h = tmp0;
+        tmp0 = _mm_alignr_epi8(row4l, row4h, 8);
+        tmp1 = _mm_alignr_epi8(row4h, row4l, 8);
+        row4l = tmp1;
+        row4h = tmp0;
+    }
+
+    __m128i *out = (__m128i *)(void *)h;
+    _mm_storeu_si128(&out[0], _mm_xor_si128(_mm_loadu_si128(&out[0]), _mm_xor_si128(row1l, row3l)));
+    _mm_storeu_si128(&out[1], _mm_xor_si128(_mm_loadu_si128(&out[1]), _mm_xor_si128(row1h, row3h)));
+    _mm_storeu_si128(&out[2], _mm_xor_si128(_mm_loadu_si128(&out[2]), _mm_xor_si128(row2l, row4l)));
+    _mm_storeu_si128(&out[3], _mm_xor_si128(_mm_loadu_si128(&out[3]), _mm_xor_si128(row2h, row4h)));
+}
+#endif
@@ -0,0 +1,104 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+#include "blake2_simd.h"
+
+#if defined(BLAKE2_SIMD_AVAILABLE)
+#include <immintrin.h>
+#include <string.h>
+
+static const uint32_t blake2s_IV[8] = {
+    0x6A09E667UL, 0xBB67AE85UL, 0x3C6EF372UL, 0xA54FF53AUL,
+    0x510E527FUL, 0x9B05688CUL, 0x1F83D9ABUL, 0x5BE0CD19UL,
+};
+
+static const uint8_t blake2s_sigma[10][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15},
+    {14, 10, 4, 8, 9, 15, 13, 6, 1, 12, 0, 2, 11, 7, 5, 3},
+    {11, 8, 12, 0, 5, 2, 15, 13, 10, 14, 3, 6, 7, 1, 9, 4},
+    {7, 9, 3, 1, 13, 12, 11, 14, 2, 6, 5, 10, 4, 0, 15, 8},
+    {9, 0, 5, 7, 2, 4, 10, 15, 14, 1, 11, 12, 6, 8, 3, 13},
+    {2, 12, 6, 10, 0, 11, 8, 3, 4, 13, 7, 5, 15, 14, 1, 9},
+    {12, 5, 1, 15, 14, 13, 4, 10, 0, 7, 6, 3, 9, 2, 8, 11},
+    {13, 11, 7, 14, 12, 1, 3, 9, 5, 0, 15, 4, 8, 6, 2, 10},
+    {6, 15, 14, 9, 11, 3, 0, 8, 12, 2, 13, 7, 1, 4, 10, 5},
+    {10, 2, 8, 4, 7, 6, 1, 5, 15, 11, 9, 14, 3, 12, 13, 0},
+};
+
+#define TARGET_SSE41 __attribute__((target("sse4.1")))
+
+// Rotations right by 16 and 8 are byte shuffles, 12 and 7 need shifts
+#define ROTR32_16(x) _mm_shuffle_epi8((x), r16)
+#define ROTR32_8(x) _mm_shuffle_epi8((x), r8)
+#define ROTR32_12(x) _mm_xor_si128(_mm_srli_epi32((x), 12), _mm_slli_epi32((x), 20))
+#define ROTR32_7(x) _mm_xor_si128(_mm_srli_epi32((x), 7), _mm_slli_epi32((x), 25))
+
+// Each row holds four state words, so one call runs the four column (or diagonal) G functions
+#define G1(row1, row2, row3, row4, buf)                  \
+    do {                                                 \
+        row1 = _mm_add_epi32(_mm_add_epi32(row1, buf), row2); \
+        row4 = ROTR32_16(_mm_xor_si128(row4, row1));     \
+        row3 = _mm_add_epi32(row3, row4);                \
+        row2 = ROTR32_12(_mm_xor_si128(row2, row3));     \
+    } while (0)
+
+#define G2(row1, row2, row3, row4, buf)                  \
+    do {                                                 \
+        row1 = _mm_add_epi32(_mm_add_epi32(row1, buf), row2); \
+        row4 = ROTR32_8(_mm_xor_si128(row4, row1));      \
+        row3 = _mm_add_epi32(row3, row4);                \
+        row2 = ROTR32_7(_mm_xor_si128(row2, row3));      \
+    } while (0)
+
+TARGET_SSE41
+void blake2s_compress_sse41(uint32_t h[8], const uint32_t t[2], const uint32_t f[2], const uint8_t block[64]) {
+    const __m128i r16 = _mm_setr_epi8(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+    const __m128i r8 = _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+
+    uint32_t m[16];
+    memcpy(m, block, sizeof(m));
+
+    const __m128i h0 = _mm_loadu_si128((const __m128i *)(const void *)&h[0]);
+    const __m128i h1 = _mm_loadu_si128((const __m128i *)(const void *)&h[4]);
+    __m128i row1 = h0;
+    __m128i row2 = h1;
+    __m128i row3 = _mm_loadu_si128((const __m128i *)(const void *)&blake2s_IV[0]);
+    __m128i row4 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(const void *)&blake2s_IV[4]),
+                                 _mm_setr_epi32((int)t[0], (int)t[1], (int)f[0], (int)f[1]));
+
+    for (uint8_t r = 0; r < 10; r++) {
+        const uint8_t *s = blake2s_sigma[r];
+
+        G1(row1, row2, row3, row4, _mm_setr_epi32((int)m[s[0]], (int)m[s[2]], (int)m[s[4]], (int)m[s[6]]));
+        G2(row1, row2, row3, row4, _mm_setr_epi32((int)m[s[1]], (int)m[s[3]], (int)m[s[5]], (int)m[s[7]]));
+
+        // Diagonalize
+        row2 = _mm_shuffle_epi32(row2, _MM_SHUFFLE(0, 3, 2, 1));
+        row3 = _mm_shuffle_epi32(row3, _MM_SHUFFLE(1, 0, 3, 2));
+        row4 = _mm_shuffle_epi32(row4, _MM_SHUFFLE(2, 1, 0, 3));
+
+        G1(row1, row2, row3, row4, _mm_setr_epi32((int)m[s[8]], (int)m[s[10]], (int)m[s[12]], (int)m[s[14]]));
+        G2(row1, row2, row3, row4, _mm_setr_epi32((int)m[s[9]], (int)m[s[11]], (int)m[s[13]], (int)m[s[15]]));
+
+        // Undiagonalize
+        row2 = _mm_shuffle_epi32(row2, _MM_SHUFFLE(2, 1, 0, 3));
+        row3 = _mm_shuffle_epi32(row3, _MM_SHUFFLE(1, 0, 3, 2));
+        row4 = _mm_shuffle_epi32(row4, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+
+    _mm_storeu_si128((__m128i *)(void *)&h[0], _mm_xor_si128(h0, _mm_xor_si128(row1, row3)));
+    _mm_storeu_si128((__m128i *)(void *)&h[4], _mm_xor_si128(h1, _mm_xor_si128(row2, row4)));
+}
+#endif
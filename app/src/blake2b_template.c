@@ -0,0 +1,219 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+#include "blake2b_template.h"
+#include <zxmacros.h>
+#include "tx_hash.h"
+#include "parser_impl_masp.h"
+#include "blake2_simd/blake2_simd.h"
+#include "host_thread_local.h"
+
+static const char *const TEMPLATE_PERSONALIZATION[BLAKE2B_TEMPLATE_TX_ID] = {
+    ZCASH_HEADERS_HASH_PERSONALIZATION,
+    ZCASH_INPUTS_HASH_PERSONALIZATION,
+    ZCASH_OUTPUTS_HASH_PERSONALIZATION,
+    ZCASH_SAPLING_SPENDS_HASH_PERSONALIZATION,
+    ZCASH_SAPLING_SPENDS_COMPACT_HASH_PERSONALIZATION,
+    ZCASH_SAPLING_SPENDS_NONCOMPACT_HASH_PERSONALIZATION,
+    ZCASH_SAPLING_CONVERTS_HASH_PERSONALIZATION,
+    ZCASH_SAPLING_OUTPUTS_HASH_PERSONALIZATION,
+    ZCASH_SAPLING_OUTPUTS_COMPACT_HASH_PERSONALIZATION,
+    ZCASH_SAPLING_OUTPUTS_MEMOS_HASH_PERSONALIZATION,
+    ZCASH_SAPLING_OUTPUTS_NONCOMPACT_HASH_PERSONALIZATION,
+    ZCASH_SAPLING_HASH_PERSONALIZATION,
+    ZCASH_TRANSPARENT_HASH_PERSONALIZATION,
+};
+
+#if !defined(LEDGER_SPECIFIC)
+// Initialised contexts are kept on hosts only, on the device they would take several KB of RAM
+static HOST_THREAD_LOCAL blake2b_template_ctx_t templates[BLAKE2B_TEMPLATE_COUNT];
+static HOST_THREAD_LOCAL uint16_t templatesReady = 0;
+#endif
+
+static zxerr_t initTemplate(blake2b_template_ctx_t *ctx, blake2b_template_e id) {
+    uint8_t personal[PERSONALIZATION_SIZE] = {0};
+    if (id == BLAKE2B_TEMPLATE_TX_ID) {
+        // Prefix followed by the little endian consensus branch id
+        const uint32_t branch_id = BRANCH_ID_IDENTIFIER;
+        MEMCPY(personal, ZCASH_TX_PERSONALIZATION_PREFIX, PERSONALIZATION_SIZE - sizeof(branch_id));
+        MEMCPY(personal + PERSONALIZATION_SIZE - sizeof(branch_id), &branch_id, sizeof(branch_id));
+    } else {
+        MEMCPY(personal, TEMPLATE_PERSONALIZATION[id], PERSONALIZATION_SIZE);
+    }
+
+#if defined(LEDGER_SPECIFIC)
+    CHECK_CX_OK(cx_blake2b_init2_no_throw(ctx, 8 * BLAKE2B_TEMPLATE_OUTPUT_LEN, NULL, 0, personal, PERSONALIZATION_SIZE));
+#else
+    if (blake2b_init_with_personalization(ctx, BLAKE2B_TEMPLATE_OUTPUT_LEN, personal, PERSONALIZATION_SIZE) != 0) {
+        return zxerr_unknown;
+    }
+#endif
+    return zxerr_ok;
+}
+
+zxerr_t blake2b_template_load(blake2b_template_ctx_t *ctx, blake2b_template_e id) {
+    if (ctx == NULL || id >= BLAKE2B_TEMPLATE_COUNT) {
+        return zxerr_no_data;
+    }
+
+#if defined(LEDGER_SPECIFIC)
+    return initTemplate(ctx, id);
+#else
+    const uint16_t mask = (uint16_t)(1u << id);
+    if ((templatesReady & mask) == 0) {
+        CHECK_ZXERR(initTemplate(&templates[id], id))
+        templatesReady |= mask;
+    }
+
+    *ctx = templates[id];
+    return zxerr_ok;
+#endif
+}
+
+zxerr_t blake2b_template_update(blake2b_template_ctx_t *ctx, const uint8_t *input, size_t inputLen) {
+    if (ctx == NULL) {
+        return zxerr_no_data;
+    }
+#if defined(LEDGER_SPECIFIC)
+    CHECK_CX_OK(cx_hash_no_throw(&ctx->header, 0, input, inputLen, NULL, 0));
+#else
+    if (blake2b_update(ctx, input, inputLen) != 0) {
+        return zxerr_unknown;
+    }
+#endif
+    return zxerr_ok;
+}
+
+zxerr_t blake2b_template_final(blake2b_template_ctx_t *ctx, uint8_t *output) {
+    if (ctx == NULL || output == NULL) {
+        return zxerr_no_data;
+    }
+#if defined(LEDGER_SPECIFIC)
+    CHECK_CX_OK(cx_hash_no_throw(&ctx->header, CX_LAST, NULL, 0, output, BLAKE2B_TEMPLATE_OUTPUT_LEN));
+#else
+    if (blake2b_final(ctx, output, BLAKE2B_TEMPLATE_OUTPUT_LEN) != 0) {
+        return zxerr_unknown;
+    }
+#endif
+    return zxerr_ok;
+}
+
+zxerr_t blake2b_multi_init(blake2b_multi_t *multi, const blake2b_template_e *ids, uint8_t count) {
+    if (multi == NULL || ids == NULL || count == 0 || count > BLAKE2B_MULTI_MAX_LANES) {
+        return zxerr_no_data;
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        CHECK_ZXERR(blake2b_template_load(&multi->lane[i], ids[i]))
+    }
+    multi->count = count;
+    return zxerr_ok;
+}
+
+#if defined(BLAKE2_SIMD_AVAILABLE)
+// Same buffering as blake2b_update: a block is only compressed once more input follows it, so the
+// last one stays buffered for blake2b_final
+static void lockstepUpdate(blake2b_multi_t *multi, const bytes_t *inputs) {
+    static const uint64_t zeroFlags[2] = {0};
+    uint64_t scratchH[8] = {0};
+    const uint64_t scratchT[2] = {0};
+
+    uint16_t offset[BLAKE2B_MULTI_MAX_LANES] = {0};
+    while (true) {
+        uint64_t *h[BLAKE2B_MULTI_MAX_LANES] = {scratchH, scratchH, scratchH, scratchH};
+        const uint64_t *t[BLAKE2B_MULTI_MAX_LANES] = {scratchT, scratchT, scratchT, scratchT};
+        const uint8_t *blocks[BLAKE2B_MULTI_MAX_LANES] = {0};
+        uint8_t ready = 0;
+
+        for (uint8_t i = 0; i < multi->count; i++) {
+            blake2b_state *S = &multi->lane[i];
+            const size_t remaining = inputs[i].len - offset[i];
+            if (S->buflen + remaining <= BLAKE2B_BLOCKBYTES) {
+                continue;
+            }
+
+            const uint8_t *in = inputs[i].ptr + offset[i];
+
+            if (S->buflen == 0) {
+                blocks[ready] = in;
+                offset[i] += BLAKE2B_BLOCKBYTES;
+            } else {
+                const size_t fill = BLAKE2B_BLOCKBYTES - S->buflen;
+                MEMCPY(S->buf + S->buflen, in, fill);
+                offset[i] += (uint16_t)fill;
+                S->buflen = 0;
+                blocks[ready] = S->buf;
+            }
+            S->t[0] += BLAKE2B_BLOCKBYTES;
+            S->t[1] += (S->t[0] < BLAKE2B_BLOCKBYTES);
+            h[ready] = S->h;
+            t[ready] = S->t;
+            ready++;
+        }
+
+        if (ready == 0) {
+            break;
+        }
+        if (ready == 1) {
+            blake2b_compress_avx2(h[0], t[0], zeroFlags, blocks[0]);
+            continue;
+        }
+        for (uint8_t i = ready; i < BLAKE2B_MULTI_MAX_LANES; i++) {
+            blocks[i] = blocks[0];
+        }
+        blake2b_compress_avx2_x4(h, t, blocks);
+    }
+
+    for (uint8_t i = 0; i < multi->count; i++) {
+        blake2b_state *S = &multi->lane[i];
+        const size_t remaining = inputs[i].len - offset[i];
+        if (remaining > 0) {
+            MEMCPY(S->buf + S->buflen, inputs[i].ptr + offset[i], remaining);
+            S->buflen += remaining;
+        }
+    }
+}
+#endif
+
+zxerr_t blake2b_multi_update(blake2b_multi_t *multi, const bytes_t *inputs) {
+    if (multi == NULL || inputs == NULL) {
+        return zxerr_no_data;
+    }
+
+#if defined(BLAKE2_SIMD_AVAILABLE)
+    if (blake2_backend_get() == BLAKE2_BACKEND_AVX2) {
+        lockstepUpdate(multi, inputs);
+        return zxerr_ok;
+    }
+#endif
+
+    for (uint8_t i = 0; i < multi->count; i++) {
+        if (inputs[i].len > 0) {
+            CHECK_ZXERR(blake2b_template_update(&multi->lane[i], inputs[i].ptr, inputs[i].len))
+        }
+    }
+    return zxerr_ok;
+}
+
+zxerr_t blake2b_multi_final(blake2b_multi_t *multi, uint8_t *outputs) {
+    if (multi == NULL || outputs == NULL) {
+        return zxerr_no_data;
+    }
+
+    for (uint8_t i = 0; i < multi->count; i++) {
+        CHECK_ZXERR(blake2b_template_final(&multi->lane[i], outputs + i * BLAKE2B_TEMPLATE_OUTPUT_LEN))
+    }
+    return zxerr_ok;
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "zxerror.h"
+#include "parser_types.h"
+
+#if defined(LEDGER_SPECIFIC)
+#include "cx.h"
+typedef cx_blake2b_t blake2b_template_ctx_t;
+#else
+#include "blake2.h"
+typedef blake2b_state blake2b_template_ctx_t;
+#endif
+
+#define BLAKE2B_TEMPLATE_OUTPUT_LEN 32
+#define BLAKE2B_MULTI_MAX_LANES 4
+
+// One entry per personalisation used by the MASP transaction id (ZIP-244)
+typedef enum {
+    BLAKE2B_TEMPLATE_HEADERS = 0,
+    BLAKE2B_TEMPLATE_INPUTS,
+    BLAKE2B_TEMPLATE_OUTPUTS,
+    BLAKE2B_TEMPLATE_SAPLING_SPENDS,
+    BLAKE2B_TEMPLATE_SAPLING_SPENDS_COMPACT,
+    BLAKE2B_TEMPLATE_SAPLING_SPENDS_NONCOMPACT,
+    BLAKE2B_TEMPLATE_SAPLING_CONVERTS,
+    BLAKE2B_TEMPLATE_SAPLING_OUTPUTS,
+    BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_COMPACT,
+    BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_MEMOS,
+    BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_NONCOMPACT,
+    BLAKE2B_TEMPLATE_SAPLING,
+    BLAKE2B_TEMPLATE_TRANSPARENT,
+    BLAKE2B_TEMPLATE_TX_ID,
+    BLAKE2B_TEMPLATE_COUNT,
+} blake2b_template_e;
+
+// Sets ctx to a personalised 256-bit BLAKE2b context. Hosts initialise each template on first use and
+// copy it afterwards, the device initialises ctx in place.
+zxerr_t blake2b_template_load(blake2b_template_ctx_t *ctx, blake2b_template_e id);
+zxerr_t blake2b_template_update(blake2b_template_ctx_t *ctx, const uint8_t *input, size_t inputLen);
+// Writes BLAKE2B_TEMPLATE_OUTPUT_LEN bytes
+zxerr_t blake2b_template_final(blake2b_template_ctx_t *ctx, uint8_t *output);
+
+// Independent personalised contexts advanced together. On hosts with AVX2, blocks that become ready
+// in several lanes during one update are compressed in lockstep, otherwise lanes are fed one after the
+// other while the caller's record is still hot in cache.
+typedef struct {
+    blake2b_template_ctx_t lane[BLAKE2B_MULTI_MAX_LANES];
+    uint8_t count;
+} blake2b_multi_t;
+
+zxerr_t blake2b_multi_init(blake2b_multi_t *multi, const blake2b_template_e *ids, uint8_t count);
+// inputs holds one entry per lane, entries with len 0 leave the lane untouched
+zxerr_t blake2b_multi_update(blake2b_multi_t *multi, const bytes_t *inputs);
+// Writes count * BLAKE2B_TEMPLATE_OUTPUT_LEN bytes, lane digests in order
+zxerr_t blake2b_multi_final(blake2b_multi_t *multi, uint8_t *outputs);
+
+#ifdef __cplusplus
+}
+#endif
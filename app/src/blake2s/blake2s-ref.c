@@ -21,6 +21,7 @@
 
 #include "blake2.h"
 #include "blake2-impl.h"
+#include "../blake2_simd/blake2_simd.h"
 
 static const uint32_t blake2s_IV[8] =
 {
@@ -197,7 +198,7 @@ int blake2s_init_key( blake2s_state *S, size_t outlen, const void *key, size_t k
     G(r,7,v[ 3],v[ 4],v[ 9],v[14]); \
   } while(0)
 
-static void blake2s_compress( blake2s_state *S, const uint8_t in[BLAKE2S_BLOCKBYTES] )
+static void blake2s_compress_ref( blake2s_state *S, const uint8_t in[BLAKE2S_BLOCKBYTES] )
 {
   uint32_t m[16];
   uint32_t v[16];
@@ -239,6 +240,18 @@ static void blake2s_compress( blake2s_state *S, const uint8_t in[BLAKE2S_BLOCKBY
 #undef G
 #undef ROUND
 
+/* Host builds use the SSE4.1 kernel when available, AVX2 brings nothing more for a single BLAKE2s stream */
+static void blake2s_compress( blake2s_state *S, const uint8_t in[BLAKE2S_BLOCKBYTES] )
+{
+#if defined(BLAKE2_SIMD_AVAILABLE)
+  if( blake2_backend_get() != BLAKE2_BACKEND_REF ) {
+    blake2s_compress_sse41( S->h, S->t, S->f, in );
+    return;
+  }
+#endif
+  blake2s_compress_ref( S, in );
+}
+
 int blake2s_update( blake2s_state *S, const void *pin, size_t inlen )
 {
   const unsigned char * in = (const unsigned char *)pin;
@@ -113,6 +113,11 @@ typedef enum {
 #define INS_SIGN_MASP_SPENDS            0x07
 #define INS_EXTRACT_SPEND_SIGN          0x08
 #define INS_CLEAN_BUFFERS               0x09
+#define INS_GET_RAND_BATCH              0x0B
+
+// Items per INS_GET_RAND_BATCH response, as documented in APDUSPEC.md
+#define MAX_RAND_BATCH_PAIRS            3
+#define MAX_RAND_BATCH_CONVERTS         7
 
 #define APDU_CODE_CHECK_SIGN_TR_FAIL 0x6999
 #ifdef __cplusplus
@@ -82,13 +82,35 @@ __Z_INLINE zxerr_t app_fill_randomness(masp_type_e type) {
     return err;
 }
 
-__Z_INLINE zxerr_t app_fill_spend_sig() {
+__Z_INLINE zxerr_t app_fill_randomness_batch(masp_type_e type, uint8_t count) {
+    // Put data directly in the apdu buffer
+    zemu_log("app_fill_randomness_batch\n");
+    MEMZERO(G_io_apdu_buffer, IO_APDU_BUFFER_SIZE);
+
+    if (get_state() != STATE_INITIAL && get_state() != STATE_PROCESSED_RANDOMNESS) {
+        return zxerr_unknown;
+    }
+
+    cmdResponseLen = 0;
+    zxerr_t err = crypto_computeRandomnessBatch(type, count, G_io_apdu_buffer, IO_APDU_BUFFER_SIZE - 3, &cmdResponseLen);
+
+    if (err != zxerr_ok || cmdResponseLen == 0) {
+        transaction_reset();
+        THROW(APDU_CODE_DATA_INVALID);
+    }
+
+    set_state(STATE_PROCESSED_RANDOMNESS);
+    return err;
+}
+
+__Z_INLINE zxerr_t app_fill_spend_sig(bool multiple) {
     // Put data directly in the apdu buffer
     zemu_log("app_fill_spend_sig\n");
     MEMZERO(G_io_apdu_buffer, IO_APDU_BUFFER_SIZE);
 
     cmdResponseLen = 0;
-    zxerr_t err = crypto_extract_spend_signature(G_io_apdu_buffer, IO_APDU_BUFFER_SIZE - 3, &cmdResponseLen);
+    zxerr_t err = multiple ? crypto_extract_spend_signatures(G_io_apdu_buffer, IO_APDU_BUFFER_SIZE - 3, &cmdResponseLen)
+                           : crypto_extract_spend_signature(G_io_apdu_buffer, IO_APDU_BUFFER_SIZE - 3, &cmdResponseLen);
 
     if (err != zxerr_ok || cmdResponseLen == 0) {
         transaction_reset();
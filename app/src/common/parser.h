@@ -25,12 +25,18 @@ extern "C" {
 const char *parser_getErrorDescription(parser_error_t err);
 const char *parser_getMsgPackTypeDescription(uint8_t type);
 
-//// parses a tx buffer
+//// parses a tx buffer, continuing from parser_parse_chunk if data only grew since then
 parser_error_t parser_parse(parser_context_t *ctx,
                             const uint8_t *data,
                             size_t dataLen,
                             parser_tx_t *tx_obj);
 
+//// parses as much of a partially received tx buffer as possible
+parser_error_t parser_parse_chunk(parser_context_t *ctx,
+                                  const uint8_t *data,
+                                  size_t dataLen,
+                                  parser_tx_t *tx_obj);
+
 //// verifies tx fields
 parser_error_t parser_validate(parser_context_t *ctx);
 
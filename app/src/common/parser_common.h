@@ -22,6 +22,7 @@ extern "C" {
 #include "parser_txdef.h"
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
 
 #define CHECK_ERROR(__CALL) { \
     parser_error_t __err = __CALL;  \
@@ -59,6 +60,7 @@ typedef enum {
     parser_invalid_number_of_spends,
     parser_invalid_number_of_outputs,
     parser_invalid_number_of_converts,
+    parser_invalid_number_of_assets,
     parser_invalid_rk,
     parser_invalid_cv,
     parser_invalid_target_hash,
@@ -69,6 +71,8 @@ typedef struct {
     uint16_t bufferLen;
     uint16_t offset;
     parser_tx_t *tx_obj;
+    // Review items are listed in expert mode, taken from app_mode when parsing starts
+    bool expert;
 } parser_context_t;
 
 #ifdef __cplusplus
@@ -27,6 +27,10 @@
 #elif defined(TARGET_NANOS)
 #define RAM_BUFFER_SIZE 0
 #define FLASH_BUFFER_SIZE 8192
+#else
+// Host emulator, same layout as the larger devices
+#define RAM_BUFFER_SIZE 8192
+#define FLASH_BUFFER_SIZE 16384
 #endif
 
 // Ram
@@ -40,6 +44,9 @@ typedef struct {
 #if defined(TARGET_NANOS) || defined(TARGET_NANOX) || defined(TARGET_NANOS2) || defined(TARGET_STAX) || defined(TARGET_FLEX)
 storage_t NV_CONST N_appdata_impl __attribute__((aligned(64)));
 #define N_appdata (*(NV_VOLATILE storage_t *)PIC(&N_appdata_impl))
+#else
+storage_t N_appdata_impl __attribute__((aligned(64)));
+#define N_appdata N_appdata_impl
 #endif
 
 static parser_tx_t tx_obj;
@@ -73,9 +80,12 @@ parser_tx_t* tx_get_txObject() {
     return &tx_obj;
 }
 
-const char *tx_parse() {
-    MEMZERO(&tx_obj, sizeof(tx_obj));
+void tx_parse_chunk() {
+    // Errors are reported by tx_parse once the last chunk is received
+    parser_parse_chunk(&ctx_parsed_tx, tx_get_buffer(), tx_get_buffer_length(), &tx_obj);
+}
 
+const char *tx_parse() {
     uint8_t err = parser_parse(
             &ctx_parsed_tx,
             tx_get_buffer(),
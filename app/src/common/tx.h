@@ -40,11 +40,18 @@ uint32_t tx_get_buffer_length();
 /// \return
 uint8_t *tx_get_buffer();
 
+/// Parse the sections already stored in the transaction buffer
+/// This function should be called after each chunk, tx_parse will continue from there.
+void tx_parse_chunk();
+
 /// Parse message stored in transaction buffer
 /// This function should be called as soon as full buffer data is loaded.
 /// \return It returns NULL if data is valid or error message otherwise.
 const char *tx_parse();
 
+/// Drops any partially parsed transaction
+void tx_parse_reset();
+
 /// Return the number of items in the transaction
 zxerr_t tx_getNumItems(uint8_t *num_items);
 
@@ -48,6 +48,7 @@
 #define SIGN_PREHASH_SIZE (SIGN_PREFIX_SIZE + CX_SHA256_SIZE)
 
 #define MAX_SIGNATURE_HASHES 10
+#define SIGN_SPENDS_BATCH_SIZE 4
 
 #if defined(COMPILE_MASP) && defined(LEDGER_SPECIFIC)
 uint8_t change_address[PAYMENT_ADDR_LEN];
@@ -400,8 +401,8 @@ zxerr_t crypto_sign(const parser_tx_t *txObj, uint8_t *output, uint16_t outputLe
     section_hashes.indices.ptr[section_hashes.hashesLen] = code->idx;
     section_hashes.indices.ptr[section_hashes.hashesLen+1] = data->idx;
     // Concatenate the code and data section hashes
-    CHECK_ZXERR(crypto_hashCodeSection(code, codeHash, HASH_LEN))
-    CHECK_ZXERR(crypto_hashDataSection(data, dataHash, HASH_LEN))
+    MEMCPY(codeHash, code->section_hash, HASH_LEN);
+    MEMCPY(dataHash, data->section_hash, HASH_LEN);
     section_hashes.hashesLen += 2;
     signature_section.hashes.hashesLen += 2;
 
@@ -422,7 +423,7 @@ zxerr_t crypto_sign(const parser_tx_t *txObj, uint8_t *output, uint16_t outputLe
         const section_t *memo = txObj->transaction.header.memoSection;
         uint8_t *memoHash = section_hashes.hashes.ptr + (section_hashes.hashesLen * HASH_LEN);
         section_hashes.indices.ptr[section_hashes.hashesLen] = memo->idx;
-        CHECK_ZXERR(crypto_hashExtraDataSection(memo, memoHash, HASH_LEN))
+        MEMCPY(memoHash, memo->section_hash, HASH_LEN);
         section_hashes.hashesLen++;
         signature_section.hashes.hashesLen++;
     }
@@ -496,6 +497,19 @@ zxerr_t crypto_sign(const parser_tx_t *txObj, uint8_t *output, uint16_t outputLe
 }
 
 // MASP
+#if defined(COMPILE_MASP)
+// Key bundle of the last ZIP-32 account, reused by get keys and spend signing requests
+static keys_t cachedKeys;
+static uint32_t cachedKeysAccount;
+static bool cachedKeysValid = false;
+
+void crypto_clearKeysCache(void) {
+    MEMZERO(&cachedKeys, sizeof(cachedKeys));
+    cachedKeysAccount = 0;
+    cachedKeysValid = false;
+}
+#endif
+
 static zxerr_t computeKeys(keys_t * saplingKeys) {
     if (saplingKeys == NULL) {
         return zxerr_no_data;
@@ -503,6 +517,14 @@ static zxerr_t computeKeys(keys_t * saplingKeys) {
 
     CHECK_ZXERR(verify_zip32_path());
 
+#if defined(COMPILE_MASP)
+    if (cachedKeysValid && cachedKeysAccount == hdPath[2]) {
+        MEMCPY(saplingKeys, &cachedKeys, sizeof(keys_t));
+        return zxerr_ok;
+    }
+    crypto_clearKeysCache();
+#endif
+
     // Compute ask, nsk
     zip32_child_ask_nsk(hdPath[2], saplingKeys->ask, saplingKeys->nsk);
 
@@ -515,6 +537,12 @@ static zxerr_t computeKeys(keys_t * saplingKeys) {
     // Compute address
     get_pkd(hdPath[2], saplingKeys->diversifier, saplingKeys->pkd);
 
+#if defined(COMPILE_MASP)
+    MEMCPY(&cachedKeys, saplingKeys, sizeof(keys_t));
+    cachedKeysAccount = hdPath[2];
+    cachedKeysValid = true;
+#endif
+
     return zxerr_ok;
 }
 
@@ -637,47 +665,6 @@ zxerr_t crypto_fillMASP(uint8_t *buffer, uint16_t bufferLen, uint16_t *cmdRespon
 
 // https://github.com/anoma/masp/blob/8d83b172698098fba393006016072bc201ed9ab7/masp_primitives/src/sapling.rs#L170
 // https://github.com/anoma/masp/blob/main/masp_primitives/src/sapling/redjubjub.rs#L136
-static zxerr_t sign_sapling_spend(keys_t *keys, uint8_t alpha[static KEY_LENGTH], uint8_t sign_hash[static KEY_LENGTH], uint8_t *signature) {
-    if (alpha == NULL || sign_hash == NULL || signature == NULL) {
-        return zxerr_no_data;
-    }
-
-    uint8_t data_to_be_signed[2 * HASH_LEN] = {0};
-    uint8_t rsk[KEY_LENGTH] = {0};
-    uint8_t rk[KEY_LENGTH] = {0};
-
-    // get randomized secret
-    CHECK_PARSER_OK(parser_randomized_secret_from_seed(keys->ask, alpha, rsk));
-
-    //rsk to rk
-    CHECK_PARSER_OK(parser_scalar_multiplication(rsk, SpendingKeyGenerator, rk));
-
-    // sign
-    MEMCPY(data_to_be_signed, rk, KEY_LENGTH);
-    MEMCPY(data_to_be_signed + KEY_LENGTH, sign_hash, HASH_LEN);
-
-    // Get rng
-    uint8_t rng[RNG_LEN] = {0};
-    cx_rng_no_throw(rng, RNG_LEN);
-
-    // Compute r and rbar
-    uint8_t r[32] = {0};
-    uint8_t rbar[32] = {0};
-    CHECK_PARSER_OK(h_star(rng, sizeof(rng), data_to_be_signed, sizeof(data_to_be_signed), r));
-    CHECK_PARSER_OK(parser_scalar_multiplication(r, SpendingKeyGenerator, rbar));
-
-    //compute s and sbar
-    uint8_t s[32] = {0};
-    uint8_t sbar[32] = {0};
-    CHECK_PARSER_OK(h_star(rbar, sizeof(rbar), data_to_be_signed, sizeof(data_to_be_signed), s));
-    CHECK_PARSER_OK(parser_compute_sbar(s, r, rsk, sbar));
-
-    MEMCPY(signature, rbar, HASH_LEN);
-    MEMCPY(signature + HASH_LEN, sbar, HASH_LEN);
-
-    return zxerr_ok;
-}
-
 zxerr_t crypto_sign_spends_sapling(const parser_tx_t *txObj, keys_t *keys) {
     zemu_log_stack("crypto_signspends_sapling");
     if (txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_spends == 0) {
@@ -688,27 +675,46 @@ zxerr_t crypto_sign_spends_sapling(const parser_tx_t *txObj, keys_t *keys) {
     uint8_t sign_hash[HASH_LEN] = {0};
     signature_hash(txObj, sign_hash);
 
-    uint8_t signature[2 * HASH_LEN] = {0};
-    const uint8_t *spend = txObj->transaction.sections.maspBuilder.builder.sapling_builder.spends.ptr;
-    uint16_t spendLen = 0;
-
-    for (uint64_t i = 0; i < txObj->transaction.sections.maspBuilder.builder.sapling_builder.n_spends; i++) {
-        // Get spend description and alpha
-        spend += spendLen;
-        spend_item_t *item = spendlist_retrieve_rand_item(i);
+    // Spends are signed in chunks, ask and the sighash are handed once per chunk
+    uint8_t alphas[SIGN_SPENDS_BATCH_SIZE][KEY_LENGTH] = {0};
+    uint8_t rngs[SIGN_SPENDS_BATCH_SIZE][RNG_LEN] = {0};
+    uint8_t signatures[SIGN_SPENDS_BATCH_SIZE][SIGNATURE_SIZE] = {0};
+
+    const uint64_t n_spends = txObj->transaction.sections.maspBuilder.builder.sapling_builder.n_spends;
+    zxerr_t err = zxerr_ok;
+    for (uint64_t first = 0; first < n_spends && err == zxerr_ok; first += SIGN_SPENDS_BATCH_SIZE) {
+        const uint8_t count = (n_spends - first) < SIGN_SPENDS_BATCH_SIZE ? (uint8_t)(n_spends - first) : SIGN_SPENDS_BATCH_SIZE;
+        for (uint8_t i = 0; i < count; i++) {
+            // Get alpha
+            const spend_item_t *item = spendlist_retrieve_rand_item(first + i);
+            if (item == NULL) {
+                err = zxerr_no_data;
+                break;
+            }
+            MEMCPY(alphas[i], item->alpha, KEY_LENGTH);
+            cx_rng_no_throw(rngs[i], RNG_LEN);
+        }
+        if (err != zxerr_ok) {
+            break;
+        }
 
         io_seproxyhal_io_heartbeat();
-        CHECK_ZXERR(sign_sapling_spend(keys, item->alpha, sign_hash, signature));
+        if (sign_spends_batch(keys->ask, sign_hash, (const uint8_t *)alphas, (const uint8_t *)rngs, count, (uint8_t *)signatures) != parser_ok) {
+            err = zxerr_unknown;
+            break;
+        }
         io_seproxyhal_io_heartbeat();
 
-        // Save signature in flash
-        CHECK_ZXERR(spend_signatures_append(signature));
-
-        // Get this spend lenght to get next one
-        getSpendDescriptionLen(spend, &spendLen);
+        // Save signatures in flash
+        for (uint8_t i = 0; i < count && err == zxerr_ok; i++) {
+            err = spend_signatures_append(signatures[i]);
+        }
     }
 
-    return zxerr_ok;
+    MEMZERO(alphas, sizeof(alphas));
+    MEMZERO(rngs, sizeof(rngs));
+    MEMZERO(signatures, sizeof(signatures));
+    return err;
 }
 
 zxerr_t crypto_extract_spend_signature(uint8_t *buffer, uint16_t bufferLen, uint16_t *cmdResponseLen) {
@@ -722,47 +728,75 @@ zxerr_t crypto_extract_spend_signature(uint8_t *buffer, uint16_t bufferLen, uint
     return get_next_spend_signature(buffer);
 }
 
-parser_error_t checkSpends(const parser_tx_t *txObj, keys_t *keys, parser_context_t *builder_spends_ctx, parser_context_t *tx_spends_ctx, parser_context_t *indices_ctx) {
+zxerr_t crypto_extract_spend_signatures(uint8_t *buffer, uint16_t bufferLen, uint16_t *cmdResponseLen) {
+    if (!spend_signatures_more_extract() || (get_state() != STATE_SIGNED_SPENDS && get_state() != STATE_EXTRACT_SPENDS)) {
+        zemu_log_stack("crypto_extract_spend_signatures: no more signatures");
+        return zxerr_unknown;
+    }
+    if (buffer == NULL || cmdResponseLen == NULL || bufferLen < SPEND_SIGNATURES_HEADER_LEN + SIGNATURE_SIZE) {
+        return zxerr_buffer_too_small;
+    }
+
+    MEMZERO(buffer, bufferLen);
+    // Header: index of the first signature, signatures in this response, total signatures
+    const uint8_t maxCount = (bufferLen - SPEND_SIGNATURES_HEADER_LEN) / SIGNATURE_SIZE;
+    uint8_t index = 0;
+    uint8_t count = 0;
+    CHECK_ZXERR(get_next_spend_signatures(buffer + SPEND_SIGNATURES_HEADER_LEN, maxCount, &index, &count))
+    buffer[0] = index;
+    buffer[1] = count;
+    buffer[2] = transaction_get_n_spend_signatures();
+
+    *cmdResponseLen = SPEND_SIGNATURES_HEADER_LEN + count * SIGNATURE_SIZE;
+    return zxerr_ok;
+}
+
+// With a batch the value commitments are queued, without one each is recomputed and compared
+static parser_error_t checkValueCommitment(value_commitment_batch_t *batch, uint64_t value, uint8_t *rcv, uint8_t *generator, const uint8_t *cv) {
+    if (batch != NULL) {
+        return valueCommitmentBatchAdd(batch, value, rcv, generator, cv);
+    }
+
+    uint8_t expected[KEY_LENGTH] = {0};
+    CHECK_ERROR(compute_value_commitment(generator, value, rcv, expected));
+    if (MEMCMP(expected, cv, CV_LEN) != 0) {
+        return parser_invalid_cv;
+    }
+    return parser_ok;
+}
+
+parser_error_t checkSpends(const parser_tx_t *txObj, keys_t *keys, parser_context_t *builder_spends_ctx, parser_context_t *tx_spends_ctx, value_commitment_batch_t *batch) {
     if (txObj == NULL || keys == NULL) {
         return parser_unexpected_error;
     }
 
-    if (txObj->transaction.sections.maspBuilder.metadata.n_spends_indices != txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_spends) {
+    const masp_sapling_metadata_t *metadata = &txObj->transaction.sections.maspBuilder.metadata;
+    if (metadata->n_spends_indices != txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_spends) {
         return parser_invalid_number_of_spends;
     }
 
-    for (uint64_t indice = 0; indice < txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_spends; indice++) {
-        // Find the spend descriptor information object corresponding to this
-        // spend descriptor
-        uint32_t i;
-        indices_ctx->offset = 0;
-        for (i = 0; i < txObj->transaction.sections.maspBuilder.metadata.n_spends_indices; i++) {
-            uint64_t curr_indice;
-            CHECK_ERROR(readUint64(indices_ctx, &curr_indice));
-            if (curr_indice == indice) break;
+    for (uint32_t indice = 0; indice < metadata->n_spends_indices; indice++) {
+        // Spend descriptor information object corresponding to this spend descriptor
+        const uint8_t i = metadata->spends_inverse[indice];
+        if (i == INVALID_METADATA_INDEX) {
+            return parser_invalid_number_of_spends;
         }
 
         CTX_CHECK_AND_ADVANCE(tx_spends_ctx, SHIELDED_SPENDS_LEN * indice);
         spend_item_t *item = spendlist_retrieve_rand_item(indice);
 
-        if(i > txObj->transaction.sections.maspBuilder.metadata.n_spends_indices) {
-            return parser_invalid_number_of_spends;
-        } 
-        
-        CHECK_ERROR(getNextSpendDescription(builder_spends_ctx, i));
+        CHECK_ERROR(getSpendDescription(&txObj->transaction.sections.maspBuilder.builder.sapling_builder, i, builder_spends_ctx));
 
         //check cv computation validaded in cpp_tests
-        uint8_t cv[KEY_LENGTH] = {0};
+        uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
         uint8_t identifier[IDENTIFIER_LEN] = {0};
         uint64_t value = 0;
         CTX_CHECK_AND_ADVANCE(builder_spends_ctx, EXTENDED_FVK_LEN + DIVERSIFIER_LEN)
         CHECK_ERROR(readBytesSize(builder_spends_ctx, identifier, IDENTIFIER_LEN));
         CHECK_ERROR(readUint64(builder_spends_ctx, &value));
 
-        CHECK_ERROR(computeValueCommitment(value, item->rcv, identifier, cv));
-        if(MEMCMP(cv, tx_spends_ctx->buffer + tx_spends_ctx->offset, CV_LEN) != 0) {
-            return parser_invalid_cv;
-        }
+        CHECK_ERROR(computeValueCommitmentGenerator(identifier, generator));
+        CHECK_ERROR(checkValueCommitment(batch, value, item->rcv, generator, tx_spends_ctx->buffer + tx_spends_ctx->offset));
 
         //check rk
         uint8_t rk[KEY_LENGTH] = {0};
@@ -770,39 +804,40 @@ parser_error_t checkSpends(const parser_tx_t *txObj, keys_t *keys, parser_contex
 
         CTX_CHECK_AND_ADVANCE(tx_spends_ctx, CV_LEN + NULLIFIER_LEN);
 
-        builder_spends_ctx->offset = 0;
         tx_spends_ctx->offset = 0;
     }
     return parser_ok;
 }
 
-parser_error_t checkOutputs(const parser_tx_t *txObj, parser_context_t *builder_outputs_ctx, parser_context_t *tx_outputs_ctx, parser_context_t *indices_ctx) {
+parser_error_t checkOutputs(const parser_tx_t *txObj, parser_context_t *builder_outputs_ctx, parser_context_t *tx_outputs_ctx, value_commitment_batch_t *batch) {
     if (txObj == NULL) {
         return parser_unexpected_error;
     }
 
-    if (txObj->transaction.sections.maspBuilder.metadata.n_outputs_indices > txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_outputs) {
+    const masp_sapling_metadata_t *metadata = &txObj->transaction.sections.maspBuilder.metadata;
+    const uint64_t n_shielded_outputs = txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_outputs;
+    if (metadata->n_outputs_indices > n_shielded_outputs || n_shielded_outputs > SPEND_LIST_SIZE) {
         return parser_invalid_number_of_outputs;
     }
 
-    for (uint64_t indice = 0; indice < txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_outputs; indice++) {
-        // Find the output descriptor information object corresponding to this
-        // output descriptor
-        uint32_t i;
-        indices_ctx->offset = 0;
-        for (i = 0; i < txObj->transaction.sections.maspBuilder.metadata.n_outputs_indices; i++) {
-            uint64_t curr_indice;
-            CHECK_ERROR(readUint64(indices_ctx, &curr_indice));
-            if (curr_indice == indice) break;
+    // Every builder output must land inside the bundle, the remaining positions hold dummy outputs
+    for (uint32_t i = 0; i < metadata->n_outputs_indices; i++) {
+        if (metadata->outputs_forward[i] >= n_shielded_outputs) {
+            return parser_invalid_number_of_outputs;
         }
+    }
+
+    for (uint32_t indice = 0; indice < n_shielded_outputs; indice++) {
+        // Output descriptor information object corresponding to this output descriptor, if any
+        const uint8_t i = metadata->outputs_inverse[indice];
         CTX_CHECK_AND_ADVANCE(tx_outputs_ctx, SHIELDED_OUTPUTS_LEN * indice);
         output_item_t *item = outputlist_retrieve_rand_item(indice);
         uint64_t value = 0;
         // Use the dummy note identifier as the default
         uint8_t identifier[IDENTIFIER_LEN] = DEFAULT_IDENTIFIER;
 
-        if (i < txObj->transaction.sections.maspBuilder.metadata.n_outputs_indices) {
-            CHECK_ERROR(getNextOutputDescription(builder_outputs_ctx, i));
+        if (i != INVALID_METADATA_INDEX) {
+            CHECK_ERROR(getOutputDescription(&txObj->transaction.sections.maspBuilder.builder.sapling_builder, i, builder_outputs_ctx));
             uint8_t has_ovk = 0;
             CHECK_ERROR(readByte(builder_outputs_ctx, &has_ovk));
             CTX_CHECK_AND_ADVANCE(builder_outputs_ctx, (has_ovk ? KEY_LENGTH : 0) + PAYMENT_ADDR_LEN);
@@ -811,38 +846,33 @@ parser_error_t checkOutputs(const parser_tx_t *txObj, parser_context_t *builder_
         }
 
         //check cv computation validaded in cpp_tests
-        uint8_t cv[KEY_LENGTH] = {0};
-        CHECK_ERROR(computeValueCommitment(value, item->rcv, identifier, cv));
-        if(MEMCMP(cv, tx_outputs_ctx->buffer + tx_outputs_ctx->offset, CV_LEN) != 0) {
-            return parser_invalid_cv;
-        }
+        uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+        CHECK_ERROR(computeValueCommitmentGenerator(identifier, generator));
+        CHECK_ERROR(checkValueCommitment(batch, value, item->rcv, generator, tx_outputs_ctx->buffer + tx_outputs_ctx->offset));
 
-        builder_outputs_ctx->offset = 0;
         tx_outputs_ctx->offset = 0;
-        indices_ctx->offset = 0;
     }
     return parser_ok;
 }
 
-parser_error_t checkConverts(const parser_tx_t *txObj, parser_context_t *builder_converts_ctx, parser_context_t *tx_converts_ctx, parser_context_t *indices_ctx) {
+parser_error_t checkConverts(const parser_tx_t *txObj, parser_context_t *builder_converts_ctx, parser_context_t *tx_converts_ctx, value_commitment_batch_t *batch) {
     if (txObj == NULL) {
         return parser_unexpected_error;
     }
 
-    if (txObj->transaction.sections.maspBuilder.metadata.n_converts_indices != txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_converts) {
+    const masp_sapling_metadata_t *metadata = &txObj->transaction.sections.maspBuilder.metadata;
+    if (metadata->n_converts_indices != txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_converts) {
         return parser_invalid_number_of_converts;
     }
 
     for (uint32_t i = 0; i < txObj->transaction.sections.maspBuilder.builder.sapling_builder.n_converts; i++) {
-        CHECK_ERROR(getNextConvertDescription(builder_converts_ctx, i));
+        CHECK_ERROR(getConvertDescription(&txObj->transaction.sections.maspBuilder.builder.sapling_builder, i, builder_converts_ctx));
 
-        uint64_t indice = 0;
-        CHECK_ERROR(readUint64(indices_ctx, &indice));
+        const uint8_t indice = metadata->converts_forward[i];
         CTX_CHECK_AND_ADVANCE(tx_converts_ctx, SHIELDED_CONVERTS_LEN * indice);
         convert_item_t *item = convertlist_retrieve_rand_item(indice);
 
         //check cv (computation validaded in cpp_tests
-        uint8_t cv[KEY_LENGTH] = {0};
         uint8_t generator[IDENTIFIER_LEN] = {0};
         uint64_t value = 0;
 
@@ -853,22 +883,16 @@ parser_error_t checkConverts(const parser_tx_t *txObj, parser_context_t *builder
         CHECK_ERROR(readBytesSize(builder_converts_ctx, generator, IDENTIFIER_LEN));
         CHECK_ERROR(readUint64(builder_converts_ctx, &value));
 
-        CHECK_ERROR(computeConvertValueCommitment(value, item->rcv, generator, cv));
-        if(MEMCMP(cv, tx_converts_ctx->buffer + tx_converts_ctx->offset, CV_LEN) != 0) {
-            return parser_invalid_cv;
-        }
+        uint8_t point[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+        CHECK_ERROR(value_commitment_generator(generator, point));
+        CHECK_ERROR(checkValueCommitment(batch, value, item->rcv, point, tx_converts_ctx->buffer + tx_converts_ctx->offset));
 
-        builder_converts_ctx->offset = 0;
         tx_converts_ctx->offset = 0;
     }
     return parser_ok;
 }
 
-zxerr_t crypto_check_masp(const parser_tx_t *txObj, keys_t *keys) {
-    if (txObj == NULL || keys == NULL) {
-        return zxerr_unknown;
-    }
-
+static parser_error_t checkMaspDescriptions(const parser_tx_t *txObj, keys_t *keys, value_commitment_batch_t *batch) {
     // For now verify cv and rk https://github.com/anoma/masp/blob/main/masp_proofs/src/sapling/prover.rs#L278    
     // Check Spends
     parser_context_t builder_spends_ctx =  {.buffer = txObj->transaction.sections.maspBuilder.builder.sapling_builder.spends.ptr,
@@ -879,12 +903,8 @@ zxerr_t crypto_check_masp(const parser_tx_t *txObj, keys_t *keys) {
                                       .bufferLen = txObj->transaction.sections.maspTx.data.sapling_bundle.shielded_spends.len,
                                       .offset = 0, 
                                       .tx_obj = NULL};
-    parser_context_t spends_indices_ctx = {.buffer = txObj->transaction.sections.maspBuilder.metadata.spends_indices.ptr,
-                                        .bufferLen = txObj->transaction.sections.maspBuilder.metadata.spends_indices.len,
-                                        .offset = 0, 
-                                        .tx_obj = NULL};
     io_seproxyhal_io_heartbeat();
-    CHECK_PARSER_OK(checkSpends(txObj, keys, &builder_spends_ctx, &tx_spends_ctx, &spends_indices_ctx));
+    CHECK_ERROR(checkSpends(txObj, keys, &builder_spends_ctx, &tx_spends_ctx, batch));
 
     // Check outputs
     parser_context_t builder_outputs_ctx = {.buffer = txObj->transaction.sections.maspBuilder.builder.sapling_builder.outputs.ptr,
@@ -895,12 +915,8 @@ zxerr_t crypto_check_masp(const parser_tx_t *txObj, keys_t *keys) {
                                      .bufferLen = txObj->transaction.sections.maspTx.data.sapling_bundle.shielded_outputs.len,
                                      .offset = 0, 
                                      .tx_obj = NULL};
-    parser_context_t output_indices_ctx = {.buffer = txObj->transaction.sections.maspBuilder.metadata.outputs_indices.ptr,
-                                .bufferLen = txObj->transaction.sections.maspBuilder.metadata.outputs_indices.len,
-                                .offset = 0, 
-                                .tx_obj = NULL};
     io_seproxyhal_io_heartbeat();
-    CHECK_PARSER_OK(checkOutputs(txObj, &builder_outputs_ctx, &tx_outputs_ctx, &output_indices_ctx));
+    CHECK_ERROR(checkOutputs(txObj, &builder_outputs_ctx, &tx_outputs_ctx, batch));
 
     // Check converts
     parser_context_t builder_converts_ctx = {.buffer = txObj->transaction.sections.maspBuilder.builder.sapling_builder.converts.ptr,
@@ -911,12 +927,29 @@ zxerr_t crypto_check_masp(const parser_tx_t *txObj, keys_t *keys) {
                                         .bufferLen = txObj->transaction.sections.maspTx.data.sapling_bundle.shielded_converts.len,
                                         .offset = 0, 
                                         .tx_obj = NULL};
-    parser_context_t converts_indices_ctx = {.buffer = txObj->transaction.sections.maspBuilder.metadata.converts_indices.ptr,
-                                           .bufferLen = txObj->transaction.sections.maspBuilder.metadata.converts_indices.len,
-                                           .offset = 0, 
-                                           .tx_obj = NULL};
     io_seproxyhal_io_heartbeat();
-    CHECK_PARSER_OK(checkConverts(txObj, &builder_converts_ctx, &tx_converts_ctx, &converts_indices_ctx));
+    CHECK_ERROR(checkConverts(txObj, &builder_converts_ctx, &tx_converts_ctx, batch));
+
+    if (batch != NULL) {
+        CHECK_ERROR(valueCommitmentBatchFlush(batch));
+    }
+    return parser_ok;
+}
+
+zxerr_t crypto_check_masp(const parser_tx_t *txObj, keys_t *keys) {
+    if (txObj == NULL || keys == NULL) {
+        return zxerr_unknown;
+    }
+
+    // Value commitments are verified in batches first. If a batch fails, everything is checked again
+    // item by item so the offending description is the one reported.
+    value_commitment_batch_t batch = {0};
+    parser_error_t err = checkMaspDescriptions(txObj, keys, &batch);
+    MEMZERO(&batch, sizeof(batch));
+    if (err == parser_invalid_cv) {
+        err = checkMaspDescriptions(txObj, keys, NULL);
+    }
+    CHECK_PARSER_OK(err);
     return zxerr_ok;
 }
 
@@ -1077,6 +1110,73 @@ zxerr_t crypto_computeRandomness(masp_type_e type, uint8_t *out, uint16_t outLen
     return zxerr_ok;
 }
 
+zxerr_t crypto_computeRandomnessBatch(masp_type_e type, uint8_t count, uint8_t *out, uint16_t outLen, uint16_t *replyLen) {
+    if (out == NULL || replyLen == NULL || count == 0) {
+        return zxerr_unknown;
+    }
+
+    uint16_t itemLen = 0;
+    switch (type) {
+        case spend:
+            itemLen = sizeof(spend_item_t);
+            break;
+        case output:
+            itemLen = sizeof(output_item_t);
+            break;
+        case convert:
+            itemLen = sizeof(convert_item_t);
+            break;
+        default:
+            return zxerr_unknown;
+    }
+    if ((uint32_t)count * itemLen > outLen) {
+        return zxerr_buffer_too_small;
+    }
+    MEMZERO(out, outLen);
+
+#ifdef APP_TESTING
+    // Keep the fixed test values and bookkeeping of the single item instructions. Those want room
+    // for a pair even for converts, so each item goes through a scratch buffer
+    uint8_t item[2 * RANDOM_LEN] = {0};
+    uint16_t offset = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t itemReplyLen = 0;
+        CHECK_ZXERR(crypto_computeRandomness(type, item, sizeof(item), &itemReplyLen))
+        if (itemReplyLen != itemLen) {
+            return zxerr_unknown;
+        }
+        MEMCPY(out + offset, item, itemReplyLen);
+        offset += itemReplyLen;
+    }
+#else
+    // Items are generated in place, the response has the same layout as the NV lists
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t *item = out + i * itemLen;
+        CHECK_ZXERR(random_fr(item, RANDOM_LEN));
+        if (type == spend) {
+            CHECK_ZXERR(random_fr(item + RANDOM_LEN, RANDOM_LEN));
+        } else if (type == output) {
+            cx_rng(item + RANDOM_LEN, RANDOM_LEN);
+        }
+    }
+
+    switch (type) {
+        case spend:
+            CHECK_ZXERR(spend_append_rand_items((const spend_item_t *) out, count));
+            break;
+        case output:
+            CHECK_ZXERR(output_append_rand_items((const output_item_t *) out, count));
+            break;
+        default:
+            CHECK_ZXERR(convert_append_rand_items((const convert_item_t *) out, count));
+            break;
+    }
+#endif
+
+    *replyLen = count * itemLen;
+    return zxerr_ok;
+}
+
 #if defined(COMPILE_MASP) && defined(LEDGER_SPECIFIC)
 zxerr_t crypto_get_change_address(void) {
     MEMZERO(change_address, sizeof(change_address));
@@ -37,10 +37,15 @@ zxerr_t crypto_get_change_address(void);
 
 zxerr_t crypto_fillAddress(uint8_t *buffer, uint16_t bufferLen, uint16_t *cmdResponseLen);
 zxerr_t crypto_sign(const parser_tx_t *txObj, uint8_t *output, uint16_t outputLen);
+#if defined(COMPILE_MASP)
+void crypto_clearKeysCache(void);
+#endif
 zxerr_t crypto_fillMASP(uint8_t *buffer, uint16_t bufferLen, uint16_t *cmdResponseLen, key_kind_e requestedKey);
 zxerr_t crypto_sign_masp_spends(parser_tx_t *txObj, uint8_t *output, uint16_t outputLen);
 zxerr_t crypto_extract_spend_signature(uint8_t *buffer, uint16_t bufferLen, uint16_t *cmdResponseLen);
+zxerr_t crypto_extract_spend_signatures(uint8_t *buffer, uint16_t bufferLen, uint16_t *cmdResponseLen);
 zxerr_t crypto_computeRandomness(masp_type_e type, uint8_t *out, uint16_t outLen, uint16_t *replyLen);
+zxerr_t crypto_computeRandomnessBatch(masp_type_e type, uint8_t count, uint8_t *out, uint16_t outLen, uint16_t *replyLen);
 zxerr_t crypto_fillDeviceSeed(uint8_t *device_seed);
 
 #ifdef __cplusplus
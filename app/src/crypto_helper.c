@@ -21,12 +21,17 @@
 #include "zxmacros.h"
 #include "bech32_encoding.h"
 #include "parser_address.h"
+#include "host_thread_local.h"
 
 #include "keys_personalizations.h"
 #include "rslib.h"
 
 #ifdef LEDGER_SPECIFIC
 #include "bolos_target.h"
+#else
+#include <errno.h>
+#include <unistd.h>
+#include <sys/random.h>
 #endif
 
 #define MAINNET_ADDRESS_T_HRP "tnam"
@@ -58,8 +63,8 @@ uint8_t bech32_hrp_len;
 char bech32_hrp[MAX_BECH32_HRP_LEN + 1];
 
 #if !defined(LEDGER_SPECIFIC)
-// Dummy function for cpp_tests
-zxerr_t crypto_fillDeviceSeed(uint8_t *device_seed) {
+// Dummy function for cpp_tests, the emulator links the real one from crypto.c
+__attribute__((weak)) zxerr_t crypto_fillDeviceSeed(uint8_t *device_seed) {
     return zxerr_unknown;
 }
 #endif
@@ -209,67 +214,70 @@ parser_error_t crypto_encodeLargeBech32(const uint8_t *address, size_t addressLe
     return parser_ok;
 }
 
-parser_error_t crypto_encodeAltAddress(const AddressAlt *addr, char *address, uint16_t addressLen) {
-    uint8_t tmpBuffer[ADDRESS_LEN_BYTES] = {0};
+parser_error_t crypto_altAddressToBytes(const AddressAlt *addr, uint8_t bytes[ADDRESS_LEN_BYTES]) {
+    if (addr == NULL || bytes == NULL) {
+        return parser_unexpected_value;
+    }
+    MEMZERO(bytes, ADDRESS_LEN_BYTES);
 
     switch (addr->tag) {
         case 0:
-            tmpBuffer[0] = PREFIX_ESTABLISHED;
-            MEMCPY(tmpBuffer + 1, addr->Established.hash.ptr, 20);
+            bytes[0] = PREFIX_ESTABLISHED;
+            MEMCPY(bytes + 1, addr->Established.hash.ptr, 20);
             break;
         case 1:
-            tmpBuffer[0] = PREFIX_IMPLICIT;
-            MEMCPY(tmpBuffer + 1, addr->Implicit.pubKeyHash.ptr, 20);
+            bytes[0] = PREFIX_IMPLICIT;
+            MEMCPY(bytes + 1, addr->Implicit.pubKeyHash.ptr, 20);
             break;
         case 2:
             switch (addr->Internal.tag) {
             case 0:
-              tmpBuffer[0] = PREFIX_POS;
+              bytes[0] = PREFIX_POS;
               break;
             case 1:
-              tmpBuffer[0] = PREFIX_SLASH_POOL;
+              bytes[0] = PREFIX_SLASH_POOL;
               break;
             case 2:
-              tmpBuffer[0] = PREFIX_PARAMETERS;
+              bytes[0] = PREFIX_PARAMETERS;
               break;
             case 3:
-              tmpBuffer[0] = PREFIX_IBC;
+              bytes[0] = PREFIX_IBC;
               break;
             case 4:
-              tmpBuffer[0] = PREFIX_IBC_TOKEN;
-              MEMCPY(tmpBuffer + 1, addr->Internal.IbcToken.ibcTokenHash.ptr, 20);
+              bytes[0] = PREFIX_IBC_TOKEN;
+              MEMCPY(bytes + 1, addr->Internal.IbcToken.ibcTokenHash.ptr, 20);
               break;
             case 5:
-              tmpBuffer[0] = PREFIX_GOVERNANCE;
+              bytes[0] = PREFIX_GOVERNANCE;
               break;
             case 6:
-              tmpBuffer[0] = PREFIX_ETH_BRIDGE;
+              bytes[0] = PREFIX_ETH_BRIDGE;
               break;
             case 7:
-              tmpBuffer[0] = PREFIX_BRIDGE_POOL;
+              bytes[0] = PREFIX_BRIDGE_POOL;
               break;
             case 8:
-              tmpBuffer[0] = PREFIX_ERC20;
-              MEMCPY(tmpBuffer + 1, addr->Internal.Erc20.erc20Addr.ptr, 20);
+              bytes[0] = PREFIX_ERC20;
+              MEMCPY(bytes + 1, addr->Internal.Erc20.erc20Addr.ptr, 20);
               break;
             case 9:
-              tmpBuffer[0] = PREFIX_NUT;
-              MEMCPY(tmpBuffer + 1, addr->Internal.Nut.ethAddr.ptr, 20);
+              bytes[0] = PREFIX_NUT;
+              MEMCPY(bytes + 1, addr->Internal.Nut.ethAddr.ptr, 20);
               break;
             case 10:
-              tmpBuffer[0] = PREFIX_MULTITOKEN;
+              bytes[0] = PREFIX_MULTITOKEN;
               break;
             case 11:
-              tmpBuffer[0] = PREFIX_PGF;
+              bytes[0] = PREFIX_PGF;
               break;
             case 12:
-              tmpBuffer[0] = PREFIX_MASP;
+              bytes[0] = PREFIX_MASP;
               break;
             case 13:
-              tmpBuffer[0] = PREFIX_REPLAY_PROTECTION;
+              bytes[0] = PREFIX_REPLAY_PROTECTION;
              break;
             case 14:
-              tmpBuffer[0] = PREFIX_TMP_STORAGE;
+              bytes[0] = PREFIX_TMP_STORAGE;
               break;
             }
             break;
@@ -277,6 +285,12 @@ parser_error_t crypto_encodeAltAddress(const AddressAlt *addr, char *address, ui
         default:
             return parser_value_out_of_range;
     }
+    return parser_ok;
+}
+
+parser_error_t crypto_encodeAltAddress(const AddressAlt *addr, char *address, uint16_t addressLen) {
+    uint8_t tmpBuffer[ADDRESS_LEN_BYTES] = {0};
+    CHECK_ERROR(crypto_altAddressToBytes(addr, tmpBuffer))
 
     char HRP[12] = MAINNET_ADDRESS_T_HRP;
     // Check HRP for mainnet/testnet
@@ -318,6 +332,46 @@ zxerr_t crypto_sha256(const uint8_t *input, uint16_t inputLen, uint8_t *output,
     return zxerr_ok;
 }
 
+#if defined(TARGET_NANOS) || defined(TARGET_NANOS2) || defined(TARGET_NANOX) || defined(TARGET_STAX) || defined(TARGET_FLEX)
+static HOST_THREAD_LOCAL cx_sha256_t streamSha256;
+#else
+static HOST_THREAD_LOCAL picohash_ctx_t streamSha256;
+#endif
+
+zxerr_t crypto_streamSha256Init(void) {
+#if defined(TARGET_NANOS) || defined(TARGET_NANOS2) || defined(TARGET_NANOX) || defined(TARGET_STAX) || defined(TARGET_FLEX)
+    MEMZERO(&streamSha256, sizeof(streamSha256));
+    cx_sha256_init(&streamSha256);
+#else
+    picohash_init_sha256(&streamSha256);
+#endif
+    return zxerr_ok;
+}
+
+zxerr_t crypto_streamSha256Update(const uint8_t *input, uint32_t inputLen) {
+    if (input == NULL) {
+        return zxerr_no_data;
+    }
+#if defined(TARGET_NANOS) || defined(TARGET_NANOS2) || defined(TARGET_NANOX) || defined(TARGET_STAX) || defined(TARGET_FLEX)
+    CHECK_CX_OK(cx_sha256_update(&streamSha256, input, inputLen));
+#else
+    picohash_update(&streamSha256, input, inputLen);
+#endif
+    return zxerr_ok;
+}
+
+zxerr_t crypto_streamSha256Final(uint8_t *output, uint32_t outputLen) {
+    if (output == NULL || outputLen < CX_SHA256_SIZE) {
+        return zxerr_invalid_crypto_settings;
+    }
+#if defined(TARGET_NANOS) || defined(TARGET_NANOS2) || defined(TARGET_NANOX) || defined(TARGET_STAX) || defined(TARGET_FLEX)
+    CHECK_CX_OK(cx_sha256_final(&streamSha256, output));
+#else
+    picohash_final(&streamSha256, output);
+#endif
+    return zxerr_ok;
+}
+
 zxerr_t crypto_computeCodeHash(section_t *extraData) {
     if (extraData == NULL) {
         return zxerr_invalid_crypto_settings;
@@ -434,26 +488,144 @@ zxerr_t crypto_hashCodeSection(const section_t *code, uint8_t *output, uint32_t
 
 // MASP Section
 // Derive the asset type corresponding to the given asset data
+// Asset types already derived in the current transaction, asset data bytes are the key
+typedef struct {
+    uint8_t bytesLen;
+    uint8_t bytes[ASSET_TYPE_MEMO_KEY_LEN];
+    uint8_t nonce;
+    uint8_t identifier[ASSET_IDENTIFIER_LENGTH];
+} asset_type_memo_entry_t;
+
+static HOST_THREAD_LOCAL asset_type_memo_entry_t assetTypeMemo[ASSET_TYPE_MEMO_SIZE];
+static HOST_THREAD_LOCAL uint8_t assetTypeMemoLen = 0;
+static HOST_THREAD_LOCAL uint8_t assetTypeMemoNext = 0;
+
+// Personalised state with GH_FIRST_BLOCK absorbed, shared by every derivation
+static HOST_THREAD_LOCAL blake2s_state assetTypeMidstate;
+static HOST_THREAD_LOCAL bool assetTypeMidstateReady = false;
+
+void crypto_clearAssetTypeMemo(void) {
+    MEMZERO(assetTypeMemo, sizeof(assetTypeMemo));
+    assetTypeMemoLen = 0;
+    assetTypeMemoNext = 0;
+}
+
+static const asset_type_memo_entry_t *findAssetTypeByBytes(const bytes_t *bytes) {
+    for (uint8_t i = 0; i < assetTypeMemoLen; i++) {
+        if (assetTypeMemo[i].bytesLen == bytes->len && MEMCMP(assetTypeMemo[i].bytes, bytes->ptr, bytes->len) == 0) {
+            return &assetTypeMemo[i];
+        }
+    }
+    return NULL;
+}
+
+static void storeAssetType(const bytes_t *bytes, uint8_t nonce, const uint8_t *identifier) {
+    if (bytes->len > ASSET_TYPE_MEMO_KEY_LEN) {
+        return;
+    }
+    // Oldest entry is replaced once the memo is full
+    asset_type_memo_entry_t *entry = &assetTypeMemo[assetTypeMemoNext];
+    entry->bytesLen = (uint8_t)bytes->len;
+    MEMCPY(entry->bytes, bytes->ptr, bytes->len);
+    entry->nonce = nonce;
+    MEMCPY(entry->identifier, identifier, ASSET_IDENTIFIER_LENGTH);
+
+    assetTypeMemoNext = (assetTypeMemoNext + 1) % ASSET_TYPE_MEMO_SIZE;
+    if (assetTypeMemoLen < ASSET_TYPE_MEMO_SIZE) {
+        assetTypeMemoLen++;
+    }
+}
+
+// Value commitment generators of the current transaction, asset identifiers are the key.
+// Points are kept decompressed with the cofactor cleared, cleared by transaction_reset
+typedef struct {
+    uint8_t identifier[ASSET_IDENTIFIER_LENGTH];
+    uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN];
+} generator_cache_entry_t;
+
+static HOST_THREAD_LOCAL generator_cache_entry_t generatorCache[GENERATOR_CACHE_SIZE];
+static HOST_THREAD_LOCAL uint8_t generatorCacheLen = 0;
+static HOST_THREAD_LOCAL uint8_t generatorCacheNext = 0;
+
+void crypto_clearGeneratorCache(void) {
+    MEMZERO(generatorCache, sizeof(generatorCache));
+    generatorCacheLen = 0;
+    generatorCacheNext = 0;
+}
+
+static void storeGenerator(const uint8_t *identifier, const uint8_t *generator) {
+    // Oldest entry is replaced once the cache is full
+    generator_cache_entry_t *entry = &generatorCache[generatorCacheNext];
+    MEMCPY(entry->identifier, identifier, ASSET_IDENTIFIER_LENGTH);
+    MEMCPY(entry->generator, generator, VALUE_COMMITMENT_GENERATOR_LEN);
+
+    generatorCacheNext = (generatorCacheNext + 1) % GENERATOR_CACHE_SIZE;
+    if (generatorCacheLen < GENERATOR_CACHE_SIZE) {
+        generatorCacheLen++;
+    }
+}
+
+static void hashValueCommitmentGenerator(const uint8_t *identifier, uint8_t hash[KEY_LENGTH]) {
+    blake2s_state state = {0};
+    blake2s_init_with_personalization(&state, 32, (const uint8_t *)VALUE_COMMITMENT_GENERATOR_PERSONALIZATION, sizeof(VALUE_COMMITMENT_GENERATOR_PERSONALIZATION));
+    blake2s_update(&state, identifier, KEY_LENGTH);
+    blake2s_final(&state, hash, KEY_LENGTH);
+}
+
+parser_error_t computeValueCommitmentGenerator(const uint8_t *identifier, uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN]) {
+    if (identifier == NULL || generator == NULL) {
+        return parser_unexpected_error;
+    }
+
+    for (uint8_t i = 0; i < generatorCacheLen; i++) {
+        if (MEMCMP(generatorCache[i].identifier, identifier, ASSET_IDENTIFIER_LENGTH) == 0) {
+            MEMCPY(generator, generatorCache[i].generator, VALUE_COMMITMENT_GENERATOR_LEN);
+            return parser_ok;
+        }
+    }
+
+    uint8_t hash[KEY_LENGTH] = {0};
+    hashValueCommitmentGenerator(identifier, hash);
+    CHECK_ERROR(value_commitment_generator(hash, generator));
+    storeGenerator(identifier, generator);
+    return parser_ok;
+}
+
 parser_error_t derive_asset_type(const masp_asset_data_t *asset_data, uint8_t *identifier, uint8_t *nonce) {
-    if(asset_data == NULL || nonce == NULL) {
+    if(asset_data == NULL || identifier == NULL || nonce == NULL) {
         return parser_unexpected_error;
     }
 
+    const asset_type_memo_entry_t *memo = findAssetTypeByBytes(&asset_data->bytes);
+    if (memo != NULL) {
+        *nonce = memo->nonce;
+        MEMCPY(identifier, memo->identifier, ASSET_IDENTIFIER_LENGTH);
+        return parser_ok;
+    }
+
+    if (!assetTypeMidstateReady) {
+        blake2s_init_with_personalization(&assetTypeMidstate, 32, (const uint8_t *)ASSET_IDENTIFIER_PERSONALIZATION, sizeof(ASSET_IDENTIFIER_PERSONALIZATION));
+        blake2s_update(&assetTypeMidstate, (const uint8_t *)GH_FIRST_BLOCK, sizeof(GH_FIRST_BLOCK));
+        assetTypeMidstateReady = true;
+    }
+
+    // GH_FIRST_BLOCK is compressed once here, each nonce attempt only compresses the last block
+    blake2s_state prefix_state = assetTypeMidstate;
+    blake2s_update(&prefix_state, asset_data->bytes.ptr, asset_data->bytes.len);
+
     for(*nonce = 0; *nonce <= 255; (*nonce) ++) {
-        blake2s_state ai_state = {0};
-        blake2s_init_with_personalization(&ai_state, 32, (const uint8_t *)ASSET_IDENTIFIER_PERSONALIZATION, sizeof(ASSET_IDENTIFIER_PERSONALIZATION));
-        blake2s_update(&ai_state, (const uint8_t *)GH_FIRST_BLOCK, sizeof(GH_FIRST_BLOCK));
-        blake2s_update(&ai_state, asset_data->bytes.ptr, asset_data->bytes.len);
+        blake2s_state ai_state = prefix_state;
         blake2s_update(&ai_state, nonce, sizeof(*nonce));
         blake2s_final(&ai_state, identifier, ASSET_IDENTIFIER_LENGTH);
 
         uint8_t hash[32] = {0};
-        blake2s_state vcg_state = {0};
-        blake2s_init_with_personalization(&vcg_state, 32, (const uint8_t *)VALUE_COMMITMENT_GENERATOR_PERSONALIZATION, sizeof(VALUE_COMMITMENT_GENERATOR_PERSONALIZATION));
-        blake2s_update(&vcg_state, identifier, KEY_LENGTH);
-        blake2s_final(&vcg_state, hash, KEY_LENGTH);
+        hashValueCommitmentGenerator(identifier, hash);
 
-        if(is_valid_diversifier(hash) == parser_ok) {
+        // The decompressed generator is what the value commitment checks need later on
+        uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+        if(value_commitment_generator(hash, generator) == parser_ok) {
+            storeAssetType(&asset_data->bytes, *nonce, identifier);
+            storeGenerator(identifier, generator);
             return parser_ok;
         }
     }
@@ -461,33 +633,15 @@ parser_error_t derive_asset_type(const masp_asset_data_t *asset_data, uint8_t *i
     return parser_unexpected_error;
 }
 
-static void u64_to_bytes(uint64_t value, uint8_t array[32]) {
-    MEMZERO(array, 32);
-
-    // Fill the first 8 bytes with the uint64_t value in little-endian order
-    for (int i = 0; i < 8; i++) {
-        array[i] = (value >> (i * 8)) & 0xFF;
-    }
-}
-
 //https://github.com/anoma/masp/blob/main/masp_primitives/src/sapling.rs#L194
 parser_error_t computeValueCommitment(uint64_t value, uint8_t *rcv, uint8_t *identifier, uint8_t *cv) {
     if(rcv == NULL || identifier == NULL || cv == NULL) {
         return parser_unexpected_error;
     }
 
-    uint8_t value_bytes[32] = {0};
-    u64_to_bytes(value, value_bytes);
-
-    uint8_t hash[32] = {0};
-    blake2s_state state = {0};
-    blake2s_init_with_personalization(&state, 32, (const uint8_t *)VALUE_COMMITMENT_GENERATOR_PERSONALIZATION, sizeof(VALUE_COMMITMENT_GENERATOR_PERSONALIZATION));
-    blake2s_update(&state, identifier, KEY_LENGTH);
-    blake2s_final(&state, hash, KEY_LENGTH);
-
-    uint8_t scalar[32] = {0};
-    CHECK_ERROR(parser_scalar_multiplication(rcv, ValueCommitmentRandomnessGenerator, scalar));
-    CHECK_ERROR(add_points(hash, value_bytes, scalar, cv));
+    uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+    CHECK_ERROR(computeValueCommitmentGenerator(identifier, generator));
+    CHECK_ERROR(compute_value_commitment(generator, value, rcv, cv));
 
     return parser_ok;
 }
@@ -497,16 +651,76 @@ parser_error_t computeConvertValueCommitment(uint64_t value, uint8_t *rcv, uint8
         return parser_unexpected_error;
     }
 
-    uint8_t value_bytes[32] = {0};
-    u64_to_bytes(value, value_bytes);
+    uint8_t point[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+    CHECK_ERROR(value_commitment_generator(generator, point));
+    CHECK_ERROR(compute_value_commitment(point, value, rcv, cv));
+
+    return parser_ok;
+}
+
+// Weights only need to be unknown to whoever built the transaction, the device RNG is used for that
+// and hosts read the OS one. VALUE_COMMITMENT_TEST_WEIGHTS switches hosts to a fixed sequence so
+// fuzzing runs can be replayed, it must never be set in a build that checks real transactions.
+static parser_error_t valueCommitmentWeight(uint8_t weight[VALUE_COMMITMENT_WEIGHT_LEN]) {
+#if defined(LEDGER_SPECIFIC)
+    cx_rng_no_throw(weight, VALUE_COMMITMENT_WEIGHT_LEN);
+#elif defined(VALUE_COMMITMENT_TEST_WEIGHTS)
+    static HOST_THREAD_LOCAL uint64_t counter = 0;
+    for (uint8_t i = 0; i < VALUE_COMMITMENT_WEIGHT_LEN; i += sizeof(uint64_t)) {
+        uint64_t z = (counter += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        z ^= z >> 31;
+        MEMCPY(weight + i, &z, sizeof(z));
+    }
+#else
+    // getentropy is available on glibc and macOS, weights are well below its 256 byte limit
+    while (getentropy(weight, VALUE_COMMITMENT_WEIGHT_LEN) != 0) {
+        if (errno != EINTR) {
+            return parser_unexpected_error;
+        }
+    }
+#endif
+    // An odd weight is never zero, so a wrong commitment cannot drop out of the sum
+    weight[0] |= 0x01;
+    return parser_ok;
+}
+
+parser_error_t valueCommitmentBatchAdd(value_commitment_batch_t *batch, uint64_t value, const uint8_t *rcv,
+                                       const uint8_t *generator, const uint8_t *cv) {
+    if (batch == NULL || rcv == NULL || generator == NULL || cv == NULL) {
+        return parser_unexpected_error;
+    }
+
+    if (batch->count == VALUE_COMMITMENT_BATCH_SIZE) {
+        CHECK_ERROR(valueCommitmentBatchFlush(batch));
+    }
 
-    uint8_t scalar[32] = {0};
-    CHECK_ERROR(parser_scalar_multiplication(rcv, ValueCommitmentRandomnessGenerator, scalar));
-    CHECK_ERROR(add_points(generator, value_bytes, scalar, cv));
+    value_commitment_item_t *item = &batch->items[batch->count];
+    MEMCPY(item->generator, generator, VALUE_COMMITMENT_GENERATOR_LEN);
+    MEMCPY(item->rcv, rcv, KEY_LENGTH);
+    MEMCPY(item->cv, cv, KEY_LENGTH);
+    CHECK_ERROR(valueCommitmentWeight(item->weight));
+    item->value = value;
+    batch->count++;
 
     return parser_ok;
 }
 
+parser_error_t valueCommitmentBatchFlush(value_commitment_batch_t *batch) {
+    if (batch == NULL) {
+        return parser_unexpected_error;
+    }
+    if (batch->count == 0) {
+        return parser_ok;
+    }
+
+    const parser_error_t err = verify_value_commitments(batch->items, batch->count);
+    // rcv values are secret
+    MEMZERO(batch, sizeof(*batch));
+
+    return err == parser_ok ? parser_ok : parser_invalid_cv;
+}
 
 parser_error_t computeRk(keys_t *keys, uint8_t *alpha, uint8_t *rk) {
     if(keys == NULL || alpha == NULL || rk == NULL) {
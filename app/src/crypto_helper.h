@@ -35,6 +35,33 @@ extern "C" {
 #define MODIFIER_OVK 0x02
 #define MODIFIER_DK  0x10
 
+// Asset data is at most a 21 byte address, denom, position and an optional epoch
+#define ASSET_TYPE_MEMO_KEY_LEN 32
+#if defined(COMPILE_MASP)
+#define ASSET_TYPE_MEMO_SIZE 8
+#else
+#define ASSET_TYPE_MEMO_SIZE 1
+#endif
+
+// Value commitments checked with a single multi-scalar multiplication, see valueCommitmentBatchFlush
+#if defined(COMPILE_MASP)
+#define VALUE_COMMITMENT_BATCH_SIZE 4
+#else
+#define VALUE_COMMITMENT_BATCH_SIZE 1
+#endif
+
+// Distinct assets of a transaction whose value commitment generator is kept decompressed
+#if defined(COMPILE_MASP)
+#define GENERATOR_CACHE_SIZE 8
+#else
+#define GENERATOR_CACHE_SIZE 1
+#endif
+
+typedef struct {
+    value_commitment_item_t items[VALUE_COMMITMENT_BATCH_SIZE];
+    uint8_t count;
+} value_commitment_batch_t;
+
 
 #define ASSERT_CX_OK(CALL)      \
   do {                         \
@@ -53,6 +80,11 @@ zxerr_t crypto_encodeAddress(const uint8_t *pubkey, uint16_t pubkeyLen, uint8_t
 zxerr_t crypto_sha256(const uint8_t *input, uint16_t inputLen,
                       uint8_t *output, uint16_t outputLen);
 
+// Single SHA-256 context fed across APDU chunks while a large section is being received
+zxerr_t crypto_streamSha256Init(void);
+zxerr_t crypto_streamSha256Update(const uint8_t *input, uint32_t inputLen);
+zxerr_t crypto_streamSha256Final(uint8_t *output, uint32_t outputLen);
+
 zxerr_t crypto_computeCodeHash(section_t *extraData);
 zxerr_t crypto_hashDataSection(const section_t *data, uint8_t *output, uint32_t outputLen);
 zxerr_t crypto_hashCodeSection(const section_t *section, uint8_t *output, uint32_t outputLen);
@@ -63,10 +95,20 @@ zxerr_t crypto_hashExtraDataSection(const section_t *section, uint8_t *output, u
 parser_error_t convertKey(const uint8_t spendingKey[KEY_LENGTH], const uint8_t modifier, uint8_t outputKey[KEY_LENGTH], bool reduceWideByte);
 parser_error_t generate_key(const uint8_t expandedKey[KEY_LENGTH], constant_key_t keyType, uint8_t output[KEY_LENGTH]);
 parser_error_t computeValueCommitment(uint64_t value, uint8_t *rcv, uint8_t *identifier, uint8_t *cv);
+// Generator of the asset, cached until crypto_clearGeneratorCache (called from transaction_reset)
+parser_error_t computeValueCommitmentGenerator(const uint8_t *identifier, uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN]);
+void crypto_clearGeneratorCache(void);
+// Queue cv == value * generator + rcv * H, verified with random weights once the batch is full or flushed.
+// A failed batch only reports parser_invalid_cv, checking the items one by one tells which one is wrong.
+parser_error_t valueCommitmentBatchAdd(value_commitment_batch_t *batch, uint64_t value, const uint8_t *rcv,
+                                       const uint8_t *generator, const uint8_t *cv);
+parser_error_t valueCommitmentBatchFlush(value_commitment_batch_t *batch);
 parser_error_t computeRk(keys_t *keys, uint8_t *alpha, uint8_t *rk);
 parser_error_t crypto_encodeLargeBech32( const uint8_t *address, size_t addressLen, uint8_t *output, size_t outputLen, bool paymentAddr);
+parser_error_t crypto_altAddressToBytes(const AddressAlt *addr, uint8_t bytes[ADDRESS_LEN_BYTES]);
 parser_error_t crypto_encodeAltAddress(const AddressAlt *addr, char *address, uint16_t addressLen);
 parser_error_t derive_asset_type(const masp_asset_data_t *asset_data, uint8_t *identifier, uint8_t *nonce);
+void crypto_clearAssetTypeMemo(void);
 parser_error_t h_star(uint8_t *a, uint16_t a_len, uint8_t *b, uint16_t b_len, uint8_t *output);
 parser_error_t parser_scalar_multiplication(const uint8_t input[32], constant_key_t key, uint8_t output[32]);
 parser_error_t parser_compute_sbar(const uint8_t s[32], uint8_t r[32], uint8_t rsk[32], uint8_t sbar[32]);
@@ -0,0 +1,25 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+#pragma once
+
+// Mutable file-scope state of the parser and its crypto helpers (memos, caches, hash templates).
+// The device runs a single thread; host builds keep one copy per thread so several transactions
+// can be parsed in parallel, e.g. by the test vector runner.
+#if defined(LEDGER_SPECIFIC)
+#define HOST_THREAD_LOCAL
+#else
+#define HOST_THREAD_LOCAL __thread
+#endif
@@ -30,6 +30,19 @@ typedef enum {
     ValueCommitmentRandomnessGenerator,
 } constant_key_t;
 
+#define VALUE_COMMITMENT_WEIGHT_LEN 16
+// Affine u || v of a generator with the cofactor cleared, see value_commitment_generator
+#define VALUE_COMMITMENT_GENERATOR_LEN 64
+
+// Mirrors ValueCommitmentItem in app/rust/src/lib.rs
+typedef struct {
+    uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN];
+    uint8_t rcv[32];
+    uint8_t cv[32];
+    uint8_t weight[VALUE_COMMITMENT_WEIGHT_LEN];
+    uint64_t value;
+} value_commitment_item_t;
+
 #define RNG_LEN 80
 #define KEY_LENGTH 32
 #define ASSET_IDENTIFIER_LENGTH 32
@@ -20,6 +20,7 @@
 #include "cx.h"
 #include "os.h"
 #include "view.h"
+#include "crypto_helper.h"
 
 transaction_info_t NV_CONST N_transaction_info_impl
     __attribute__((aligned(64)));
@@ -37,21 +38,27 @@ convertlist_t NV_CONST N_convertlist_impl __attribute__((aligned(64)));
 
 transaction_header_t transaction_header;
 
-zxerr_t spend_append_rand_item(uint8_t *rcv, uint8_t *alpha) {
-  if (transaction_header.spendlist_len >= SPEND_LIST_SIZE) {
+zxerr_t spend_append_rand_items(const spend_item_t *items, uint8_t count) {
+  if (items == NULL || count > SPEND_LIST_SIZE - transaction_header.spendlist_len) {
     return zxerr_unknown;
   }
-  spend_item_t newitem;
-  MEMCPY(newitem.rcv, rcv, RANDOM_LEN);
-  MEMCPY(newitem.alpha, alpha, RANDOM_LEN);
 
+  // Contiguous items are committed with a single NVM write
   MEMCPY_NV((void *)&N_spendlist.items[transaction_header.spendlist_len],
-            &newitem, sizeof(spend_item_t));
+            (void *)items, count * sizeof(spend_item_t));
 
-  transaction_header.spendlist_len += 1;
+  transaction_header.spendlist_len += count;
   return zxerr_ok;
 }
 
+zxerr_t spend_append_rand_item(uint8_t *rcv, uint8_t *alpha) {
+  spend_item_t newitem;
+  MEMCPY(newitem.rcv, rcv, RANDOM_LEN);
+  MEMCPY(newitem.alpha, alpha, RANDOM_LEN);
+
+  return spend_append_rand_items(&newitem, 1);
+}
+
 spend_item_t *spendlist_retrieve_rand_item(uint8_t i) {
   if (transaction_header.spendlist_len < i) {
     return NULL;
@@ -60,20 +67,24 @@ spend_item_t *spendlist_retrieve_rand_item(uint8_t i) {
   }
 }
 
-zxerr_t output_append_rand_item(uint8_t *rcv, uint8_t *rcm) {
-  if (transaction_header.outputlist_len >= SPEND_LIST_SIZE) {
+zxerr_t output_append_rand_items(const output_item_t *items, uint8_t count) {
+  if (items == NULL || count > SPEND_LIST_SIZE - transaction_header.outputlist_len) {
     return zxerr_unknown;
   }
 
+  MEMCPY_NV((void *)&N_outputlist.items[transaction_header.outputlist_len],
+            (void *)items, count * sizeof(output_item_t));
+
+  transaction_header.outputlist_len += count;
+  return zxerr_ok;
+}
+
+zxerr_t output_append_rand_item(uint8_t *rcv, uint8_t *rcm) {
   output_item_t newitem = {0};
   MEMCPY(newitem.rcv, rcv, RANDOM_LEN);
   MEMCPY(newitem.rcm, rcm, RANDOM_LEN);
 
-  MEMCPY_NV((void *)&N_outputlist.items[transaction_header.outputlist_len],
-            &newitem, sizeof(output_item_t));
-
-  transaction_header.outputlist_len += 1;
-  return zxerr_ok;
+  return output_append_rand_items(&newitem, 1);
 }
 
 output_item_t *outputlist_retrieve_rand_item(uint64_t i) {
@@ -84,21 +95,25 @@ output_item_t *outputlist_retrieve_rand_item(uint64_t i) {
   }
 }
 
-zxerr_t convert_append_rand_item(uint8_t *rcv) {
-  if (transaction_header.convertlist_len >= SPEND_LIST_SIZE) {
+zxerr_t convert_append_rand_items(const convert_item_t *items, uint8_t count) {
+  if (items == NULL || count > SPEND_LIST_SIZE - transaction_header.convertlist_len) {
     return zxerr_unknown;
   }
 
-  convert_item_t newitem = {0};
-  MEMCPY(newitem.rcv, rcv, RANDOM_LEN);
-
   MEMCPY_NV((void *)&N_convertlist.items[transaction_header.convertlist_len],
-            &newitem, sizeof(convert_item_t));
+            (void *)items, count * sizeof(convert_item_t));
 
-  transaction_header.convertlist_len += 1;
+  transaction_header.convertlist_len += count;
   return zxerr_ok;
 }
 
+zxerr_t convert_append_rand_item(uint8_t *rcv) {
+  convert_item_t newitem = {0};
+  MEMCPY(newitem.rcv, rcv, RANDOM_LEN);
+
+  return convert_append_rand_items(&newitem, 1);
+}
+
 convert_item_t *convertlist_retrieve_rand_item(uint8_t i) {
   if (transaction_header.convertlist_len <= i) {
     return NULL;
@@ -119,6 +134,10 @@ uint8_t transaction_get_n_converts() {
     return transaction_header.convertlist_len;
 }
 
+uint8_t transaction_get_n_spend_signatures() {
+    return transaction_header.spends_sign_len;
+}
+
 bool spend_signatures_more_extract() {
   return transaction_header.spends_sign_index < transaction_header.spends_sign_len;
 }
@@ -136,17 +155,27 @@ zxerr_t spend_signatures_append(uint8_t *signature) {
   return zxerr_ok;
 }
 
-zxerr_t get_next_spend_signature(uint8_t *result) {
-  if (!spend_signatures_more_extract()) {
+zxerr_t get_next_spend_signatures(uint8_t *result, uint8_t maxCount, uint8_t *index, uint8_t *count) {
+  if (result == NULL || index == NULL || count == NULL || maxCount == 0 || !spend_signatures_more_extract()) {
       return zxerr_unknown;
   }
-  const uint8_t index = transaction_header.spends_sign_index;
-  MEMCPY(result, (void *)&N_transactioninfo.spend_signatures[index], SIGNATURE_SIZE);
-  transaction_header.spends_sign_index++;
+  *index = transaction_header.spends_sign_index;
+  *count = transaction_header.spends_sign_len - *index;
+  if (*count > maxCount) {
+      *count = maxCount;
+  }
+  MEMCPY(result, (void *)&N_transactioninfo.spend_signatures[*index], *count * SIGNATURE_SIZE);
+  transaction_header.spends_sign_index += *count;
   set_state(STATE_EXTRACT_SPENDS);
   return zxerr_ok;
 }
 
+zxerr_t get_next_spend_signature(uint8_t *result) {
+  uint8_t index = 0;
+  uint8_t count = 0;
+  return get_next_spend_signatures(result, 1, &index, &count);
+}
+
 uint8_t get_state() {
     return transaction_header.state;
 }
@@ -208,6 +237,7 @@ void transaction_reset() {
     zeroize_outputs();
     zeroize_converts();
     zeroize_signatures();
+    crypto_clearGeneratorCache();
     set_state(STATE_INITIAL);
 }
 
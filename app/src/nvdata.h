@@ -22,8 +22,8 @@
 #include <stdbool.h>
 #include "parser_txdef.h"
 
-#define SPEND_LIST_SIZE 15
 #define SIGNATURE_SIZE 64
+#define SPEND_SIGNATURES_HEADER_LEN 3
 
 // Possible states
 #define STATE_INITIAL 0x00
@@ -69,17 +69,22 @@ typedef struct {
 } transaction_info_t;
 
 zxerr_t spend_append_rand_item(uint8_t *rcv, uint8_t *alpha);
+zxerr_t spend_append_rand_items(const spend_item_t *items, uint8_t count);
 spend_item_t *spendlist_retrieve_rand_item(uint8_t i);
 zxerr_t output_append_rand_item(uint8_t *rcv, uint8_t *rcm);
+zxerr_t output_append_rand_items(const output_item_t *items, uint8_t count);
 output_item_t *outputlist_retrieve_rand_item(uint64_t i);
 zxerr_t convert_append_rand_item(uint8_t *rcv);
+zxerr_t convert_append_rand_items(const convert_item_t *items, uint8_t count);
 convert_item_t *convertlist_retrieve_rand_item(uint8_t i);
 
 void transaction_reset();
 uint8_t transaction_get_n_spends();
 uint8_t transaction_get_n_outputs();
 uint8_t transaction_get_n_converts();
+uint8_t transaction_get_n_spend_signatures();
 zxerr_t get_next_spend_signature(uint8_t *result);
+zxerr_t get_next_spend_signatures(uint8_t *result, uint8_t maxCount, uint8_t *index, uint8_t *count);
 zxerr_t spend_signatures_append(uint8_t *signature);
 bool spend_signatures_more_extract();
 
@@ -19,6 +19,7 @@
 
 #include <zxtypes.h>
 
+#include "app_mode.h"
 #include "parser_common.h"
 #include "parser_impl.h"
 #include "common/parser.h"
@@ -46,15 +47,56 @@ parser_error_t parser_init_context(parser_context_t *ctx,
     return parser_ok;
 }
 
+// A previous parser_parse_chunk call can be continued if the buffer only grew since then
+static bool parser_can_resume(const uint8_t *data,
+                              size_t dataLen,
+                              const parser_tx_t *tx_obj) {
+    const parse_progress_t *progress = &tx_obj->progress;
+    return progress->buffer != NULL && progress->buffer == data &&
+           dataLen >= progress->bufferLen && dataLen <= UINT16_MAX;
+}
+
+static parser_error_t parser_start(parser_context_t *ctx,
+                                   const uint8_t *data,
+                                   size_t dataLen,
+                                   parser_tx_t *tx_obj) {
+    ctx->tx_obj = tx_obj;
+    ctx->expert = app_mode_expert();
+    if (parser_can_resume(data, dataLen, tx_obj)) {
+        ctx->buffer = data;
+        ctx->bufferLen = dataLen;
+        ctx->offset = tx_obj->progress.offset;
+        return parser_ok;
+    }
+
+    MEMZERO(tx_obj, sizeof(parser_tx_t));
+    crypto_clearAssetTypeMemo();
+    return parser_init_context(ctx, data, dataLen);
+}
+
 parser_error_t parser_parse(parser_context_t *ctx,
                             const uint8_t *data,
                             size_t dataLen,
                             parser_tx_t *tx_obj) {
-    ctx->tx_obj = tx_obj;
-    CHECK_ERROR(parser_init_context(ctx, data, dataLen))
+    CHECK_ERROR(parser_start(ctx, data, dataLen, tx_obj))
+    // Whatever parser_parse_chunk left behind is consumed here
+    tx_obj->progress.buffer = NULL;
     return _read(ctx, tx_obj);
 }
 
+parser_error_t parser_parse_chunk(parser_context_t *ctx,
+                                  const uint8_t *data,
+                                  size_t dataLen,
+                                  parser_tx_t *tx_obj) {
+    CHECK_ERROR(parser_start(ctx, data, dataLen, tx_obj))
+    CHECK_ERROR(_readPartial(ctx, tx_obj))
+
+    tx_obj->progress.buffer = ctx->buffer;
+    tx_obj->progress.bufferLen = ctx->bufferLen;
+    tx_obj->progress.offset = ctx->offset;
+    return parser_ok;
+}
+
 parser_error_t parser_validate(parser_context_t *ctx) {
 #if defined(COMPILE_MASP) && defined(LEDGER_SPECIFIC)
     // Get change address for masp transactions
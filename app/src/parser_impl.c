@@ -16,14 +16,73 @@
 #include "parser_impl.h"
 #include "zxformat.h"
 #include "leb128.h"
-#include "app_mode.h"
 #include "crypto_helper.h"
 #include "parser_impl_common.h"
 
+static parser_error_t readNextStep(parser_context_t *ctx, parser_tx_t *v) {
+    parse_progress_t *progress = &v->progress;
+    switch (progress->stage) {
+        case parse_stage_header:
+            CHECK_ERROR(readHeader(ctx, v))
+            CHECK_ERROR(readSectionsLen(ctx, v))
+            progress->nextSection = 0;
+            progress->stage = parse_stage_sections;
+            break;
+
+        case parse_stage_sections:
+            if (progress->nextSection < v->transaction.sections.sectionLen) {
+                CHECK_ERROR(readSection(ctx, v, progress->nextSection))
+                progress->nextSection++;
+            } else {
+                CHECK_ERROR(finishSections(v))
+                progress->stage = parse_stage_done;
+            }
+            break;
+
+        default:
+            return parser_unexpected_error;
+    }
+    return parser_ok;
+}
+
+parser_error_t _readPartial(parser_context_t *ctx, parser_tx_t *v) {
+    parse_progress_t *progress = &v->progress;
+    while (progress->stage != parse_stage_done && ctx->bufferLen >= progress->retryAt) {
+        const uint16_t offset = ctx->offset;
+        const uint32_t extraDataLen = v->transaction.sections.extraDataLen;
+        const uint32_t signaturesLen = v->transaction.sections.signaturesLen;
+        const bool isMasp = v->transaction.isMasp;
+
+        if (readNextStep(ctx, v) != parser_ok) {
+            // Most likely the step is not complete yet, retry it with a later chunk.
+            // Real errors are reported by _read once the whole buffer is available
+            ctx->offset = offset;
+            v->transaction.sections.extraDataLen = extraDataLen;
+            v->transaction.sections.signaturesLen = signaturesLen;
+            v->transaction.isMasp = isMasp;
+
+            // A retry costs as much as what arrived of the step, wait until that doubled so a
+            // large section is not parsed again for every chunk. streamPendingSection sets this
+            // to the section end instead when the section tells its length
+            const uint32_t retryAt = (uint32_t)offset + 2 * (uint32_t)(ctx->bufferLen - offset) + 1;
+            progress->retryAt = retryAt > UINT16_MAX ? UINT16_MAX : (uint16_t)retryAt;
+            break;
+        }
+    }
+
+    // Hash what already arrived of a large pending section, so it is not hashed at P1_LAST
+    if (progress->stage != parse_stage_done && streamPendingSection(ctx, v) != parser_ok) {
+        progress->hashStart = 0;
+        progress->hashEnd = 0;
+    }
+    return parser_ok;
+}
+
 parser_error_t _read(parser_context_t *ctx, parser_tx_t *v) {
 
-    CHECK_ERROR(readHeader(ctx, v))
-    CHECK_ERROR(readSections(ctx, v))
+    while (v->progress.stage != parse_stage_done) {
+        CHECK_ERROR(readNextStep(ctx, v))
+    }
 
     CHECK_ERROR(validateTransactionParams(v))
 
@@ -37,6 +96,9 @@ parser_error_t _read(parser_context_t *ctx, parser_tx_t *v) {
         return parser_unexpected_unparsed_bytes;
     }
 
+    // Item counts depend on the layout, so it is ready as soon as the transaction is parsed
+    CHECK_ERROR(buildDisplayLayout(ctx))
+
     return parser_ok;
 }
 
@@ -52,112 +114,214 @@ bool hasMemoToPrint(const parser_context_t *ctx) {
     return false; // No memo to print
 }
 
-__attribute__((noinline)) parser_error_t getSpendfromIndex(uint32_t index, bytes_t *spend) {
+__attribute__((noinline)) parser_error_t getSpendfromIndex(const masp_sapling_builder_t *builder, uint32_t index, bytes_t *spend) {
+    if (builder == NULL || spend == NULL || index >= builder->n_spends) {
+        return parser_unexpected_error;
+    }
+
+    const uint16_t end = (index + 1 < builder->n_spends) ? builder->spends_offsets[index + 1] : builder->spends.len;
+    spend->ptr = builder->spends.ptr + builder->spends_offsets[index];
+    spend->len = end - builder->spends_offsets[index];
+    return parser_ok;
+}
 
-    for (uint32_t i = 0; i < index; i++) {
-        spend->ptr += EXTENDED_FVK_LEN + DIVERSIFIER_LEN + NOTE_LEN;
-        uint8_t tmp_len = spend->ptr[0];
-        spend->ptr++;
-        spend->ptr += (tmp_len * (32 + 1)) + sizeof(uint64_t);
+__attribute__((noinline)) parser_error_t getOutputfromIndex(const masp_sapling_builder_t *builder, uint32_t index, bytes_t *out) {
+    if (builder == NULL || out == NULL || index >= builder->n_outputs) {
+        return parser_unexpected_error;
     }
 
+    const uint16_t end = (index + 1 < builder->n_outputs) ? builder->outputs_offsets[index + 1] : builder->outputs.len;
+    out->ptr = builder->outputs.ptr + builder->outputs_offsets[index];
+    out->len = end - builder->outputs_offsets[index];
     return parser_ok;
 }
 
-__attribute__((noinline)) parser_error_t getOutputfromIndex(uint32_t index, bytes_t *out) {
+// Binary search over the identifiers derived in readMaspBuilder. If the token is not found, index is set to
+// n_asset_type and asset_data is filled with the last asset of the section, as a full scan would leave it.
+__attribute__((noinline)) parser_error_t findAssetData(const masp_builder_section_t *maspBuilder, const uint8_t *stoken, masp_asset_data_t *asset_data, uint32_t *index) {
+    if (maspBuilder == NULL || stoken == NULL || asset_data == NULL || index == NULL) {
+        return parser_unexpected_error;
+    }
 
-    for (uint32_t i = 0; i < index; i++) {
-        uint8_t has_ovk = out->ptr[0];
-        if(has_ovk) {
-            out->ptr += OVK_PLUS_CHECK_BYTE;
+    const uint32_t n_assets = maspBuilder->n_asset_type;
+    uint32_t low = 0;
+    uint32_t high = n_assets;
+    while (low < high) {
+        const uint32_t mid = low + (high - low) / 2;
+        if (MEMCMP(maspBuilder->asset_table[maspBuilder->asset_order[mid]].identifier, stoken, ASSET_ID_LEN) < 0) {
+            low = mid + 1;
         } else {
-            out->ptr++;
+            high = mid;
         }
-        out->ptr += PAYMENT_ADDR_LEN + OUT_NOTE_LEN + MEMO_LEN;
     }
 
+    *index = n_assets;
+    if (low < n_assets && MEMCMP(maspBuilder->asset_table[maspBuilder->asset_order[low]].identifier, stoken, ASSET_ID_LEN) == 0) {
+        *index = maspBuilder->asset_order[low];
+    }
+
+    if (n_assets == 0) {
+        return parser_ok;
+    }
+
+    const masp_asset_entry_t *entry = &maspBuilder->asset_table[(*index < n_assets) ? *index : n_assets - 1];
+    parser_context_t asset_data_ctx = {.buffer = maspBuilder->asset_data.ptr + entry->offset,
+                                       .bufferLen = maspBuilder->asset_data.len - entry->offset,
+                                       .offset = 0,
+                                       .tx_obj = NULL};
+    CHECK_ERROR(readAssetData(&asset_data_ctx, asset_data))
+    asset_data->symbol = entry->symbol;
     return parser_ok;
 }
 
-__attribute__((noinline)) parser_error_t findAssetData(const masp_builder_section_t *maspBuilder, const uint8_t *stoken, masp_asset_data_t *asset_data, uint32_t *index) {
-    parser_context_t asset_data_ctx = {.buffer = maspBuilder->asset_data.ptr, .bufferLen = maspBuilder->asset_data.len, .offset = 0, .tx_obj = NULL};
-    for (*index = 0; *index < maspBuilder->n_asset_type; (*index)++) {
-        CHECK_ERROR(readAssetData(&asset_data_ctx, asset_data))
-        uint8_t identifier[32];
-        uint8_t nonce;
-        CHECK_ERROR(readToken(&asset_data->token, &asset_data->symbol));
-        CHECK_ERROR(derive_asset_type(asset_data, identifier, &nonce))
-        if(MEMCMP(identifier, stoken, ASSET_ID_LEN) == 0) {
-            return parser_ok;
+// Walks the transfer entities in display order. Items are stored in the layout table while it has
+// room, and the item at lookupIdx is copied to lookup when one is given.
+typedef struct {
+    display_layout_t *layout;
+    uint16_t numItems;
+    uint8_t lookupIdx;
+    layout_item_t *lookup;
+} layout_walk_t;
+
+static parser_error_t appendLayoutItems(layout_walk_t *walk, layout_item_kind_e kind, uint16_t entity, uint8_t fields) {
+    for (uint8_t field = 0; field < fields; field++) {
+        // Display indices are 8 bits wide
+        if (walk->numItems >= UINT8_MAX) {
+            return parser_unexpected_number_items;
+        }
+        const layout_item_t item = {.kind = (uint8_t) kind, .field = field, .entity = entity};
+        if (walk->layout != NULL && walk->numItems < MAX_LAYOUT_ITEMS) {
+            walk->layout->items[walk->numItems] = item;
         }
+        if (walk->lookup != NULL && walk->numItems == walk->lookupIdx) {
+            *walk->lookup = item;
+        }
+        walk->numItems++;
     }
     return parser_ok;
 }
 
-parser_error_t checkMaspSpendsSymbols (const parser_context_t *ctx) {
-    bytes_t spend = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.spends;
-    masp_asset_data_t asset_data = {0};
-    uint32_t asset_idx = 0;
-
-    for (uint32_t i = 0; i < ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_spends; i++) {
-        getSpendfromIndex(i, &spend);
-        const uint8_t *spend_token = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN;
-        CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, spend_token, &asset_data, &asset_idx))
-        if(asset_data.symbol == NULL) {
-            ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_spends++;
+static parser_error_t appendTransferLayout(layout_walk_t *walk, layout_item_kind_e kind, const bytes_t *list, uint32_t list_len) {
+    parser_context_t list_ctx = {.buffer = list->ptr, .bufferLen = list->len, .offset = 0, .tx_obj = NULL};
+    AddressAlt owner = {0};
+    AddressAlt token = {0};
+    bytes_t amount = {0};
+    uint8_t amount_denom = 0;
+    const char *symbol = NULL;
+
+    for (uint32_t i = 0; i < list_len; i++) {
+        const uint16_t entity = list_ctx.offset;
+        CHECK_ERROR(readTransferSourceTarget(&list_ctx, &owner, &token, &amount, &amount_denom, &symbol))
+        // MASP internal address is shown through the spends/outputs instead
+        if (!isMaspInternalAddress(&owner)) {
+            CHECK_ERROR(appendLayoutItems(walk, kind, entity, 2 + (symbol == NULL)))
         }
     }
     return parser_ok;
 }
 
-parser_error_t checkMaspOutputsSymbols (const parser_context_t *ctx) {
-    bytes_t output = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.outputs;
+static parser_error_t appendMaspLayout(const parser_context_t *ctx, layout_walk_t *walk, layout_item_kind_e kind) {
+    const masp_builder_section_t *maspBuilder = &ctx->tx_obj->transaction.sections.maspBuilder;
+    const masp_sapling_builder_t *builder = &maspBuilder->builder.sapling_builder;
+    const uint32_t n_items = kind == layout_spend ? builder->n_spends : builder->n_outputs;
+    bytes_t description = {0};
+    const uint8_t *asset_token = NULL;
     masp_asset_data_t asset_data = {0};
     uint32_t asset_idx = 0;
 
-    for (uint32_t i = 0; i < ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_outputs; i++) {
-        getOutputfromIndex(i, &output);
-        const uint8_t *output_token = output.ptr + (output.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN;
-        CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, output_token, &asset_data, &asset_idx))
-        if(asset_data.symbol == NULL) {
-            ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_outputs++;
+    for (uint32_t i = 0; i < n_items; i++) {
+        if (kind == layout_spend) {
+            CHECK_ERROR(getSpendfromIndex(builder, i, &description))
+            asset_token = description.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN;
+        } else {
+            CHECK_ERROR(getOutputfromIndex(builder, i, &description))
+            asset_token = description.ptr + (description.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN;
         }
+        CHECK_ERROR(findAssetData(maspBuilder, asset_token, &asset_data, &asset_idx))
+        CHECK_ERROR(appendLayoutItems(walk, kind, (uint16_t) i, asset_data.symbol == NULL ? 3 : 2))
+    }
+    return parser_ok;
+}
+
+static parser_error_t walkDisplayLayout(const parser_context_t *ctx, layout_walk_t *walk) {
+    const tx_transfer_t *transfer = NULL;
+    switch (ctx->tx_obj->typeTx) {
+        case Transfer:
+            transfer = &ctx->tx_obj->transfer;
+            break;
+        case IBC:
+            transfer = &ctx->tx_obj->ibc.transfer;
+            break;
+        default:
+            return parser_ok;
+    }
+
+    // Same order as displayed: sources, spends, targets, outputs
+    CHECK_ERROR(appendTransferLayout(walk, layout_source, &transfer->sources, transfer->sources_len))
+    if (ctx->tx_obj->transaction.isMasp) {
+        CHECK_ERROR(appendMaspLayout(ctx, walk, layout_spend))
     }
+    CHECK_ERROR(appendTransferLayout(walk, layout_target, &transfer->targets, transfer->targets_len))
+    if (ctx->tx_obj->transaction.isMasp) {
+        CHECK_ERROR(appendMaspLayout(ctx, walk, layout_output))
+    }
+    return parser_ok;
+}
+
+parser_error_t buildDisplayLayout(const parser_context_t *ctx) {
+    display_layout_t *layout = &ctx->tx_obj->layout;
+    layout_walk_t walk = {.layout = layout, .numItems = 0, .lookupIdx = 0, .lookup = NULL};
+    layout->numItems = 0;
+    CHECK_ERROR(walkDisplayLayout(ctx, &walk))
+    layout->numItems = (uint8_t) walk.numItems;
     return parser_ok;
 }
 
+parser_error_t getLayoutItem(const parser_context_t *ctx, uint8_t idx, layout_item_t *item) {
+    const display_layout_t *layout = &ctx->tx_obj->layout;
+    if (item == NULL || idx >= layout->numItems) {
+        return parser_display_idx_out_of_range;
+    }
+    if (idx < MAX_LAYOUT_ITEMS) {
+        *item = layout->items[idx];
+        return parser_ok;
+    }
+
+    // Items that did not fit in the table are found by walking the entities again
+    layout_walk_t walk = {.layout = NULL, .numItems = 0, .lookupIdx = idx, .lookup = item};
+    return walkDisplayLayout(ctx, &walk);
+}
+
 parser_error_t getNumItems(const parser_context_t *ctx, uint8_t *numItems) {
     *numItems = 0;
     switch (ctx->tx_obj->typeTx) {
         case Unbond:
         case Bond:
-            *numItems = (app_mode_expert() ? BOND_EXPERT_PARAMS : BOND_NORMAL_PARAMS) + ctx->tx_obj->bond.has_source;
+            *numItems = (ctx->expert ? BOND_EXPERT_PARAMS : BOND_NORMAL_PARAMS) + ctx->tx_obj->bond.has_source;
             break;
 
         case Custom:
-            *numItems = (app_mode_expert() ? CUSTOM_EXPERT_PARAMS : CUSTOM_NORMAL_PARAMS);
+            *numItems = (ctx->expert ? CUSTOM_EXPERT_PARAMS : CUSTOM_NORMAL_PARAMS);
             break;
 
         case Transfer:
             if(ctx->tx_obj->transaction.isMasp) {
-                uint8_t items = 1;
-                items += 2 * ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_outputs + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_outputs; // print from outputs
-                items += 2 * ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_spends + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_spends; // print from spends
-
-                *numItems = (app_mode_expert() ? items + TRANSFER_EXPERT_MASP_PARAMS : items + TRANSFER_NORMAL_MASP_PARAMS);
+                const uint8_t items = 1;
+                *numItems = (ctx->expert ? items + TRANSFER_EXPERT_MASP_PARAMS : items + TRANSFER_NORMAL_MASP_PARAMS);
             } else {
-                *numItems = (app_mode_expert() ? TRANSFER_EXPERT_PARAMS : TRANSFER_NORMAL_PARAMS);
+                *numItems = (ctx->expert ? TRANSFER_EXPERT_PARAMS : TRANSFER_NORMAL_PARAMS);
             }
-            (*numItems) += ctx->tx_obj->transfer.non_masp_sources_len*2 + ctx->tx_obj->transfer.non_masp_targets_len*2 + ctx->tx_obj->transfer.no_symbol_sources + ctx->tx_obj->transfer.no_symbol_targets;
+            // sources, spends, targets and outputs
+            (*numItems) += ctx->tx_obj->layout.numItems;
             break;
 
         case InitAccount: {
             const uint32_t pubkeys_num = ctx->tx_obj->initAccount.number_of_pubkeys;
-            *numItems = (uint8_t)((app_mode_expert() ? INIT_ACCOUNT_EXPERT_PARAMS : INIT_ACCOUNT_NORMAL_PARAMS) + pubkeys_num);
+            *numItems = (uint8_t)((ctx->expert ? INIT_ACCOUNT_EXPERT_PARAMS : INIT_ACCOUNT_NORMAL_PARAMS) + pubkeys_num);
             break;
         }
         case InitProposal: {
-            *numItems = (app_mode_expert() ? INIT_PROPOSAL_EXPERT_PARAMS : INIT_PROPOSAL_NORMAL_PARAMS);
+            *numItems = (ctx->expert ? INIT_PROPOSAL_EXPERT_PARAMS : INIT_PROPOSAL_NORMAL_PARAMS);
             if (ctx->tx_obj->initProposal.proposal_type == DefaultWithWasm) {
                 (*numItems)++;
             } else if (ctx->tx_obj->initProposal.proposal_type == PGFSteward) {
@@ -168,23 +332,23 @@ parser_error_t getNumItems(const parser_context_t *ctx, uint8_t *numItems) {
             break;
         }
         case VoteProposal: {
-            *numItems = (uint8_t) (app_mode_expert() ? VOTE_PROPOSAL_EXPERT_PARAMS : VOTE_PROPOSAL_NORMAL_PARAMS);
+            *numItems = (uint8_t) (ctx->expert ? VOTE_PROPOSAL_EXPERT_PARAMS : VOTE_PROPOSAL_NORMAL_PARAMS);
             break;
         }
         case RevealPubkey:
-            *numItems = (app_mode_expert() ? REVEAL_PUBKEY_EXPERT_PARAMS : REVEAL_PUBKEY_NORMAL_PARAMS);
+            *numItems = (ctx->expert ? REVEAL_PUBKEY_EXPERT_PARAMS : REVEAL_PUBKEY_NORMAL_PARAMS);
             break;
 
         case Withdraw:
-            *numItems = (app_mode_expert() ? WITHDRAW_EXPERT_PARAMS : WITHDRAW_NORMAL_PARAMS) + ctx->tx_obj->withdraw.has_source;
+            *numItems = (ctx->expert ? WITHDRAW_EXPERT_PARAMS : WITHDRAW_NORMAL_PARAMS) + ctx->tx_obj->withdraw.has_source;
             break;
 
         case CommissionChange:
-            *numItems = (app_mode_expert() ? COMMISSION_CHANGE_EXPERT_PARAMS : COMMISSION_CHANGE_NORMAL_PARAMS);
+            *numItems = (ctx->expert ? COMMISSION_CHANGE_EXPERT_PARAMS : COMMISSION_CHANGE_NORMAL_PARAMS);
             break;
 
         case BecomeValidator: {
-            *numItems = (app_mode_expert() ? BECOME_VALIDATOR_EXPERT_PARAMS : BECOME_VALIDATOR_NORMAL_PARAMS);
+            *numItems = (ctx->expert ? BECOME_VALIDATOR_EXPERT_PARAMS : BECOME_VALIDATOR_NORMAL_PARAMS);
             if(ctx->tx_obj->becomeValidator.has_name) {
                 (*numItems)++;
             }
@@ -206,51 +370,48 @@ parser_error_t getNumItems(const parser_context_t *ctx, uint8_t *numItems) {
             const uint32_t pubkeys_num = ctx->tx_obj->updateVp.number_of_pubkeys;
             const uint8_t has_threshold = ctx->tx_obj->updateVp.has_threshold;
             const uint8_t has_vp_code = ctx->tx_obj->updateVp.has_vp_code;
-            *numItems = (uint8_t) ((app_mode_expert() ? UPDATE_VP_EXPERT_PARAMS : UPDATE_VP_NORMAL_PARAMS) + pubkeys_num + has_threshold + has_vp_code);
+            *numItems = (uint8_t) ((ctx->expert ? UPDATE_VP_EXPERT_PARAMS : UPDATE_VP_NORMAL_PARAMS) + pubkeys_num + has_threshold + has_vp_code);
             break;
         }
 
         case ReactivateValidator:
         case DeactivateValidator:
         case UnjailValidator:
-            *numItems = (app_mode_expert() ? UNJAIL_VALIDATOR_EXPERT_PARAMS : UNJAIL_VALIDATOR_NORMAL_PARAMS);
+            *numItems = (ctx->expert ? UNJAIL_VALIDATOR_EXPERT_PARAMS : UNJAIL_VALIDATOR_NORMAL_PARAMS);
             break;
 
         case IBC:
-            *numItems = (app_mode_expert() ?  IBC_EXPERT_PARAMS : IBC_NORMAL_PARAMS);
-            if(ctx->tx_obj->transaction.isMasp) {
-                *numItems += 2 * ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_outputs + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_outputs; // print from outputs
-                *numItems += 2 * ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_spends + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_spends; // print from spends
-            }
-            *numItems += ctx->tx_obj->ibc.transfer.non_masp_sources_len*2 + ctx->tx_obj->ibc.transfer.non_masp_targets_len*2 + ctx->tx_obj->ibc.transfer.no_symbol_sources + ctx->tx_obj->ibc.transfer.no_symbol_targets;
-            *numItems += ctx->tx_obj->ibc.memo.len > 0 && app_mode_expert();
+            *numItems = (ctx->expert ?  IBC_EXPERT_PARAMS : IBC_NORMAL_PARAMS);
+            // sources, spends, targets and outputs
+            *numItems += ctx->tx_obj->layout.numItems;
+            *numItems += ctx->tx_obj->ibc.memo.len > 0 && ctx->expert;
             if(ctx->tx_obj->ibc.is_nft) {
                 *numItems += ctx->tx_obj->ibc.n_token_id;
             }
             break;
 
         case Redelegate:
-            *numItems = (app_mode_expert() ? REDELEGATE_EXPERT_PARAMS : REDELEGATE_NORMAL_PARAMS);
+            *numItems = (ctx->expert ? REDELEGATE_EXPERT_PARAMS : REDELEGATE_NORMAL_PARAMS);
             break;
 
         case ClaimRewards:
-            *numItems = (app_mode_expert() ? CLAIM_REWARDS_EXPERT_PARAMS : CLAIM_REWARDS_NORMAL_PARAMS) + ctx->tx_obj->withdraw.has_source;
+            *numItems = (ctx->expert ? CLAIM_REWARDS_EXPERT_PARAMS : CLAIM_REWARDS_NORMAL_PARAMS) + ctx->tx_obj->withdraw.has_source;
             break;
 
         case ResignSteward:
-            *numItems = (app_mode_expert() ? RESIGN_STEWARD_EXPERT_PARAMS : RESIGN_STEWARD_NORMAL_PARAMS);
+            *numItems = (ctx->expert ? RESIGN_STEWARD_EXPERT_PARAMS : RESIGN_STEWARD_NORMAL_PARAMS);
             break;
 
         case ChangeConsensusKey:
-            *numItems = (app_mode_expert() ? CHANGE_CONSENSUS_KEY_EXPERT_PARAMS : CHANGE_CONSENSUS_KEY_NORMAL_PARAMS);
+            *numItems = (ctx->expert ? CHANGE_CONSENSUS_KEY_EXPERT_PARAMS : CHANGE_CONSENSUS_KEY_NORMAL_PARAMS);
             break;
 
         case UpdateStewardCommission:
-            *numItems = (app_mode_expert() ? UPDATE_STEWARD_COMMISSION_EXPERT_PARAMS : UPDATE_STEWARD_COMMISSION_NORMAL_PARAMS) + 2 * ctx->tx_obj->updateStewardCommission.commissionLen;
+            *numItems = (ctx->expert ? UPDATE_STEWARD_COMMISSION_EXPERT_PARAMS : UPDATE_STEWARD_COMMISSION_NORMAL_PARAMS) + 2 * ctx->tx_obj->updateStewardCommission.commissionLen;
             break;
 
         case ChangeValidatorMetadata: {
-            *numItems = app_mode_expert() ? CHANGE_VALIDATOR_METADATA_EXPERT_PARAMS : CHANGE_VALIDATOR_METADATA_NORMAL_PARAMS;
+            *numItems = ctx->expert ? CHANGE_VALIDATOR_METADATA_EXPERT_PARAMS : CHANGE_VALIDATOR_METADATA_NORMAL_PARAMS;
 
             if (ctx->tx_obj->metadataChange.has_name) {
                 (*numItems)++;
@@ -278,7 +439,7 @@ parser_error_t getNumItems(const parser_context_t *ctx, uint8_t *numItems) {
         }
 
         case BridgePoolTransfer:
-            *numItems = app_mode_expert() ? BRIDGE_POOL_TRANSFER_EXPERT_PARAMS : BRIDGE_POOL_TRANSFER_NORMAL_PARAMS;
+            *numItems = ctx->expert ? BRIDGE_POOL_TRANSFER_EXPERT_PARAMS : BRIDGE_POOL_TRANSFER_NORMAL_PARAMS;
             break;
 
         default:
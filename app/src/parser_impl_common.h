@@ -120,7 +120,10 @@ parser_error_t readToken(const AddressAlt *token, const char **symbol);
 parser_error_t readVote(bytes_t *vote, yay_vote_type_e type, char *strVote, uint16_t strVoteLen);
 
 parser_error_t readHeader(parser_context_t *ctx, parser_tx_t *v);
-parser_error_t readSections(parser_context_t *ctx, parser_tx_t *v);
+parser_error_t readSectionsLen(parser_context_t *ctx, parser_tx_t *v);
+parser_error_t readSection(parser_context_t *ctx, parser_tx_t *v, uint32_t i);
+parser_error_t finishSections(parser_tx_t *v);
+parser_error_t streamPendingSection(parser_context_t *ctx, parser_tx_t *v);
 parser_error_t validateTransactionParams(parser_tx_t *txObj);
 parser_error_t verifyShieldedHash(parser_context_t *ctx);
 
@@ -117,32 +117,65 @@ static parser_error_t readTransparentBundle(parser_context_t *ctx, masp_transpar
     return parser_ok;
 }
 
-static parser_error_t readSaplingMetadata(parser_context_t *ctx, masp_sapling_metadata_t *metadata) {
-    if (ctx == NULL || metadata == NULL) {
+// Decode a list of u64 indices into forward and inverse tables. Every index must be lower than
+// maxIndex and appear only once, so the forward table is a permutation (or an injection for outputs).
+static parser_error_t readMetadataIndices(parser_context_t *ctx, uint32_t *n_indices, bytes_t *indices,
+                                          uint8_t *forward, uint8_t *inverse, bool isPermutation) {
+    if (ctx == NULL || n_indices == NULL || indices == NULL || forward == NULL || inverse == NULL) {
         return parser_unexpected_error;
     }
 
-    CHECK_ERROR(readUint32(ctx, &metadata->n_spends_indices))
-    if (metadata->n_spends_indices != 0) {
-        metadata->spends_indices.len = metadata->n_spends_indices * sizeof(uint64_t);
-        CHECK_ERROR(readBytes(ctx, &metadata->spends_indices.ptr, metadata->spends_indices.len))
+    CHECK_ERROR(readUint32(ctx, n_indices))
+    if (*n_indices > SPEND_LIST_SIZE) {
+        return parser_value_out_of_range;
     }
 
-    CHECK_ERROR(readUint32(ctx, &metadata->n_converts_indices))
-    if (metadata->n_converts_indices != 0) {
-        metadata->converts_indices.len = metadata->n_converts_indices * sizeof(uint64_t);
-        CHECK_ERROR(readBytes(ctx, &metadata->converts_indices.ptr, metadata->converts_indices.len))
+    for (uint8_t i = 0; i < SPEND_LIST_SIZE; i++) {
+        forward[i] = INVALID_METADATA_INDEX;
+        inverse[i] = INVALID_METADATA_INDEX;
     }
 
-    CHECK_ERROR(readUint32(ctx, &metadata->n_outputs_indices))
-    if (metadata->n_outputs_indices != 0) {
-        metadata->outputs_indices.len = metadata->n_outputs_indices * sizeof(uint64_t);
-        CHECK_ERROR(readBytes(ctx, &metadata->outputs_indices.ptr, metadata->outputs_indices.len))
+    if (*n_indices == 0) {
+        return parser_ok;
+    }
+
+    indices->ptr = ctx->buffer + ctx->offset;
+    indices->len = *n_indices * sizeof(uint64_t);
+    const uint64_t maxIndex = isPermutation ? *n_indices : SPEND_LIST_SIZE;
+    for (uint32_t i = 0; i < *n_indices; i++) {
+        uint64_t index = 0;
+        CHECK_ERROR(readUint64(ctx, &index))
+        if (index >= maxIndex) {
+            return parser_value_out_of_range;
+        }
+        if (inverse[index] != INVALID_METADATA_INDEX) {
+            return parser_duplicated_field;
+        }
+        forward[i] = (uint8_t)index;
+        inverse[index] = (uint8_t)i;
     }
 
     return parser_ok;
 }
 
+static parser_error_t readSaplingMetadata(parser_context_t *ctx, masp_sapling_metadata_t *metadata) {
+    if (ctx == NULL || metadata == NULL) {
+        return parser_unexpected_error;
+    }
+
+    CHECK_ERROR(readMetadataIndices(ctx, &metadata->n_spends_indices, &metadata->spends_indices,
+                                    metadata->spends_forward, metadata->spends_inverse, true))
+
+    CHECK_ERROR(readMetadataIndices(ctx, &metadata->n_converts_indices, &metadata->converts_indices,
+                                    metadata->converts_forward, metadata->converts_inverse, true))
+
+    // Outputs can be interleaved with dummy outputs, their indices only need to be unique
+    CHECK_ERROR(readMetadataIndices(ctx, &metadata->n_outputs_indices, &metadata->outputs_indices,
+                                    metadata->outputs_forward, metadata->outputs_inverse, false))
+
+    return parser_ok;
+}
+
 static parser_error_t readTransparentBuilder(parser_context_t *ctx, masp_transparent_builder_t *builder) {
     if (ctx == NULL || builder == NULL) {
         return parser_unexpected_error;
@@ -169,6 +202,9 @@ static parser_error_t readSpendDescriptionInfo(parser_context_t *ctx, masp_sapli
     }
 
     CHECK_ERROR(readUint32(ctx, &builder->n_spends))
+    if (builder->n_spends > SPEND_LIST_SIZE) {
+        return parser_invalid_number_of_spends;
+    }
 #if defined(LEDGER_SPECIFIC) && !defined(APP_TESTING)
     if (G_io_apdu_buffer[OFFSET_INS] == INS_SIGN_MASP_SPENDS) {
         uint32_t rnd_spends = (uint32_t)transaction_get_n_spends();
@@ -185,6 +221,7 @@ static parser_error_t readSpendDescriptionInfo(parser_context_t *ctx, masp_sapli
     uint8_t tmp_8 = 0;
     bytes_t tmp = {0};
     for(uint32_t i = 0; i < builder->n_spends; i++) {
+        builder->spends_offsets[i] = ctx->offset - tmp_offset;
 
         // parse Extyended Full Viewing Key
         CHECK_ERROR(readBytes(ctx, &tmp.ptr, EXTENDED_FVK_LEN))
@@ -206,81 +243,39 @@ static parser_error_t readSpendDescriptionInfo(parser_context_t *ctx, masp_sapli
     return parser_ok;
 }
 
-parser_error_t getSpendDescriptionLen(const uint8_t *spend, uint16_t *len) {
-    if (spend == NULL || len == NULL) {
+// Position the context at the index-th description using the offsets recorded while parsing the builder
+static parser_error_t seekDescription(parser_context_t *ctx, const uint16_t *offsets, uint32_t n_items, uint32_t index) {
+    if (ctx == NULL || offsets == NULL) {
         return parser_unexpected_error;
     }
 
-    uint16_t offset = EXTENDED_FVK_LEN + DIVERSIFIER_LEN + NOTE_LEN;
-    spend += offset;
-    uint8_t auth_path_len = *spend;
-    *len = offset + 1 + (auth_path_len * (32 + 1)) + POSITION_LEN;
+    if (index >= n_items || offsets[index] >= ctx->bufferLen) {
+        return parser_value_out_of_range;
+    }
 
+    ctx->offset = offsets[index];
     return parser_ok;
 }
 
-parser_error_t getNextSpendDescription(parser_context_t *spend, uint8_t index) {
-    if (spend == NULL) {
+parser_error_t getSpendDescription(const masp_sapling_builder_t *builder, uint32_t index, parser_context_t *spend) {
+    if (builder == NULL) {
         return parser_unexpected_error;
     }
-
-    for (int i = 0 ; i< index; i++) {
-        CTX_CHECK_AND_ADVANCE(spend, EXTENDED_FVK_LEN + DIVERSIFIER_LEN + NOTE_LEN);
-        uint8_t auth_path_len = 0;
-        CHECK_ERROR(readByte(spend, &auth_path_len))
-        CTX_CHECK_AND_ADVANCE(spend, (auth_path_len * (32 + 1)) + POSITION_LEN);
-    }
-
-    return parser_ok;
+    return seekDescription(spend, builder->spends_offsets, builder->n_spends, index);
 }
 
-parser_error_t getNextOutputDescription(parser_context_t *output, uint8_t index) {
-    if (output == NULL) {
+parser_error_t getOutputDescription(const masp_sapling_builder_t *builder, uint32_t index, parser_context_t *output) {
+    if (builder == NULL) {
         return parser_unexpected_error;
     }
-
-    for (int i = 0; i < index; i++) {
-        uint8_t has_ovk = 0;
-        CHECK_ERROR(readByte(output, &has_ovk));
-        CTX_CHECK_AND_ADVANCE(output, (has_ovk ? 32 : 0) + PAYMENT_ADDR_LEN + OUT_NOTE_LEN + MEMO_LEN);
-    }
-    return parser_ok;
+    return seekDescription(output, builder->outputs_offsets, builder->n_outputs, index);
 }
 
-parser_error_t getNextConvertDescription(parser_context_t *convert, uint8_t index) {
-    if (convert == NULL) {
+parser_error_t getConvertDescription(const masp_sapling_builder_t *builder, uint32_t index, parser_context_t *convert) {
+    if (builder == NULL) {
         return parser_unexpected_error;
     }
-    uint64_t allowed_size = 0;
-    uint16_t tmp16 = 0;
-    uint32_t tmp32 = 0;
-    uint8_t merkel_size = 0;
-    uint8_t tag = 0;
-    for (int i = 0; i < index; i++) {
-        CHECK_ERROR(readByte(convert, &tag));
-
-        switch(tag) {
-        case 253:
-            CHECK_ERROR(readUint16(convert, &tmp16));
-            allowed_size = (uint64_t)tmp16;
-            break;
-        case 254:
-            CHECK_ERROR(readUint32(convert, &tmp32));
-            allowed_size = (uint64_t)tmp32;
-            break;
-        case 255:
-            CHECK_ERROR(readUint64(convert, &allowed_size));
-            break;
-        default:
-            allowed_size = (uint64_t)tag;
-        }
-        CTX_CHECK_AND_ADVANCE(convert, allowed_size * (ASSET_ID_LEN + INT_128_LEN) + sizeof(uint64_t));
-        CTX_CHECK_AND_ADVANCE(convert, 32);
-        CHECK_ERROR(readByte(convert, &merkel_size));
-        CTX_CHECK_AND_ADVANCE(convert, merkel_size * (32 + 1) + sizeof(uint64_t));
-    }
-
-    return parser_ok;
+    return seekDescription(convert, builder->converts_offsets, builder->n_converts, index);
 }
 
 static parser_error_t readConvertDescriptionInfo(parser_context_t *ctx, masp_sapling_builder_t *builder) {
@@ -289,6 +284,9 @@ static parser_error_t readConvertDescriptionInfo(parser_context_t *ctx, masp_sap
     }
 
     CHECK_ERROR(readUint32(ctx, &builder->n_converts))
+    if (builder->n_converts > SPEND_LIST_SIZE) {
+        return parser_invalid_number_of_converts;
+    }
 #if defined(LEDGER_SPECIFIC) && !defined(APP_TESTING)
     if (G_io_apdu_buffer[OFFSET_INS] == INS_SIGN_MASP_SPENDS) {
         uint32_t rnd_converts = (uint32_t)transaction_get_n_converts();
@@ -306,6 +304,7 @@ static parser_error_t readConvertDescriptionInfo(parser_context_t *ctx, masp_sap
     uint64_t tmp_64 = 0;
     bytes_t tmp = {0};
     for (uint32_t i = 0; i < builder->n_converts; i++) {
+        builder->converts_offsets[i] = ctx->offset - tmp_offset;
 
         // Parse Allowed conversion
         CHECK_ERROR(readCompactSize(ctx, &tmp_64))
@@ -336,6 +335,9 @@ static parser_error_t readSaplingOutputDescriptionInfo(parser_context_t *ctx, ma
     }
 
     CHECK_ERROR(readUint32(ctx, &builder->n_outputs))
+    if (builder->n_outputs > SPEND_LIST_SIZE) {
+        return parser_invalid_number_of_outputs;
+    }
 #if defined(LEDGER_SPECIFIC) && !defined(APP_TESTING)
     if (G_io_apdu_buffer[OFFSET_INS] == INS_SIGN_MASP_SPENDS) {
         uint32_t rnd_outputs = (uint32_t)transaction_get_n_outputs();
@@ -351,6 +353,7 @@ static parser_error_t readSaplingOutputDescriptionInfo(parser_context_t *ctx, ma
 
     bytes_t tmp = {0};
     for (uint32_t i = 0; i < builder->n_outputs; i++) {
+        builder->outputs_offsets[i] = ctx->offset - tmp_offset;
         CHECK_ERROR(readByte(ctx, &builder->has_ovk))
         if (builder->has_ovk) {
             // Parse ovk
@@ -476,16 +479,44 @@ parser_error_t readMaspBuilder(parser_context_t *ctx, masp_builder_section_t *ma
     CHECK_ERROR(readBytes(ctx, &maspBuilder->target_hash.ptr, maspBuilder->target_hash.len))
 
     CHECK_ERROR(readUint32(ctx, &maspBuilder->n_asset_type))
+    if (maspBuilder->n_asset_type > MAX_ASSET_TYPES) {
+        return parser_invalid_number_of_assets;
+    }
     maspBuilder->asset_data.ptr = ctx->buffer + ctx->offset;
     for (uint32_t i = 0; i < maspBuilder->n_asset_type; i++) {
-        masp_asset_data_t asset_data;
+        masp_asset_data_t asset_data = {0};
+        masp_asset_entry_t *entry = &maspBuilder->asset_table[i];
+        entry->offset = ctx->buffer + ctx->offset - maspBuilder->asset_data.ptr;
         CHECK_ERROR(readAssetData(ctx, &asset_data))
+        CHECK_ERROR(readToken(&asset_data.token, &entry->symbol))
+        uint8_t nonce = 0;
+        CHECK_ERROR(derive_asset_type(&asset_data, entry->identifier, &nonce))
+
+        // Keep asset_order sorted by identifier, equal identifiers stay in reading order
+        uint32_t pos = i;
+        while (pos > 0 && MEMCMP(maspBuilder->asset_table[maspBuilder->asset_order[pos - 1]].identifier, entry->identifier, ASSET_ID_LEN) > 0) {
+            maspBuilder->asset_order[pos] = maspBuilder->asset_order[pos - 1];
+            pos--;
+        }
+        maspBuilder->asset_order[pos] = (uint8_t)i;
     }
     maspBuilder->asset_data.len = ctx->buffer + ctx->offset - maspBuilder->asset_data.ptr;
 
     CHECK_ERROR(readSaplingMetadata(ctx, &maspBuilder->metadata))
     CHECK_ERROR(readBuilder(ctx, &maspBuilder->builder))
 
+    // Metadata holds exactly one index per builder description
+    const masp_sapling_builder_t *sapling_builder = &maspBuilder->builder.sapling_builder;
+    if (maspBuilder->metadata.n_spends_indices != sapling_builder->n_spends) {
+        return parser_invalid_number_of_spends;
+    }
+    if (maspBuilder->metadata.n_converts_indices != sapling_builder->n_converts) {
+        return parser_invalid_number_of_converts;
+    }
+    if (maspBuilder->metadata.n_outputs_indices != sapling_builder->n_outputs) {
+        return parser_invalid_number_of_outputs;
+    }
+
     return parser_ok;
 }
 
@@ -30,10 +30,9 @@ extern "C" {
 
 parser_error_t readMaspTx(parser_context_t *ctx, masp_tx_section_t *maspTx);
 parser_error_t readMaspBuilder(parser_context_t *ctx, masp_builder_section_t *maspBuilder);
-parser_error_t getSpendDescriptionLen(const uint8_t *spend, uint16_t *len);
-parser_error_t getNextSpendDescription(parser_context_t *spend, uint8_t index);
-parser_error_t getNextOutputDescription(parser_context_t *output, uint8_t index);
-parser_error_t getNextConvertDescription(parser_context_t *convert, uint8_t index);
+parser_error_t getSpendDescription(const masp_sapling_builder_t *builder, uint32_t index, parser_context_t *spend);
+parser_error_t getOutputDescription(const masp_sapling_builder_t *builder, uint32_t index, parser_context_t *output);
+parser_error_t getConvertDescription(const masp_sapling_builder_t *builder, uint32_t index, parser_context_t *convert);
 #ifdef __cplusplus
 }
 #endif
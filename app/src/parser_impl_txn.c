@@ -26,6 +26,8 @@
 #include "parser_address.h"
 #include "tx_hash.h"
 #include "parser_impl.h"
+#include "crypto.h"
+#include "token_registry.h"
 
 #include <zxformat.h>
 
@@ -41,21 +43,6 @@
 static const vp_types_t vp_user = { "vp_user.wasm", "User"};
 static const vp_types_t vp_validator = { "vp_validator.wasm", "Validator"};
 
-#define NAM_TOKEN(_address, _symbol) { \
-        .address  = _address, \
-        .symbol = _symbol, \
-    }
-
-static const tokens_t nam_tokens[] = {
-    NAM_TOKEN("tnam1q9gr66cvu4hrzm0sd5kmlnjje82gs3xlfg3v6nu7", "NAM "),
-    NAM_TOKEN("tnam1p5z8ruwyu7ha8urhq2l0dhpk2f5dv3ts7uyf2n75", "uOSMO "),
-    NAM_TOKEN("tnam1pkg30gnt4q0zn7j00r6hms4ajrxn6f5ysyyl7w9m", "uATOM "),
-    NAM_TOKEN("tnam1pklj3kwp0cpsdvv56584rsajty974527qsp8n0nm", "uTIA "),
-    NAM_TOKEN("tnam1p4px8sw3am4qvetj7eu77gftm4fz4hcw2ulpldc7", "ustOSMO "),
-    NAM_TOKEN("tnam1p5z5538v3kdk3wdx7r2hpqm4uq9926dz3ughcp7n", "ustATOM "),
-    NAM_TOKEN("tnam1ph6xhf0defk65hm7l5ursscwqdj8ehrcdv300u4g", "ustTIA "),
-};
-
 #define PREFIX_IMPLICIT 0
 #define PREFIX_ESTABLISHED 1
 #define PREFIX_INTERNAL 2
@@ -65,18 +52,35 @@ parser_error_t readToken(const AddressAlt *token, const char **symbol) {
         return parser_unexpected_value;
     }
 
-    // Convert token to address
-    char address[53] = {0};
-    CHECK_ERROR(crypto_encodeAltAddress(token, address, sizeof(address)))
+    uint8_t address[ADDRESS_LEN_BYTES] = {0};
+    CHECK_ERROR(crypto_altAddressToBytes(token, address))
 
     *symbol = NULL;
 
-    const uint16_t tokenListLen = sizeof(nam_tokens) / sizeof(nam_tokens[0]);
-    for (uint16_t i = 0; i < tokenListLen; i++) {
-        if (!memcmp(&address, &nam_tokens[i].address, ADDRESS_LEN_TESTNET)) {
-            *symbol = (char*) PIC(nam_tokens[i].symbol);
+    // Token addresses are bech32m encoded with the network HRP, each network has its own list
+    const token_registry_t *registry = &token_registry_mainnet;
+#if defined(LEDGER_SPECIFIC)
+    if (hdPath[1] == HDPATH_1_TESTNET) {
+        registry = &token_registry_testnet;
+    }
+#endif
+
+    // Entries are sorted by address bytes, see app/scripts/gen_token_registry.py
+    const tokens_t *tokens = (const tokens_t *) PIC(registry->tokens);
+    uint16_t low = 0;
+    uint16_t high = registry->len;
+    while (low < high) {
+        const uint16_t mid = low + (high - low) / 2;
+        const int cmp = memcmp(address, tokens[mid].address, ADDRESS_LEN_BYTES);
+        if (cmp == 0) {
+            *symbol = (const char *) PIC(tokens[mid].symbol);
             return parser_ok;
         }
+        if (cmp < 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
     }
 
     return parser_ok;
@@ -150,11 +154,7 @@ static parser_error_t readInitAccountTxn(const bytes_t *data,const section_t *ex
     bool found_vp_code = false;
     // Load the linked to data from the extra data sections
     for (uint32_t i = 0; i < extraDataLen; i++) {
-        uint8_t extraDataHash[HASH_LEN] = {0};
-        if (crypto_hashExtraDataSection(&extra_data[i], extraDataHash, sizeof(extraDataHash)) != zxerr_ok) {
-            return parser_unexpected_error;
-        }
-
+        const uint8_t *extraDataHash = extra_data[i].section_hash;
         if (!memcmp(extraDataHash, v->initAccount.vp_type_sechash.ptr, HASH_LEN)) {
             // If this section contains the VP code hash
             v->initAccount.vp_type_secidx = extra_data[i].idx;
@@ -335,11 +335,7 @@ static parser_error_t readInitProposalTxn(const bytes_t *data, const section_t *
     bool found_content = false, found_code = false;
     // Load the linked to data from the extra data sections
     for (uint32_t i = 0; i < extraDataLen; i++) {
-        uint8_t extraDataHash[HASH_LEN] = {0};
-        if (crypto_hashExtraDataSection(&extra_data[i], extraDataHash, sizeof(extraDataHash)) != zxerr_ok) {
-            return parser_unexpected_error;
-        }
-
+        const uint8_t *extraDataHash = extra_data[i].section_hash;
         if (!memcmp(extraDataHash, v->initProposal.content_sechash.ptr, HASH_LEN)) {
             // If this section contains the init proposal content
             v->initProposal.content_secidx = extra_data[i].idx;
@@ -478,11 +474,7 @@ static parser_error_t readUpdateVPTxn(const bytes_t *data, const section_t *extr
     bool found_vp_code = false;
     // Load the linked to data from the extra data sections
     for (uint32_t i = 0; i < extraDataLen * v->updateVp.has_vp_code; i++) {
-        uint8_t extraDataHash[HASH_LEN] = {0};
-        if (crypto_hashExtraDataSection(&extra_data[i], extraDataHash, sizeof(extraDataHash)) != zxerr_ok) {
-            return parser_unexpected_error;
-        }
-
+        const uint8_t *extraDataHash = extra_data[i].section_hash;
         if (!memcmp(extraDataHash, v->updateVp.vp_type_sechash.ptr, HASH_LEN)) {
             // If this section contains the VP code hash
             v->updateVp.vp_type_secidx = extra_data[i].idx;
@@ -536,8 +528,6 @@ static parser_error_t readTransferTxn(const bytes_t *data, parser_tx_t *v) {
         uint8_t amount_denom;
         const char* symbol;
         CHECK_ERROR(readTransferSourceTarget(&ctx, &owner, &token, &amount, &amount_denom, &symbol))
-        v->transfer.non_masp_sources_len += !isMaspInternalAddress(&owner);
-        v->transfer.no_symbol_sources += (symbol == NULL) && !isMaspInternalAddress(&owner);
     }
     v->transfer.sources.len = ctx.buffer + ctx.offset - v->transfer.sources.ptr;
 
@@ -552,8 +542,6 @@ static parser_error_t readTransferTxn(const bytes_t *data, parser_tx_t *v) {
         uint8_t amount_denom;
         const char* symbol;
         CHECK_ERROR(readTransferSourceTarget(&ctx, &owner, &token, &amount, &amount_denom, &symbol))
-        v->transfer.non_masp_targets_len += !isMaspInternalAddress(&owner);
-        v->transfer.no_symbol_targets += (symbol == NULL) && !isMaspInternalAddress(&owner);
     }
     v->transfer.targets.len = ctx.buffer + ctx.offset - v->transfer.targets.ptr;
 
@@ -905,8 +893,6 @@ static parser_error_t readIBCTxn(const bytes_t *data, parser_tx_t *v) {
             uint8_t amount_denom;
             const char* symbol;
             CHECK_ERROR(readTransferSourceTarget(&ctx, &owner, &token, &amount, &amount_denom, &symbol))
-            v->ibc.transfer.non_masp_sources_len += !isMaspInternalAddress(&owner);
-            v->ibc.transfer.no_symbol_sources += (symbol == NULL) && !isMaspInternalAddress(&owner);
         }
         v->ibc.transfer.sources.len = ctx.buffer + ctx.offset - v->ibc.transfer.sources.ptr;
 
@@ -921,8 +907,6 @@ static parser_error_t readIBCTxn(const bytes_t *data, parser_tx_t *v) {
             uint8_t amount_denom;
             const char* symbol;
             CHECK_ERROR(readTransferSourceTarget(&ctx, &owner, &token, &amount, &amount_denom, &symbol))
-            v->ibc.transfer.non_masp_targets_len += !isMaspInternalAddress(&owner);
-            v->ibc.transfer.no_symbol_targets += (symbol == NULL) && !isMaspInternalAddress(&owner);
         }
         v->ibc.transfer.targets.len = ctx.buffer + ctx.offset - v->ibc.transfer.targets.ptr;
 
@@ -1037,6 +1021,85 @@ static parser_error_t readSalt(parser_context_t *ctx, bytes_t *salt) {
     return parser_ok;
 }
 
+// Finish a digest that was streamed while the bytes [start, end) were arriving
+static bool takeStreamedHash(parser_context_t *ctx, uint16_t start, uint16_t end, uint8_t *output) {
+    parse_progress_t *progress = &ctx->tx_obj->progress;
+    if (progress->hashEnd <= progress->hashStart || progress->hashStart != start || progress->hashEnd > end) {
+        return false;
+    }
+    const uint16_t hashed = progress->hashEnd;
+    progress->hashStart = 0;
+    progress->hashEnd = 0;
+
+    return crypto_streamSha256Update(ctx->buffer + hashed, end - hashed) == zxerr_ok &&
+           crypto_streamSha256Final(output, HASH_LEN) == zxerr_ok;
+}
+
+parser_error_t streamPendingSection(parser_context_t *ctx, parser_tx_t *v) {
+    if (ctx == NULL || v == NULL) {
+        return parser_unexpected_value;
+    }
+    if (v->progress.stage != parse_stage_sections || ctx->offset >= ctx->bufferLen) {
+        return parser_ok;
+    }
+
+    const uint8_t *section = ctx->buffer + ctx->offset;
+    const uint16_t available = ctx->bufferLen - ctx->offset;
+    uint16_t lenOffset = 0;
+    bool wholeSection = false;
+    switch (section[0]) {
+        case DISCRIMINANT_DATA:
+            // The data digest covers the whole serialized section
+            lenOffset = 1 + SALT_LEN;
+            wholeSection = true;
+            break;
+        case DISCRIMINANT_EXTRA_DATA:
+            // Only the committed bytes are large enough to be worth streaming
+            if (available <= 1 + SALT_LEN || section[1 + SALT_LEN] == 0) {
+                return parser_ok;
+            }
+            lenOffset = 1 + SALT_LEN + 1;
+            break;
+        default:
+            return parser_ok;
+    }
+    if (available < lenOffset + sizeof(uint32_t)) {
+        return parser_ok;
+    }
+
+    const uint32_t bytesLen = (uint32_t)section[lenOffset] | ((uint32_t)section[lenOffset + 1] << 8) |
+                              ((uint32_t)section[lenOffset + 2] << 16) | ((uint32_t)section[lenOffset + 3] << 24);
+    const uint32_t bytesStart = (uint32_t)ctx->offset + lenOffset + sizeof(uint32_t);
+    if (bytesLen > UINT16_MAX || bytesStart + bytesLen > UINT16_MAX) {
+        return parser_ok;
+    }
+    const uint16_t hashStart = wholeSection ? ctx->offset : (uint16_t)bytesStart;
+    const uint32_t bytesEnd = bytesStart + bytesLen;
+    const uint16_t hashEnd = bytesEnd < ctx->bufferLen ? (uint16_t)bytesEnd : ctx->bufferLen;
+
+    // No point in reading the section again before all of its bytes arrived
+    if (bytesEnd > ctx->bufferLen) {
+        v->progress.retryAt = (uint16_t)bytesEnd;
+    }
+
+    parse_progress_t *progress = &v->progress;
+    if (progress->hashEnd <= progress->hashStart || progress->hashStart != hashStart) {
+        if (crypto_streamSha256Init() != zxerr_ok) {
+            return parser_unexpected_error;
+        }
+        progress->hashStart = hashStart;
+        progress->hashEnd = hashStart;
+    }
+    if (hashEnd > progress->hashEnd) {
+        if (crypto_streamSha256Update(ctx->buffer + progress->hashEnd, hashEnd - progress->hashEnd) != zxerr_ok) {
+            return parser_unexpected_error;
+        }
+        progress->hashEnd = hashEnd;
+    }
+
+    return parser_ok;
+}
+
 static parser_error_t readExtraDataSection(parser_context_t *ctx, section_t *extraData) {
     if (ctx == NULL || extraData == NULL) {
         return parser_unexpected_error;
@@ -1048,6 +1111,7 @@ static parser_error_t readExtraDataSection(parser_context_t *ctx, section_t *ext
     }
     CHECK_ERROR(readSalt(ctx, &extraData->salt))
 
+    bool bytesHashed = false;
     CHECK_ERROR(readByte(ctx, &extraData->commitmentDiscriminant))
     if (extraData->commitmentDiscriminant) {
         uint32_t bytesLen = 0;
@@ -1056,7 +1120,9 @@ static parser_error_t readExtraDataSection(parser_context_t *ctx, section_t *ext
              return parser_value_out_of_range;
         }
         extraData->bytes.len = (uint16_t)bytesLen;
+        const uint16_t bytesStart = ctx->offset;
         CHECK_ERROR(readBytes(ctx, &extraData->bytes.ptr, extraData->bytes.len))
+        bytesHashed = takeStreamedHash(ctx, bytesStart, ctx->offset, extraData->bytes_hash);
     } else {
         uint8_t const * code_hash;
         CHECK_ERROR(readBytes(ctx, &code_hash, HASH_LEN))
@@ -1081,7 +1147,8 @@ static parser_error_t readExtraDataSection(parser_context_t *ctx, section_t *ext
         CHECK_ERROR(readBytes(ctx, &extraData->tag.ptr, extraData->tag.len))
     }
 
-    if (crypto_computeCodeHash(extraData) != zxerr_ok) {
+    if ((!bytesHashed && crypto_computeCodeHash(extraData) != zxerr_ok) ||
+        crypto_hashExtraDataSection(extraData, extraData->section_hash, sizeof(extraData->section_hash)) != zxerr_ok) {
         return parser_unexpected_error;
     }
 
@@ -1164,6 +1231,7 @@ static parser_error_t readDataSection(parser_context_t *ctx, section_t *data) {
         return parser_unexpected_error;
     }
 
+    const uint16_t sectionStart = ctx->offset;
     CHECK_ERROR(readByte(ctx, &data->discriminant))
     if (data->discriminant != DISCRIMINANT_DATA) {
         return parser_unexpected_value;
@@ -1178,12 +1246,12 @@ static parser_error_t readDataSection(parser_context_t *ctx, section_t *data) {
     CHECK_ERROR(readBytes(ctx, &data->bytes.ptr, data->bytes.len))
 
     // Must make sure that header dataHash refers to this section's hash
-    uint8_t dataHash[HASH_LEN] = {0};
-    if (crypto_hashDataSection(data, dataHash, sizeof(dataHash)) != zxerr_ok) {
+    if (!takeStreamedHash(ctx, sectionStart, ctx->offset, data->section_hash) &&
+        crypto_hashDataSection(data, data->section_hash, sizeof(data->section_hash)) != zxerr_ok) {
         return parser_unexpected_error;
     }
     header_t *header = &ctx->tx_obj->transaction.header;
-    if (memcmp(dataHash, header->dataHash.ptr, header->dataHash.len) != 0) {
+    if (memcmp(data->section_hash, header->dataHash.ptr, header->dataHash.len) != 0) {
         return parser_unexpected_value;
     }
     return parser_ok;
@@ -1231,18 +1299,17 @@ static parser_error_t readCodeSection(parser_context_t *ctx, section_t *code) {
     }
 
     // Must make sure that header codeHash refers to this section's hash
-    uint8_t codeHash[HASH_LEN] = {0};
-    if (crypto_hashCodeSection(code, codeHash, sizeof(codeHash)) != zxerr_ok) {
+    if (crypto_hashCodeSection(code, code->section_hash, sizeof(code->section_hash)) != zxerr_ok) {
         return parser_unexpected_error;
     }
     header_t *header = &ctx->tx_obj->transaction.header;
-    if (memcmp(codeHash, header->codeHash.ptr, header->codeHash.len) != 0) {
+    if (memcmp(code->section_hash, header->codeHash.ptr, header->codeHash.len) != 0) {
         return parser_unexpected_value;
     }
     return parser_ok;
 }
 
-parser_error_t readSections(parser_context_t *ctx, parser_tx_t *v) {
+parser_error_t readSectionsLen(parser_context_t *ctx, parser_tx_t *v) {
     if (ctx == NULL || v == NULL) {
         return parser_unexpected_value;
     }
@@ -1255,56 +1322,73 @@ parser_error_t readSections(parser_context_t *ctx, parser_tx_t *v) {
     v->transaction.sections.extraDataLen = 0;
     v->transaction.sections.signaturesLen = 0;
 
-    for (uint32_t i = 0; i < v->transaction.sections.sectionLen; i++) {
-        if (ctx->offset >= ctx->bufferLen) {
-            return parser_unexpected_error;
+    return parser_ok;
+}
+
+parser_error_t readSection(parser_context_t *ctx, parser_tx_t *v, uint32_t i) {
+    if (ctx == NULL || v == NULL) {
+        return parser_unexpected_value;
+    }
+    if (ctx->offset >= ctx->bufferLen) {
+        return parser_unexpected_error;
+    }
+    const uint8_t discriminant = *(ctx->buffer + ctx->offset);
+    switch (discriminant) {
+        case DISCRIMINANT_DATA: {
+            CHECK_ERROR(readDataSection(ctx, &v->transaction.sections.data))
+            v->transaction.sections.data.idx = i+1;
+            break;
         }
-        const uint8_t discriminant = *(ctx->buffer + ctx->offset);
-        switch (discriminant) {
-            case DISCRIMINANT_DATA: {
-                CHECK_ERROR(readDataSection(ctx, &v->transaction.sections.data))
-                v->transaction.sections.data.idx = i+1;
-                break;
-            }
-            case DISCRIMINANT_EXTRA_DATA: {
-                if (v->transaction.sections.extraDataLen >= MAX_EXTRA_DATA_SECS) {
-                    return parser_unexpected_field;
-                }
-                section_t *extraData = &v->transaction.sections.extraData[v->transaction.sections.extraDataLen++];
-                CHECK_ERROR(readExtraDataSection(ctx, extraData))
-                extraData->idx = i+1;
-                break;
-            }
-            case DISCRIMINANT_CODE: {
-                CHECK_ERROR(readCodeSection(ctx, &v->transaction.sections.code))
-                v->transaction.sections.code.idx = i+1;
-                break;
+        case DISCRIMINANT_EXTRA_DATA: {
+            if (v->transaction.sections.extraDataLen >= MAX_EXTRA_DATA_SECS) {
+                return parser_unexpected_field;
             }
-            case DISCRIMINANT_SIGNATURE: {
-                if (v->transaction.sections.signaturesLen >= MAX_SIGNATURE_SECS) {
-                    return parser_value_out_of_range;
-                }
-                signature_section_t *signature = &v->transaction.sections.signatures[v->transaction.sections.signaturesLen++];
-                CHECK_ERROR(readSignatureSection(ctx, signature))
-                signature->idx = i+1;
-                break;
+            section_t *extraData = &v->transaction.sections.extraData[v->transaction.sections.extraDataLen++];
+            CHECK_ERROR(readExtraDataSection(ctx, extraData))
+            extraData->idx = i+1;
+            break;
+        }
+        case DISCRIMINANT_CODE: {
+            CHECK_ERROR(readCodeSection(ctx, &v->transaction.sections.code))
+            v->transaction.sections.code.idx = i+1;
+            break;
+        }
+        case DISCRIMINANT_SIGNATURE: {
+            if (v->transaction.sections.signaturesLen >= MAX_SIGNATURE_SECS) {
+                return parser_value_out_of_range;
             }
+            signature_section_t *signature = &v->transaction.sections.signatures[v->transaction.sections.signaturesLen++];
+            CHECK_ERROR(readSignatureSection(ctx, signature))
+            signature->idx = i+1;
+            break;
+        }
 #if defined(COMPILE_MASP)
-            case DISCRIMINANT_MASP_TX:
-                // Identify tx has masp tx
-                v->transaction.isMasp = true;
-                CHECK_ERROR(readMaspTx(ctx, &v->transaction.sections.maspTx))
-                v->transaction.maspTx_idx = i+1;
-                break;
-            case DISCRIMINANT_MASP_BUILDER:
-                CHECK_ERROR(readMaspBuilder(ctx, &v->transaction.sections.maspBuilder))
-                CHECK_ERROR(checkMaspSpendsSymbols(ctx))
-                CHECK_ERROR(checkMaspOutputsSymbols(ctx))
-                break;
+        case DISCRIMINANT_MASP_TX:
+            // Identify tx has masp tx
+            v->transaction.isMasp = true;
+            CHECK_ERROR(readMaspTx(ctx, &v->transaction.sections.maspTx))
+            v->transaction.maspTx_idx = i+1;
+            break;
+        case DISCRIMINANT_MASP_BUILDER:
+            CHECK_ERROR(readMaspBuilder(ctx, &v->transaction.sections.maspBuilder))
+            break;
 #endif
-            default:
-                return parser_unexpected_field;
-        }
+        default:
+            return parser_unexpected_field;
+    }
+
+    return parser_ok;
+}
+
+parser_error_t finishSections(parser_tx_t *v) {
+    // Missing code or data sections are still committed to when signing
+    section_t *code = &v->transaction.sections.code;
+    if (code->idx == 0 && crypto_hashCodeSection(code, code->section_hash, sizeof(code->section_hash)) != zxerr_ok) {
+        return parser_unexpected_error;
+    }
+    section_t *data = &v->transaction.sections.data;
+    if (data->idx == 0 && crypto_hashDataSection(data, data->section_hash, sizeof(data->section_hash)) != zxerr_ok) {
+        return parser_unexpected_error;
     }
 
     return parser_ok;
@@ -1320,11 +1404,7 @@ parser_error_t validateTransactionParams(parser_tx_t *txObj) {
         const section_t *extra_data = txObj->transaction.sections.extraData;
         // Load the linked to data from the extra data sections
         for (uint32_t i = 0; i < txObj->transaction.sections.extraDataLen; i++) {
-            uint8_t extraDataHash[HASH_LEN] = {0};
-            if (crypto_hashExtraDataSection(&extra_data[i], extraDataHash, sizeof(extraDataHash)) != zxerr_ok) {
-                return parser_unexpected_error;
-            }
-
+            const uint8_t *extraDataHash = extra_data[i].section_hash;
             if (!memcmp(extraDataHash, txObj->transaction.header.memoHash.ptr, HASH_LEN)) {
                 // If this section contains the memo
                 txObj->transaction.header.memoSection = &extra_data[i];
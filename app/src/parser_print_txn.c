@@ -15,7 +15,6 @@
 ********************************************************************************/
 #include "parser_print_common.h"
 #include "parser_impl_common.h"
-#include "app_mode.h"
 #include <zxmacros.h>
 #include <zxformat.h>
 #include "coin.h"
@@ -96,7 +95,7 @@ static __attribute__((noinline)) parser_error_t printBondTxn( const parser_conte
         displayIdx++;
     }
 
-    if (displayIdx >= 5 && app_mode_expert()) {
+    if (displayIdx >= 5 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -107,7 +106,7 @@ static __attribute__((noinline)) parser_error_t printBondTxn( const parser_conte
             if (ctx->tx_obj->typeTx == Unbond) {
                 snprintf(outVal, outValLen, "Unbond");
             }
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -143,7 +142,7 @@ static __attribute__((noinline)) parser_error_t printBondTxn( const parser_conte
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                return parser_display_idx_out_of_range;
             }
             displayIdx -= 7;
@@ -163,7 +162,7 @@ static __attribute__((noinline)) parser_error_t printResignSteward( const parser
         displayIdx++;
     }
 
-    if (displayIdx >= 3 && app_mode_expert()) {
+    if (displayIdx >= 3 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -171,7 +170,7 @@ static __attribute__((noinline)) parser_error_t printResignSteward( const parser
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Resign Steward");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -195,7 +194,7 @@ static __attribute__((noinline)) parser_error_t printResignSteward( const parser
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                return parser_display_idx_out_of_range;
             }
             displayIdx -= 5;
@@ -205,6 +204,13 @@ static __attribute__((noinline)) parser_error_t printResignSteward( const parser
     return parser_ok;
 }
 
+static parser_error_t readLayoutSourceTarget(const bytes_t *list, const layout_item_t *item,
+                                             AddressAlt *owner, AddressAlt *token, bytes_t *amount,
+                                             uint8_t *amount_denom, const char **symbol) {
+    parser_context_t list_ctx = {.buffer = list->ptr, .bufferLen = list->len, .offset = item->entity, .tx_obj = NULL};
+    return readTransferSourceTarget(&list_ctx, owner, token, amount, amount_denom, symbol);
+}
+
 static __attribute__((noinline)) parser_error_t printTransferTxn( const parser_context_t *ctx,
                                         uint8_t displayIdx,
                                         char *outKey, uint16_t outKeyLen,
@@ -214,16 +220,10 @@ static __attribute__((noinline)) parser_error_t printTransferTxn( const parser_c
     bytes_t spend = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.spends;
     // Get pointer to the outputs
     bytes_t out = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.outputs;
-    // Compute number of spends/outs in the builder tx , and number of itemns to be printer for each
-    uint32_t n_spends = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_spends * (uint32_t) ctx->tx_obj->transaction.isMasp;
-    uint32_t n_outs = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_outputs * (uint32_t) ctx->tx_obj->transaction.isMasp;
 
     const uint8_t typeStart = 0;
     const uint8_t sourcesStart = 1;
-    const uint8_t spendsStart = sourcesStart + 2*ctx->tx_obj->transfer.non_masp_sources_len + ctx->tx_obj->transfer.no_symbol_sources;
-    const uint8_t targetsStart = spendsStart + 2*n_spends + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_spends;
-    const uint8_t outputsStart = targetsStart + 2*ctx->tx_obj->transfer.non_masp_targets_len + ctx->tx_obj->transfer.no_symbol_targets;
-    const uint8_t memoStart = outputsStart + 2*n_outs + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_outputs;
+    const uint8_t memoStart = sourcesStart + ctx->tx_obj->layout.numItems;
     const uint8_t expertStart = memoStart + (ctx->tx_obj->transaction.header.memoSection != NULL);
     AddressAlt source_address = {0};
     AddressAlt target_address = {0};
@@ -243,75 +243,46 @@ static __attribute__((noinline)) parser_error_t printTransferTxn( const parser_c
 
     if (typeStart <= displayIdx && displayIdx < sourcesStart) {
         displayIdx = 0;
-    } else if (sourcesStart <= displayIdx && displayIdx < spendsStart) {
-        displayIdx -= sourcesStart;
-        parser_context_t sources_ctx = {.buffer = ctx->tx_obj->transfer.sources.ptr, .bufferLen = ctx->tx_obj->transfer.sources.len, .offset = 0, .tx_obj = NULL};
- 
-        for (uint32_t i = 0; i < ctx->tx_obj->transfer.sources_len; i++) {
-            CHECK_ERROR(readTransferSourceTarget(&sources_ctx, &source_address, &token, &namount, &amount_denom, &symbol))
-            if (isMaspInternalAddress(&source_address)) {
-            } else if (displayIdx >= 2 + (symbol == NULL)) {
-                displayIdx -= 2 + (symbol == NULL);
-            } else {
-                displayIdx += 1;
+    } else if (sourcesStart <= displayIdx && displayIdx < memoStart) {
+        layout_item_t item = {0};
+        CHECK_ERROR(getLayoutItem(ctx, displayIdx - sourcesStart, &item))
+        switch (item.kind) {
+            case layout_source:
+                CHECK_ERROR(readLayoutSourceTarget(&ctx->tx_obj->transfer.sources, &item, &source_address, &token, &namount, &amount_denom, &symbol))
+                displayIdx = 1 + item.field;
                 break;
-            }
-        }
-    } else if (spendsStart <= displayIdx && displayIdx < targetsStart) {
-        displayIdx -= spendsStart;
-        for(uint32_t i = 0; i < n_spends; i++) {
-            getSpendfromIndex(i, &spend);
-            stoken = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN;
-            amount = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN + ASSET_ID_LEN;
-            CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, stoken, &asset_data, &asset_idx))
-
-            if (displayIdx >= (asset_data.symbol == NULL ? 3 : 2)) {
-                displayIdx -= (asset_data.symbol == NULL ? 3 : 2);
-            } else {
-                displayIdx += 7;  // Base case number for spends
+            case layout_spend:
+                CHECK_ERROR(getSpendfromIndex(&ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder, item.entity, &spend))
+                stoken = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN;
+                amount = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN + ASSET_ID_LEN;
+                CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, stoken, &asset_data, &asset_idx))
+                displayIdx = 7 + item.field;  // Base case number for spends
                 break;
-            }
-        }
-    } else if (targetsStart <= displayIdx && displayIdx < outputsStart) {
-        displayIdx -= targetsStart;
-        parser_context_t targets_ctx = {.buffer = ctx->tx_obj->transfer.targets.ptr, .bufferLen = ctx->tx_obj->transfer.targets.len, .offset = 0, .tx_obj = NULL};
-        
-        for (uint32_t i = 0; i < ctx->tx_obj->transfer.targets_len; i++) {
-            CHECK_ERROR(readTransferSourceTarget(&targets_ctx, &target_address, &token, &namount, &amount_denom, &symbol))
-            if(isMaspInternalAddress(&target_address)) {
-            } else if(displayIdx >= 2 + (symbol == NULL)) {
-                displayIdx -= 2 + (symbol == NULL);
-            } else {
-                displayIdx += 4;
+            case layout_target:
+                CHECK_ERROR(readLayoutSourceTarget(&ctx->tx_obj->transfer.targets, &item, &target_address, &token, &namount, &amount_denom, &symbol))
+                displayIdx = 4 + item.field;
                 break;
-            }
-        }
-    } else if(outputsStart <= displayIdx && displayIdx < memoStart) {
-        displayIdx -= outputsStart;
-        for(uint32_t i = 0; i < n_outs; i++) {
-            getOutputfromIndex(i, &out);
-            rtoken = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN;
-            amount = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN + ASSET_ID_LEN;
-            CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, rtoken, &asset_data, &asset_idx))
-
-            if (displayIdx >= (asset_data.symbol == NULL ? 3 : 2)) {
-                displayIdx -= (asset_data.symbol == NULL ? 3 : 2);
-            } else {
-                displayIdx += 10;  // Base case number for outputs
+            case layout_output:
+                CHECK_ERROR(getOutputfromIndex(&ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder, item.entity, &out))
+                rtoken = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN;
+                amount = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN + ASSET_ID_LEN;
+                CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, rtoken, &asset_data, &asset_idx))
+                displayIdx = 10 + item.field;  // Base case number for outputs
                 break;
-            }
+            default:
+                return parser_unexpected_value;
         }
     } else if(memoStart <= displayIdx && displayIdx < expertStart) {
         displayIdx = 13;
     } else if(expertStart <= displayIdx) {
-        displayIdx = (app_mode_expert() ? 16 : 14) + (displayIdx - expertStart);
+        displayIdx = (ctx->expert ? 16 : 14) + (displayIdx - expertStart);
     }
 
     switch (displayIdx) {
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Transfer");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -394,7 +365,7 @@ static __attribute__((noinline)) parser_error_t printTransferTxn( const parser_c
 #ifndef LEDGER_SPECIFIC
             uint8_t change_address[PAYMENT_ADDR_LEN] = {0x4e, 0x71, 0x48, 0xcb, 0xd2, 0xfe, 0xce, 0x3a, 0xd9, 0x30, 0x1e, 0xba, 0xe4, 0x08, 0x51, 0xd1, 0x72, 0x39, 0x5d, 0x12, 0xf0, 0xd9, 0x0c, 0x2c, 0x1e, 0x01, 0xcd, 0x3c, 0x47, 0x5d, 0x59, 0xff, 0xf5, 0xe2, 0x6d, 0x21, 0x12, 0x50, 0xd8, 0xe9, 0xb6, 0x12, 0x3a};
 #endif
-            if(!app_mode_expert()) {
+            if(!ctx->expert) {
                 if(MEMCMP(out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1), change_address, PAYMENT_ADDR_LEN) == 0) {
                     snprintf(outVal, outValLen, "Self");
                     break;
@@ -447,7 +418,7 @@ static __attribute__((noinline)) parser_error_t printTransferTxn( const parser_c
             break;
 
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                return parser_display_idx_out_of_range;
             }
             displayIdx -= 16;
@@ -463,7 +434,7 @@ static __attribute__((noinline)) parser_error_t printCustomTxn( const parser_con
                                            char *outVal, uint16_t outValLen,
                                            uint8_t pageIdx, uint8_t *pageCount) {
 
-    if(displayIdx >= 1 && app_mode_expert()) {
+    if(displayIdx >= 1 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -471,7 +442,7 @@ static __attribute__((noinline)) parser_error_t printCustomTxn( const parser_con
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Custom");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -488,7 +459,7 @@ static __attribute__((noinline)) parser_error_t printCustomTxn( const parser_con
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 3;
@@ -520,7 +491,7 @@ static __attribute__((noinline)) parser_error_t printInitAccountTxn(  const pars
         adjustedDisplayIdx++;
     }
 
-    if(adjustedDisplayIdx >= 5 && app_mode_expert()) {
+    if(adjustedDisplayIdx >= 5 && ctx->expert) {
         adjustedDisplayIdx += 2;
     }
 
@@ -528,7 +499,7 @@ static __attribute__((noinline)) parser_error_t printInitAccountTxn(  const pars
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Init Account");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -560,7 +531,7 @@ static __attribute__((noinline)) parser_error_t printInitAccountTxn(  const pars
 
         case 3:
             snprintf(outKey, outKeyLen, "VP type");
-            if (ctx->tx_obj->initAccount.vp_type_text != NULL && !app_mode_expert()) {
+            if (ctx->tx_obj->initAccount.vp_type_text != NULL && !ctx->expert) {
                 pageString(outVal, outValLen,ctx->tx_obj->initAccount.vp_type_text, pageIdx, pageCount);
             } else {
                 pageStringHex(outVal, outValLen, (const char*)ctx->tx_obj->initAccount.vp_type_hash.ptr, ctx->tx_obj->initAccount.vp_type_hash.len, pageIdx, pageCount);
@@ -581,7 +552,7 @@ static __attribute__((noinline)) parser_error_t printInitAccountTxn(  const pars
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 3 + pubkeys_num + (hasMemo ? 1 : 0);
@@ -626,7 +597,7 @@ static __attribute__((noinline)) parser_error_t printInitProposalTxn(  const par
         adjustedIdx++;
     }
 
-    if(adjustedIdx >= 8 && app_mode_expert()) {
+    if(adjustedIdx >= 8 && ctx->expert) {
         adjustedIdx += 2;
     }
 
@@ -636,7 +607,7 @@ static __attribute__((noinline)) parser_error_t printInitProposalTxn(  const par
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Init proposal");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -694,7 +665,7 @@ static __attribute__((noinline)) parser_error_t printInitProposalTxn(  const par
             break;
 
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             adjustedIdx -= 10;
@@ -717,7 +688,7 @@ static __attribute__((noinline)) parser_error_t printVoteProposalTxn(  const par
         displayIdx++;
     }
 
-    if(displayIdx >= 5 && app_mode_expert()) {
+    if(displayIdx >= 5 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -725,7 +696,7 @@ static __attribute__((noinline)) parser_error_t printVoteProposalTxn(  const par
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Vote Proposal");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -777,7 +748,7 @@ static __attribute__((noinline)) parser_error_t printVoteProposalTxn(  const par
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 7;
@@ -799,7 +770,7 @@ static __attribute__((noinline)) parser_error_t printRevealPubkeyTxn(  const par
         displayIdx++;
     }
 
-    if(displayIdx >= 3 && app_mode_expert()) {
+    if(displayIdx >= 3 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -807,7 +778,7 @@ static __attribute__((noinline)) parser_error_t printRevealPubkeyTxn(  const par
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Reveal Pubkey");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -833,7 +804,7 @@ static __attribute__((noinline)) parser_error_t printRevealPubkeyTxn(  const par
             break;
 
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 5;
@@ -853,7 +824,7 @@ static __attribute__((noinline)) parser_error_t printChangeConsensusKeyTxn( cons
         displayIdx++;
     }
 
-    if(displayIdx >= 4 && app_mode_expert()) {
+    if(displayIdx >= 4 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -861,7 +832,7 @@ static __attribute__((noinline)) parser_error_t printChangeConsensusKeyTxn( cons
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Change consensus key");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -890,7 +861,7 @@ static __attribute__((noinline)) parser_error_t printChangeConsensusKeyTxn( cons
             break;
 
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                return parser_display_idx_out_of_range;
             }
             displayIdx -= 6;
@@ -910,7 +881,7 @@ static __attribute__((noinline)) parser_error_t printUnjailValidatorTxn(const pa
         displayIdx++;
     }
 
-    if(displayIdx >= 3 && app_mode_expert()) {
+    if(displayIdx >= 3 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -918,7 +889,7 @@ static __attribute__((noinline)) parser_error_t printUnjailValidatorTxn(const pa
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Unjail Validator");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -943,7 +914,7 @@ static __attribute__((noinline)) parser_error_t printUnjailValidatorTxn(const pa
             break;
 
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 5;
@@ -962,7 +933,7 @@ static __attribute__((noinline)) parser_error_t printActivateValidator(const par
         displayIdx++;
     }
 
-    if(displayIdx >= 3 && app_mode_expert()) {
+    if(displayIdx >= 3 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -973,7 +944,7 @@ static __attribute__((noinline)) parser_error_t printActivateValidator(const par
             if (ctx->tx_obj->typeTx == DeactivateValidator) {
                 snprintf(outVal, outValLen, "Deactivate Validator");
             }
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -997,7 +968,7 @@ static __attribute__((noinline)) parser_error_t printActivateValidator(const par
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 5;
@@ -1036,7 +1007,7 @@ static __attribute__((noinline)) parser_error_t printUpdateVPTxn(const parser_co
         adjustedDisplayIdx++;
     }
 
-    if(adjustedDisplayIdx >= 6 && app_mode_expert()) {
+    if(adjustedDisplayIdx >= 6 && ctx->expert) {
         adjustedDisplayIdx += 2;
     }
 
@@ -1044,7 +1015,7 @@ static __attribute__((noinline)) parser_error_t printUpdateVPTxn(const parser_co
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Update Account");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -1080,7 +1051,7 @@ static __attribute__((noinline)) parser_error_t printUpdateVPTxn(const parser_co
         }
         case 4:
             snprintf(outKey, outKeyLen, "VP type");
-            if (ctx->tx_obj->updateVp.vp_type_text != NULL && !app_mode_expert()) {
+            if (ctx->tx_obj->updateVp.vp_type_text != NULL && !ctx->expert) {
                 pageString(outVal, outValLen,ctx->tx_obj->updateVp.vp_type_text, pageIdx, pageCount);
             } else {
                 pageStringHex(outVal, outValLen, (const char*)ctx->tx_obj->updateVp.vp_type_hash.ptr, ctx->tx_obj->updateVp.vp_type_hash.len, pageIdx, pageCount);
@@ -1103,7 +1074,7 @@ static __attribute__((noinline)) parser_error_t printUpdateVPTxn(const parser_co
             break;
 
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 5 + pubkeys_num - (updateVp->has_threshold ? 0 : 1) - (updateVp->has_vp_code ? 0 : 1)
@@ -1141,7 +1112,7 @@ static __attribute__((noinline)) parser_error_t printBecomeValidatorTxn(  const
         displayIdx++;
     }
 
-    if(displayIdx >= 15 && app_mode_expert()) {
+    if(displayIdx >= 15 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -1149,7 +1120,7 @@ static __attribute__((noinline)) parser_error_t printBecomeValidatorTxn(  const
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Become Validator");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -1257,7 +1228,7 @@ static __attribute__((noinline)) parser_error_t printBecomeValidatorTxn(  const
             break;
 
         default: {
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 17;
@@ -1284,7 +1255,7 @@ static __attribute__((noinline)) parser_error_t printWithdrawTxn( const parser_c
         displayIdx++;
     }
 
-    if(displayIdx >= 4 && app_mode_expert()) {
+    if(displayIdx >= 4 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -1297,7 +1268,7 @@ static __attribute__((noinline)) parser_error_t printWithdrawTxn( const parser_c
             } else {
                 snprintf(outVal, outValLen, "Withdraw");
             }
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -1329,7 +1300,7 @@ static __attribute__((noinline)) parser_error_t printWithdrawTxn( const parser_c
             break;
 
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                return parser_display_idx_out_of_range;
             }
             displayIdx -= 6;
@@ -1349,7 +1320,7 @@ static __attribute__((noinline)) parser_error_t printCommissionChangeTxn( const
     if (displayIdx >= 3 && !hasMemo) {
         displayIdx++;
     }
-    if(displayIdx >= 4 && app_mode_expert()) {
+    if(displayIdx >= 4 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -1357,7 +1328,7 @@ static __attribute__((noinline)) parser_error_t printCommissionChangeTxn( const
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Change commission");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -1386,7 +1357,7 @@ static __attribute__((noinline)) parser_error_t printCommissionChangeTxn( const
             break;
 
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 6;
@@ -1406,15 +1377,9 @@ static __attribute__((noinline)) parser_error_t printIBCTxn( const parser_contex
     bytes_t spend = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.spends;
     // Get pointer to the outputs
     bytes_t out = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.outputs;
-    // Compute number of spends/outs in the builder tx , and number of itemns to be printer for each
-    uint32_t n_spends = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_spends * (uint32_t) ctx->tx_obj->transaction.isMasp;
-    uint32_t n_outs = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_outputs * (uint32_t) ctx->tx_obj->transaction.isMasp;
 
     const uint8_t sourcesStart = 9;
-    const uint8_t spendsStart = sourcesStart + 2*ctx->tx_obj->ibc.transfer.non_masp_sources_len + ctx->tx_obj->ibc.transfer.no_symbol_sources;
-    const uint8_t targetsStart = spendsStart + 2*n_spends + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_spends;
-    const uint8_t outputsStart = targetsStart + 2*ctx->tx_obj->ibc.transfer.non_masp_targets_len + ctx->tx_obj->ibc.transfer.no_symbol_targets;
-    const uint8_t memoStart = outputsStart + 2*n_outs + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_outputs;
+    const uint8_t memoStart = sourcesStart + ctx->tx_obj->layout.numItems;
     const uint8_t expertStart = memoStart + (ctx->tx_obj->transaction.header.memoSection != NULL);
     AddressAlt source_address = {0};
     AddressAlt target_address = {0};
@@ -1434,67 +1399,38 @@ static __attribute__((noinline)) parser_error_t printIBCTxn( const parser_contex
     const tx_ibc_t *ibc = &ctx->tx_obj->ibc;
 
     // Skip printing the IBC memo in normal mode
-    if (displayIdx >= 6 && !(app_mode_expert() && ctx->tx_obj->ibc.memo.len > 0)) {
+    if (displayIdx >= 6 && !(ctx->expert && ctx->tx_obj->ibc.memo.len > 0)) {
         displayIdx ++;
     }
 
-    if (sourcesStart <= displayIdx && displayIdx < spendsStart) {
-        displayIdx -= sourcesStart;
-        parser_context_t sources_ctx = {.buffer = ctx->tx_obj->ibc.transfer.sources.ptr, .bufferLen = ctx->tx_obj->ibc.transfer.sources.len, .offset = 0, .tx_obj = NULL};
- 
-        for (uint32_t i = 0; i < ctx->tx_obj->ibc.transfer.sources_len; i++) {
-            CHECK_ERROR(readTransferSourceTarget(&sources_ctx, &source_address, &token, &namount, &amount_denom, &symbol))
-            if (isMaspInternalAddress(&source_address)) {
-            } else if (displayIdx >= 2 + (symbol == NULL)) {
-                displayIdx -= 2 + (symbol == NULL);
-            } else {
-                displayIdx += 9;
+    if (sourcesStart <= displayIdx && displayIdx < memoStart) {
+        layout_item_t item = {0};
+        CHECK_ERROR(getLayoutItem(ctx, displayIdx - sourcesStart, &item))
+        switch (item.kind) {
+            case layout_source:
+                CHECK_ERROR(readLayoutSourceTarget(&ctx->tx_obj->ibc.transfer.sources, &item, &source_address, &token, &namount, &amount_denom, &symbol))
+                displayIdx = 9 + item.field;
                 break;
-            }
-        }
-    } else if (spendsStart <= displayIdx && displayIdx < targetsStart) {
-        displayIdx -= spendsStart;
-        for(uint32_t i = 0; i < n_spends; i++) {
-            getSpendfromIndex(i, &spend);
-            stoken = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN;
-            amount = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN + ASSET_ID_LEN;
-            CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, stoken, &asset_data, &asset_idx))
-
-            if (displayIdx >= (asset_data.symbol == NULL ? 3 : 2)) {
-                displayIdx -= (asset_data.symbol == NULL ? 3 : 2);
-            } else {
-                displayIdx += 15;  // Base case number for spends
+            case layout_spend:
+                CHECK_ERROR(getSpendfromIndex(&ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder, item.entity, &spend))
+                stoken = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN;
+                amount = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN + ASSET_ID_LEN;
+                CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, stoken, &asset_data, &asset_idx))
+                displayIdx = 15 + item.field;  // Base case number for spends
                 break;
-            }
-        }
-    } else if (targetsStart <= displayIdx && displayIdx < outputsStart) {
-        displayIdx -= targetsStart;
-        parser_context_t targets_ctx = {.buffer = ctx->tx_obj->ibc.transfer.targets.ptr, .bufferLen = ctx->tx_obj->ibc.transfer.targets.len, .offset = 0, .tx_obj = NULL};
-        
-        for (uint32_t i = 0; i < ctx->tx_obj->ibc.transfer.targets_len; i++) {
-            CHECK_ERROR(readTransferSourceTarget(&targets_ctx, &target_address, &token, &namount, &amount_denom, &symbol))
-            if(isMaspInternalAddress(&target_address)) {
-            } else if(displayIdx >= 2 + (symbol == NULL)) {
-                displayIdx -= 2 + (symbol == NULL);
-            } else {
-                displayIdx += 12;
+            case layout_target:
+                CHECK_ERROR(readLayoutSourceTarget(&ctx->tx_obj->ibc.transfer.targets, &item, &target_address, &token, &namount, &amount_denom, &symbol))
+                displayIdx = 12 + item.field;
                 break;
-            }
-        }
-    } else if(outputsStart <= displayIdx && displayIdx < memoStart) {
-        displayIdx -= outputsStart;
-        for(uint32_t i = 0; i < n_outs; i++) {
-            getOutputfromIndex(i, &out);
-            rtoken = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN;
-            amount = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN + ASSET_ID_LEN;
-            CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, rtoken, &asset_data, &asset_idx))
-
-            if (displayIdx >= (asset_data.symbol == NULL ? 3 : 2)) {
-                displayIdx -= (asset_data.symbol == NULL ? 3 : 2);
-            } else {
-                displayIdx += 18;  // Base case number for outputs
+            case layout_output:
+                CHECK_ERROR(getOutputfromIndex(&ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder, item.entity, &out))
+                rtoken = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN;
+                amount = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN + ASSET_ID_LEN;
+                CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, rtoken, &asset_data, &asset_idx))
+                displayIdx = 18 + item.field;  // Base case number for outputs
                 break;
-            }
+            default:
+                return parser_unexpected_value;
         }
     } else if(memoStart <= displayIdx && displayIdx < expertStart) {
         displayIdx = 21;
@@ -1502,7 +1438,7 @@ static __attribute__((noinline)) parser_error_t printIBCTxn( const parser_contex
         displayIdx = 22 + (displayIdx - expertStart);
     }
 
-    if(displayIdx >= 22 && app_mode_expert()) {
+    if(displayIdx >= 22 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -1510,7 +1446,7 @@ static __attribute__((noinline)) parser_error_t printIBCTxn( const parser_contex
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "IBC Transfer");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -1651,7 +1587,7 @@ static __attribute__((noinline)) parser_error_t printIBCTxn( const parser_contex
 #ifndef LEDGER_SPECIFIC
             uint8_t change_address[PAYMENT_ADDR_LEN] = {0x4e, 0x71, 0x48, 0xcb, 0xd2, 0xfe, 0xce, 0x3a, 0xd9, 0x30, 0x1e, 0xba, 0xe4, 0x08, 0x51, 0xd1, 0x72, 0x39, 0x5d, 0x12, 0xf0, 0xd9, 0x0c, 0x2c, 0x1e, 0x01, 0xcd, 0x3c, 0x47, 0x5d, 0x59, 0xff, 0xf5, 0xe2, 0x6d, 0x21, 0x12, 0x50, 0xd8, 0xe9, 0xb6, 0x12, 0x3a};
 #endif
-            if(!app_mode_expert()) {
+            if(!ctx->expert) {
                 if(MEMCMP(out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1), change_address, PAYMENT_ADDR_LEN) == 0) {
                     snprintf(outVal, outValLen, "Self");
                     break;
@@ -1704,7 +1640,7 @@ static __attribute__((noinline)) parser_error_t printIBCTxn( const parser_contex
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                return parser_display_idx_out_of_range;
             }
             displayIdx -= 24;
@@ -1769,15 +1705,9 @@ static __attribute__((noinline)) parser_error_t printNFTIBCTxn( const parser_con
     bytes_t spend = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.spends;
     // Get pointer to the outputs
     bytes_t out = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.outputs;
-    // Compute number of spends/outs in the builder tx , and number of itemns to be printer for each
-    uint32_t n_spends = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_spends * (uint32_t) ctx->tx_obj->transaction.isMasp;
-    uint32_t n_outs = ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.n_outputs * (uint32_t) ctx->tx_obj->transaction.isMasp;
 
     const uint8_t sourcesStart = 10;
-    const uint8_t spendsStart = sourcesStart + 2*ctx->tx_obj->ibc.transfer.non_masp_sources_len + ctx->tx_obj->ibc.transfer.no_symbol_sources;
-    const uint8_t targetsStart = spendsStart + 2*n_spends + + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_spends;
-    const uint8_t outputsStart = targetsStart + 2*ctx->tx_obj->ibc.transfer.non_masp_targets_len + ctx->tx_obj->ibc.transfer.no_symbol_targets;
-    const uint8_t memoStart = outputsStart + 2*n_outs + ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder.no_symbol_outputs;
+    const uint8_t memoStart = sourcesStart + ctx->tx_obj->layout.numItems;
     const uint8_t expertStart = memoStart + (ctx->tx_obj->transaction.header.memoSection != NULL);
     AddressAlt source_address = {0};
     AddressAlt target_address = {0};
@@ -1804,67 +1734,38 @@ static __attribute__((noinline)) parser_error_t printNFTIBCTxn( const parser_con
         displayIdx -= (ibc->n_token_id -1);
     }
 
-    if(displayIdx >= 7 && (ctx->tx_obj->ibc.memo.len == 0 || !app_mode_expert())) {
+    if(displayIdx >= 7 && (ctx->tx_obj->ibc.memo.len == 0 || !ctx->expert)) {
         displayIdx++;
     }
 
-    if (sourcesStart <= displayIdx && displayIdx < spendsStart) {
-        displayIdx -= sourcesStart;
-        parser_context_t sources_ctx = {.buffer = ctx->tx_obj->ibc.transfer.sources.ptr, .bufferLen = ctx->tx_obj->ibc.transfer.sources.len, .offset = 0, .tx_obj = NULL};
- 
-        for (uint32_t i = 0; i < ctx->tx_obj->ibc.transfer.sources_len; i++) {
-            CHECK_ERROR(readTransferSourceTarget(&sources_ctx, &source_address, &token, &namount, &amount_denom, &symbol))
-            if (isMaspInternalAddress(&source_address)) {
-            } else if (displayIdx >= 2 + (symbol == NULL)) {
-                displayIdx -= 2 + (symbol == NULL);
-            } else {
-                displayIdx += 10;
+    if (sourcesStart <= displayIdx && displayIdx < memoStart) {
+        layout_item_t item = {0};
+        CHECK_ERROR(getLayoutItem(ctx, displayIdx - sourcesStart, &item))
+        switch (item.kind) {
+            case layout_source:
+                CHECK_ERROR(readLayoutSourceTarget(&ctx->tx_obj->ibc.transfer.sources, &item, &source_address, &token, &namount, &amount_denom, &symbol))
+                displayIdx = 10 + item.field;
                 break;
-            }
-        }
-    } else if (spendsStart <= displayIdx && displayIdx < targetsStart) {
-        displayIdx -= spendsStart;
-        for(uint32_t i = 0; i < n_spends; i++) {
-            getSpendfromIndex(i, &spend);
-            stoken = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN;
-            amount = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN + ASSET_ID_LEN;
-            CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, stoken, &asset_data, &asset_idx))
-
-            if (displayIdx >= (asset_data.symbol == NULL ? 3 : 2)) {
-                displayIdx -= (asset_data.symbol == NULL ? 3 : 2);
-            } else {
-                displayIdx += 16;  // Base case number for spends
+            case layout_spend:
+                CHECK_ERROR(getSpendfromIndex(&ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder, item.entity, &spend))
+                stoken = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN;
+                amount = spend.ptr + EXTENDED_FVK_LEN + DIVERSIFIER_LEN + ASSET_ID_LEN;
+                CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, stoken, &asset_data, &asset_idx))
+                displayIdx = 16 + item.field;  // Base case number for spends
                 break;
-            }
-        }
-    } else if (targetsStart <= displayIdx && displayIdx < outputsStart) {
-        displayIdx -= targetsStart;
-        parser_context_t targets_ctx = {.buffer = ctx->tx_obj->ibc.transfer.targets.ptr, .bufferLen = ctx->tx_obj->ibc.transfer.targets.len, .offset = 0, .tx_obj = NULL};
-        
-        for (uint32_t i = 0; i < ctx->tx_obj->ibc.transfer.targets_len; i++) {
-            CHECK_ERROR(readTransferSourceTarget(&targets_ctx, &target_address, &token, &namount, &amount_denom, &symbol))
-            if(isMaspInternalAddress(&target_address)) {
-            } else if(displayIdx >= 2 + (symbol == NULL)) {
-                displayIdx -= 2 + (symbol == NULL);
-            } else {
-                displayIdx += 13;
+            case layout_target:
+                CHECK_ERROR(readLayoutSourceTarget(&ctx->tx_obj->ibc.transfer.targets, &item, &target_address, &token, &namount, &amount_denom, &symbol))
+                displayIdx = 13 + item.field;
                 break;
-            }
-        }
-    } else if(outputsStart <= displayIdx && displayIdx < memoStart) {
-        displayIdx -= outputsStart;
-        for(uint32_t i = 0; i < n_outs; i++) {
-            getOutputfromIndex(i, &out);
-            rtoken = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN;
-            amount = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN + ASSET_ID_LEN;
-            CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, rtoken, &asset_data, &asset_idx))
-
-            if (displayIdx >= (asset_data.symbol == NULL ? 3 : 2)) {
-                displayIdx -= (asset_data.symbol == NULL ? 3 : 2);
-            } else {
-                displayIdx += 19;  // Base case number for outputs
+            case layout_output:
+                CHECK_ERROR(getOutputfromIndex(&ctx->tx_obj->transaction.sections.maspBuilder.builder.sapling_builder, item.entity, &out))
+                rtoken = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN;
+                amount = out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1) + PAYMENT_ADDR_LEN + ASSET_ID_LEN;
+                CHECK_ERROR(findAssetData(&ctx->tx_obj->transaction.sections.maspBuilder, rtoken, &asset_data, &asset_idx))
+                displayIdx = 19 + item.field;  // Base case number for outputs
                 break;
-            }
+            default:
+                return parser_unexpected_value;
         }
     } else if(memoStart <= displayIdx && displayIdx < expertStart) {
         displayIdx = 22;
@@ -1872,7 +1773,7 @@ static __attribute__((noinline)) parser_error_t printNFTIBCTxn( const parser_con
         displayIdx = 23 + (displayIdx - expertStart);
     }
 
-    if(displayIdx >= 23 && app_mode_expert()) {
+    if(displayIdx >= 23 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -1880,7 +1781,7 @@ static __attribute__((noinline)) parser_error_t printNFTIBCTxn( const parser_con
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "IBC NFT Transfer");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -2024,7 +1925,7 @@ static __attribute__((noinline)) parser_error_t printNFTIBCTxn( const parser_con
 #ifndef LEDGER_SPECIFIC
             uint8_t change_address[PAYMENT_ADDR_LEN] = {0x4e, 0x71, 0x48, 0xcb, 0xd2, 0xfe, 0xce, 0x3a, 0xd9, 0x30, 0x1e, 0xba, 0xe4, 0x08, 0x51, 0xd1, 0x72, 0x39, 0x5d, 0x12, 0xf0, 0xd9, 0x0c, 0x2c, 0x1e, 0x01, 0xcd, 0x3c, 0x47, 0x5d, 0x59, 0xff, 0xf5, 0xe2, 0x6d, 0x21, 0x12, 0x50, 0xd8, 0xe9, 0xb6, 0x12, 0x3a};
 #endif
-            if(!app_mode_expert()) {
+            if(!ctx->expert) {
                 if(MEMCMP(out.ptr + (out.ptr[0] ? OVK_PLUS_CHECK_BYTE : 1), change_address, PAYMENT_ADDR_LEN) == 0) {
                     snprintf(outVal, outValLen, "Self");
                     break;
@@ -2077,7 +1978,7 @@ static __attribute__((noinline)) parser_error_t printNFTIBCTxn( const parser_con
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                return parser_display_idx_out_of_range;
             }
             displayIdx -= 25;
@@ -2097,7 +1998,7 @@ static __attribute__((noinline)) parser_error_t printUpdateStewardCommission( co
     if (displayIdx == 0) {
         snprintf(outKey, outKeyLen, "Type");
         snprintf(outVal, outValLen, "Update Steward Commission");
-        if (app_mode_expert()) {
+        if (ctx->expert) {
             CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                         outVal, outValLen, pageIdx, pageCount))
         }
@@ -2139,7 +2040,7 @@ static __attribute__((noinline)) parser_error_t printUpdateStewardCommission( co
         return parser_ok;
     }
 
-    if(app_mode_expert()) {
+    if(ctx->expert) {
         displayIdx += 2;
     }
     uint8_t has_memo = ctx->tx_obj->transaction.header.memoSection != NULL ? 1 : 0;
@@ -2160,7 +2061,7 @@ static __attribute__((noinline)) parser_error_t printUpdateStewardCommission( co
     }
 
 
-    if (!app_mode_expert()) {
+    if (!ctx->expert) {
         return parser_display_idx_out_of_range;
     }
     // displayIdx will be greater than the right part. No underflow
@@ -2204,7 +2105,7 @@ static __attribute__((noinline)) parser_error_t printChangeValidatorMetadata(  c
         displayIdx++;
     }
 
-    if(displayIdx >= 10 && app_mode_expert()) {
+    if(displayIdx >= 10 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -2212,7 +2113,7 @@ static __attribute__((noinline)) parser_error_t printChangeValidatorMetadata(  c
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Change metadata");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -2291,7 +2192,7 @@ static __attribute__((noinline)) parser_error_t printChangeValidatorMetadata(  c
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default: {
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 12;
@@ -2315,7 +2216,7 @@ static __attribute__((noinline)) parser_error_t printBridgePoolTransfer(  const
         displayIdx++;
     }
 
-    if(displayIdx >= 10 && app_mode_expert()) {
+    if(displayIdx >= 10 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -2323,7 +2224,7 @@ static __attribute__((noinline)) parser_error_t printBridgePoolTransfer(  const
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Bridge Pool Transfer");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -2393,7 +2294,7 @@ static __attribute__((noinline)) parser_error_t printBridgePoolTransfer(  const
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default: {
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                 return parser_display_idx_out_of_range;
             }
             displayIdx -= 12;
@@ -2419,7 +2320,7 @@ static __attribute__((noinline)) parser_error_t printRedelegate(const parser_con
         displayIdx++;
     }
 
-    if (displayIdx >= 6 && app_mode_expert()) {
+    if (displayIdx >= 6 && ctx->expert) {
         displayIdx += 2;
     }
 
@@ -2428,7 +2329,7 @@ static __attribute__((noinline)) parser_error_t printRedelegate(const parser_con
         case 0:
             snprintf(outKey, outKeyLen, "Type");
             snprintf(outVal, outValLen, "Redelegate");
-            if (app_mode_expert()) {
+            if (ctx->expert) {
                 CHECK_ERROR(printCodeHash(&ctx->tx_obj->transaction.sections.code, outKey, outKeyLen,
                                           outVal, outValLen, pageIdx, pageCount))
             }
@@ -2466,7 +2367,7 @@ static __attribute__((noinline)) parser_error_t printRedelegate(const parser_con
             CHECK_ERROR(printFee(ctx, outKey, outKeyLen, outVal, outValLen, pageIdx, pageCount))
             break;
         default:
-            if (!app_mode_expert()) {
+            if (!ctx->expert) {
                return parser_display_idx_out_of_range;
             }
             displayIdx -= 8;
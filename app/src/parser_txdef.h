@@ -27,6 +27,16 @@ extern "C" {
 
 #define MAX_EXTRA_DATA_SECS 4
 #define MAX_SIGNATURE_SECS 3
+#if defined(COMPILE_MASP)
+#define MAX_ASSET_TYPES 16
+#define SPEND_LIST_SIZE 15
+#define MAX_LAYOUT_ITEMS 128
+#else
+// MASP sections are not parsed on this target, keep the MASP tables minimal
+#define MAX_ASSET_TYPES 1
+#define SPEND_LIST_SIZE 1
+#define MAX_LAYOUT_ITEMS 32
+#endif
 #define OFFSET_INS 1
 #define ASSET_ID_LEN 32
 #define ANCHOR_LEN 32
@@ -78,10 +88,15 @@ extern "C" {
 #define VIN_ADDR_OFFSET VIN_VALUE_OFFSET + 8
 
 typedef struct {
-    uint8_t address[ADDRESS_LEN_TESTNET];
+    uint8_t address[ADDRESS_LEN_BYTES];
     const char *symbol;
 } tokens_t;
 
+typedef struct {
+    const tokens_t *tokens;
+    uint16_t len;
+} token_registry_t;
+
 typedef struct {
     const char tag[40];
     const char *text;
@@ -193,6 +208,11 @@ typedef struct {
     uint64_t masptx_len;
 } masp_tx_section_t;
 
+#define INVALID_METADATA_INDEX 0xFF
+
+// The *_forward arrays map a builder description to its position in the MASP Tx bundle,
+// the *_inverse arrays map a bundle position back to the builder description.
+// Unused entries are set to INVALID_METADATA_INDEX.
 typedef struct {
     uint32_t n_spends_indices;
     uint32_t n_converts_indices;
@@ -200,6 +220,12 @@ typedef struct {
     bytes_t spends_indices;
     bytes_t converts_indices;
     bytes_t outputs_indices;
+    uint8_t spends_forward[SPEND_LIST_SIZE];
+    uint8_t spends_inverse[SPEND_LIST_SIZE];
+    uint8_t converts_forward[SPEND_LIST_SIZE];
+    uint8_t converts_inverse[SPEND_LIST_SIZE];
+    uint8_t outputs_forward[SPEND_LIST_SIZE];
+    uint8_t outputs_inverse[SPEND_LIST_SIZE];
 } masp_sapling_metadata_t;
 
 typedef struct{
@@ -225,8 +251,10 @@ typedef struct{
     bytes_t spends;
     bytes_t converts;
     bytes_t outputs;
-    uint32_t no_symbol_spends;
-    uint32_t no_symbol_outputs;
+    // Offset of each description relative to the start of its list
+    uint16_t spends_offsets[SPEND_LIST_SIZE];
+    uint16_t converts_offsets[SPEND_LIST_SIZE];
+    uint16_t outputs_offsets[SPEND_LIST_SIZE];
 }masp_sapling_builder_t;
 
 typedef struct {
@@ -236,10 +264,19 @@ typedef struct {
     masp_sapling_builder_t sapling_builder;
 } masp_builder_t;
 
+// Asset identifiers are derived once while parsing the builder section
+typedef struct {
+    uint8_t identifier[ASSET_ID_LEN];
+    uint16_t offset; // offset of the asset data inside asset_data
+    const char* symbol;
+} masp_asset_entry_t;
+
 typedef struct {
     bytes_t target_hash;
     uint32_t n_asset_type;
     bytes_t asset_data;
+    masp_asset_entry_t asset_table[MAX_ASSET_TYPES];
+    uint8_t asset_order[MAX_ASSET_TYPES]; // asset_table indices sorted by identifier
     masp_sapling_metadata_t metadata;
     masp_builder_t builder;
 } masp_builder_section_t;
@@ -252,6 +289,7 @@ typedef struct {
     uint8_t bytes_hash[HASH_LEN];
     bytes_t tag;
     uint8_t idx;
+    uint8_t section_hash[HASH_LEN]; // Digest of the whole section, computed once when the section is read
 } section_t;
 
 typedef struct {
@@ -289,6 +327,47 @@ typedef struct {
     bool isMasp;
 } transaction_t;
 
+typedef enum {
+    parse_stage_header = 0,
+    parse_stage_sections,
+    parse_stage_done,
+} parse_stage_e;
+
+// Lets the parser resume where it stopped when the buffer grows chunk by chunk
+typedef struct {
+    const uint8_t *buffer; // set only by parser_parse_chunk
+    uint16_t bufferLen;
+    uint16_t offset;
+    uint8_t stage;
+    uint32_t nextSection;
+    // Bytes [hashStart, hashEnd) of a pending section were already fed to the streamed SHA-256
+    uint16_t hashStart;
+    uint16_t hashEnd;
+    // The pending step is not retried before the buffer holds retryAt bytes
+    uint16_t retryAt;
+} parse_progress_t;
+
+typedef enum {
+    layout_source = 0,
+    layout_spend,
+    layout_target,
+    layout_output,
+} layout_item_kind_e;
+
+// Transfer entities are shown over a variable number of screens, so the screen of every
+// entity field is resolved once when parsing ends instead of rescanning on each getItem.
+// Screens past MAX_LAYOUT_ITEMS are resolved by walking the entities again.
+typedef struct {
+    uint8_t kind;
+    uint8_t field;
+    uint16_t entity; // offset inside sources/targets, index for spends/outputs
+} layout_item_t;
+
+typedef struct {
+    uint8_t numItems; // all entity screens, including those past the table
+    layout_item_t items[MAX_LAYOUT_ITEMS];
+} display_layout_t;
+
 
 typedef struct{
     transaction_type_e typeTx;
@@ -316,6 +395,8 @@ typedef struct{
     };
 
     transaction_t transaction;
+    display_layout_t layout;
+    parse_progress_t progress;
 
 } parser_tx_t;
 
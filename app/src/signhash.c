@@ -15,13 +15,11 @@
  ********************************************************************************/
 
 #include "signhash.h"
-#include "cx.h"
+#include "blake2b_template.h"
 #include <zxformat.h>
 #include <zxmacros.h>
 #include "tx_hash.h"
 
-const uint8_t CONSENSUS_BRANCH_ID[4] = {0xa6, 0x75, 0xff, 0xe9}; // value from masp
-
 // From https://github.com/anoma/masp/blob/main/masp_primitives/src/transaction/txid.rs#L297
 zxerr_t signature_hash(const parser_tx_t *txObj, uint8_t *output) {
   zemu_log_stack("signature_hash");
@@ -29,11 +27,9 @@ zxerr_t signature_hash(const parser_tx_t *txObj, uint8_t *output) {
     return zxerr_no_data;
   }
 
-  cx_blake2b_t ctx = {0};
-
-  uint8_t personalization[16] = "ZcashTxHash_";
-  MEMCPY(personalization + 12, CONSENSUS_BRANCH_ID, 4);
-  CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx, 256, NULL, 0, (uint8_t *)personalization, PERSONALIZATION_SIZE));
+  // Personalised with ZCASH_TX_PERSONALIZATION_PREFIX and the masp consensus branch id
+  blake2b_template_ctx_t ctx;
+  CHECK_ZXERR(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_TX_ID));
 
   uint8_t header_digest[32] = {0};
   uint8_t transparent_digest[32] = {0};
@@ -43,9 +39,10 @@ zxerr_t signature_hash(const parser_tx_t *txObj, uint8_t *output) {
   CHECK_ZXERR(tx_hash_transparent_data(txObj, transparent_digest));
   CHECK_ZXERR(tx_hash_sapling_data(txObj, sapling_digest));
 
-  CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, header_digest, HASH_SIZE, NULL, 0));
-  CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, transparent_digest, HASH_SIZE, NULL, 0));
-  CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, sapling_digest, HASH_SIZE, output, HASH_SIZE));
+  CHECK_ZXERR(blake2b_template_update(&ctx, header_digest, HASH_SIZE));
+  CHECK_ZXERR(blake2b_template_update(&ctx, transparent_digest, HASH_SIZE));
+  CHECK_ZXERR(blake2b_template_update(&ctx, sapling_digest, HASH_SIZE));
+  CHECK_ZXERR(blake2b_template_final(&ctx, output));
 
   return zxerr_ok;
 }
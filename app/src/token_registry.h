@@ -0,0 +1,26 @@
+// Generated by app/scripts/gen_token_registry.py from app/scripts/tokens.json, do not edit.
+// Entries are sorted by their raw address bytes.
+#pragma once
+
+#include "parser_txdef.h"
+
+static const tokens_t tokens_mainnet[] = {
+    // tnam1q9gr66cvu4hrzm0sd5kmlnjje82gs3xlfg3v6nu7
+    {{0x01, 0x50, 0x3d, 0x6b, 0x0c, 0xe5, 0x6e, 0x31, 0x6d, 0xf0, 0x6d, 0x2d, 0xbf, 0xce, 0x52, 0xc9, 0xd4, 0x88, 0x44, 0xdf, 0x4a}, "NAM "},
+    // tnam1p5z8ruwyu7ha8urhq2l0dhpk2f5dv3ts7uyf2n75
+    {{0x0d, 0x04, 0x71, 0xf1, 0xc4, 0xe7, 0xaf, 0xd3, 0xf0, 0x77, 0x02, 0xbe, 0xf6, 0xdc, 0x36, 0x52, 0x68, 0xd6, 0x45, 0x70, 0xf7}, "uOSMO "},
+    // tnam1p5z5538v3kdk3wdx7r2hpqm4uq9926dz3ughcp7n
+    {{0x0d, 0x05, 0x4a, 0x44, 0xec, 0x8d, 0x9b, 0x68, 0xb9, 0xa6, 0xf0, 0xd5, 0x70, 0x83, 0x75, 0xe0, 0x0a, 0x55, 0x69, 0xa2, 0x8f}, "ustATOM "},
+    // tnam1p4px8sw3am4qvetj7eu77gftm4fz4hcw2ulpldc7
+    {{0x0d, 0x42, 0x63, 0xc1, 0xd1, 0xee, 0xea, 0x06, 0x65, 0x72, 0xf6, 0x79, 0xef, 0x21, 0x2b, 0xdd, 0x52, 0x2a, 0xdf, 0x0e, 0x57}, "ustOSMO "},
+    // tnam1pkg30gnt4q0zn7j00r6hms4ajrxn6f5ysyyl7w9m
+    {{0x0d, 0x91, 0x17, 0xa2, 0x6b, 0xa8, 0x1e, 0x29, 0xfa, 0x4f, 0x78, 0xf5, 0x7d, 0xc2, 0xbd, 0x90, 0xcd, 0x3d, 0x26, 0x84, 0x81}, "uATOM "},
+    // tnam1pklj3kwp0cpsdvv56584rsajty974527qsp8n0nm
+    {{0x0d, 0xbf, 0x28, 0xd9, 0xc1, 0x7e, 0x03, 0x06, 0xb1, 0x94, 0xd5, 0x0f, 0x51, 0xc3, 0xb2, 0x59, 0x0b, 0xea, 0xd1, 0x5e, 0x04}, "uTIA "},
+    // tnam1ph6xhf0defk65hm7l5ursscwqdj8ehrcdv300u4g
+    {{0x0d, 0xf4, 0x6b, 0xa5, 0xed, 0xca, 0x6d, 0xaa, 0x5f, 0x7e, 0xfd, 0x38, 0x38, 0x43, 0x0e, 0x03, 0x64, 0x7c, 0xdc, 0x78, 0x6b}, "ustTIA "},
+};
+
+static const token_registry_t token_registry_mainnet = {tokens_mainnet, 7};
+
+static const token_registry_t token_registry_testnet = {NULL, 0};
@@ -14,8 +14,7 @@
  *  limitations under the License.
  ********************************************************************************/
 #include "tx_hash.h"
-#include "cx.h"
-#include "cx.h"
+#include "blake2b_template.h"
 #include <zxformat.h>
 #include <zxmacros.h>
 #include "parser_txdef.h"
@@ -27,15 +26,16 @@ zxerr_t tx_hash_header_data(const parser_tx_t *txObj, uint8_t *output) {
         return zxerr_no_data;
     }
 
-    cx_blake2b_t ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx, 256, NULL, 0, (uint8_t*)ZCASH_HEADERS_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    blake2b_template_ctx_t ctx;
+    CHECK_ZXERR(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_HEADERS));
 
     masp_tx_data_t *maspTx = (masp_tx_data_t *)&txObj->transaction.sections.maspTx.data;
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, (const uint8_t *)&maspTx->tx_version, 4, NULL, 0));
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, (const uint8_t *)&maspTx->version_group_id, 4, NULL, 0));
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, (const uint8_t *)&maspTx->consensus_branch_id, 4, NULL, 0));
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, (const uint8_t *)&maspTx->lock_time, 4, NULL, 0));
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, (const uint8_t *)&maspTx->expiry_height, 4, output, HASH_SIZE));
+    CHECK_ZXERR(blake2b_template_update(&ctx, (const uint8_t *)&maspTx->tx_version, 4));
+    CHECK_ZXERR(blake2b_template_update(&ctx, (const uint8_t *)&maspTx->version_group_id, 4));
+    CHECK_ZXERR(blake2b_template_update(&ctx, (const uint8_t *)&maspTx->consensus_branch_id, 4));
+    CHECK_ZXERR(blake2b_template_update(&ctx, (const uint8_t *)&maspTx->lock_time, 4));
+    CHECK_ZXERR(blake2b_template_update(&ctx, (const uint8_t *)&maspTx->expiry_height, 4));
+    CHECK_ZXERR(blake2b_template_final(&ctx, output));
 
     return zxerr_ok;
 }
@@ -49,22 +49,22 @@ zxerr_t tx_hash_transparent_inputs(const parser_tx_t *txObj, uint8_t *output) {
         return zxerr_no_data;
     }
 
-    cx_blake2b_t ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx, 256, NULL, 0, (uint8_t*)ZCASH_INPUTS_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    blake2b_template_ctx_t ctx;
+    CHECK_ZXERR(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_INPUTS));
 
     if(txObj->transaction.sections.maspTx.data.transparent_bundle.n_vin == 0){
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, 0, 0, output, HASH_SIZE));
+        CHECK_ZXERR(blake2b_template_final(&ctx, output));
         return zxerr_ok;
     }
 
     const uint8_t *vin = txObj->transaction.sections.maspTx.data.transparent_bundle.vin.ptr;
 
     for(uint64_t i = 0; i < txObj->transaction.sections.maspTx.data.transparent_bundle.n_vin; i++, vin += VIN_LEN){
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, vin, ASSET_ID_LEN, NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, vin + VIN_VALUE_OFFSET, sizeof(uint64_t), NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, vin + VIN_ADDR_OFFSET, IMPLICIT_ADDR_LEN, NULL, 0));
+        CHECK_ZXERR(blake2b_template_update(&ctx, vin, ASSET_ID_LEN));
+        CHECK_ZXERR(blake2b_template_update(&ctx, vin + VIN_VALUE_OFFSET, sizeof(uint64_t)));
+        CHECK_ZXERR(blake2b_template_update(&ctx, vin + VIN_ADDR_OFFSET, IMPLICIT_ADDR_LEN));
     }
-    CHECK_CX_OK(cx_hash_final(&ctx.header, output));
+    CHECK_ZXERR(blake2b_template_final(&ctx, output));
 
     return zxerr_ok;
 
@@ -79,21 +79,21 @@ zxerr_t tx_hash_transparent_outputs(const parser_tx_t *txObj, uint8_t *output) {
         return zxerr_no_data;
     }
 
-    cx_blake2b_t ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx, 256, NULL, 0, (uint8_t*)ZCASH_OUTPUTS_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    blake2b_template_ctx_t ctx;
+    CHECK_ZXERR(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_OUTPUTS));
 
     if(txObj->transaction.sections.maspTx.data.transparent_bundle.n_vout == 0){
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, 0, 0, output, HASH_SIZE));
+        CHECK_ZXERR(blake2b_template_final(&ctx, output));
         return zxerr_ok;
     }
 
     const uint8_t *vout = txObj->transaction.sections.maspTx.data.transparent_bundle.vout.ptr;
 
     for(uint64_t i = 0; i < txObj->transaction.sections.maspTx.data.transparent_bundle.n_vout; i++, vout += VOUT_LEN){
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, vout, VOUT_LEN, NULL, 0));
+        CHECK_ZXERR(blake2b_template_update(&ctx, vout, VOUT_LEN));
     }
 
-    CHECK_CX_OK(cx_hash_final(&ctx.header, output));
+    CHECK_ZXERR(blake2b_template_final(&ctx, output));
 
     return zxerr_ok;
 
@@ -109,19 +109,19 @@ zxerr_t tx_hash_sapling_spends(const parser_tx_t *txObj, uint8_t *output) {
         return zxerr_no_data;
     }
 
-    cx_blake2b_t ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx, 256, NULL, 0, (uint8_t*)ZCASH_SAPLING_SPENDS_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    blake2b_template_ctx_t ctx;
+    CHECK_ZXERR(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_SAPLING_SPENDS));
 
     if(txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_spends == 0){
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, 0, 0, output, HASH_SIZE));
+        CHECK_ZXERR(blake2b_template_final(&ctx, output));
         return zxerr_ok;
     }
 
-    cx_blake2b_t nullifier_ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&nullifier_ctx, 256, NULL, 0, (uint8_t*)ZCASH_SAPLING_SPENDS_COMPACT_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
-
-    cx_blake2b_t nc_ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&nc_ctx, 256, NULL, 0, (uint8_t*)ZCASH_SAPLING_SPENDS_NONCOMPACT_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    // Lanes: nullifiers, then (cv, anchor, rk)
+    static const blake2b_template_e spend_lanes[] = {BLAKE2B_TEMPLATE_SAPLING_SPENDS_COMPACT,
+                                                     BLAKE2B_TEMPLATE_SAPLING_SPENDS_NONCOMPACT};
+    blake2b_multi_t lanes;
+    CHECK_ZXERR(blake2b_multi_init(&lanes, spend_lanes, sizeof(spend_lanes) / sizeof(spend_lanes[0])));
 
     const uint8_t *spend = txObj->transaction.sections.maspTx.data.sapling_bundle.shielded_spends.ptr;
     const uint64_t n_shielded_spends = txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_spends;
@@ -130,21 +130,19 @@ zxerr_t tx_hash_sapling_spends(const parser_tx_t *txObj, uint8_t *output) {
     for (uint64_t i = 0; i < n_shielded_spends; i++, spend += SHIELDED_SPENDS_LEN) {
         shielded_spends_t *shielded_spends = (shielded_spends_t *)spend;
 
-        CHECK_CX_OK(cx_hash_no_throw(&nullifier_ctx.header, 0, shielded_spends->nullifier, NULLIFIER_LEN, NULL, 0));
-
-        CHECK_CX_OK(cx_hash_no_throw(&nc_ctx.header, 0, shielded_spends->cv, CV_LEN, NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&nc_ctx.header, 0, spend_anchor_ptr, ANCHOR_LEN, NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&nc_ctx.header, 0, shielded_spends->rk, RK_LEN, NULL, 0));
+        const bytes_t first_step[] = {{shielded_spends->nullifier, NULLIFIER_LEN}, {shielded_spends->cv, CV_LEN}};
+        const bytes_t anchor_step[] = {{NULL, 0}, {spend_anchor_ptr, ANCHOR_LEN}};
+        const bytes_t rk_step[] = {{NULL, 0}, {shielded_spends->rk, RK_LEN}};
+        CHECK_ZXERR(blake2b_multi_update(&lanes, first_step));
+        CHECK_ZXERR(blake2b_multi_update(&lanes, anchor_step));
+        CHECK_ZXERR(blake2b_multi_update(&lanes, rk_step));
     }
 
-    uint8_t nullifier_hash[HASH_SIZE] = {0};
-    uint8_t nc_hash[HASH_SIZE] = {0};
-
-    CHECK_CX_OK(cx_hash_final(&nullifier_ctx.header, nullifier_hash));
-    CHECK_CX_OK(cx_hash_final(&nc_ctx.header, nc_hash));
+    uint8_t lane_hashes[2 * HASH_SIZE] = {0};
+    CHECK_ZXERR(blake2b_multi_final(&lanes, lane_hashes));
 
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, nullifier_hash, HASH_SIZE, NULL, 0));
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, nc_hash, HASH_SIZE, output, HASH_SIZE));
+    CHECK_ZXERR(blake2b_template_update(&ctx, lane_hashes, sizeof(lane_hashes)));
+    CHECK_ZXERR(blake2b_template_final(&ctx, output));
 
     return zxerr_ok;
 }
@@ -157,22 +155,22 @@ zxerr_t tx_hash_sapling_converts(const parser_tx_t *txObj, uint8_t *output) {
         return zxerr_no_data;
     }
 
-    cx_blake2b_t ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx, 256, NULL, 0, (uint8_t*)ZCASH_SAPLING_CONVERTS_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    blake2b_template_ctx_t ctx;
+    CHECK_ZXERR(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_SAPLING_CONVERTS));
 
     if(txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_converts == 0){
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, 0, 0, output, HASH_SIZE));
+        CHECK_ZXERR(blake2b_template_final(&ctx, output));
         return zxerr_ok;
     }
 
     const uint8_t *spend = txObj->transaction.sections.maspTx.data.sapling_bundle.shielded_converts.ptr;
 
     for(uint64_t i = 0; i < txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_converts; i++, spend += SHIELDED_CONVERTS_LEN){
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, spend, CV_LEN, NULL,0));
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, txObj->transaction.sections.maspTx.data.sapling_bundle.anchor_shielded_converts.ptr, ANCHOR_LEN, NULL, 0));
+        CHECK_ZXERR(blake2b_template_update(&ctx, spend, CV_LEN));
+        CHECK_ZXERR(blake2b_template_update(&ctx, txObj->transaction.sections.maspTx.data.sapling_bundle.anchor_shielded_converts.ptr, ANCHOR_LEN));
     }
 
-    CHECK_CX_OK(cx_hash_final(&ctx.header, output));
+    CHECK_ZXERR(blake2b_template_final(&ctx, output));
 
     return zxerr_ok;
 }
@@ -188,22 +186,20 @@ zxerr_t tx_hash_sapling_outputs(const parser_tx_t *txObj, uint8_t *output) {
         return zxerr_no_data;
     }
 
-    cx_blake2b_t ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx, 256, NULL, 0, (uint8_t*)ZCASH_SAPLING_OUTPUTS_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    blake2b_template_ctx_t ctx;
+    CHECK_ZXERR(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_SAPLING_OUTPUTS));
 
     if(txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_outputs == 0){
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, 0, 0, output, HASH_SIZE));
+        CHECK_ZXERR(blake2b_template_final(&ctx, output));
         return zxerr_ok;
     }
 
-    cx_blake2b_t compact_ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&compact_ctx, 256, NULL, 0, (uint8_t*)ZCASH_SAPLING_OUTPUTS_COMPACT_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
-
-    cx_blake2b_t memo_ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&memo_ctx, 256, NULL, 0, (uint8_t*)ZCASH_SAPLING_OUTPUTS_MEMOS_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
-
-    cx_blake2b_t non_compact_ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&non_compact_ctx, 256, NULL, 0, (uint8_t*)ZCASH_SAPLING_OUTPUTS_NONCOMPACT_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    // Lanes: compact, memos, then non-compact
+    static const blake2b_template_e output_lanes[] = {BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_COMPACT,
+                                                      BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_MEMOS,
+                                                      BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_NONCOMPACT};
+    blake2b_multi_t lanes;
+    CHECK_ZXERR(blake2b_multi_init(&lanes, output_lanes, sizeof(output_lanes) / sizeof(output_lanes[0])));
 
     const uint8_t *shielded_outputs_ptr = txObj->transaction.sections.maspTx.data.sapling_bundle.shielded_outputs.ptr;
     const uint64_t n_shielded_outputs = txObj->transaction.sections.maspTx.data.sapling_bundle.n_shielded_outputs;
@@ -211,28 +207,27 @@ zxerr_t tx_hash_sapling_outputs(const parser_tx_t *txObj, uint8_t *output) {
     for (uint64_t i = 0; i < n_shielded_outputs; i++, shielded_outputs_ptr += SHIELDED_OUTPUTS_LEN) {
         const shielded_outputs_t *shielded_output = (const shielded_outputs_t *)shielded_outputs_ptr;
 
-        CHECK_CX_OK(cx_hash_no_throw(&compact_ctx.header, 0, shielded_output->cmu, CMU_LEN, NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&compact_ctx.header, 0, shielded_output->ephemeral_key, EPK_LEN, NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&compact_ctx.header, 0, shielded_output->enc_ciphertext, COMPACT_NOTE_SIZE, NULL, 0));
-
-        CHECK_CX_OK(cx_hash_no_throw(&memo_ctx.header, 0, shielded_output->enc_ciphertext + COMPACT_NOTE_SIZE, NOTE_PLAINTEXT_SIZE, NULL, 0));
-
-        CHECK_CX_OK(cx_hash_no_throw(&non_compact_ctx.header, 0, shielded_output->cv, CV_LEN, NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&non_compact_ctx.header, 0, shielded_output->enc_ciphertext + COMPACT_NOTE_SIZE + NOTE_PLAINTEXT_SIZE, ENC_CIPHER_LEN - COMPACT_NOTE_SIZE - NOTE_PLAINTEXT_SIZE, NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&non_compact_ctx.header, 0, shielded_output->out_ciphertext, OUT_CIPHER_LEN, NULL, 0));
+        // cmu, epk and the compact part of the ciphertext are contiguous, as are the ciphertext tail and out_ciphertext
+        const bytes_t first_step[] = {
+            {shielded_output->cmu, CMU_LEN + EPK_LEN + COMPACT_NOTE_SIZE},
+            {shielded_output->enc_ciphertext + COMPACT_NOTE_SIZE, NOTE_PLAINTEXT_SIZE},
+            {shielded_output->cv, CV_LEN},
+        };
+        const bytes_t second_step[] = {
+            {NULL, 0},
+            {NULL, 0},
+            {shielded_output->enc_ciphertext + COMPACT_NOTE_SIZE + NOTE_PLAINTEXT_SIZE,
+             ENC_CIPHER_LEN - COMPACT_NOTE_SIZE - NOTE_PLAINTEXT_SIZE + OUT_CIPHER_LEN},
+        };
+        CHECK_ZXERR(blake2b_multi_update(&lanes, first_step));
+        CHECK_ZXERR(blake2b_multi_update(&lanes, second_step));
     }
 
-    uint8_t compact_hash[HASH_SIZE] = {0};
-    uint8_t memo_hash[HASH_SIZE] = {0};
-    uint8_t non_compact_hash[HASH_SIZE] = {0};
+    uint8_t lane_hashes[3 * HASH_SIZE] = {0};
+    CHECK_ZXERR(blake2b_multi_final(&lanes, lane_hashes));
 
-    CHECK_CX_OK(cx_hash_final(&compact_ctx.header, compact_hash));
-    CHECK_CX_OK(cx_hash_final(&memo_ctx.header, memo_hash));
-    CHECK_CX_OK(cx_hash_final(&non_compact_ctx.header, non_compact_hash));
-
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, compact_hash, HASH_SIZE, NULL, 0));
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, memo_hash, HASH_SIZE, NULL, 0));
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, non_compact_hash, HASH_SIZE, output, HASH_SIZE));
+    CHECK_ZXERR(blake2b_template_update(&ctx, lane_hashes, sizeof(lane_hashes)));
+    CHECK_ZXERR(blake2b_template_final(&ctx, output));
 
     return zxerr_ok;
 }
@@ -242,8 +237,8 @@ zxerr_t tx_hash_sapling_data(const parser_tx_t *txObj, uint8_t *output) {
         return zxerr_no_data;
     }
 
-    cx_blake2b_t ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx, 256, NULL, 0, (uint8_t *)ZCASH_SAPLING_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    blake2b_template_ctx_t ctx;
+    CHECK_ZXERR(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_SAPLING));
 
     uint8_t spends_hash[32] = {0};
     uint8_t converts_hash[32] = {0};
@@ -259,28 +254,26 @@ zxerr_t tx_hash_sapling_data(const parser_tx_t *txObj, uint8_t *output) {
 
         CHECK_ZXERR(tx_hash_sapling_outputs(txObj, outputs_hash));
 
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, spends_hash, HASH_SIZE, NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, converts_hash, HASH_SIZE, NULL, 0));
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, outputs_hash, HASH_SIZE, NULL, 0));
+        CHECK_ZXERR(blake2b_template_update(&ctx, spends_hash, HASH_SIZE));
+        CHECK_ZXERR(blake2b_template_update(&ctx, converts_hash, HASH_SIZE));
+        CHECK_ZXERR(blake2b_template_update(&ctx, outputs_hash, HASH_SIZE));
 
         if (txObj->transaction.sections.maspTx.data.sapling_bundle.n_value_sum_asset_type == 0) {
             uint8_t zero_byte = 0;
-            CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, &zero_byte, 1, NULL, 0));
+            CHECK_ZXERR(blake2b_template_update(&ctx, &zero_byte, 1));
         } else {
             // TODO: while debugging
             // https://github.com/anoma/masp/blob/8d83b172698098fba393006016072bc201ed9ab7/masp_primitives/src/transaction/txid.rs#L234,
             // there is a 0x01 byte at the beginning. Is this byte representing the n_value_sum_asset_type?
             uint8_t asset_type = (uint8_t)txObj->transaction.sections.maspTx.data.sapling_bundle.n_value_sum_asset_type;
-            CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, &asset_type, 1, NULL, 0));
+            CHECK_ZXERR(blake2b_template_update(&ctx, &asset_type, 1));
 
-            CHECK_CX_OK(cx_hash_no_throw(
-                &ctx.header, 0, txObj->transaction.sections.maspTx.data.sapling_bundle.value_sum_asset_type.ptr,
-                (ASSET_ID_LEN + INT_128_LEN) * txObj->transaction.sections.maspTx.data.sapling_bundle.n_value_sum_asset_type,
-                NULL, 0));
+            CHECK_ZXERR(blake2b_template_update(&ctx, txObj->transaction.sections.maspTx.data.sapling_bundle.value_sum_asset_type.ptr,
+                (ASSET_ID_LEN + INT_128_LEN) * txObj->transaction.sections.maspTx.data.sapling_bundle.n_value_sum_asset_type));
         }
     }
 
-    CHECK_CX_OK(cx_hash_final(&ctx.header, output));
+    CHECK_ZXERR(blake2b_template_final(&ctx, output));
 
     return zxerr_ok;
 }
@@ -290,8 +283,8 @@ zxerr_t tx_hash_transparent_data(const parser_tx_t *txObj, uint8_t *output) {
         return zxerr_no_data;
     }
 
-    cx_blake2b_t ctx = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx, 256, NULL, 0, (uint8_t *)ZCASH_TRANSPARENT_HASH_PERSONALIZATION, PERSONALIZATION_SIZE));
+    blake2b_template_ctx_t ctx;
+    CHECK_ZXERR(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_TRANSPARENT));
 
     uint8_t outputs_hash[32] = {0};
     uint8_t inputs_hash[32] = {0};
@@ -299,13 +292,13 @@ zxerr_t tx_hash_transparent_data(const parser_tx_t *txObj, uint8_t *output) {
     if (txObj->transaction.sections.maspTx.data.transparent_bundle.n_vin > 0 ||
         txObj->transaction.sections.maspTx.data.transparent_bundle.n_vout > 0) {
         CHECK_ZXERR(tx_hash_transparent_inputs(txObj, inputs_hash));
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, inputs_hash, HASH_SIZE, NULL, 0));
+        CHECK_ZXERR(blake2b_template_update(&ctx, inputs_hash, HASH_SIZE));
 
         CHECK_ZXERR(tx_hash_transparent_outputs(txObj, outputs_hash));
-        CHECK_CX_OK(cx_hash_no_throw(&ctx.header, 0, outputs_hash, HASH_SIZE, NULL, 0));
+        CHECK_ZXERR(blake2b_template_update(&ctx, outputs_hash, HASH_SIZE));
     }
 
-    CHECK_CX_OK(cx_hash_no_throw(&ctx.header, CX_LAST, NULL, 0, output, HASH_SIZE));
+    CHECK_ZXERR(blake2b_template_final(&ctx, output));
     return zxerr_ok;
 }
 
@@ -314,15 +307,8 @@ zxerr_t tx_hash_txId(const parser_tx_t *txObj, uint8_t *output) {
         return zxerr_no_data;
     }
 
-    uint8_t personal[16] = {0};
-    MEMCPY(personal, ZCASH_TX_PERSONALIZATION_PREFIX, 12);
-    
-    // Use BRANCH_ID_IDENTIFIER to set the last 4 bytes
-    uint32_t branch_id = BRANCH_ID_IDENTIFIER;
-    memcpy(&personal[12], &branch_id, sizeof(branch_id));
-
-    cx_blake2b_t ctx_hash = {0};
-    CHECK_CX_OK(cx_blake2b_init2_no_throw(&ctx_hash, 256, NULL, 0, personal, PERSONALIZATION_SIZE));
+    blake2b_template_ctx_t ctx_hash;
+    CHECK_ZXERR(blake2b_template_load(&ctx_hash, BLAKE2B_TEMPLATE_TX_ID));
 
     uint8_t header[32] = {0};
     uint8_t transparent[32] = {0};
@@ -332,9 +318,10 @@ zxerr_t tx_hash_txId(const parser_tx_t *txObj, uint8_t *output) {
     CHECK_ZXERR(tx_hash_transparent_data(txObj, transparent));
     CHECK_ZXERR(tx_hash_sapling_data(txObj, sapling));
 
-    CHECK_CX_OK(cx_hash_no_throw(&ctx_hash.header, 0, header, HASH_SIZE, NULL, 0));
-    CHECK_CX_OK(cx_hash_no_throw(&ctx_hash.header, 0, transparent, HASH_SIZE, NULL, 0));
-    CHECK_CX_OK(cx_hash_no_throw(&ctx_hash.header, CX_LAST, sapling, HASH_SIZE, output, HASH_SIZE));
+    CHECK_ZXERR(blake2b_template_update(&ctx_hash, header, HASH_SIZE));
+    CHECK_ZXERR(blake2b_template_update(&ctx_hash, transparent, HASH_SIZE));
+    CHECK_ZXERR(blake2b_template_update(&ctx_hash, sapling, HASH_SIZE));
+    CHECK_ZXERR(blake2b_template_final(&ctx_hash, output));
 
     return zxerr_ok;
 }
@@ -15,6 +15,10 @@
  ********************************************************************************/
 #pragma once
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #include <stdint.h>
 #include "zxerror.h"
 #include "parser_txdef.h"
@@ -46,3 +50,7 @@ zxerr_t tx_hash_sapling_outputs(const parser_tx_t *txObj, uint8_t *output);
 zxerr_t tx_hash_sapling_data(const parser_tx_t *txObj, uint8_t *output);
 zxerr_t tx_hash_transparent_data(const parser_tx_t *txObj, uint8_t *output);
 zxerr_t tx_hash_txId(const parser_tx_t *txObj, uint8_t *output);
+
+#ifdef __cplusplus
+}
+#endif
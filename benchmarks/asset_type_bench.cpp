@@ -0,0 +1,65 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+// Asset type derivation, with the memo cleared (nonce search) and with a memo hit
+
+#include <benchmark/benchmark.h>
+
+#include "crypto_helper.h"
+#include "parser_txdef.h"
+
+namespace {
+
+// Address tag + 20 byte hash, denom, position and no epoch
+const uint8_t ASSET_BYTES[] = {
+    0x01, 0x8e, 0x0d, 0xa5, 0x13, 0x2b, 0x45, 0xef, 0x1a, 0x22, 0x4f,
+    0x6c, 0x38, 0x9a, 0x03, 0x71, 0xb4, 0x2e, 0x19, 0xd0, 0x5c, 0x06,
+    0x00, 0x00,
+};
+
+masp_asset_data_t benchAsset() {
+    masp_asset_data_t asset = {};
+    asset.bytes.ptr = ASSET_BYTES;
+    asset.bytes.len = sizeof(ASSET_BYTES);
+    return asset;
+}
+
+void BM_DeriveAssetTypeSearch(benchmark::State &state) {
+    const masp_asset_data_t asset = benchAsset();
+    uint8_t identifier[ASSET_IDENTIFIER_LENGTH] = {0};
+    uint8_t nonce = 0;
+    for (auto _ : state) {
+        crypto_clearAssetTypeMemo();
+        benchmark::DoNotOptimize(derive_asset_type(&asset, identifier, &nonce));
+    }
+    state.counters["nonce"] = nonce;
+}
+
+void BM_DeriveAssetTypeMemo(benchmark::State &state) {
+    const masp_asset_data_t asset = benchAsset();
+    uint8_t identifier[ASSET_IDENTIFIER_LENGTH] = {0};
+    uint8_t nonce = 0;
+    crypto_clearAssetTypeMemo();
+    derive_asset_type(&asset, identifier, &nonce);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(derive_asset_type(&asset, identifier, &nonce));
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_DeriveAssetTypeSearch)->Name("asset_type/derive_search");
+BENCHMARK(BM_DeriveAssetTypeMemo)->Name("asset_type/derive_memo");
@@ -0,0 +1,81 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+// BLAKE2b and BLAKE2s throughput for every backend the CPU supports, over message sizes typical of
+// section hashing (32 bytes) up to large code and data sections
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "blake2.h"
+#include "blake2_simd/blake2_simd.h"
+
+namespace {
+
+template<typename Hash>
+void runBackend(benchmark::State &state, Hash &&hash) {
+    const auto backend = static_cast<blake2_backend_e>(state.range(0));
+    const blake2_backend_e previous = blake2_backend_get();
+    if (!blake2_backend_set(backend)) {
+        state.SkipWithError("backend not supported by this CPU");
+        return;
+    }
+    state.SetLabel(blake2_backend_name(backend));
+
+    const std::vector<uint8_t> data(static_cast<size_t>(state.range(1)), 0x5A);
+    for (auto _ : state) {
+        hash(data);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * data.size()));
+    blake2_backend_set(previous);
+}
+
+void BM_Blake2b(benchmark::State &state) {
+    runBackend(state, [](const std::vector<uint8_t> &data) {
+        uint8_t out[BLAKE2B_OUTBYTES];
+        blake2b_state ctx;
+        blake2b_init(&ctx, sizeof(out));
+        blake2b_update(&ctx, data.data(), data.size());
+        blake2b_final(&ctx, out, sizeof(out));
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+void BM_Blake2s(benchmark::State &state) {
+    runBackend(state, [](const std::vector<uint8_t> &data) {
+        uint8_t out[BLAKE2S_OUTBYTES];
+        blake2s_state ctx;
+        blake2s_init(&ctx, sizeof(out));
+        blake2s_update(&ctx, data.data(), data.size());
+        blake2s_final(&ctx, out, sizeof(out));
+        benchmark::DoNotOptimize(out);
+    });
+}
+
+void backendArgs(benchmark::internal::Benchmark *bench) {
+    bench->ArgNames({"backend", "bytes"});
+    for (const int backend : {BLAKE2_BACKEND_REF, BLAKE2_BACKEND_SSE41, BLAKE2_BACKEND_AVX2}) {
+        for (const int bytes : {32, 1024, 64 * 1024}) {
+            bench->Args({backend, bytes});
+        }
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_Blake2b)->Name("blake2/blake2b")->Apply(backendArgs);
+BENCHMARK(BM_Blake2s)->Name("blake2/blake2s")->Apply(backendArgs);
@@ -0,0 +1,109 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+// Jubjub generator multiplications through rslib. The spend authorization and value commitment
+// generators use the fixed-base tables, the proof generation key generator keeps the bit by bit
+// multiplication and serves as the baseline.
+// Value commitment checks, one by one as crypto_check_masp used to do versus batched.
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "crypto_helper.h"
+#include "keys_def.h"
+#include "zxmacros.h"
+
+extern "C" {
+#include "rslib.h"
+}
+
+namespace {
+
+// rsk from the keps test vectors
+const uint8_t BENCH_SCALAR[32] = {0x74, 0x0d, 0xf0, 0x6d, 0x1f, 0x77, 0x51, 0x71,
+                                  0xde, 0x02, 0xf5, 0x81, 0xae, 0xe3, 0x0f, 0xce,
+                                  0x6c, 0x05, 0x5e, 0x54, 0xa1, 0xc4, 0x53, 0xe6,
+                                  0xf0, 0xf3, 0x88, 0x47, 0x10, 0x26, 0xff, 0x05};
+
+void BM_ScalarMultiplication(benchmark::State &state, constant_key_t key) {
+    uint8_t output[32] = {0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(scalar_multiplication(BENCH_SCALAR, key, output));
+        benchmark::ClobberMemory();
+    }
+}
+
+// Dummy note identifier
+uint8_t BENCH_IDENTIFIER[ASSET_IDENTIFIER_LENGTH] = {
+    156, 229, 191, 54, 209, 138, 169, 235, 234, 174, 120, 186, 142, 34, 183, 118,
+    64, 243, 100, 134, 234, 27, 248, 27, 36, 245, 9, 146, 30, 110, 203, 169};
+
+struct bench_commitment_t {
+    uint64_t value;
+    uint8_t rcv[KEY_LENGTH];
+    uint8_t cv[KEY_LENGTH];
+};
+
+std::vector<bench_commitment_t> benchCommitments(size_t count) {
+    std::vector<bench_commitment_t> commitments(count);
+    for (size_t i = 0; i < count; i++) {
+        uint8_t wide[64] = {0};
+        wide[0] = static_cast<uint8_t>(i + 1);
+        wide[33] = static_cast<uint8_t>(0xa5 ^ i);
+        from_bytes_wide(wide, commitments[i].rcv);
+        commitments[i].value = 1000 * i + 1;
+        computeValueCommitment(commitments[i].value, commitments[i].rcv, BENCH_IDENTIFIER, commitments[i].cv);
+    }
+    return commitments;
+}
+
+void BM_ValueCommitmentsSingle(benchmark::State &state) {
+    auto commitments = benchCommitments(static_cast<size_t>(state.range(0)));
+    uint8_t cv[KEY_LENGTH] = {0};
+    for (auto _ : state) {
+        for (auto &commitment : commitments) {
+            computeValueCommitment(commitment.value, commitment.rcv, BENCH_IDENTIFIER, cv);
+            benchmark::DoNotOptimize(MEMCMP(cv, commitment.cv, KEY_LENGTH));
+        }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * commitments.size()));
+}
+
+void BM_ValueCommitmentsBatch(benchmark::State &state) {
+    const auto commitments = benchCommitments(static_cast<size_t>(state.range(0)));
+    uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+    for (auto _ : state) {
+        value_commitment_batch_t batch = {};
+        for (const auto &commitment : commitments) {
+            computeValueCommitmentGenerator(BENCH_IDENTIFIER, generator);
+            valueCommitmentBatchAdd(&batch, commitment.value, commitment.rcv, generator, commitment.cv);
+        }
+        benchmark::DoNotOptimize(valueCommitmentBatchFlush(&batch));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * commitments.size()));
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_ScalarMultiplication, spend_auth, SpendingKeyGenerator)
+    ->Name("jubjub/scalar_mult/spend_auth_fixed_base");
+BENCHMARK_CAPTURE(BM_ScalarMultiplication, value_commitment, ValueCommitmentRandomnessGenerator)
+    ->Name("jubjub/scalar_mult/value_commitment_fixed_base");
+BENCHMARK_CAPTURE(BM_ScalarMultiplication, proof_generation, ProofGenerationKeyGenerator)
+    ->Name("jubjub/scalar_mult/proof_generation_bits");
+BENCHMARK(BM_ValueCommitmentsSingle)->Name("jubjub/value_commitments_single")->Arg(1)->Arg(4)->Arg(15);
+BENCHMARK(BM_ValueCommitmentsBatch)->Name("jubjub/value_commitments_batch")->Arg(1)->Arg(4)->Arg(15);
@@ -0,0 +1,297 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+// Replays every blob of tests/testvectors.json through the parse -> review -> hash pipeline.
+// Benchmarks declared with BENCHMARK() in the other files of this directory run alongside.
+// Results can be written for CI with --benchmark_out=<file> --benchmark_out_format=json|csv
+
+#include <benchmark/benchmark.h>
+#include <fmt/core.h>
+#include <json/json.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <pthread.h>
+#include <string>
+#include <vector>
+
+#include "common/parser.h"
+#include "crypto_helper.h"
+#include "parser_impl.h"
+#include "zxformat.h"
+#include <app_mode.h>
+#include <hexutils.h>
+
+namespace {
+
+// Heap allocations done while a benchmark runs, the parser itself is expected to keep this at zero
+std::atomic<uint64_t> g_allocations{0};
+
+// Stack high-water mark is measured by running the step on a thread whose stack is a painted
+// buffer owned here, and counting how much of the buffer was overwritten once the thread joined
+constexpr size_t STACK_PROBE_SIZE = 256 * 1024;
+constexpr size_t STACK_PROBE_ALIGN = 4096;
+constexpr uint8_t STACK_PATTERN = 0xA5;
+
+struct bench_vector_t {
+    uint64_t index;
+    std::string name;
+    std::vector<uint8_t> blob;
+};
+
+char keyBuffer[1000];
+char valueBuffer[1000];
+
+template<typename F>
+void *runOnProbeStack(void *fn) {
+    (*static_cast<F *>(fn))();
+    return nullptr;
+}
+
+template<typename F>
+size_t probeStack(F &fn) {
+    auto *stack = static_cast<uint8_t *>(std::aligned_alloc(STACK_PROBE_ALIGN, STACK_PROBE_SIZE));
+    if (stack == nullptr) {
+        return 0;
+    }
+    memset(stack, STACK_PATTERN, STACK_PROBE_SIZE);
+
+    size_t used = 0;
+    pthread_attr_t attr;
+    pthread_t thread;
+    if (pthread_attr_init(&attr) == 0) {
+        if (pthread_attr_setstack(&attr, stack, STACK_PROBE_SIZE) == 0 &&
+            pthread_create(&thread, &attr, runOnProbeStack<F>, &fn) == 0) {
+            pthread_join(thread, nullptr);
+            // The stack grows down from the end of the buffer
+            size_t untouched = 0;
+            while (untouched < STACK_PROBE_SIZE && stack[untouched] == STACK_PATTERN) {
+                untouched++;
+            }
+            used = STACK_PROBE_SIZE - untouched;
+        }
+        pthread_attr_destroy(&attr);
+    }
+    std::free(stack);
+    return used;
+}
+
+template<typename F>
+size_t measureStack(F &&fn) {
+    // The thread descriptor and TLS are placed in the same buffer, their share is measured once
+    static const size_t overhead = [] {
+        auto idle = [] {};
+        return probeStack(idle);
+    }();
+    const size_t used = probeStack(fn);
+    return used > overhead ? used - overhead : 0;
+}
+
+std::vector<bench_vector_t> loadVectors(const std::string &jsonFile) {
+    std::vector<bench_vector_t> answer;
+
+    std::ifstream inFile(std::string(TESTVECTORS_DIR) + jsonFile);
+    if (!inFile.is_open()) {
+        return answer;
+    }
+
+    Json::CharReaderBuilder builder;
+    Json::Value obj;
+    JSONCPP_STRING errs;
+    Json::parseFromStream(builder, inFile, &obj, &errs);
+
+    for (Json::ArrayIndex i = 0; i < obj.size(); i++) {
+        const std::string hex = obj[i]["blob"].asString();
+        std::vector<uint8_t> blob(hex.size() / 2);
+        const uint16_t blobLen = parseHexString(blob.data(), blob.size(), hex.c_str());
+        blob.resize(blobLen);
+        answer.push_back(bench_vector_t{obj[i]["index"].asUInt64(), obj[i]["name"].asString(), blob});
+    }
+
+    return answer;
+}
+
+parser_error_t parseBlob(const bench_vector_t &vector, parser_context_t *ctx, parser_tx_t *txObj) {
+    MEMZERO(txObj, sizeof(*txObj));
+    return parser_parse(ctx, vector.blob.data(), vector.blob.size(), txObj);
+}
+
+parser_error_t dumpItems(parser_context_t *ctx) {
+    uint8_t numItems = 0;
+    CHECK_ERROR(parser_getNumItems(ctx, &numItems))
+
+    for (uint8_t idx = 0; idx < numItems; idx++) {
+        uint8_t pageIdx = 0;
+        uint8_t pageCount = 1;
+        while (pageIdx < pageCount) {
+            CHECK_ERROR(parser_getItem(ctx, idx, keyBuffer, sizeof(keyBuffer),
+                                       valueBuffer, sizeof(valueBuffer), pageIdx, &pageCount))
+            pageIdx++;
+        }
+    }
+    return parser_ok;
+}
+
+zxerr_t hashSections(const parser_tx_t *txObj, uint8_t *digest) {
+    const sections_t *sections = &txObj->transaction.sections;
+    CHECK_ZXERR(crypto_hashCodeSection(&sections->code, digest, HASH_LEN))
+    CHECK_ZXERR(crypto_hashDataSection(&sections->data, digest, HASH_LEN))
+    for (uint32_t i = 0; i < sections->extraDataLen; i++) {
+        CHECK_ZXERR(crypto_hashExtraDataSection(&sections->extraData[i], digest, HASH_LEN))
+    }
+    return zxerr_ok;
+}
+
+void reportCounters(benchmark::State &state, uint64_t allocations, size_t stackUse, size_t blobLen) {
+    state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations),
+                                                  benchmark::Counter::kAvgIterations);
+    state.counters["stack_bytes"] = static_cast<double>(stackUse);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * blobLen));
+}
+
+void BM_Parse(benchmark::State &state, const bench_vector_t &vector) {
+    parser_tx_t txObj;
+    parser_context_t ctx;
+
+    const uint64_t allocationsStart = g_allocations;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parseBlob(vector, &ctx, &txObj));
+    }
+    const uint64_t allocations = g_allocations - allocationsStart;
+
+    const size_t stackUse = measureStack([&] { parseBlob(vector, &ctx, &txObj); });
+    reportCounters(state, allocations, stackUse, vector.blob.size());
+}
+
+void BM_Validate(benchmark::State &state, const bench_vector_t &vector) {
+    parser_tx_t txObj;
+    parser_context_t ctx;
+    if (parseBlob(vector, &ctx, &txObj) != parser_ok) {
+        state.SkipWithError("parser_parse failed");
+        return;
+    }
+
+    const uint64_t allocationsStart = g_allocations;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parser_validate(&ctx));
+    }
+    const uint64_t allocations = g_allocations - allocationsStart;
+
+    const size_t stackUse = measureStack([&] { parser_validate(&ctx); });
+    reportCounters(state, allocations, stackUse, vector.blob.size());
+}
+
+void BM_Review(benchmark::State &state, const bench_vector_t &vector, bool expertMode) {
+    app_mode_set_expert(expertMode);
+
+    parser_tx_t txObj;
+    parser_context_t ctx;
+    if (parseBlob(vector, &ctx, &txObj) != parser_ok || parser_validate(&ctx) != parser_ok) {
+        state.SkipWithError("transaction could not be parsed");
+        return;
+    }
+
+    const uint64_t allocationsStart = g_allocations;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dumpItems(&ctx));
+    }
+    const uint64_t allocations = g_allocations - allocationsStart;
+
+    const size_t stackUse = measureStack([&] { dumpItems(&ctx); });
+    reportCounters(state, allocations, stackUse, vector.blob.size());
+}
+
+void BM_HashSections(benchmark::State &state, const bench_vector_t &vector) {
+    parser_tx_t txObj;
+    parser_context_t ctx;
+    if (parseBlob(vector, &ctx, &txObj) != parser_ok) {
+        state.SkipWithError("parser_parse failed");
+        return;
+    }
+
+    uint8_t digest[HASH_LEN] = {0};
+    const uint64_t allocationsStart = g_allocations;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hashSections(&txObj, digest));
+        benchmark::ClobberMemory();
+    }
+    const uint64_t allocations = g_allocations - allocationsStart;
+
+    const size_t stackUse = measureStack([&] { hashSections(&txObj, digest); });
+    reportCounters(state, allocations, stackUse, vector.blob.size());
+}
+
+// Transactions are grouped by the wasm tag of their code section, e.g. "tx_transfer.wasm"
+std::string transactionType(const bench_vector_t &vector) {
+    parser_tx_t txObj;
+    parser_context_t ctx;
+    if (parseBlob(vector, &ctx, &txObj) != parser_ok || txObj.transaction.sections.code.tag.ptr == nullptr) {
+        return "unknown";
+    }
+    const bytes_t *tag = &txObj.transaction.sections.code.tag;
+    return std::string(reinterpret_cast<const char *>(tag->ptr), tag->len);
+}
+
+}  // namespace
+
+void *operator new(std::size_t size) {
+    g_allocations++;
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+int main(int argc, char **argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    // Kept alive until the benchmarks have run, registered benchmarks hold references into it
+    static const std::vector<bench_vector_t> vectors = loadVectors("testvectors.json");
+    if (vectors.empty()) {
+        std::cerr << "No test vectors found in " << TESTVECTORS_DIR << ", only static benchmarks will run" << std::endl;
+    }
+
+    for (const auto &vector : vectors) {
+        const std::string type = transactionType(vector);
+        const std::string suffix = fmt::format("{}/{}_{}", type, vector.index, vector.name);
+
+        benchmark::RegisterBenchmark(("parse/" + suffix).c_str(), BM_Parse, vector);
+        benchmark::RegisterBenchmark(("validate/" + suffix).c_str(), BM_Validate, vector);
+        benchmark::RegisterBenchmark(("review_normal/" + suffix).c_str(), BM_Review, vector, false);
+        benchmark::RegisterBenchmark(("review_expert/" + suffix).c_str(), BM_Review, vector, true);
+        benchmark::RegisterBenchmark(("hash_sections/" + suffix).c_str(), BM_HashSections, vector);
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
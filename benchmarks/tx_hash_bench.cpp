@@ -0,0 +1,101 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+// Personalised BLAKE2b contexts cloned from a template versus initialised from scratch, a full tx id
+// and the sapling output digest for 1 to 15 outputs with each BLAKE2 backend
+
+#include <benchmark/benchmark.h>
+
+#include "blake2.h"
+#include "blake2b_template.h"
+#include "blake2_simd/blake2_simd.h"
+#include "parser_txdef.h"
+#include "signhash.h"
+#include "tx_hash.h"
+
+#include <vector>
+
+namespace {
+
+void BM_Blake2bFreshInit(benchmark::State &state) {
+    blake2b_state ctx;
+    for (auto _ : state) {
+        blake2b_init_with_personalization(&ctx, BLAKE2B_TEMPLATE_OUTPUT_LEN,
+                                          (const uint8_t *)ZCASH_SAPLING_OUTPUTS_HASH_PERSONALIZATION,
+                                          PERSONALIZATION_SIZE);
+        benchmark::DoNotOptimize(&ctx);
+    }
+}
+
+void BM_Blake2bTemplateLoad(benchmark::State &state) {
+    blake2b_template_ctx_t ctx;
+    for (auto _ : state) {
+        blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_SAPLING_OUTPUTS);
+        benchmark::DoNotOptimize(&ctx);
+    }
+}
+
+// Without MASP bundles every sub-hash is the personalised empty digest, so this is dominated by setup
+void BM_TxIdEmptyBundles(benchmark::State &state) {
+    const parser_tx_t txObj = {};
+    uint8_t output[HASH_SIZE] = {0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tx_hash_txId(&txObj, output));
+        benchmark::DoNotOptimize(signature_hash(&txObj, output));
+    }
+}
+
+void BM_SaplingOutputs(benchmark::State &state) {
+    const auto backend = static_cast<blake2_backend_e>(state.range(0));
+    const auto outputs = static_cast<uint64_t>(state.range(1));
+    const blake2_backend_e previous = blake2_backend_get();
+    if (!blake2_backend_set(backend)) {
+        state.SkipWithError("backend not supported by this CPU");
+        return;
+    }
+    state.SetLabel(blake2_backend_name(backend));
+
+    std::vector<uint8_t> records(outputs * SHIELDED_OUTPUTS_LEN);
+    for (size_t i = 0; i < records.size(); i++) {
+        records[i] = static_cast<uint8_t>(i);
+    }
+    parser_tx_t txObj = {};
+    txObj.transaction.sections.maspTx.data.sapling_bundle.n_shielded_outputs = outputs;
+    txObj.transaction.sections.maspTx.data.sapling_bundle.shielded_outputs.ptr = records.data();
+
+    uint8_t output[HASH_SIZE] = {0};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tx_hash_sapling_outputs(&txObj, output));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * outputs));
+    blake2_backend_set(previous);
+}
+
+void saplingOutputArgs(benchmark::internal::Benchmark *bench) {
+    bench->ArgNames({"backend", "outputs"});
+    for (const int backend : {BLAKE2_BACKEND_REF, BLAKE2_BACKEND_AVX2}) {
+        for (const int outputs : {1, 2, 4, 8, 15}) {
+            bench->Args({backend, outputs});
+        }
+    }
+}
+
+}  // namespace
+
+BENCHMARK(BM_Blake2bFreshInit)->Name("tx_hash/blake2b_fresh_init");
+BENCHMARK(BM_Blake2bTemplateLoad)->Name("tx_hash/blake2b_template_load");
+BENCHMARK(BM_TxIdEmptyBundles)->Name("tx_hash/txid_and_sighash_empty");
+BENCHMARK(BM_SaplingOutputs)->Name("tx_hash/sapling_outputs")->Apply(saplingOutputArgs);
@@ -0,0 +1,337 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+// Checks every vector of tests/testvectors.json in normal and expert mode, like the ui_tests do,
+// but with the corpus parsed once and the (vector, mode) pairs spread over a pool of threads.
+//   namada_vectors [testvectors.json] [--threads N] [--mode normal|expert|both] [--filter TEXT] [--slowest N]
+// Reports parse, validate and dump latency percentiles per mode and the slowest vectors.
+
+#include <fmt/core.h>
+#include <json/json.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <hexutils.h>
+
+#include "common/parser.h"
+#include "parser_impl.h"
+#include "ui_dump.h"
+
+namespace {
+
+// Same line widths as the ui_tests
+constexpr uint16_t DUMP_KEY_LEN = 39;
+constexpr uint16_t DUMP_VALUE_LEN = 39;
+
+enum mode_e {
+    MODE_NORMAL = 0,
+    MODE_EXPERT,
+    MODE_COUNT,
+};
+
+const char *const MODE_NAMES[MODE_COUNT] = {"normal", "expert"};
+
+struct options_t {
+    std::string vectors = std::string(TESTVECTORS_DIR) + "testvectors.json";
+    std::string filter;
+    uint32_t threads = 0;
+    uint32_t slowest = 5;
+    bool modes[MODE_COUNT] = {true, true};
+};
+
+struct vector_t {
+    uint64_t index;
+    std::string name;
+    std::vector<uint8_t> blob;
+    std::vector<std::string> expected[MODE_COUNT];
+};
+
+struct job_t {
+    const vector_t *vector;
+    mode_e mode;
+};
+
+struct result_t {
+    const vector_t *vector = nullptr;
+    mode_e mode = MODE_NORMAL;
+    uint64_t parseNs = 0;
+    uint64_t validateNs = 0;
+    uint64_t dumpNs = 0;
+    std::string failure;
+};
+
+void usage() {
+    fmt::print(stderr,
+               "usage: namada_vectors [testvectors.json] [--threads N] [--mode normal|expert|both]"
+               " [--filter TEXT] [--slowest N]\n");
+}
+
+bool parseOptions(int argc, char **argv, options_t *options) {
+    int i = 1;
+    if (argc > 1 && argv[1][0] != '-') {
+        options->vectors = argv[1];
+        i = 2;
+    }
+
+    for (; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--threads" && hasValue) {
+            options->threads = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--slowest" && hasValue) {
+            options->slowest = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--filter" && hasValue) {
+            options->filter = argv[++i];
+        } else if (arg == "--mode" && hasValue) {
+            const std::string mode = argv[++i];
+            if (mode != "normal" && mode != "expert" && mode != "both") {
+                return false;
+            }
+            options->modes[MODE_NORMAL] = mode != "expert";
+            options->modes[MODE_EXPERT] = mode != "normal";
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t nowNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+double toMicros(uint64_t ns) {
+    return static_cast<double>(ns) / 1000.0;
+}
+
+std::vector<std::string> readStrings(const Json::Value &array) {
+    std::vector<std::string> answer;
+    answer.reserve(array.size());
+    for (const auto &s : array) {
+        answer.push_back(s.asString());
+    }
+    return answer;
+}
+
+// The corpus is read, and every blob decoded, once for all threads
+bool loadVectors(const options_t &options, std::vector<vector_t> *vectors) {
+    std::ifstream inFile(options.vectors);
+    if (!inFile.is_open()) {
+        return false;
+    }
+
+    Json::CharReaderBuilder builder;
+    Json::Value obj;
+    JSONCPP_STRING errs;
+    if (!Json::parseFromStream(builder, inFile, &obj, &errs)) {
+        return false;
+    }
+
+    vectors->reserve(obj.size());
+    for (Json::ArrayIndex i = 0; i < obj.size(); i++) {
+        const std::string name = obj[i]["name"].asString();
+        if (!options.filter.empty() && name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+
+        const std::string hex = obj[i]["blob"].asString();
+        vector_t vector;
+        vector.index = obj[i]["index"].asUInt64();
+        vector.name = name;
+        vector.blob.resize(hex.size() / 2);
+        vector.blob.resize(parseHexString(vector.blob.data(), vector.blob.size(), hex.c_str()));
+        vector.expected[MODE_NORMAL] = readStrings(obj[i]["output"]);
+        vector.expected[MODE_EXPERT] = readStrings(obj[i]["output_expert"]);
+        vectors->push_back(std::move(vector));
+    }
+    return true;
+}
+
+std::string compareOutput(const std::vector<std::string> &output, const std::vector<std::string> &expected) {
+    for (size_t i = 0; i < std::min(output.size(), expected.size()); i++) {
+        if (output[i] != expected[i]) {
+            return fmt::format("line {}: expected \"{}\", received \"{}\"", i, expected[i], output[i]);
+        }
+    }
+    if (output.size() != expected.size()) {
+        return fmt::format("expected {} lines, received {}", expected.size(), output.size());
+    }
+    return "";
+}
+
+// Review mode is part of the parser context, so threads rendering different modes do not interfere.
+// The memos and caches the parser uses are per thread in host builds.
+void runJob(const job_t &job, parser_tx_t *txObj, result_t *result) {
+    result->vector = job.vector;
+    result->mode = job.mode;
+
+    parser_context_t ctx;
+    MEMZERO(&ctx, sizeof(ctx));
+    MEMZERO(txObj, sizeof(*txObj));
+
+    uint64_t start = nowNs();
+    parser_error_t err = parser_parse(&ctx, job.vector->blob.data(), job.vector->blob.size(), txObj);
+    result->parseNs = nowNs() - start;
+    ctx.expert = job.mode == MODE_EXPERT;
+    if (err != parser_ok) {
+        result->failure = fmt::format("parse: {}", parser_getErrorDescription(err));
+        return;
+    }
+
+    start = nowNs();
+    err = parser_validate(&ctx);
+    result->validateNs = nowNs() - start;
+    if (err != parser_ok) {
+        result->failure = fmt::format("validate: {}", parser_getErrorDescription(err));
+        return;
+    }
+
+    start = nowNs();
+    const std::vector<std::string> output = dumpUI(&ctx, DUMP_KEY_LEN, DUMP_VALUE_LEN);
+    result->dumpNs = nowNs() - start;
+
+    result->failure = compareOutput(output, job.vector->expected[job.mode]);
+}
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    const size_t idx = static_cast<size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+    return values[idx];
+}
+
+void printPercentiles(const std::vector<result_t> &results, mode_e mode) {
+    std::vector<double> parse;
+    std::vector<double> validate;
+    std::vector<double> dump;
+    for (const auto &result : results) {
+        if (result.mode == mode) {
+            parse.push_back(toMicros(result.parseNs));
+            validate.push_back(toMicros(result.validateNs));
+            dump.push_back(toMicros(result.dumpNs));
+        }
+    }
+    if (parse.empty()) {
+        return;
+    }
+
+    fmt::print("\n{} mode, {} vectors\n", MODE_NAMES[mode], parse.size());
+    fmt::print("{:<10} {:>12} {:>12} {:>12} {:>12}\n", "phase", "p50 [us]", "p90 [us]", "p99 [us]", "max [us]");
+    const std::pair<const char *, const std::vector<double> *> phases[] = {
+            {"parse", &parse}, {"validate", &validate}, {"dump", &dump}};
+    for (const auto &phase : phases) {
+        fmt::print("{:<10} {:>12.1f} {:>12.1f} {:>12.1f} {:>12.1f}\n", phase.first,
+                   percentile(*phase.second, 0.50), percentile(*phase.second, 0.90),
+                   percentile(*phase.second, 0.99), percentile(*phase.second, 1.0));
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    options_t options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    std::vector<vector_t> vectors;
+    if (!loadVectors(options, &vectors)) {
+        fmt::print(stderr, "could not read {}\n", options.vectors);
+        return EXIT_FAILURE;
+    }
+
+    std::vector<job_t> jobs;
+    for (const auto &vector : vectors) {
+        for (uint8_t mode = 0; mode < MODE_COUNT; mode++) {
+            if (options.modes[mode]) {
+                jobs.push_back(job_t{&vector, static_cast<mode_e>(mode)});
+            }
+        }
+    }
+
+    uint32_t threadCount = options.threads;
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threadCount = static_cast<uint32_t>(std::min<size_t>(threadCount, std::max<size_t>(jobs.size(), 1)));
+
+    // Threads take the next pending job, so slow vectors do not hold back a whole shard
+    std::vector<result_t> results(jobs.size());
+    std::atomic<size_t> nextJob{0};
+    const uint64_t start = nowNs();
+    std::vector<std::thread> pool;
+    for (uint32_t t = 0; t < threadCount; t++) {
+        pool.emplace_back([&] {
+            auto txObj = std::make_unique<parser_tx_t>();
+            for (size_t idx = nextJob++; idx < jobs.size(); idx = nextJob++) {
+                runJob(jobs[idx], txObj.get(), &results[idx]);
+            }
+        });
+    }
+    for (auto &thread : pool) {
+        thread.join();
+    }
+    const uint64_t elapsedNs = nowNs() - start;
+
+    size_t failures = 0;
+    for (const auto &result : results) {
+        if (!result.failure.empty()) {
+            failures++;
+            fmt::print("FAIL {}_{} [{}] {}\n", result.vector->index, result.vector->name,
+                       MODE_NAMES[result.mode], result.failure);
+        }
+    }
+
+    for (uint8_t mode = 0; mode < MODE_COUNT; mode++) {
+        printPercentiles(results, static_cast<mode_e>(mode));
+    }
+
+    std::vector<const result_t *> slowest;
+    for (const auto &result : results) {
+        slowest.push_back(&result);
+    }
+    const auto totalNs = [](const result_t *r) { return r->parseNs + r->validateNs + r->dumpNs; };
+    const size_t slowestCount = std::min<size_t>(options.slowest, slowest.size());
+    std::partial_sort(slowest.begin(), slowest.begin() + slowestCount, slowest.end(),
+                      [&](const result_t *a, const result_t *b) { return totalNs(a) > totalNs(b); });
+    if (slowestCount > 0) {
+        fmt::print("\nslowest vectors\n");
+    }
+    for (size_t i = 0; i < slowestCount; i++) {
+        fmt::print("{:>12.1f} us  {}_{} [{}]\n", toMicros(totalNs(slowest[i])), slowest[i]->vector->index,
+                   slowest[i]->vector->name, MODE_NAMES[slowest[i]->mode]);
+    }
+
+    fmt::print("\n{} vectors, {} checks on {} threads in {:.1f} ms: {} passed, {} failed\n",
+               vectors.size(), jobs.size(), threadCount, static_cast<double>(elapsedNs) / 1e6,
+               jobs.size() - failures, failures);
+
+    return failures == 0 && !jobs.empty() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
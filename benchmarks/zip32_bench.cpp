@@ -0,0 +1,55 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+// Diversifier search through the rslib entry points, one valid diversifier versus a list of them
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "keys_def.h"
+
+extern "C" {
+#include "rslib.h"
+}
+
+namespace {
+
+constexpr uint32_t BENCH_ACCOUNT = 0;
+
+void BM_DiversifierFindValid(benchmark::State &state) {
+    uint8_t diversifier[DIVERSIFIER_LENGTH] = {0};
+    for (auto _ : state) {
+        diversifier_find_valid(BENCH_ACCOUNT, diversifier);
+        benchmark::DoNotOptimize(diversifier);
+    }
+}
+
+void BM_DiversifierFindList(benchmark::State &state) {
+    const auto count = static_cast<uint8_t>(state.range(0));
+    const uint8_t start[DIVERSIFIER_LENGTH] = {0};
+    std::vector<uint8_t> diversifiers(count * DIVERSIFIER_LENGTH);
+    for (auto _ : state) {
+        diversifier_find_list(BENCH_ACCOUNT, start, diversifiers.data(), count);
+        benchmark::DoNotOptimize(diversifiers.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+}  // namespace
+
+BENCHMARK(BM_DiversifierFindValid)->Name("zip32/diversifier_find_valid");
+BENCHMARK(BM_DiversifierFindList)->Name("zip32/diversifier_find_list")->Arg(1)->Arg(4)->Arg(10);
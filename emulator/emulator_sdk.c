@@ -0,0 +1,382 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "emulator_sdk.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <openssl/bn.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
+#include "os.h"
+#include "cx.h"
+#include "cx_sha256.h"
+#include "picohash.h"
+
+// Same mnemonic as the Zemu test device, so keys match the ones used by tests_zemu
+#define EMULATOR_DEFAULT_MNEMONIC \
+    "equip will roof matter pink blind book anxiety banner elbow sun young"
+
+#define ED25519_KEY_LEN 32
+#define SLIP10_CHAIN_CODE_LEN 32
+
+_Static_assert(sizeof(cx_sha256_t) >= sizeof(picohash_ctx_t), "cx_sha256_t cannot hold a picohash context");
+
+static uint8_t device_seed[EMULATOR_SEED_LEN];
+static bool device_seed_ready = false;
+
+static uint64_t rng_seed = 0;
+static uint64_t rng_counter = 0;
+static uint8_t rng_block[PICOHASH_SHA256_DIGEST_LENGTH];
+static size_t rng_available = 0;
+
+static try_context_t *current_try_context = NULL;
+
+///////////////////////////////////////////////////////////////////////////////
+// Exceptions
+
+try_context_t *try_context_get(void) {
+    return current_try_context;
+}
+
+try_context_t *try_context_set(try_context_t *context) {
+    try_context_t *previous = current_try_context;
+    current_try_context = context;
+    return previous;
+}
+
+void os_longjmp(exception_t exception) {
+    if (current_try_context == NULL) {
+        // Nobody to catch it, same as a device reset
+        abort();
+    }
+    longjmp(current_try_context->jmp_buf, exception);
+}
+
+unsigned int os_global_pin_is_validated(void) {
+    return BOLOS_UX_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Seed and key derivation
+
+zxerr_t emulator_sdk_set_mnemonic(const char *mnemonic) {
+    if (mnemonic == NULL) {
+        mnemonic = EMULATOR_DEFAULT_MNEMONIC;
+    }
+
+    // BIP39 seed with an empty passphrase
+    const char salt[] = "mnemonic";
+    if (PKCS5_PBKDF2_HMAC(mnemonic, (int) strlen(mnemonic),
+                          (const unsigned char *) salt, (int) strlen(salt),
+                          2048, EVP_sha512(), sizeof(device_seed), device_seed) != 1) {
+        device_seed_ready = false;
+        return zxerr_unknown;
+    }
+
+    device_seed_ready = true;
+    return zxerr_ok;
+}
+
+// SLIP-10 for ed25519 only defines hardened children, the device hardens every index as well
+cx_err_t os_derive_bip32_with_seed_no_throw(unsigned int derivation_mode,
+                                            cx_curve_t curve,
+                                            const uint32_t *path,
+                                            size_t path_len,
+                                            uint8_t raw_privkey[64],
+                                            uint8_t *chain_code,
+                                            __attribute__((unused)) unsigned char *seed_key,
+                                            __attribute__((unused)) size_t seed_key_len) {
+    if (derivation_mode != HDW_ED25519_SLIP10 || curve != CX_CURVE_Ed25519 ||
+        raw_privkey == NULL || (path == NULL && path_len != 0)) {
+        return CX_INVALID_PARAMETER;
+    }
+    if (!device_seed_ready && emulator_sdk_set_mnemonic(NULL) != zxerr_ok) {
+        return CX_INTERNAL_ERROR;
+    }
+
+    uint8_t node[ED25519_KEY_LEN + SLIP10_CHAIN_CODE_LEN] = {0};
+    unsigned int nodeLen = sizeof(node);
+    const char masterKey[] = "ed25519 seed";
+    if (HMAC(EVP_sha512(), masterKey, (int) strlen(masterKey),
+             device_seed, sizeof(device_seed), node, &nodeLen) == NULL) {
+        return CX_INTERNAL_ERROR;
+    }
+
+    for (size_t i = 0; i < path_len; i++) {
+        const uint32_t index = path[i] | 0x80000000u;
+        uint8_t data[1 + ED25519_KEY_LEN + sizeof(uint32_t)] = {0};
+        memcpy(data + 1, node, ED25519_KEY_LEN);
+        data[1 + ED25519_KEY_LEN] = (uint8_t) (index >> 24);
+        data[2 + ED25519_KEY_LEN] = (uint8_t) (index >> 16);
+        data[3 + ED25519_KEY_LEN] = (uint8_t) (index >> 8);
+        data[4 + ED25519_KEY_LEN] = (uint8_t) index;
+
+        nodeLen = sizeof(node);
+        if (HMAC(EVP_sha512(), node + ED25519_KEY_LEN, SLIP10_CHAIN_CODE_LEN,
+                 data, sizeof(data), node, &nodeLen) == NULL) {
+            memset(node, 0, sizeof(node));
+            return CX_INTERNAL_ERROR;
+        }
+        memset(data, 0, sizeof(data));
+    }
+
+    memset(raw_privkey, 0, 64);
+    memcpy(raw_privkey, node, ED25519_KEY_LEN);
+    if (chain_code != NULL) {
+        memcpy(chain_code, node + ED25519_KEY_LEN, SLIP10_CHAIN_CODE_LEN);
+    }
+    memset(node, 0, sizeof(node));
+    return CX_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Ed25519
+
+cx_err_t cx_ecfp_init_private_key_no_throw(cx_curve_t curve, const uint8_t *rawkey, size_t key_len,
+                                           cx_ecfp_private_key_t *pvkey) {
+    if (curve != CX_CURVE_Ed25519 || pvkey == NULL || key_len > sizeof(pvkey->d) ||
+        (rawkey == NULL && key_len != 0)) {
+        return CX_INVALID_PARAMETER;
+    }
+    memset(pvkey, 0, sizeof(*pvkey));
+    pvkey->curve = curve;
+    pvkey->d_len = key_len;
+    if (key_len != 0) {
+        memcpy(pvkey->d, rawkey, key_len);
+    }
+    return CX_OK;
+}
+
+cx_err_t cx_ecfp_init_public_key_no_throw(cx_curve_t curve, const uint8_t *rawkey, size_t key_len,
+                                          cx_ecfp_public_key_t *pukey) {
+    if (curve != CX_CURVE_Ed25519 || pukey == NULL || key_len > sizeof(pukey->W) ||
+        (rawkey == NULL && key_len != 0)) {
+        return CX_INVALID_PARAMETER;
+    }
+    memset(pukey, 0, sizeof(*pukey));
+    pukey->curve = curve;
+    pukey->W_len = key_len;
+    if (key_len != 0) {
+        memcpy(pukey->W, rawkey, key_len);
+    }
+    return CX_OK;
+}
+
+static EVP_PKEY *ed25519_private_key(const cx_ecfp_private_key_t *pvkey) {
+    if (pvkey == NULL || pvkey->curve != CX_CURVE_Ed25519 || pvkey->d_len != ED25519_KEY_LEN) {
+        return NULL;
+    }
+    return EVP_PKEY_new_raw_private_key(EVP_PKEY_ED25519, NULL, pvkey->d, ED25519_KEY_LEN);
+}
+
+// The encoded key is y in little endian with the sign of x on top, the SDK hands out the affine point instead
+static cx_err_t ed25519_decompress(const uint8_t encoded[ED25519_KEY_LEN], uint8_t W[65]) {
+    uint8_t yBytes[ED25519_KEY_LEN] = {0};
+    for (size_t i = 0; i < ED25519_KEY_LEN; i++) {
+        yBytes[i] = encoded[ED25519_KEY_LEN - 1 - i];
+    }
+    const int xSign = yBytes[0] >> 7;
+    yBytes[0] &= 0x7F;
+
+    cx_err_t error = CX_INTERNAL_ERROR;
+    BN_CTX *ctx = BN_CTX_new();
+    BIGNUM *p = BN_new();
+    BIGNUM *d = BN_new();
+    BIGNUM *y = BN_bin2bn(yBytes, sizeof(yBytes), NULL);
+    BIGNUM *u = BN_new();
+    BIGNUM *v = BN_new();
+    BIGNUM *x = BN_new();
+    BIGNUM *tmp = BN_new();
+    if (ctx == NULL || p == NULL || d == NULL || y == NULL || u == NULL || v == NULL || x == NULL || tmp == NULL) {
+        goto cleanup;
+    }
+
+    // p = 2^255 - 19, d = -121665 / 121666
+    if (!BN_set_bit(p, 255) || !BN_sub_word(p, 19) ||
+        !BN_set_word(tmp, 121666) || BN_mod_inverse(tmp, tmp, p, ctx) == NULL ||
+        !BN_set_word(d, 121665) || !BN_mod_mul(d, d, tmp, p, ctx) || !BN_sub(d, p, d)) {
+        goto cleanup;
+    }
+
+    // x^2 = (y^2 - 1) / (d y^2 + 1)
+    if (!BN_mod_sqr(tmp, y, p, ctx) ||
+        !BN_mod_sub(u, tmp, BN_value_one(), p, ctx) ||
+        !BN_mod_mul(v, d, tmp, p, ctx) || !BN_mod_add(v, v, BN_value_one(), p, ctx) ||
+        BN_mod_inverse(v, v, p, ctx) == NULL || !BN_mod_mul(tmp, u, v, p, ctx)) {
+        goto cleanup;
+    }
+    if (BN_is_zero(tmp)) {
+        BN_zero(x);
+    } else if (BN_mod_sqrt(x, tmp, p, ctx) == NULL) {
+        goto cleanup;
+    }
+    if (BN_is_odd(x) != xSign && !BN_is_zero(x) && !BN_sub(x, p, x)) {
+        goto cleanup;
+    }
+
+    W[0] = 0x04;
+    if (BN_bn2binpad(x, W + 1, ED25519_KEY_LEN) != ED25519_KEY_LEN ||
+        BN_bn2binpad(y, W + 1 + ED25519_KEY_LEN, ED25519_KEY_LEN) != ED25519_KEY_LEN) {
+        goto cleanup;
+    }
+    error = CX_OK;
+
+cleanup:
+    BN_free(tmp);
+    BN_free(x);
+    BN_free(v);
+    BN_free(u);
+    BN_free(y);
+    BN_free(d);
+    BN_free(p);
+    BN_CTX_free(ctx);
+    return error;
+}
+
+cx_err_t cx_ecfp_generate_pair_no_throw(cx_curve_t curve, cx_ecfp_public_key_t *pubkey,
+                                        cx_ecfp_private_key_t *privkey, bool keepprivate) {
+    if (curve != CX_CURVE_Ed25519 || pubkey == NULL || privkey == NULL) {
+        return CX_INVALID_PARAMETER;
+    }
+    if (!keepprivate) {
+        uint8_t rawkey[ED25519_KEY_LEN] = {0};
+        cx_rng_no_throw(rawkey, sizeof(rawkey));
+        cx_ecfp_init_private_key_no_throw(curve, rawkey, sizeof(rawkey), privkey);
+        memset(rawkey, 0, sizeof(rawkey));
+    }
+
+    EVP_PKEY *pkey = ed25519_private_key(privkey);
+    if (pkey == NULL) {
+        return CX_INVALID_PARAMETER;
+    }
+
+    uint8_t encoded[ED25519_KEY_LEN] = {0};
+    size_t encodedLen = sizeof(encoded);
+    const int ok = EVP_PKEY_get_raw_public_key(pkey, encoded, &encodedLen);
+    EVP_PKEY_free(pkey);
+    if (ok != 1 || encodedLen != ED25519_KEY_LEN) {
+        return CX_INTERNAL_ERROR;
+    }
+
+    memset(pubkey, 0, sizeof(*pubkey));
+    pubkey->curve = curve;
+    pubkey->W_len = sizeof(pubkey->W);
+    return ed25519_decompress(encoded, pubkey->W);
+}
+
+cx_err_t cx_eddsa_sign_no_throw(const cx_ecfp_private_key_t *pvkey, cx_md_t hashID, const uint8_t *hash,
+                                size_t hash_len, uint8_t *sig, size_t sig_len) {
+    if (hashID != CX_SHA512 || (hash == NULL && hash_len != 0) || sig == NULL || sig_len < 64) {
+        return CX_INVALID_PARAMETER;
+    }
+
+    EVP_PKEY *pkey = ed25519_private_key(pvkey);
+    if (pkey == NULL) {
+        return CX_INVALID_PARAMETER;
+    }
+
+    cx_err_t error = CX_INTERNAL_ERROR;
+    size_t signatureLen = 64;
+    EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+    if (ctx != NULL &&
+        EVP_DigestSignInit(ctx, NULL, NULL, NULL, pkey) == 1 &&
+        EVP_DigestSign(ctx, sig, &signatureLen, hash, hash_len) == 1 &&
+        signatureLen == 64) {
+        error = CX_OK;
+    }
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    return error;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Random numbers, SHA-256 in counter mode
+
+void emulator_sdk_reset_rng(uint64_t seed) {
+    rng_seed = seed;
+    rng_counter = 0;
+    rng_available = 0;
+}
+
+void cx_rng_no_throw(uint8_t *buffer, size_t len) {
+    while (len > 0) {
+        if (rng_available == 0) {
+            uint8_t input[2 * sizeof(uint64_t)] = {0};
+            for (size_t i = 0; i < sizeof(uint64_t); i++) {
+                input[i] = (uint8_t) (rng_seed >> (8 * i));
+                input[sizeof(uint64_t) + i] = (uint8_t) (rng_counter >> (8 * i));
+            }
+            rng_counter++;
+            cx_hash_sha256(input, sizeof(input), rng_block, sizeof(rng_block));
+            rng_available = sizeof(rng_block);
+        }
+
+        const size_t take = len < rng_available ? len : rng_available;
+        memcpy(buffer, rng_block + sizeof(rng_block) - rng_available, take);
+        rng_available -= take;
+        buffer += take;
+        len -= take;
+    }
+}
+
+uint8_t *cx_rng(uint8_t *buffer, size_t len) {
+    cx_rng_no_throw(buffer, len);
+    return buffer;
+}
+
+void cx_trng_get_random_data(uint8_t *buffer, size_t len) {
+    cx_rng_no_throw(buffer, len);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SHA-256
+
+int cx_sha256_init(cx_sha256_t *hash) {
+    if (hash == NULL) {
+        return CX_NONE;
+    }
+    picohash_init_sha256((picohash_ctx_t *) hash);
+    return CX_SHA256;
+}
+
+cx_err_t cx_sha256_update(cx_sha256_t *ctx, const uint8_t *data, size_t len) {
+    if (ctx == NULL || (data == NULL && len != 0)) {
+        return CX_INVALID_PARAMETER;
+    }
+    picohash_update((picohash_ctx_t *) ctx, data, len);
+    return CX_OK;
+}
+
+cx_err_t cx_sha256_final(cx_sha256_t *ctx, uint8_t *digest) {
+    if (ctx == NULL || digest == NULL) {
+        return CX_INVALID_PARAMETER;
+    }
+    picohash_final((picohash_ctx_t *) ctx, digest);
+    return CX_OK;
+}
+
+size_t cx_hash_sha256(const uint8_t *in, size_t len, uint8_t *out, size_t out_len) {
+    if (out == NULL || out_len < CX_SHA256_SIZE) {
+        return 0;
+    }
+    picohash_ctx_t ctx;
+    picohash_init_sha256(&ctx);
+    picohash_update(&ctx, in, len);
+    picohash_final(&ctx, out);
+    return CX_SHA256_SIZE;
+}
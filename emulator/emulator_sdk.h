@@ -0,0 +1,37 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "zxerror.h"
+
+#define EMULATOR_SEED_LEN 64
+
+/// Derives the BIP39 seed used for every key of the emulated device
+/// \param mnemonic space separated words, NULL selects the Zemu test mnemonic
+zxerr_t emulator_sdk_set_mnemonic(const char *mnemonic);
+
+/// Restarts the deterministic random number generator
+void emulator_sdk_reset_rng(uint64_t seed);
+
+#ifdef __cplusplus
+}
+#endif
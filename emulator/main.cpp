@@ -0,0 +1,411 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+
+// Host emulator of the Namada app.
+//   namada_emulator serve [--port N] [--expert] [--timings] [--mnemonic "..."]
+//     Listens on 127.0.0.1 with the Speculos APDU framing, so any client able to talk to Speculos can drive it.
+//   namada_emulator replay <testvectors.json> [--iterations N] [--expert] [--strict] [--mnemonic "..."]
+//     Signs every blob through INS_SIGN and reports latency percentiles per phase. With --strict, any vector
+//     with an expected UI output for the mode that the emulator rejects fails the run.
+
+#include <fmt/core.h>
+#include <json/json.h>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <hexutils.h>
+
+#include "app_main.h"
+#include "coin.h"
+#include "namada_emulator.h"
+
+namespace {
+
+constexpr uint16_t DEFAULT_PORT = 9999;
+constexpr size_t CHUNK_SIZE = 250;
+constexpr uint16_t SW_OK = 0x9000;
+
+// m/44'/877'/0'/0'/0'
+const std::array<uint32_t, HDPATH_LEN_DEFAULT> SIGNING_PATH = {
+        HDPATH_0_DEFAULT, HDPATH_1_DEFAULT, MASK_HARDENED, MASK_HARDENED, MASK_HARDENED,
+};
+
+struct options_t {
+    std::string command;
+    std::string vectors;
+    std::string mnemonic;
+    uint16_t port = DEFAULT_PORT;
+    uint32_t iterations = 1;
+    bool expert = false;
+    bool timings = false;
+    bool strict = false;
+};
+
+struct vector_t {
+    uint64_t index;
+    std::string name;
+    std::vector<uint8_t> blob;
+    // The UI tests parse and render the blob in this mode
+    bool expected[2];
+};
+
+// Latency samples of one phase, in microseconds
+struct samples_t {
+    const char *name;
+    std::vector<double> values;
+};
+
+void usage() {
+    fmt::print(stderr,
+               "usage: namada_emulator serve [--port N] [--expert] [--timings] [--mnemonic WORDS]\n"
+               "       namada_emulator replay <testvectors.json> [--iterations N] [--expert] [--strict]"
+               " [--mnemonic WORDS]\n");
+}
+
+bool parseOptions(int argc, char **argv, options_t *options) {
+    if (argc < 2) {
+        return false;
+    }
+    options->command = argv[1];
+
+    int i = 2;
+    if (options->command == "replay") {
+        if (argc < 3) {
+            return false;
+        }
+        options->vectors = argv[2];
+        i = 3;
+    } else if (options->command != "serve") {
+        return false;
+    }
+
+    for (; i < argc; i++) {
+        const std::string arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--expert") {
+            options->expert = true;
+        } else if (arg == "--timings") {
+            options->timings = true;
+        } else if (arg == "--strict") {
+            options->strict = true;
+        } else if (arg == "--port" && hasValue) {
+            options->port = static_cast<uint16_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--iterations" && hasValue) {
+            options->iterations = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--mnemonic" && hasValue) {
+            options->mnemonic = argv[++i];
+        } else {
+            return false;
+        }
+    }
+    return options->iterations > 0;
+}
+
+std::vector<uint8_t> buildApdu(uint8_t ins, uint8_t p1, uint8_t p2, const uint8_t *data, size_t dataLen) {
+    std::vector<uint8_t> apdu = {CLA, ins, p1, p2, static_cast<uint8_t>(dataLen)};
+    apdu.insert(apdu.end(), data, data + dataLen);
+    return apdu;
+}
+
+uint16_t statusWord(const uint8_t *response, uint16_t responseLen) {
+    if (responseLen < 2) {
+        return 0;
+    }
+    return static_cast<uint16_t>((response[responseLen - 2] << 8) | response[responseLen - 1]);
+}
+
+double toMicros(uint64_t ns) {
+    return static_cast<double>(ns) / 1000.0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// replay
+
+std::vector<vector_t> loadVectors(const std::string &jsonFile) {
+    std::vector<vector_t> answer;
+
+    std::ifstream inFile(jsonFile);
+    if (!inFile.is_open()) {
+        return answer;
+    }
+
+    Json::CharReaderBuilder builder;
+    Json::Value obj;
+    JSONCPP_STRING errs;
+    if (!Json::parseFromStream(builder, inFile, &obj, &errs)) {
+        return answer;
+    }
+
+    for (Json::ArrayIndex i = 0; i < obj.size(); i++) {
+        const std::string hex = obj[i]["blob"].asString();
+        std::vector<uint8_t> blob(hex.size() / 2);
+        const uint16_t blobLen = parseHexString(blob.data(), blob.size(), hex.c_str());
+        blob.resize(blobLen);
+        answer.push_back(vector_t{obj[i]["index"].asUInt64(), obj[i]["name"].asString(), blob,
+                                  {!obj[i]["output"].empty(), !obj[i]["output_expert"].empty()}});
+    }
+
+    return answer;
+}
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) {
+        return 0;
+    }
+    std::sort(values.begin(), values.end());
+    const size_t idx = static_cast<size_t>(p * static_cast<double>(values.size() - 1) + 0.5);
+    return values[idx];
+}
+
+// INIT with the path, then the blob in chunks. Phase timings of the signature are returned in lastTiming.
+bool signBlob(const vector_t &vector, uint64_t *chunksNs, emulator_timing_t *lastTiming, uint16_t *sw) {
+    uint8_t response[EMULATOR_APDU_MAX_LEN];
+    uint16_t responseLen = 0;
+    emulator_timing_t timing = {};
+    *chunksNs = 0;
+
+    std::vector<uint8_t> path = {static_cast<uint8_t>(SIGNING_PATH.size())};
+    for (const uint32_t element : SIGNING_PATH) {
+        for (size_t i = 0; i < sizeof(element); i++) {
+            path.push_back(static_cast<uint8_t>(element >> (8 * i)));
+        }
+    }
+
+    std::vector<uint8_t> apdu = buildApdu(INS_SIGN, P1_INIT, 0, path.data(), path.size());
+    if (emulator_exchange(apdu.data(), apdu.size(), response, sizeof(response), &responseLen, &timing) != zxerr_ok) {
+        return false;
+    }
+    *chunksNs += timing.apdu_ns;
+    *sw = statusWord(response, responseLen);
+    if (*sw != SW_OK) {
+        return true;
+    }
+
+    for (size_t offset = 0; offset < vector.blob.size(); offset += CHUNK_SIZE) {
+        const size_t len = std::min(CHUNK_SIZE, vector.blob.size() - offset);
+        const bool last = offset + len == vector.blob.size();
+        apdu = buildApdu(INS_SIGN, last ? P1_LAST : P1_ADD, 0, vector.blob.data() + offset, len);
+        if (emulator_exchange(apdu.data(), apdu.size(), response, sizeof(response), &responseLen, &timing) != zxerr_ok) {
+            return false;
+        }
+        *sw = statusWord(response, responseLen);
+        if (*sw != SW_OK) {
+            return true;
+        }
+        if (last) {
+            *lastTiming = timing;
+        } else {
+            *chunksNs += timing.apdu_ns;
+        }
+    }
+    return true;
+}
+
+int replay(const options_t &options) {
+    const std::vector<vector_t> vectors = loadVectors(options.vectors);
+    if (vectors.empty()) {
+        fmt::print(stderr, "no test vectors in {}\n", options.vectors);
+        return EXIT_FAILURE;
+    }
+
+    samples_t chunks = {"chunks", {}};
+    samples_t parse = {"parse", {}};
+    samples_t review = {"review", {}};
+    samples_t sign = {"sign", {}};
+    samples_t total = {"total", {}};
+    size_t signedCount = 0;
+    size_t rejectedCount = 0;
+    size_t unexpectedCount = 0;
+
+    for (uint32_t iteration = 0; iteration < options.iterations; iteration++) {
+        for (const auto &vector : vectors) {
+            // Every transaction starts from a clean device, as the tests do
+            if (emulator_init(options.mnemonic.empty() ? nullptr : options.mnemonic.c_str(), options.expert) != zxerr_ok) {
+                fmt::print(stderr, "emulator init failed\n");
+                return EXIT_FAILURE;
+            }
+
+            uint64_t chunksNs = 0;
+            emulator_timing_t timing = {};
+            uint16_t sw = 0;
+            if (!signBlob(vector, &chunksNs, &timing, &sw)) {
+                fmt::print(stderr, "{} {}: emulator error\n", vector.index, vector.name);
+                return EXIT_FAILURE;
+            }
+            if (sw != SW_OK || !timing.reviewed) {
+                const bool unexpected = vector.expected[options.expert ? 1 : 0];
+                if (iteration == 0) {
+                    fmt::print("{} {}: rejected with 0x{:04X}{}\n", vector.index, vector.name, sw,
+                               unexpected ? ", expected to sign" : "");
+                }
+                rejectedCount++;
+                unexpectedCount += unexpected ? 1 : 0;
+                continue;
+            }
+
+            signedCount++;
+            chunks.values.push_back(toMicros(chunksNs));
+            parse.values.push_back(toMicros(timing.apdu_ns));
+            review.values.push_back(toMicros(timing.review_ns));
+            sign.values.push_back(toMicros(timing.approve_ns));
+            total.values.push_back(toMicros(chunksNs + timing.apdu_ns + timing.review_ns + timing.approve_ns));
+        }
+    }
+
+    fmt::print("\n{} vectors x {} iterations: {} signed, {} rejected ({} mode)\n",
+               vectors.size(), options.iterations, signedCount, rejectedCount, options.expert ? "expert" : "normal");
+    fmt::print("{:<8} {:>12} {:>12} {:>12}\n", "phase", "p50 [us]", "p90 [us]", "p99 [us]");
+    for (const samples_t *samples : {&chunks, &parse, &review, &sign, &total}) {
+        fmt::print("{:<8} {:>12.1f} {:>12.1f} {:>12.1f}\n", samples->name,
+                   percentile(samples->values, 0.50), percentile(samples->values, 0.90),
+                   percentile(samples->values, 0.99));
+    }
+
+    if (options.strict && unexpectedCount > 0) {
+        fmt::print(stderr, "{} rejections of vectors the UI tests expect to parse\n", unexpectedCount);
+        return EXIT_FAILURE;
+    }
+    return signedCount > 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// serve
+
+bool readAll(int fd, uint8_t *buffer, size_t len) {
+    while (len > 0) {
+        const ssize_t n = read(fd, buffer, len);
+        if (n <= 0) {
+            return false;
+        }
+        buffer += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool writeAll(int fd, const uint8_t *buffer, size_t len) {
+    while (len > 0) {
+        const ssize_t n = write(fd, buffer, len);
+        if (n <= 0) {
+            return false;
+        }
+        buffer += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// Speculos framing: requests are a big endian u32 length and the APDU,
+// replies a big endian u32 length of the data followed by the data and the status word
+void serveClient(int fd, const options_t &options) {
+    uint8_t header[4];
+    uint8_t command[EMULATOR_APDU_MAX_LEN];
+    uint8_t response[EMULATOR_APDU_MAX_LEN];
+
+    while (readAll(fd, header, sizeof(header))) {
+        const uint32_t commandLen = (static_cast<uint32_t>(header[0]) << 24) | (static_cast<uint32_t>(header[1]) << 16) |
+                                    (static_cast<uint32_t>(header[2]) << 8) | header[3];
+        if (commandLen == 0 || commandLen > sizeof(command) || !readAll(fd, command, commandLen)) {
+            return;
+        }
+
+        uint16_t responseLen = 0;
+        emulator_timing_t timing = {};
+        if (emulator_exchange(command, static_cast<uint16_t>(commandLen), response, sizeof(response),
+                              &responseLen, &timing) != zxerr_ok || responseLen < 2) {
+            // Same answer the device gives when something unexpected happens
+            response[0] = APDU_CODE_UNKNOWN >> 8;
+            response[1] = APDU_CODE_UNKNOWN & 0xFF;
+            responseLen = 2;
+        }
+
+        if (options.timings) {
+            fmt::print("INS 0x{:02X} P1 0x{:02X} -> 0x{:04X} | apdu {:.1f} us", command[OFFSET_INS], command[OFFSET_P1],
+                       statusWord(response, responseLen), toMicros(timing.apdu_ns));
+            if (timing.reviewed) {
+                fmt::print(" | review {:.1f} us | approve {:.1f} us", toMicros(timing.review_ns), toMicros(timing.approve_ns));
+            }
+            fmt::print("\n");
+        }
+
+        const uint32_t dataLen = responseLen - 2;
+        const uint8_t lenBytes[4] = {static_cast<uint8_t>(dataLen >> 24), static_cast<uint8_t>(dataLen >> 16),
+                                     static_cast<uint8_t>(dataLen >> 8), static_cast<uint8_t>(dataLen)};
+        if (!writeAll(fd, lenBytes, sizeof(lenBytes)) || !writeAll(fd, response, responseLen)) {
+            return;
+        }
+    }
+}
+
+int serve(const options_t &options) {
+    if (emulator_init(options.mnemonic.empty() ? nullptr : options.mnemonic.c_str(), options.expert) != zxerr_ok) {
+        fmt::print(stderr, "emulator init failed\n");
+        return EXIT_FAILURE;
+    }
+
+    const int server = socket(AF_INET, SOCK_STREAM, 0);
+    if (server < 0) {
+        perror("socket");
+        return EXIT_FAILURE;
+    }
+    const int reuse = 1;
+    setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(options.port);
+    if (bind(server, reinterpret_cast<sockaddr *>(&addr), sizeof(addr)) != 0 || listen(server, 1) != 0) {
+        perror("bind");
+        close(server);
+        return EXIT_FAILURE;
+    }
+    fmt::print("namada emulator listening on 127.0.0.1:{}\n", options.port);
+
+    // One client at a time, like a device on a single USB port
+    for (;;) {
+        const int client = accept(server, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+        serveClient(client, options);
+        close(client);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    options_t options;
+    if (!parseOptions(argc, argv, &options)) {
+        usage();
+        return EXIT_FAILURE;
+    }
+
+    return options.command == "serve" ? serve(options) : replay(options);
+}
@@ -0,0 +1,222 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#include "namada_emulator.h"
+
+#include <string.h>
+#include <time.h>
+
+#include <os.h>
+#include <os_io_seproxyhal.h>
+
+#include "actions.h"
+#include "app_main.h"
+#include "app_mode.h"
+#include "crypto.h"
+#include "emulator_sdk.h"
+#include "nvdata.h"
+#include "view.h"
+#include "zxmacros.h"
+
+// Same line widths as the UI tests
+#define EMULATOR_REVIEW_KEY_LEN 40
+#define EMULATOR_REVIEW_VALUE_LEN 40
+
+uint8_t G_io_apdu_buffer[IO_APDU_BUFFER_SIZE];
+
+typedef struct {
+    viewfunc_getItem_t getItem;
+    viewfunc_getNumItems_t getNumItems;
+    viewfunc_accept_t accept;
+    bool pending;
+} emulator_review_t;
+
+static emulator_review_t review;
+
+static uint16_t asyncReplyLen = 0;
+static bool asyncReplied = false;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// SDK and view hooks
+
+// Only replies sent after an approval go through here, the rest are returned by handleApdu
+unsigned short io_exchange(__Z_UNUSED unsigned char channel_and_flags, unsigned short tx_len) {
+    asyncReplyLen = tx_len;
+    asyncReplied = true;
+    return 0;
+}
+
+void io_seproxyhal_io_heartbeat(void) {}
+
+void view_init() {}
+
+void view_idle_show(__Z_UNUSED uint8_t item_idx, __Z_UNUSED const char *statusString) {}
+
+void view_review_init(viewfunc_getItem_t viewfuncGetItem,
+                      viewfunc_getNumItems_t viewfuncGetNumItems,
+                      viewfunc_accept_t viewfuncAccept) {
+    review.getItem = viewfuncGetItem;
+    review.getNumItems = viewfuncGetNumItems;
+    review.accept = viewfuncAccept;
+    review.pending = false;
+}
+
+void view_review_show(__Z_UNUSED review_type_e reviewKind) {
+    review.pending = true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Renders every page the user would scroll through before approving
+static zxerr_t review_walk(void) {
+    if (review.getItem == NULL || review.getNumItems == NULL || review.accept == NULL) {
+        return zxerr_no_data;
+    }
+
+    uint8_t numItems = 0;
+    CHECK_ZXERR(review.getNumItems(&numItems))
+
+    char key[EMULATOR_REVIEW_KEY_LEN];
+    char value[EMULATOR_REVIEW_VALUE_LEN];
+    for (uint8_t idx = 0; idx < numItems; idx++) {
+        uint8_t pageCount = 1;
+        for (uint8_t pageIdx = 0; pageIdx < pageCount; pageIdx++) {
+            CHECK_ZXERR(review.getItem((int8_t) idx, key, sizeof(key), value, sizeof(value), pageIdx, &pageCount))
+        }
+    }
+    return zxerr_ok;
+}
+
+static zxerr_t run_apdu(uint16_t rx, volatile uint32_t *flags, volatile uint32_t *tx) {
+    volatile zxerr_t err = zxerr_ok;
+    BEGIN_TRY
+    {
+        TRY
+        {
+            handleApdu(flags, tx, rx);
+        }
+        CATCH_OTHER(e)
+        {
+            // handleApdu answers everything but EXCEPTION_IO_RESET
+            (void) e;
+            err = zxerr_unknown;
+        }
+        FINALLY
+        {}
+    }
+    END_TRY;
+    return err;
+}
+
+static zxerr_t run_approval(bool approve) {
+    volatile zxerr_t err = zxerr_ok;
+    BEGIN_TRY
+    {
+        TRY
+        {
+            if (approve) {
+                review.accept();
+            } else {
+                app_reject();
+            }
+        }
+        CATCH_OTHER(e)
+        {
+            (void) e;
+            err = zxerr_unknown;
+        }
+        FINALLY
+        {}
+    }
+    END_TRY;
+    return err;
+}
+
+zxerr_t emulator_init(const char *mnemonic, bool expert) {
+    CHECK_ZXERR(emulator_sdk_set_mnemonic(mnemonic))
+    emulator_sdk_reset_rng(0);
+    app_mode_set_expert(expert ? 1 : 0);
+
+    MEMZERO(G_io_apdu_buffer, sizeof(G_io_apdu_buffer));
+    MEMZERO(&review, sizeof(review));
+    transaction_reset();
+#if defined(COMPILE_MASP)
+    crypto_clearKeysCache();
+#endif
+    return zxerr_ok;
+}
+
+zxerr_t emulator_exchange(const uint8_t *command, uint16_t commandLen,
+                          uint8_t *response, uint16_t responseSize, uint16_t *responseLen,
+                          emulator_timing_t *timing) {
+    if (command == NULL || response == NULL || responseLen == NULL ||
+        commandLen == 0 || commandLen > sizeof(G_io_apdu_buffer)) {
+        return zxerr_out_of_bounds;
+    }
+
+    emulator_timing_t phases = {0};
+    *responseLen = 0;
+    review.pending = false;
+    asyncReplied = false;
+
+    MEMZERO(G_io_apdu_buffer, sizeof(G_io_apdu_buffer));
+    MEMCPY(G_io_apdu_buffer, command, commandLen);
+
+    volatile uint32_t flags = 0;
+    volatile uint32_t tx = 0;
+    uint64_t start = now_ns();
+    CHECK_ZXERR(run_apdu(commandLen, &flags, &tx))
+    phases.apdu_ns = now_ns() - start;
+
+    uint32_t replyLen = tx;
+    if ((flags & IO_ASYNCH_REPLY) != 0) {
+        if (!review.pending) {
+            return zxerr_unknown;
+        }
+        review.pending = false;
+        phases.reviewed = true;
+
+        start = now_ns();
+        const zxerr_t reviewErr = review_walk();
+        phases.review_ns = now_ns() - start;
+
+        // A page that cannot be rendered is rejected, as a user would do
+        start = now_ns();
+        CHECK_ZXERR(run_approval(reviewErr == zxerr_ok))
+        phases.approve_ns = now_ns() - start;
+
+        if (!asyncReplied) {
+            return zxerr_unknown;
+        }
+        replyLen = asyncReplyLen;
+    }
+
+    if (replyLen > sizeof(G_io_apdu_buffer) || replyLen > responseSize) {
+        return zxerr_buffer_too_small;
+    }
+    MEMCPY(response, G_io_apdu_buffer, replyLen);
+    *responseLen = (uint16_t) replyLen;
+
+    if (timing != NULL) {
+        *timing = phases;
+    }
+    return zxerr_ok;
+}
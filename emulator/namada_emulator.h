@@ -0,0 +1,57 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "zxerror.h"
+
+// Command plus response including the status word, as seen on the wire
+#define EMULATOR_APDU_MAX_LEN 260
+
+/// Time spent in each phase of a single exchange, in nanoseconds
+typedef struct {
+    /// handleApdu, including chunk buffering and parsing of the last chunk
+    uint64_t apdu_ns;
+    /// Walking every item and page of the review, zero when there is no review
+    uint64_t review_ns;
+    /// Approval callback, e.g. signing and building the reply
+    uint64_t approve_ns;
+    /// The command opened a review that was auto-approved
+    bool reviewed;
+} emulator_timing_t;
+
+/// Resets the emulated device
+/// \param mnemonic BIP39 mnemonic for the device seed, NULL selects the Zemu test mnemonic
+/// \param expert enables expert mode for the reviews
+zxerr_t emulator_init(const char *mnemonic, bool expert);
+
+/// Runs one APDU through the app, approving any review it opens
+/// \param command raw APDU
+/// \param response receives the response data followed by the status word
+/// \param timing optional, filled with the time spent in each phase
+zxerr_t emulator_exchange(const uint8_t *command, uint16_t commandLen,
+                          uint8_t *response, uint16_t responseSize, uint16_t *responseLen,
+                          emulator_timing_t *timing);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,97 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#pragma once
+
+// Host stand-in for the cryptography API of the Ledger SDK, backed by OpenSSL in emulator_sdk.c
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t cx_err_t;
+#define CX_OK 0x00000000
+#define CX_INTERNAL_ERROR 0xFFFFFF85
+#define CX_INVALID_PARAMETER 0xFFFFFF84
+
+typedef enum {
+    CX_CURVE_NONE = 0,
+    CX_CURVE_Ed25519 = 0x41,
+} cx_curve_t;
+
+typedef enum {
+    CX_NONE = 0,
+    CX_SHA256 = 3,
+    CX_SHA512 = 5,
+} cx_md_t;
+
+#define CX_LAST 1
+
+#ifndef CX_SHA256_SIZE
+#define CX_SHA256_SIZE 32
+#endif
+
+typedef struct {
+    cx_curve_t curve;
+    size_t d_len;
+    uint8_t d[64];
+} cx_ecfp_private_key_t;
+
+// W is the uncompressed point 04 || x || y, both big endian
+typedef struct {
+    cx_curve_t curve;
+    size_t W_len;
+    uint8_t W[65];
+} cx_ecfp_public_key_t;
+
+cx_err_t cx_ecfp_init_private_key_no_throw(cx_curve_t curve, const uint8_t *rawkey, size_t key_len, cx_ecfp_private_key_t *pvkey);
+cx_err_t cx_ecfp_init_public_key_no_throw(cx_curve_t curve, const uint8_t *rawkey, size_t key_len, cx_ecfp_public_key_t *pukey);
+cx_err_t cx_ecfp_generate_pair_no_throw(cx_curve_t curve, cx_ecfp_public_key_t *pubkey, cx_ecfp_private_key_t *privkey, bool keepprivate);
+cx_err_t cx_eddsa_sign_no_throw(const cx_ecfp_private_key_t *pvkey, cx_md_t hashID, const uint8_t *hash, size_t hash_len, uint8_t *sig, size_t sig_len);
+
+// Random numbers come from a deterministic generator so emulator runs can be replayed
+void cx_rng_no_throw(uint8_t *buffer, size_t len);
+uint8_t *cx_rng(uint8_t *buffer, size_t len);
+void cx_trng_get_random_data(uint8_t *buffer, size_t len);
+
+#ifndef CHECK_CX_OK
+#define CHECK_CX_OK(CALL)               \
+    do {                                \
+        cx_err_t __cx_err = CALL;       \
+        if (__cx_err != CX_OK) {        \
+            return zxerr_unknown;       \
+        }                               \
+    } while (0)
+#endif
+
+#ifndef CATCH_CXERROR
+#define CATCH_CXERROR(CALL)             \
+    do {                                \
+        cx_err_t __cx_err = CALL;       \
+        if (__cx_err != CX_OK) {        \
+            goto catch_cx_error;        \
+        }                               \
+    } while (0)
+#endif
+
+#include "cx_sha256.h"
+
+#ifdef __cplusplus
+}
+#endif
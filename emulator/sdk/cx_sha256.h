@@ -0,0 +1,39 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cx.h"
+
+// Large enough for the picohash context it wraps, checked in emulator_sdk.c
+typedef struct {
+    uint64_t state[64];
+} cx_sha256_t;
+
+int cx_sha256_init(cx_sha256_t *hash);
+cx_err_t cx_sha256_update(cx_sha256_t *ctx, const uint8_t *data, size_t len);
+cx_err_t cx_sha256_final(cx_sha256_t *ctx, uint8_t *digest);
+size_t cx_hash_sha256(const uint8_t *in, size_t len, uint8_t *out, size_t out_len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,137 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#pragma once
+
+// Host stand-in for the parts of the Ledger SDK os.h used by the app.
+// Only what apdu_handler.c, crypto.c, nvdata.c and common/tx.c need is provided.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <setjmp.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cx.h"
+#include "zxmacros.h"
+
+#ifndef TARGET_ID
+#define TARGET_ID 0x33000004  // Nano X
+#endif
+
+// Non volatile memory lives in RAM on the host, zxmacros.h may already provide these
+#ifndef NV_CONST
+#define NV_CONST
+#endif
+#ifndef NV_VOLATILE
+#define NV_VOLATILE volatile
+#endif
+#ifndef MEMCPY_NV
+#define MEMCPY_NV(dst, src, size) memcpy((void *) (dst), (const void *) (src), (size))
+#endif
+#ifndef PIC
+#define PIC(x) (x)
+#endif
+
+// Exceptions, same control flow as the SDK TRY/CATCH macros
+typedef uint16_t exception_t;
+
+typedef struct try_context_s {
+    jmp_buf jmp_buf;
+    struct try_context_s *previous;
+    exception_t ex;
+} try_context_t;
+
+try_context_t *try_context_get(void);
+try_context_t *try_context_set(try_context_t *context);
+void os_longjmp(exception_t exception) __attribute__((noreturn));
+
+#define EXCEPTION 1
+#define EXCEPTION_IO_RESET 0x10
+
+#define THROW(x) os_longjmp(x)
+
+#define BEGIN_TRY \
+    {             \
+        try_context_t __try_context;
+
+#define TRY                                                  \
+    __try_context.previous = try_context_get();              \
+    __try_context.ex = (exception_t) setjmp(__try_context.jmp_buf); \
+    if (__try_context.ex == 0) {                             \
+        try_context_set(&__try_context);
+
+#define CATCH(x)                              \
+        goto __finally;                       \
+    }                                         \
+    else if (__try_context.ex == (x)) {       \
+        __try_context.ex = 0;                 \
+        try_context_set(__try_context.previous);
+
+#define CATCH_OTHER(e)                        \
+        goto __finally;                       \
+    }                                         \
+    else {                                    \
+        exception_t e = __try_context.ex;     \
+        __try_context.ex = 0;                 \
+        try_context_set(__try_context.previous);
+
+#define FINALLY                                      \
+        goto __finally;                              \
+    }                                                \
+    __finally:                                       \
+    if (try_context_get() == &__try_context) {       \
+        try_context_set(__try_context.previous);     \
+    }
+
+#define END_TRY                                  \
+        if (__try_context.ex != 0) {             \
+            THROW(__try_context.ex);             \
+        }                                        \
+    }
+
+// PIN is always validated on the emulator
+#define BOLOS_UX_OK 0xB0105011
+unsigned int os_global_pin_is_validated(void);
+
+#ifndef CHECK_PIN_VALIDATED
+#define CHECK_PIN_VALIDATED()                                       \
+    {                                                               \
+        if (os_global_pin_is_validated() != BOLOS_UX_OK) {          \
+            THROW(APDU_CODE_COMMAND_NOT_ALLOWED);                   \
+        }                                                           \
+    }
+#endif
+
+// Key derivation from the emulator seed, see emulator_sdk.c
+#define HDW_NORMAL 0
+#define HDW_ED25519_SLIP10 1
+
+cx_err_t os_derive_bip32_with_seed_no_throw(unsigned int derivation_mode,
+                                            cx_curve_t curve,
+                                            const uint32_t *path,
+                                            size_t path_len,
+                                            uint8_t raw_privkey[64],
+                                            uint8_t *chain_code,
+                                            unsigned char *seed_key,
+                                            size_t seed_key_len);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,39 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#include "os.h"
+
+#define IO_APDU_BUFFER_SIZE (5 + 255)
+#define IO_ASYNCH_REPLY 0x10
+#define IO_RETURN_AFTER_TX 0x20
+#define CHANNEL_APDU 0
+
+extern uint8_t G_io_apdu_buffer[IO_APDU_BUFFER_SIZE];
+
+// Replies sent outside of handleApdu, e.g. after an approved review, are captured by the emulator
+unsigned short io_exchange(unsigned char channel_and_flags, unsigned short tx_len);
+void io_seproxyhal_io_heartbeat(void);
+
+#ifdef __cplusplus
+}
+#endif
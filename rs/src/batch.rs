@@ -0,0 +1,584 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+//! Signing sessions for batches of wrapper transactions
+
+use std::collections::HashMap;
+use std::sync::mpsc;
+use std::thread;
+use std::time::{Duration, Instant};
+
+use ledger_transport::{APDUAnswer, APDUCommand, APDUErrorCode, Exchange};
+use ledger_zondax_generic::{ChunkPayloadType, LedgerAppError};
+
+use crate::params::{InstructionCode, CLA, PK_LEN_PLUS_TAG, USER_MESSAGE_CHUNK_SIZE};
+use crate::utils::{BIP44Path, ResponseSignature};
+use crate::{check_signature, parse_signature, NamError, NamadaApp};
+
+/// Transaction to be signed as part of a batch
+pub struct BatchTransaction<'a> {
+    /// Serialized wrapper transaction
+    pub blob: &'a [u8],
+    /// Section hashes used to check the returned signatures, `None` skips the check
+    pub section_hashes: Option<HashMap<usize, Vec<u8>>>,
+}
+
+/// Time spent on one transaction of a batch
+#[derive(Clone, Copy, Debug, Default)]
+pub struct BatchTiming {
+    /// From the first chunk sent to the signatures received, including the review on the device
+    pub device: Duration,
+    /// Signature check, run on a worker thread while the device handles the next transaction
+    pub verify: Option<Duration>,
+}
+
+/// Outcome of one transaction of a batch
+pub struct BatchSignResult<E>
+where
+    E: std::error::Error,
+{
+    /// Position of the transaction in the batch
+    pub index: usize,
+    /// Signatures, or why the device did not return them
+    pub signature: Result<ResponseSignature, NamError<E>>,
+    /// Whether the signatures match the session public key and section hashes, `None` if not checked
+    pub verified: Option<bool>,
+    /// Time spent on the transaction
+    pub timing: BatchTiming,
+}
+
+impl<E: std::error::Error> BatchSignResult<E> {
+    /// Signed and, when section hashes were given, verified
+    pub fn is_ok(&self) -> bool {
+        self.signature.is_ok() && self.verified != Some(false)
+    }
+}
+
+/// Outcome of a whole batch, one result per transaction in the order they were given
+pub struct BatchSignReport<E>
+where
+    E: std::error::Error,
+{
+    /// Per transaction results
+    pub results: Vec<BatchSignResult<E>>,
+    /// Wall time of the batch
+    pub elapsed: Duration,
+}
+
+impl<E: std::error::Error> BatchSignReport<E> {
+    /// Transactions that were rejected, failed or returned signatures that do not verify
+    pub fn failures(&self) -> impl Iterator<Item = &BatchSignResult<E>> {
+        self.results.iter().filter(|result| !result.is_ok())
+    }
+}
+
+/// Signatures handed to the verifier thread
+struct VerifyJob {
+    index: usize,
+    signature: ResponseSignature,
+    section_hashes: Option<HashMap<usize, Vec<u8>>>,
+}
+
+/// Signatures back from the verifier thread
+struct VerifiedJob {
+    index: usize,
+    signature: ResponseSignature,
+    verified: Option<bool>,
+    verify: Option<Duration>,
+}
+
+/// Signs several wrapper transactions with the same key. The path is serialized and the public
+/// key retrieved once for the whole session instead of once per transaction.
+pub struct SignSession<'a, E> {
+    app: &'a NamadaApp<E>,
+    serialized_path: Vec<u8>,
+    pubkey: [u8; PK_LEN_PLUS_TAG],
+}
+
+impl<E> NamadaApp<E>
+where
+    E: Exchange + Send + Sync,
+    E::Error: std::error::Error,
+{
+    /// Open a signing session for `path`
+    pub async fn sign_session(
+        &self,
+        path: &BIP44Path,
+    ) -> Result<SignSession<'_, E>, NamError<E::Error>> {
+        let response_address = self.get_address_and_pubkey(path, false).await?;
+
+        Ok(SignSession {
+            app: self,
+            serialized_path: path.serialize_path().unwrap(),
+            pubkey: response_address.public_key,
+        })
+    }
+
+    /// Sign several wrapper transactions with the key at `path`, see [`SignSession::sign_batch`]
+    pub async fn sign_batch(
+        &self,
+        path: &BIP44Path,
+        transactions: &[BatchTransaction<'_>],
+    ) -> Result<BatchSignReport<E::Error>, NamError<E::Error>> {
+        let session = self.sign_session(path).await?;
+        Ok(session.sign_batch(transactions).await)
+    }
+}
+
+impl<'a, E> SignSession<'a, E>
+where
+    E: Exchange + Send + Sync,
+    E::Error: std::error::Error,
+{
+    /// Public key of the session, tag included
+    pub fn pubkey(&self) -> &[u8; PK_LEN_PLUS_TAG] {
+        &self.pubkey
+    }
+
+    /// Split a transaction in the APDUs that carry it. Chunks borrow the blob and the session
+    /// path, nothing is copied.
+    fn prepare_chunks<'b>(
+        &'b self,
+        blob: &'b [u8],
+    ) -> Result<Vec<APDUCommand<&'b [u8]>>, LedgerAppError<E::Error>> {
+        let chunks = blob.chunks(USER_MESSAGE_CHUNK_SIZE);
+        match chunks.len() {
+            0 => return Err(LedgerAppError::InvalidEmptyMessage),
+            n if n > 255 => return Err(LedgerAppError::InvalidMessageSize),
+            _ => (),
+        }
+
+        let last_chunk_index = chunks.len() - 1;
+        let mut commands = Vec::with_capacity(chunks.len() + 1);
+        commands.push(APDUCommand {
+            cla: CLA,
+            ins: InstructionCode::Sign as _,
+            p1: ChunkPayloadType::Init as u8,
+            p2: 0x00,
+            data: self.serialized_path.as_slice(),
+        });
+        for (packet_idx, chunk) in chunks.enumerate() {
+            let p1 = if packet_idx == last_chunk_index {
+                ChunkPayloadType::Last
+            } else {
+                ChunkPayloadType::Add
+            };
+            commands.push(APDUCommand {
+                cla: CLA,
+                ins: InstructionCode::Sign as _,
+                p1: p1 as u8,
+                p2: 0x00,
+                data: chunk,
+            });
+        }
+        Ok(commands)
+    }
+
+    async fn send_chunks(
+        &self,
+        commands: &[APDUCommand<&[u8]>],
+    ) -> Result<APDUAnswer<E::AnswerType>, NamError<E::Error>> {
+        let mut last_response = None;
+        for command in commands {
+            let response = self
+                .app
+                .apdu_transport
+                .exchange(command)
+                .await
+                .map_err(LedgerAppError::TransportError)?;
+
+            match response.error_code() {
+                Ok(APDUErrorCode::NoError) => {}
+                Ok(err) => {
+                    return Err(NamError::Ledger(LedgerAppError::AppSpecific(
+                        err as _,
+                        err.description(),
+                    )))
+                }
+                Err(err) => {
+                    return Err(NamError::Ledger(LedgerAppError::AppSpecific(
+                        err,
+                        "[APDU_ERROR] Unknown".to_string(),
+                    )))
+                }
+            }
+            last_response = Some(response);
+        }
+
+        last_response.ok_or(NamError::Ledger(LedgerAppError::InvalidEmptyMessage))
+    }
+
+    /// Sign one wrapper transaction
+    pub async fn sign(&self, blob: &[u8]) -> Result<ResponseSignature, NamError<E::Error>> {
+        let commands = self.prepare_chunks(blob)?;
+        let response = self.send_chunks(&commands).await?;
+
+        // Transactions is signed - Retrieve signatures
+        parse_signature(response.apdu_data())
+    }
+
+    /// Sign several wrapper transactions, one after the other.
+    ///
+    /// Signatures are checked on a worker thread while the device handles the next transaction.
+    /// A transaction that fails or is rejected on the device is reported in its result and the
+    /// batch moves on to the next one.
+    pub async fn sign_batch(
+        &self,
+        transactions: &[BatchTransaction<'_>],
+    ) -> BatchSignReport<E::Error> {
+        let batch_start = Instant::now();
+
+        let pubkey = self.pubkey;
+        let (jobs, pending) = mpsc::channel::<VerifyJob>();
+        let verifier = thread::spawn(move || {
+            pending
+                .into_iter()
+                .map(|job| match job.section_hashes {
+                    Some(section_hashes) => {
+                        let start = Instant::now();
+                        let verified = check_signature(&job.signature, &section_hashes, &pubkey);
+                        VerifiedJob {
+                            index: job.index,
+                            signature: job.signature,
+                            verified: Some(verified),
+                            verify: Some(start.elapsed()),
+                        }
+                    }
+                    None => VerifiedJob {
+                        index: job.index,
+                        signature: job.signature,
+                        verified: None,
+                        verify: None,
+                    },
+                })
+                .collect::<Vec<_>>()
+        });
+
+        let mut results: Vec<Option<BatchSignResult<E::Error>>> =
+            transactions.iter().map(|_| None).collect();
+        let mut device_times = vec![Duration::default(); transactions.len()];
+
+        for (index, transaction) in transactions.iter().enumerate() {
+            let start = Instant::now();
+            let signature = self.sign(transaction.blob).await;
+            device_times[index] = start.elapsed();
+
+            match signature {
+                Ok(signature) => {
+                    // The verifier only stops once `jobs` is dropped
+                    let _ = jobs.send(VerifyJob {
+                        index,
+                        signature,
+                        section_hashes: transaction.section_hashes.clone(),
+                    });
+                }
+                Err(err) => {
+                    results[index] = Some(BatchSignResult {
+                        index,
+                        signature: Err(err),
+                        verified: None,
+                        timing: BatchTiming {
+                            device: device_times[index],
+                            verify: None,
+                        },
+                    });
+                }
+            }
+        }
+        drop(jobs);
+
+        for job in verifier.join().expect("signature verifier panicked") {
+            results[job.index] = Some(BatchSignResult {
+                index: job.index,
+                signature: Ok(job.signature),
+                verified: job.verified,
+                timing: BatchTiming {
+                    device: device_times[job.index],
+                    verify: job.verify,
+                },
+            });
+        }
+
+        BatchSignReport {
+            results: results
+                .into_iter()
+                .map(|result| result.expect("every transaction has a result"))
+                .collect(),
+            elapsed: batch_start.elapsed(),
+        }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::params::{ADDRESS_LEN, SALT_LEN, SIG_LEN_PLUS_TAG};
+    use crate::signature_section_digest;
+    use ed25519_dalek::{Signer, SigningKey};
+    use ledger_transport::async_trait;
+    use std::collections::HashSet;
+    use std::ops::Deref;
+    use std::sync::Mutex;
+
+    #[derive(Debug, thiserror::Error)]
+    #[error("fake device error")]
+    struct FakeDeviceError;
+
+    /// Signs like the app does, rejecting, corrupting or cutting short (keeping the given number
+    /// of bytes of) the answers to the transactions it is told to
+    struct FakeDevice {
+        key: SigningKey,
+        section_hashes: HashMap<usize, Vec<u8>>,
+        reject: HashSet<usize>,
+        corrupt: HashSet<usize>,
+        truncate: HashMap<usize, usize>,
+        state: Mutex<FakeDeviceState>,
+    }
+
+    #[derive(Default)]
+    struct FakeDeviceState {
+        address_requests: usize,
+        signed: usize,
+        blob: Vec<u8>,
+        commands: Vec<(u8, u8, Vec<u8>)>,
+    }
+
+    impl FakeDevice {
+        fn pubkey(&self) -> Vec<u8> {
+            let mut pubkey = vec![0x00];
+            pubkey.extend_from_slice(self.key.verifying_key().as_bytes());
+            pubkey
+        }
+
+        fn address_answer(&self) -> Vec<u8> {
+            let pubkey = self.pubkey();
+            let mut answer = pubkey.clone();
+            answer.push(pubkey.len() as u8);
+            answer.extend_from_slice(&pubkey);
+            answer.push(ADDRESS_LEN as u8);
+            answer.extend_from_slice(&[b'a'; ADDRESS_LEN]);
+            answer
+        }
+
+        fn signature_answer(&self, corrupt: bool) -> Vec<u8> {
+            let pubkey = self.pubkey();
+            let raw_indices = vec![0u8, 1, 2];
+            let wrapper_indices = vec![0u8, 1, 2, 3];
+
+            let raw_hash =
+                signature_section_digest(&[], &self.section_hashes, &raw_indices, None, None);
+            let mut raw_signature = vec![0x00];
+            raw_signature.extend_from_slice(&self.key.sign(&raw_hash).to_bytes());
+
+            let mut hashes = self.section_hashes.clone();
+            hashes.insert(
+                hashes.len() - 1,
+                signature_section_digest(
+                    &[&pubkey[..]],
+                    &self.section_hashes,
+                    &raw_indices,
+                    Some(&raw_signature[..]),
+                    Some(&[0x03u8][..]),
+                )
+                .to_vec(),
+            );
+            let wrapper_hash = signature_section_digest(&[], &hashes, &wrapper_indices, None, None);
+            let mut wrapper_signature = vec![0x00];
+            wrapper_signature.extend_from_slice(&self.key.sign(&wrapper_hash).to_bytes());
+            if corrupt {
+                wrapper_signature[1] ^= 0x01;
+            }
+
+            let mut answer = pubkey;
+            answer.extend_from_slice(&[0x11; 8]);
+            answer.extend_from_slice(&raw_signature);
+            answer.extend_from_slice(&[0x22; 8]);
+            answer.extend_from_slice(&wrapper_signature);
+            answer.push(raw_indices.len() as u8);
+            answer.extend_from_slice(&raw_indices);
+            answer.push(wrapper_indices.len() as u8);
+            answer.extend_from_slice(&wrapper_indices);
+            answer
+        }
+    }
+
+    #[async_trait]
+    impl Exchange for FakeDevice {
+        type Error = FakeDeviceError;
+        type AnswerType = Vec<u8>;
+
+        async fn exchange<I>(
+            &self,
+            command: &APDUCommand<I>,
+        ) -> Result<APDUAnswer<Self::AnswerType>, Self::Error>
+        where
+            I: Deref<Target = [u8]> + Send + Sync,
+        {
+            let mut state = self.state.lock().unwrap();
+            state
+                .commands
+                .push((command.ins, command.p1, command.data.to_vec()));
+
+            let mut answer = match command.ins {
+                ins if ins == InstructionCode::GetAddressAndPubkey as u8 => {
+                    state.address_requests += 1;
+                    self.address_answer()
+                }
+                ins if ins == InstructionCode::Sign as u8 => match command.p1 {
+                    0x00 => {
+                        state.blob.clear();
+                        vec![]
+                    }
+                    0x01 => {
+                        state.blob.extend_from_slice(&command.data);
+                        vec![]
+                    }
+                    _ => {
+                        state.blob.extend_from_slice(&command.data);
+                        let index = state.signed;
+                        state.signed += 1;
+                        if self.reject.contains(&index) {
+                            return APDUAnswer::from_answer(vec![0x69, 0x86])
+                                .map_err(|_| FakeDeviceError);
+                        }
+                        let mut answer = self.signature_answer(self.corrupt.contains(&index));
+                        if let Some(len) = self.truncate.get(&index) {
+                            answer.truncate(*len);
+                        }
+                        answer
+                    }
+                },
+                _ => return APDUAnswer::from_answer(vec![0x6d, 0x00]).map_err(|_| FakeDeviceError),
+            };
+            answer.extend_from_slice(&[0x90, 0x00]);
+            APDUAnswer::from_answer(answer).map_err(|_| FakeDeviceError)
+        }
+    }
+
+    fn section_hashes() -> HashMap<usize, Vec<u8>> {
+        let mut hashes = HashMap::new();
+        for (index, byte) in [(0usize, 0x10u8), (1, 0x11), (2, 0x12), (0xff, 0xff)] {
+            hashes.insert(index, vec![byte; 32]);
+        }
+        hashes
+    }
+
+    #[tokio::test]
+    async fn sign_batch_reports_each_transaction() {
+        let app = NamadaApp::new(FakeDevice {
+            key: SigningKey::from_bytes(&[7u8; 32]),
+            section_hashes: section_hashes(),
+            reject: vec![1].into_iter().collect(),
+            corrupt: vec![2].into_iter().collect(),
+            truncate: HashMap::new(),
+            state: Mutex::new(FakeDeviceState::default()),
+        });
+        let path = BIP44Path {
+            path: "m/44'/877'/0'/0'/0'".to_string(),
+        };
+
+        let blob = vec![0xabu8; 2 * USER_MESSAGE_CHUNK_SIZE + 10];
+        let transactions: Vec<BatchTransaction> = (0..4)
+            .map(|index| BatchTransaction {
+                blob: &blob,
+                section_hashes: if index == 3 {
+                    None
+                } else {
+                    Some(section_hashes())
+                },
+            })
+            .collect();
+
+        let report = app.sign_batch(&path, &transactions).await.unwrap();
+        assert_eq!(report.results.len(), 4);
+
+        assert_eq!(report.results[0].verified, Some(true));
+        assert!(report.results[0].timing.verify.is_some());
+        assert!(report.results[1].signature.is_err());
+        assert_eq!(report.results[1].verified, None);
+        assert!(report.results[2].signature.is_ok());
+        assert_eq!(report.results[2].verified, Some(false));
+        assert!(report.results[3].signature.is_ok());
+        assert_eq!(report.results[3].verified, None);
+
+        let failures: Vec<usize> = report.failures().map(|result| result.index).collect();
+        assert_eq!(failures, vec![1, 2]);
+
+        // Public key retrieved once, path sent in every init chunk and the blob in three chunks
+        let state = app.apdu_transport.state.lock().unwrap();
+        assert_eq!(state.address_requests, 1);
+        let serialized_path = path.serialize_path().unwrap();
+        let sign_commands: Vec<_> = state
+            .commands
+            .iter()
+            .filter(|(ins, _, _)| *ins == InstructionCode::Sign as u8)
+            .collect();
+        assert_eq!(sign_commands.len(), 4 * 4);
+        for tx_commands in sign_commands.chunks(4) {
+            assert_eq!(tx_commands[0].1, ChunkPayloadType::Init as u8);
+            assert_eq!(tx_commands[0].2, serialized_path);
+            assert_eq!(tx_commands[1].1, ChunkPayloadType::Add as u8);
+            assert_eq!(tx_commands[2].1, ChunkPayloadType::Add as u8);
+            assert_eq!(tx_commands[3].1, ChunkPayloadType::Last as u8);
+        }
+        assert_eq!(state.blob, blob);
+    }
+
+    #[tokio::test]
+    async fn short_sign_answer_is_an_error() {
+        let device = FakeDevice {
+            key: SigningKey::from_bytes(&[7u8; 32]),
+            section_hashes: section_hashes(),
+            reject: HashSet::new(),
+            corrupt: HashSet::new(),
+            truncate: HashMap::new(),
+            state: Mutex::new(FakeDeviceState::default()),
+        };
+        let full_len = device.signature_answer(false).len();
+        // Empty, inside the public key, inside the wrapper signature, inside the index lists
+        let cuts = [
+            0,
+            10,
+            PK_LEN_PLUS_TAG + 2 * SALT_LEN + SIG_LEN_PLUS_TAG + 20,
+            full_len - 5,
+            full_len - 1,
+        ];
+        let app = NamadaApp::new(FakeDevice {
+            truncate: cuts.iter().copied().enumerate().collect(),
+            ..device
+        });
+        let path = BIP44Path {
+            path: "m/44'/877'/0'/0'/0'".to_string(),
+        };
+
+        let blob = vec![0xabu8; 10];
+        let transactions: Vec<BatchTransaction> = (0..cuts.len() + 1)
+            .map(|_| BatchTransaction {
+                blob: &blob,
+                section_hashes: Some(section_hashes()),
+            })
+            .collect();
+
+        let report = app.sign_batch(&path, &transactions).await.unwrap();
+        for result in &report.results[..cuts.len()] {
+            assert!(matches!(
+                result.signature,
+                Err(NamError::Ledger(LedgerAppError::InvalidMessageSize))
+            ));
+            assert_eq!(result.verified, None);
+        }
+        assert!(report.results[cuts.len()].is_ok());
+    }
+}
@@ -0,0 +1,131 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+//! Transport for the host emulator (`namada_emulator serve`) and Speculos
+
+use std::io::{Read, Write};
+use std::net::{TcpStream, ToSocketAddrs};
+use std::ops::Deref;
+use std::sync::Mutex;
+
+use ledger_transport::{async_trait, APDUAnswer, APDUCommand, Exchange};
+
+/// Largest answer accepted from the emulator, well above what an APDU can carry
+const MAX_ANSWER_LEN: usize = 0x10000;
+
+/// Emulator transport errors
+#[derive(Debug, thiserror::Error)]
+pub enum TransportEmulatorError {
+    /// Socket error
+    #[error("emulator connection error: {0}")]
+    Io(#[from] std::io::Error),
+    /// Answer without a status word or larger than any APDU
+    #[error("invalid answer from the emulator")]
+    InvalidAnswer,
+}
+
+/// Transport over the Speculos APDU protocol: requests are a big endian u32 length followed by
+/// the APDU, answers a big endian u32 length of the data followed by the data and the status word.
+///
+/// Exchanges block on a local socket, which is fine for driving a local emulator.
+pub struct TransportEmulator {
+    stream: Mutex<TcpStream>,
+}
+
+impl TransportEmulator {
+    /// Connect to an emulator listening on `addr`, e.g. `"127.0.0.1:9999"`
+    pub fn connect<A: ToSocketAddrs>(addr: A) -> Result<Self, TransportEmulatorError> {
+        let stream = TcpStream::connect(addr)?;
+        stream.set_nodelay(true)?;
+        Ok(TransportEmulator {
+            stream: Mutex::new(stream),
+        })
+    }
+
+    fn exchange_raw(&self, apdu: &[u8]) -> Result<Vec<u8>, TransportEmulatorError> {
+        let mut stream = self.stream.lock().unwrap_or_else(|e| e.into_inner());
+
+        let mut request = Vec::with_capacity(4 + apdu.len());
+        request.extend_from_slice(&(apdu.len() as u32).to_be_bytes());
+        request.extend_from_slice(apdu);
+        stream.write_all(&request)?;
+
+        let mut len = [0u8; 4];
+        stream.read_exact(&mut len)?;
+        let data_len = u32::from_be_bytes(len) as usize;
+        if data_len > MAX_ANSWER_LEN {
+            return Err(TransportEmulatorError::InvalidAnswer);
+        }
+
+        // Data plus status word
+        let mut answer = vec![0u8; data_len + 2];
+        stream.read_exact(&mut answer)?;
+        Ok(answer)
+    }
+}
+
+#[async_trait]
+impl Exchange for TransportEmulator {
+    type Error = TransportEmulatorError;
+    type AnswerType = Vec<u8>;
+
+    async fn exchange<I>(
+        &self,
+        command: &APDUCommand<I>,
+    ) -> Result<APDUAnswer<Self::AnswerType>, Self::Error>
+    where
+        I: Deref<Target = [u8]> + Send + Sync,
+    {
+        let answer = self.exchange_raw(&command.serialize())?;
+        APDUAnswer::from_answer(answer).map_err(|_| TransportEmulatorError::InvalidAnswer)
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::net::TcpListener;
+    use std::thread;
+
+    #[tokio::test]
+    async fn exchange_uses_speculos_framing() {
+        let listener = TcpListener::bind("127.0.0.1:0").unwrap();
+        let addr = listener.local_addr().unwrap();
+
+        let emulator = thread::spawn(move || {
+            let (mut stream, _) = listener.accept().unwrap();
+            let mut request = [0u8; 4 + 5];
+            stream.read_exact(&mut request).unwrap();
+            assert_eq!(request, [0, 0, 0, 5, 0x57, 0x00, 0x00, 0x00, 0x00]);
+            stream
+                .write_all(&[0, 0, 0, 3, 0x01, 0x02, 0x03, 0x90, 0x00])
+                .unwrap();
+        });
+
+        let transport = TransportEmulator::connect(addr).unwrap();
+        let command = APDUCommand {
+            cla: 0x57,
+            ins: 0x00,
+            p1: 0x00,
+            p2: 0x00,
+            data: Vec::new(),
+        };
+        let answer = transport.exchange(&command).await.unwrap();
+        assert_eq!(answer.data(), &[0x01, 0x02, 0x03]);
+        assert_eq!(answer.retcode(), 0x9000);
+
+        emulator.join().unwrap();
+    }
+}
@@ -34,7 +34,10 @@ pub use params::{
     InstructionCode, KeyResponse, NamadaKeys, ADDRESS_LEN, CLA, ED25519_PUBKEY_LEN,
     PK_LEN_PLUS_TAG, SIG_LEN_PLUS_TAG,
 };
-use params::{KEY_LEN, PAYMENT_ADDR_LEN, SALT_LEN, XFVK_LEN};
+use params::{
+    KEY_LEN, MAX_RAND_BATCH_CONVERTS, MAX_RAND_BATCH_PAIRS, PAYMENT_ADDR_LEN, SALT_LEN,
+    SPEND_SIGNATURES_HEADER_LEN, XFVK_LEN,
+};
 use utils::{
     ResponseAddress, ResponseGetConvertRandomness, ResponseGetOutputRandomness,
     ResponseGetSpendRandomness, ResponseMaspSign, ResponseProofGenKey, ResponsePubAddress,
@@ -47,6 +50,15 @@ use std::str;
 mod utils;
 pub use utils::BIP44Path;
 
+mod emulator;
+pub use emulator::{TransportEmulator, TransportEmulatorError};
+
+mod batch;
+pub use batch::{BatchSignReport, BatchSignResult, BatchTiming, BatchTransaction, SignSession};
+
+mod verify;
+pub use verify::SignatureBatch;
+
 /// Ledger App Error
 #[derive(Debug, thiserror::Error)]
 pub enum NamError<E>
@@ -193,26 +205,7 @@ where
         }
 
         // Transactions is signed - Retrieve signatures
-        let rest = response.apdu_data();
-        let (pubkey, rest) = rest.split_at(PK_LEN_PLUS_TAG);
-        let (raw_salt, rest) = rest.split_at(SALT_LEN);
-        let (raw_signature, rest) = rest.split_at(SIG_LEN_PLUS_TAG);
-        let (wrapper_salt, rest) = rest.split_at(SALT_LEN);
-        let (wrapper_signature, rest) = rest.split_at(SIG_LEN_PLUS_TAG);
-        let (raw_indices_len, rest) = rest.split_at(1);
-        let (raw_indices, rest) = rest.split_at(raw_indices_len[0] as usize);
-        let (wrapper_indices_len, rest) = rest.split_at(1);
-        let (wrapper_indices, _rest) = rest.split_at(wrapper_indices_len[0] as usize);
-
-        Ok(ResponseSignature {
-            pubkey: pubkey.try_into().unwrap(),
-            raw_salt: raw_salt.try_into().unwrap(),
-            raw_signature: raw_signature.try_into().unwrap(),
-            wrapper_salt: wrapper_salt.try_into().unwrap(),
-            wrapper_signature: wrapper_signature.try_into().unwrap(),
-            raw_indices: raw_indices.into(),
-            wrapper_indices: wrapper_indices.into(),
-        })
+        parse_signature(response.apdu_data())
     }
 
     /// Compute hash from signature section
@@ -224,36 +217,15 @@ where
         signature: Option<Vec<u8>>,
         prefix: Option<Vec<u8>>,
     ) -> Vec<u8> {
-        let mut hasher = Sha256::new();
-
-        if let Some(prefix) = prefix {
-            hasher.update(prefix);
-        }
-
-        hasher.update((indices.len() as u32).to_le_bytes());
-        for &index in &indices {
-            hasher.update(&hashes[&(index as usize)]);
-        }
-
-        hasher.update([0x01]);
-
-        hasher.update(&[pubkeys.len() as u8, 0, 0, 0]);
-        for pubkey in pubkeys {
-            hasher.update(pubkey);
-        }
-
-        match signature {
-            Some(sig) => {
-                hasher.update([1, 0, 0, 0]);
-                hasher.update([0x00]);
-                hasher.update(sig);
-            }
-            None => {
-                hasher.update([0, 0, 0, 0]);
-            }
-        }
-
-        hasher.finalize().to_vec()
+        let pubkeys: Vec<&[u8]> = pubkeys.iter().map(Vec::as_slice).collect();
+        signature_section_digest(
+            &pubkeys,
+            hashes,
+            &indices,
+            signature.as_deref(),
+            prefix.as_deref(),
+        )
+        .to_vec()
     }
 
     /// Verify signature
@@ -263,58 +235,7 @@ where
         section_hashes: HashMap<usize, Vec<u8>>,
         pubkey: &[u8],
     ) -> bool {
-        use ed25519_dalek::{Signature, VerifyingKey};
-
-        if pubkey != &signature.pubkey {
-            return false;
-        }
-
-        let mut public_key_bytes = [0u8; 32];
-        public_key_bytes.copy_from_slice(&signature.pubkey[1..33]);
-        let public_key = VerifyingKey::from_bytes(&public_key_bytes).unwrap();
-        let unsigned_raw_sig_hash = self.hash_signature_sec(
-            vec![],
-            &section_hashes,
-            signature.raw_indices.clone(),
-            None,
-            None,
-        );
-        let mut raw_signature_bytes = [0u8; 64];
-        raw_signature_bytes.copy_from_slice(&signature.raw_signature[1..65]);
-        let raw_signature = Signature::from_bytes(&raw_signature_bytes);
-        let raw_sig = public_key
-            .verify(&unsigned_raw_sig_hash, &raw_signature)
-            .is_ok();
-
-        // Verify wrapper signature
-        let prefix: Vec<u8> = vec![0x03];
-        let raw_hash = self.hash_signature_sec(
-            vec![signature.pubkey.to_vec()],
-            &section_hashes,
-            signature.raw_indices.clone(),
-            Some(signature.raw_signature.to_vec()),
-            Some(prefix),
-        );
-
-        let mut tmp_hashes = section_hashes.clone();
-        tmp_hashes.insert(tmp_hashes.len() - 1, raw_hash);
-
-        let unsigned_wrapper_sig_hash = self.hash_signature_sec(
-            vec![],
-            &tmp_hashes,
-            signature.wrapper_indices.clone(),
-            None,
-            None,
-        );
-
-        let mut wrapper_signature_bytes = [0u8; 64];
-        wrapper_signature_bytes.copy_from_slice(&signature.wrapper_signature[1..65]);
-        let wrapper_signature = Signature::from_bytes(&wrapper_signature_bytes);
-        let wrapper_sig = public_key
-            .verify(&unsigned_wrapper_sig_hash, &wrapper_signature)
-            .is_ok();
-
-        raw_sig && wrapper_sig
+        check_signature(signature, &section_hashes, pubkey)
     }
 
     /// Retrieve masp keys from the Namada app
@@ -524,6 +445,118 @@ where
         })
     }
 
+    /// Request `count` randomness items of one kind, splitting them in as few APDUs as possible
+    async fn get_randomness_batch(
+        &self,
+        kind: u8,
+        count: usize,
+        item_len: usize,
+        max_per_request: u8,
+    ) -> Result<Vec<u8>, NamError<E::Error>> {
+        let mut items = Vec::with_capacity(count * item_len);
+        let mut pending = count;
+        while pending > 0 {
+            let batch = pending.min(max_per_request as usize);
+            let arr: &[u8] = &[];
+            let command = APDUCommand {
+                cla: CLA,
+                ins: InstructionCode::GetRandomnessBatch as _,
+                p1: kind,
+                p2: batch as u8,
+                data: arr, // Send empty data
+            };
+
+            let response = self
+                .apdu_transport
+                .exchange(&command)
+                .await
+                .map_err(LedgerAppError::TransportError)?;
+
+            match response.error_code() {
+                Ok(APDUErrorCode::NoError) => {}
+                Ok(err) => {
+                    return Err(NamError::Ledger(LedgerAppError::AppSpecific(
+                        err as _,
+                        err.description(),
+                    )))
+                }
+                Err(err) => {
+                    return Err(NamError::Ledger(LedgerAppError::AppSpecific(
+                        err,
+                        "[APDU_ERROR] Unknown".to_string(),
+                    )))
+                }
+            }
+
+            let response_data = response.apdu_data();
+            if response_data.len() < batch * item_len {
+                return Err(NamError::Ledger(LedgerAppError::InvalidMessageSize));
+            }
+            items.extend_from_slice(&response_data[..batch * item_len]);
+            pending -= batch;
+        }
+        Ok(items)
+    }
+
+    /// Get Randomness for several spends
+    pub async fn get_spend_randomness_batch(
+        &self,
+        count: usize,
+    ) -> Result<Vec<ResponseGetSpendRandomness>, NamError<E::Error>> {
+        let items = self
+            .get_randomness_batch(0x00, count, 2 * KEY_LEN, MAX_RAND_BATCH_PAIRS)
+            .await?;
+
+        Ok(items
+            .chunks_exact(2 * KEY_LEN)
+            .map(|item| {
+                let (rcv, alpha) = item.split_at(KEY_LEN);
+                ResponseGetSpendRandomness {
+                    rcv: rcv.try_into().unwrap(),
+                    alpha: alpha.try_into().unwrap(),
+                }
+            })
+            .collect())
+    }
+
+    /// Get Randomness for several outputs
+    pub async fn get_output_randomness_batch(
+        &self,
+        count: usize,
+    ) -> Result<Vec<ResponseGetOutputRandomness>, NamError<E::Error>> {
+        let items = self
+            .get_randomness_batch(0x01, count, 2 * KEY_LEN, MAX_RAND_BATCH_PAIRS)
+            .await?;
+
+        Ok(items
+            .chunks_exact(2 * KEY_LEN)
+            .map(|item| {
+                let (rcv, rcm) = item.split_at(KEY_LEN);
+                ResponseGetOutputRandomness {
+                    rcv: rcv.try_into().unwrap(),
+                    rcm: rcm.try_into().unwrap(),
+                }
+            })
+            .collect())
+    }
+
+    /// Get Randomness for several converts
+    pub async fn get_convert_randomness_batch(
+        &self,
+        count: usize,
+    ) -> Result<Vec<ResponseGetConvertRandomness>, NamError<E::Error>> {
+        let items = self
+            .get_randomness_batch(0x02, count, KEY_LEN, MAX_RAND_BATCH_CONVERTS)
+            .await?;
+
+        Ok(items
+            .chunks_exact(KEY_LEN)
+            .map(|rcv| ResponseGetConvertRandomness {
+                rcv: rcv.try_into().unwrap(),
+            })
+            .collect())
+    }
+
     /// Get Spend signature
     pub async fn get_spend_signature(&self) -> Result<ResponseSpendSignature, NamError<E::Error>> {
         let arr: &[u8] = &[];
@@ -570,6 +603,69 @@ where
         })
     }
 
+    /// Get all spend signatures, several of them are packed in each response
+    pub async fn get_spend_signatures(
+        &self,
+    ) -> Result<Vec<ResponseSpendSignature>, NamError<E::Error>> {
+        let mut signatures = Vec::new();
+        loop {
+            let arr: &[u8] = &[];
+            let command = APDUCommand {
+                cla: CLA,
+                ins: InstructionCode::ExtractSpendSignature as _,
+                p1: 0x01,
+                p2: 0x00,
+                data: arr, // Send empty data
+            };
+
+            let response = self
+                .apdu_transport
+                .exchange(&command)
+                .await
+                .map_err(LedgerAppError::TransportError)?;
+
+            match response.error_code() {
+                Ok(APDUErrorCode::NoError) => {}
+                Ok(err) => {
+                    return Err(NamError::Ledger(LedgerAppError::AppSpecific(
+                        err as _,
+                        err.description(),
+                    )))
+                }
+                Err(err) => {
+                    return Err(NamError::Ledger(LedgerAppError::AppSpecific(
+                        err,
+                        "[APDU_ERROR] Unknown".to_string(),
+                    )))
+                }
+            }
+
+            // Header: first index, signatures in this response, total signatures
+            let response_data = response.apdu_data();
+            if response_data.len() < SPEND_SIGNATURES_HEADER_LEN {
+                return Err(NamError::Ledger(LedgerAppError::InvalidMessageSize));
+            }
+            let (header, rest) = response_data.split_at(SPEND_SIGNATURES_HEADER_LEN);
+            let (index, count, total) =
+                (header[0] as usize, header[1] as usize, header[2] as usize);
+            if count == 0 || index != signatures.len() || rest.len() < count * 2 * KEY_LEN {
+                return Err(NamError::Ledger(LedgerAppError::InvalidMessageSize));
+            }
+
+            for signature in rest.chunks_exact(2 * KEY_LEN).take(count) {
+                let (rbar, sbar) = signature.split_at(KEY_LEN);
+                signatures.push(ResponseSpendSignature {
+                    rbar: rbar.try_into().unwrap(),
+                    sbar: sbar.try_into().unwrap(),
+                });
+            }
+
+            if signatures.len() >= total {
+                return Ok(signatures);
+            }
+        }
+    }
+
     /// Sign Masp signing
     pub async fn sign_masp_spends(
         &self,
@@ -632,3 +728,166 @@ where
         Ok(())
     }
 }
+
+/// Split `len` bytes off the front of a device answer, failing when the answer is too short
+fn split_answer<E>(data: &[u8], len: usize) -> Result<(&[u8], &[u8]), NamError<E>>
+where
+    E: std::error::Error,
+{
+    if data.len() < len {
+        return Err(NamError::Ledger(LedgerAppError::InvalidMessageSize));
+    }
+    Ok(data.split_at(len))
+}
+
+/// Parse the answer to the last chunk of a [`InstructionCode::Sign`] request
+fn parse_signature<E>(data: &[u8]) -> Result<ResponseSignature, NamError<E>>
+where
+    E: std::error::Error,
+{
+    let (pubkey, rest) = split_answer(data, PK_LEN_PLUS_TAG)?;
+    let (raw_salt, rest) = split_answer(rest, SALT_LEN)?;
+    let (raw_signature, rest) = split_answer(rest, SIG_LEN_PLUS_TAG)?;
+    let (wrapper_salt, rest) = split_answer(rest, SALT_LEN)?;
+    let (wrapper_signature, rest) = split_answer(rest, SIG_LEN_PLUS_TAG)?;
+    let (raw_indices_len, rest) = split_answer(rest, 1)?;
+    let (raw_indices, rest) = split_answer(rest, raw_indices_len[0] as usize)?;
+    let (wrapper_indices_len, rest) = split_answer(rest, 1)?;
+    let (wrapper_indices, _rest) = split_answer(rest, wrapper_indices_len[0] as usize)?;
+
+    Ok(ResponseSignature {
+        pubkey: pubkey.try_into().unwrap(),
+        raw_salt: raw_salt.try_into().unwrap(),
+        raw_signature: raw_signature.try_into().unwrap(),
+        wrapper_salt: wrapper_salt.try_into().unwrap(),
+        wrapper_signature: wrapper_signature.try_into().unwrap(),
+        raw_indices: raw_indices.into(),
+        wrapper_indices: wrapper_indices.into(),
+    })
+}
+
+/// Hash of a signature section over the given section hashes
+fn signature_section_digest(
+    pubkeys: &[&[u8]],
+    hashes: &HashMap<usize, Vec<u8>>,
+    indices: &[u8],
+    signature: Option<&[u8]>,
+    prefix: Option<&[u8]>,
+) -> [u8; 32] {
+    let mut hasher = Sha256::new();
+
+    if let Some(prefix) = prefix {
+        hasher.update(prefix);
+    }
+
+    hasher.update((indices.len() as u32).to_le_bytes());
+    for &index in indices {
+        hasher.update(&hashes[&(index as usize)]);
+    }
+
+    hasher.update([0x01]);
+
+    hasher.update(&[pubkeys.len() as u8, 0, 0, 0]);
+    for pubkey in pubkeys {
+        hasher.update(pubkey);
+    }
+
+    match signature {
+        Some(sig) => {
+            hasher.update([1, 0, 0, 0]);
+            hasher.update([0x00]);
+            hasher.update(sig);
+        }
+        None => {
+            hasher.update([0, 0, 0, 0]);
+        }
+    }
+
+    let mut digest = [0u8; 32];
+    digest.copy_from_slice(&hasher.finalize());
+    digest
+}
+
+/// Messages signed by the raw and wrapper signatures of a response, `None` if the response is
+/// not for `pubkey` or refers to sections that are not in `section_hashes`
+fn signature_messages(
+    signature: &ResponseSignature,
+    section_hashes: &HashMap<usize, Vec<u8>>,
+    pubkey: &[u8],
+) -> Option<([u8; 32], [u8; 32])> {
+    if pubkey != &signature.pubkey {
+        return None;
+    }
+
+    // Indices come from the device, an unknown one would make the hash lookup panic
+    let covered = |indices: &[u8], hashes: &HashMap<usize, Vec<u8>>| {
+        indices
+            .iter()
+            .all(|index| hashes.contains_key(&(*index as usize)))
+    };
+    if section_hashes.is_empty() || !covered(&signature.raw_indices, section_hashes) {
+        return None;
+    }
+
+    let unsigned_raw_sig_hash =
+        signature_section_digest(&[], section_hashes, &signature.raw_indices, None, None);
+
+    // The wrapper signature also covers the raw signature section
+    let raw_hash = signature_section_digest(
+        &[&signature.pubkey[..]],
+        section_hashes,
+        &signature.raw_indices,
+        Some(&signature.raw_signature[..]),
+        Some(&[0x03u8][..]),
+    );
+
+    let mut tmp_hashes = section_hashes.clone();
+    tmp_hashes.insert(tmp_hashes.len() - 1, raw_hash.to_vec());
+    if !covered(&signature.wrapper_indices, &tmp_hashes) {
+        return None;
+    }
+
+    let unsigned_wrapper_sig_hash =
+        signature_section_digest(&[], &tmp_hashes, &signature.wrapper_indices, None, None);
+
+    Some((unsigned_raw_sig_hash, unsigned_wrapper_sig_hash))
+}
+
+/// Check the raw and wrapper signatures returned by the device. Does not need the app, so it
+/// can run on a worker thread while the device signs the next transaction of a batch.
+fn check_signature(
+    signature: &ResponseSignature,
+    section_hashes: &HashMap<usize, Vec<u8>>,
+    pubkey: &[u8],
+) -> bool {
+    use ed25519_dalek::{Signature, VerifyingKey};
+
+    let (unsigned_raw_sig_hash, unsigned_wrapper_sig_hash) =
+        match signature_messages(signature, section_hashes, pubkey) {
+            Some(messages) => messages,
+            None => return false,
+        };
+
+    let mut public_key_bytes = [0u8; 32];
+    public_key_bytes.copy_from_slice(&signature.pubkey[1..33]);
+    let public_key = match VerifyingKey::from_bytes(&public_key_bytes) {
+        Ok(public_key) => public_key,
+        Err(_) => return false,
+    };
+
+    let mut raw_signature_bytes = [0u8; 64];
+    raw_signature_bytes.copy_from_slice(&signature.raw_signature[1..65]);
+    let raw_signature = Signature::from_bytes(&raw_signature_bytes);
+    let raw_sig = public_key
+        .verify(&unsigned_raw_sig_hash, &raw_signature)
+        .is_ok();
+
+    let mut wrapper_signature_bytes = [0u8; 64];
+    wrapper_signature_bytes.copy_from_slice(&signature.wrapper_signature[1..65]);
+    let wrapper_signature = Signature::from_bytes(&wrapper_signature_bytes);
+    let wrapper_sig = public_key
+        .verify(&unsigned_wrapper_sig_hash, &wrapper_signature)
+        .is_ok();
+
+    raw_sig && wrapper_sig
+}
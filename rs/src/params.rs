@@ -68,8 +68,19 @@ pub enum InstructionCode {
 
     /// Instruction to retrieve a signed section
     GetSignature = 0x0a,
+    /// Instruction to generate several randomness values at once
+    GetRandomnessBatch = 0x0b,
 }
 
+/// Max spend or output randomness items returned by a single batch request
+pub const MAX_RAND_BATCH_PAIRS: u8 = 3;
+/// Max convert randomness items returned by a single batch request
+pub const MAX_RAND_BATCH_CONVERTS: u8 = 7;
+/// Transaction bytes carried by each signing chunk
+pub const USER_MESSAGE_CHUNK_SIZE: usize = 250;
+/// Header of a multi-signature spend signature response
+pub const SPEND_SIGNATURES_HEADER_LEN: usize = 3;
+
 #[derive(Clone, Debug)]
 /// Masp keys return types
 pub enum NamadaKeys {
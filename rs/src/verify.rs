@@ -0,0 +1,314 @@
+/*******************************************************************************
+*   (c) 2018 - 2024 Zondax AG
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+********************************************************************************/
+//! Batch verification of the Ed25519 signatures returned by the app
+
+use std::borrow::Cow;
+use std::collections::HashMap;
+use std::convert::TryInto;
+
+use ed25519_dalek::{Signature, Verifier, VerifyingKey};
+
+use crate::params::{ED25519_PUBKEY_LEN, ED25519_SIGNATURE_LEN};
+use crate::signature_messages;
+use crate::utils::ResponseSignature;
+
+/// A signature waiting to be checked
+struct Entry<'a> {
+    id: usize,
+    key: VerifyingKey,
+    message: Cow<'a, [u8]>,
+    signature: Signature,
+}
+
+/// Collects (public key, message, signature) triples, possibly from many responses, and checks
+/// them with a single Ed25519 batch verification. When the batch fails it is split in halves
+/// until the bad signatures are found, so a few bad entries cost a few extra batches.
+#[derive(Default)]
+pub struct SignatureBatch<'a> {
+    entries: Vec<Entry<'a>>,
+    // Ids that cannot verify: malformed keys or signatures, responses for another key
+    rejected: Vec<usize>,
+    next_id: usize,
+}
+
+impl<'a> SignatureBatch<'a> {
+    /// Create an empty batch
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Create an empty batch with room for `signatures` signatures
+    pub fn with_capacity(signatures: usize) -> Self {
+        SignatureBatch {
+            entries: Vec::with_capacity(signatures),
+            rejected: Vec::new(),
+            next_id: 0,
+        }
+    }
+
+    /// Number of ids handed out so far
+    pub fn len(&self) -> usize {
+        self.next_id
+    }
+
+    /// Whether nothing was queued yet
+    pub fn is_empty(&self) -> bool {
+        self.next_id == 0
+    }
+
+    /// Queue `signature` over `message` by `pubkey`. The key and signature may carry the tag
+    /// byte the app prefixes them with. Returns the id reported by [`SignatureBatch::verify`].
+    pub fn push(&mut self, pubkey: &[u8], message: &'a [u8], signature: &[u8]) -> usize {
+        let id = self.next_id();
+        self.queue(id, pubkey, Cow::Borrowed(message), signature);
+        id
+    }
+
+    /// Queue the raw and wrapper signatures of a sign response under a single id, checking them
+    /// against `pubkey` and the transaction `section_hashes` as
+    /// [`NamadaApp::verify_signature`](crate::NamadaApp::verify_signature) does.
+    pub fn push_response(
+        &mut self,
+        signature: &ResponseSignature,
+        section_hashes: &HashMap<usize, Vec<u8>>,
+        pubkey: &[u8],
+    ) -> usize {
+        let id = self.next_id();
+        match signature_messages(signature, section_hashes, pubkey) {
+            Some((raw_hash, wrapper_hash)) => {
+                self.queue(
+                    id,
+                    &signature.pubkey,
+                    Cow::Owned(raw_hash.to_vec()),
+                    &signature.raw_signature,
+                );
+                self.queue(
+                    id,
+                    &signature.pubkey,
+                    Cow::Owned(wrapper_hash.to_vec()),
+                    &signature.wrapper_signature,
+                );
+            }
+            None => self.rejected.push(id),
+        }
+        id
+    }
+
+    /// Check every queued signature. Returns the sorted ids with at least one invalid
+    /// signature, empty when everything verifies.
+    pub fn verify(&self) -> Vec<usize> {
+        let mut invalid = self.rejected.clone();
+        bisect(&self.entries, &mut invalid);
+        invalid.sort_unstable();
+        invalid.dedup();
+        invalid
+    }
+
+    fn next_id(&mut self) -> usize {
+        let id = self.next_id;
+        self.next_id += 1;
+        id
+    }
+
+    fn queue(&mut self, id: usize, pubkey: &[u8], message: Cow<'a, [u8]>, signature: &[u8]) {
+        let key = strip_tag(pubkey, ED25519_PUBKEY_LEN)
+            .and_then(|key| VerifyingKey::from_bytes(key.try_into().unwrap()).ok());
+        let signature = strip_tag(signature, ED25519_SIGNATURE_LEN)
+            .map(|signature| Signature::from_bytes(signature.try_into().unwrap()));
+
+        match (key, signature) {
+            (Some(key), Some(signature)) => self.entries.push(Entry {
+                id,
+                key,
+                message,
+                signature,
+            }),
+            _ => self.rejected.push(id),
+        }
+    }
+}
+
+/// Drop the leading tag byte, if any, of a key or signature of length `len`
+fn strip_tag(bytes: &[u8], len: usize) -> Option<&[u8]> {
+    if bytes.len() == len {
+        Some(bytes)
+    } else if bytes.len() == len + 1 {
+        Some(&bytes[1..])
+    } else {
+        None
+    }
+}
+
+/// Batch-verify `entries`, splitting failed batches in halves down to single signatures
+fn bisect(entries: &[Entry], invalid: &mut Vec<usize>) {
+    match entries {
+        [] => {}
+        [entry] => {
+            if entry
+                .key
+                .verify(&entry.message[..], &entry.signature)
+                .is_err()
+            {
+                invalid.push(entry.id);
+            }
+        }
+        _ => {
+            if verify_entries(entries) {
+                return;
+            }
+            let (left, right) = entries.split_at(entries.len() / 2);
+            bisect(left, invalid);
+            bisect(right, invalid);
+        }
+    }
+}
+
+fn verify_entries(entries: &[Entry]) -> bool {
+    let messages: Vec<&[u8]> = entries.iter().map(|entry| &entry.message[..]).collect();
+    let signatures: Vec<Signature> = entries.iter().map(|entry| entry.signature).collect();
+    let keys: Vec<VerifyingKey> = entries.iter().map(|entry| entry.key).collect();
+    ed25519_dalek::verify_batch(&messages, &signatures, &keys).is_ok()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::{check_signature, signature_section_digest};
+    use ed25519_dalek::{Signer, SigningKey};
+
+    fn section_hashes() -> HashMap<usize, Vec<u8>> {
+        let mut hashes = HashMap::new();
+        for (index, byte) in [(0usize, 0x10u8), (1, 0x11), (0xff, 0xff)] {
+            hashes.insert(index, vec![byte; 32]);
+        }
+        hashes
+    }
+
+    fn tagged(bytes: &[u8]) -> Vec<u8> {
+        let mut tagged = vec![0x00];
+        tagged.extend_from_slice(bytes);
+        tagged
+    }
+
+    /// Response as the app builds it: the raw signature covers sections 0 and 1, the wrapper one
+    /// also covers the raw signature section
+    fn signed_response(key: &SigningKey, hashes: &HashMap<usize, Vec<u8>>) -> ResponseSignature {
+        let pubkey = tagged(key.verifying_key().as_bytes());
+        let raw_indices = vec![0u8, 1];
+        let wrapper_indices = vec![0u8, 1, 2];
+
+        let raw_hash = signature_section_digest(&[], hashes, &raw_indices, None, None);
+        let raw_signature = tagged(&key.sign(&raw_hash).to_bytes());
+
+        let mut tmp_hashes = hashes.clone();
+        tmp_hashes.insert(
+            tmp_hashes.len() - 1,
+            signature_section_digest(
+                &[&pubkey[..]],
+                hashes,
+                &raw_indices,
+                Some(&raw_signature[..]),
+                Some(&[0x03u8][..]),
+            )
+            .to_vec(),
+        );
+        let wrapper_hash = signature_section_digest(&[], &tmp_hashes, &wrapper_indices, None, None);
+        let wrapper_signature = tagged(&key.sign(&wrapper_hash).to_bytes());
+
+        ResponseSignature {
+            pubkey: pubkey[..].try_into().unwrap(),
+            raw_salt: [0x11; 8],
+            raw_signature: raw_signature[..].try_into().unwrap(),
+            wrapper_salt: [0x22; 8],
+            wrapper_signature: wrapper_signature[..].try_into().unwrap(),
+            raw_indices,
+            wrapper_indices,
+        }
+    }
+
+    #[test]
+    fn bisects_to_bad_signatures() {
+        let keys: Vec<SigningKey> = (0..16u8)
+            .map(|i| SigningKey::from_bytes(&[i + 1; 32]))
+            .collect();
+        let messages: Vec<Vec<u8>> = (0..16u8).map(|i| vec![i; 32 + i as usize]).collect();
+        let mut signatures: Vec<[u8; 64]> = keys
+            .iter()
+            .zip(&messages)
+            .map(|(key, message)| key.sign(message).to_bytes())
+            .collect();
+        signatures[3][10] ^= 0x01;
+        signatures[11][40] ^= 0x01;
+
+        let mut batch = SignatureBatch::with_capacity(keys.len());
+        for ((key, message), signature) in keys.iter().zip(&messages).zip(&signatures) {
+            batch.push(key.verifying_key().as_bytes(), message, signature);
+        }
+        assert_eq!(batch.len(), 16);
+        assert_eq!(batch.verify(), vec![3, 11]);
+    }
+
+    #[test]
+    fn all_valid_and_malformed_entries() {
+        let key = SigningKey::from_bytes(&[9u8; 32]);
+        let message = b"namada".to_vec();
+        let signature = key.sign(&message).to_bytes();
+
+        let mut batch = SignatureBatch::new();
+        assert!(batch.verify().is_empty());
+
+        batch.push(
+            &tagged(key.verifying_key().as_bytes()),
+            &message,
+            &tagged(&signature),
+        );
+        batch.push(key.verifying_key().as_bytes(), &message, &signature);
+        assert!(batch.verify().is_empty());
+
+        let short_signature = batch.push(key.verifying_key().as_bytes(), &message, &signature[1..]);
+        assert_eq!(batch.verify(), vec![short_signature]);
+    }
+
+    #[test]
+    fn responses_match_verify_signature() {
+        let hashes = section_hashes();
+        let keys: Vec<SigningKey> = (0..5u8)
+            .map(|i| SigningKey::from_bytes(&[0x40 + i; 32]))
+            .collect();
+        let mut responses: Vec<ResponseSignature> = keys
+            .iter()
+            .map(|key| signed_response(key, &hashes))
+            .collect();
+        responses[1].wrapper_signature[5] ^= 0x01;
+        responses[4].raw_signature[5] ^= 0x01;
+
+        let mut batch = SignatureBatch::new();
+        for response in &responses {
+            let pubkey = response.pubkey;
+            batch.push_response(response, &hashes, &pubkey);
+        }
+        // Response for another key than the one expected
+        let other = batch.push_response(&responses[0], &hashes, &responses[2].pubkey);
+
+        for (index, response) in responses.iter().enumerate() {
+            assert_eq!(
+                check_signature(response, &hashes, &response.pubkey),
+                index != 1 && index != 4
+            );
+        }
+        assert_eq!(batch.verify(), vec![1, 4, other]);
+    }
+}
@@ -0,0 +1,153 @@
+/*******************************************************************************
+ *   (c) 2018 - 2024 Zondax AG
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ ********************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <zxformat.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "blake2.h"
+#include "blake2_simd/blake2_simd.h"
+#include "blake2b_template.h"
+
+namespace {
+
+const blake2_backend_e BACKENDS[] = {BLAKE2_BACKEND_REF, BLAKE2_BACKEND_SSE41, BLAKE2_BACKEND_AVX2};
+
+// Lengths around the block boundaries of both variants
+const size_t LENGTHS[] = {0, 1, 3, 63, 64, 65, 127, 128, 129, 255, 256, 257, 1000};
+
+std::vector<uint8_t> testData(size_t len) {
+    std::vector<uint8_t> data(len);
+    for (size_t i = 0; i < len; i++) {
+        data[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+    return data;
+}
+
+// Input is fed in growing chunks so buffered and direct block compression are both exercised
+std::vector<uint8_t> hashBlake2b(const std::vector<uint8_t> &data, size_t outLen) {
+    std::vector<uint8_t> out(outLen);
+    blake2b_state state;
+    blake2b_init(&state, outLen);
+    size_t offset = 0;
+    size_t step = 1;
+    while (offset < data.size()) {
+        const size_t chunk = std::min(step, data.size() - offset);
+        blake2b_update(&state, data.data() + offset, chunk);
+        offset += chunk;
+        step = 3 * step + 1;
+    }
+    blake2b_final(&state, out.data(), outLen);
+    return out;
+}
+
+std::vector<uint8_t> hashBlake2s(const std::vector<uint8_t> &data, size_t outLen) {
+    std::vector<uint8_t> out(outLen);
+    blake2s_state state;
+    blake2s_init(&state, outLen);
+    blake2s_update(&state, data.data(), data.size());
+    blake2s_final(&state, out.data(), outLen);
+    return out;
+}
+
+std::string toHex(const std::vector<uint8_t> &data) {
+    std::string hex(2 * data.size() + 1, '\0');
+    array_to_hexstr(&hex[0], hex.size(), data.data(), data.size());
+    hex.resize(2 * data.size());
+    return hex;
+}
+
+class Blake2Backend : public ::testing::TestWithParam<blake2_backend_e> {
+ protected:
+    void SetUp() override {
+        previous = blake2_backend_get();
+        if (!blake2_backend_set(GetParam())) {
+            GTEST_SKIP() << "CPU lacks " << blake2_backend_name(GetParam());
+        }
+    }
+
+    void TearDown() override { blake2_backend_set(previous); }
+
+    blake2_backend_e previous = BLAKE2_BACKEND_REF;
+};
+
+}  // namespace
+
+// RFC 7693 appendix A and B
+TEST_P(Blake2Backend, KnownAnswer) {
+    const std::vector<uint8_t> abc = {'a', 'b', 'c'};
+    EXPECT_EQ(toHex(hashBlake2b(abc, 64)),
+              "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d1"
+              "7d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923");
+    EXPECT_EQ(toHex(hashBlake2s(abc, 32)), "508c5e8c327c14e2e1a72ba34eeb452f37458b209ed63a294d999b4c86675982");
+}
+
+TEST_P(Blake2Backend, MatchesReference) {
+    for (const size_t len : LENGTHS) {
+        const std::vector<uint8_t> data = testData(len);
+
+        ASSERT_TRUE(blake2_backend_set(GetParam()));
+        const std::vector<uint8_t> b = hashBlake2b(data, 64);
+        const std::vector<uint8_t> s = hashBlake2s(data, 32);
+
+        ASSERT_TRUE(blake2_backend_set(BLAKE2_BACKEND_REF));
+        EXPECT_EQ(b, hashBlake2b(data, 64)) << "blake2b, length " << len;
+        EXPECT_EQ(s, hashBlake2s(data, 32)) << "blake2s, length " << len;
+    }
+}
+
+// Lanes advanced together, with uneven chunk sizes, must match each lane hashed on its own
+TEST_P(Blake2Backend, MultiLaneMatchesSingleLane) {
+    const blake2b_template_e ids[] = {BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_COMPACT, BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_MEMOS,
+                                      BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_NONCOMPACT};
+    const std::vector<uint8_t> data = testData(4000);
+    const uint16_t chunks[][3] = {{148, 512, 32}, {0, 0, 96}, {0, 129, 0}, {128, 128, 128}, {1, 0, 300}, {700, 5, 0}};
+
+    blake2b_multi_t multi;
+    ASSERT_EQ(blake2b_multi_init(&multi, ids, 3), zxerr_ok);
+    blake2b_template_ctx_t single[3];
+    for (uint8_t lane = 0; lane < 3; lane++) {
+        ASSERT_EQ(blake2b_template_load(&single[lane], ids[lane]), zxerr_ok);
+    }
+
+    uint16_t offset[3] = {0};
+    for (const auto &chunk : chunks) {
+        bytes_t inputs[3];
+        for (uint8_t lane = 0; lane < 3; lane++) {
+            inputs[lane] = {data.data() + offset[lane], chunk[lane]};
+            ASSERT_EQ(blake2b_template_update(&single[lane], inputs[lane].ptr, inputs[lane].len), zxerr_ok);
+            offset[lane] += chunk[lane];
+        }
+        ASSERT_EQ(blake2b_multi_update(&multi, inputs), zxerr_ok);
+    }
+
+    uint8_t multiDigests[3 * BLAKE2B_TEMPLATE_OUTPUT_LEN] = {0};
+    ASSERT_EQ(blake2b_multi_final(&multi, multiDigests), zxerr_ok);
+    for (uint8_t lane = 0; lane < 3; lane++) {
+        uint8_t digest[BLAKE2B_TEMPLATE_OUTPUT_LEN] = {0};
+        ASSERT_EQ(blake2b_template_final(&single[lane], digest), zxerr_ok);
+        EXPECT_EQ(memcmp(digest, multiDigests + lane * BLAKE2B_TEMPLATE_OUTPUT_LEN, sizeof(digest)), 0) << "lane " << +lane;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(Blake2, Blake2Backend, ::testing::ValuesIn(BACKENDS),
+                         [](const ::testing::TestParamInfo<blake2_backend_e> &info) {
+                             return std::string(blake2_backend_name(info.param));
+                         });
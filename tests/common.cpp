@@ -26,54 +26,9 @@
 #include <json/json.h>
 #include <app_mode.h>
 #include <hexutils.h>
-
-std::vector<std::string> dumpUI(parser_context_t *ctx,
-                                uint16_t maxKeyLen,
-                                uint16_t maxValueLen) {
-    auto answer = std::vector<std::string>();
-
-    uint8_t numItems;
-    parser_error_t err = parser_getNumItems(ctx, &numItems);
-    if (err != parser_ok) {
-        return answer;
-    }
-
-    for (uint8_t idx = 0; idx < numItems; idx++) {
-        char keyBuffer[1000];
-        char valueBuffer[1000];
-        uint8_t pageIdx = 0;
-        uint8_t pageCount = 1;
-
-        while (pageIdx < pageCount) {
-            std::stringstream ss;
-
-            err = parser_getItem(ctx, idx,
-                                 keyBuffer, maxKeyLen,
-                                 valueBuffer, maxValueLen,
-                                 pageIdx, &pageCount);
-
-            ss << fmt::format("{} | {}", idx, keyBuffer);
-            if (pageCount > 1) {
-                ss << fmt::format(" [{}/{}]", pageIdx + 1, pageCount);
-            }
-            ss << " : ";
-
-            if (err == parser_ok) {
-                // Model multiple lines
-                ss << fmt::format("{}", valueBuffer);
-            } else {
-                ss << parser_getErrorDescription(err);
-            }
-
-            auto output = ss.str();
-            answer.push_back(output);
-
-            pageIdx++;
-        }
-    }
-
-    return answer;
-}
+#include <random>
+#include <memory>
+#include <thread>
 
 std::string CleanTestname(std::string s) {
     s.erase(remove_if(s.begin(), s.end(), [](char v) -> bool {
@@ -153,7 +108,7 @@ void check_testcase(const testcase_t &tc, bool expert_mode) {
     std::cout << std::endl << std::endl;
 
 #if 1
-    std::vector<std::string> expected = app_mode_expert() ? tc.expected_expert : tc.expected;
+    std::vector<std::string> expected = expert_mode ? tc.expected_expert : tc.expected;
     EXPECT_EQ(output.size(), expected.size());
     for (size_t i = 0; i < expected.size(); i++) {
         if (i < output.size()) {
@@ -162,3 +117,79 @@ void check_testcase(const testcase_t &tc, bool expert_mode) {
     }
 #endif
 }
+
+void check_incremental_testcase(const testcase_t &tc) {
+    uint8_t buffer[10000] = {0};
+    const uint16_t bufferLen = parseHexString(buffer, sizeof(buffer), tc.blob.c_str());
+
+    parser_context_t expected_ctx = {0};
+    parser_tx_t expected_tx;
+    memset(&expected_tx, 0, sizeof(expected_tx));
+    parser_error_t err = parser_parse(&expected_ctx, buffer, bufferLen, &expected_tx);
+    ASSERT_EQ(err, parser_ok) << parser_getErrorDescription(err);
+    err = parser_validate(&expected_ctx);
+    ASSERT_EQ(err, parser_ok) << parser_getErrorDescription(err);
+
+    // Feed the same buffer in random chunk sizes, as the APDU handler does
+    parser_context_t ctx = {0};
+    parser_tx_t tx_obj;
+    memset(&tx_obj, 0, sizeof(tx_obj));
+    std::mt19937 rng(tc.index);
+    std::uniform_int_distribution<uint16_t> chunkLen(1, 250);
+    for (uint16_t received = chunkLen(rng); received < bufferLen; received += chunkLen(rng)) {
+        parser_parse_chunk(&ctx, buffer, received, &tx_obj);
+    }
+
+    err = parser_parse(&ctx, buffer, bufferLen, &tx_obj);
+    ASSERT_EQ(err, parser_ok) << parser_getErrorDescription(err);
+    err = parser_validate(&ctx);
+    ASSERT_EQ(err, parser_ok) << parser_getErrorDescription(err);
+
+    // memoSection points into each object's own extra data, compare it by index
+    const auto memoIndex = [](const parser_tx_t &tx) -> ptrdiff_t {
+        const section_t *memo = tx.transaction.header.memoSection;
+        return memo == nullptr ? -1 : memo - tx.transaction.sections.extraData;
+    };
+    EXPECT_EQ(memoIndex(tx_obj), memoIndex(expected_tx));
+    tx_obj.transaction.header.memoSection = nullptr;
+    expected_tx.transaction.header.memoSection = nullptr;
+
+    // Only the resume bookkeeping may differ from the one-shot parse
+    memset(&expected_tx.progress, 0, sizeof(expected_tx.progress));
+    memset(&tx_obj.progress, 0, sizeof(tx_obj.progress));
+    EXPECT_EQ(memcmp(&tx_obj, &expected_tx, sizeof(parser_tx_t)), 0);
+    EXPECT_EQ(ctx.offset, expected_ctx.offset);
+    EXPECT_EQ(dumpUI(&ctx, 39, 39), dumpUI(&expected_ctx, 39, 39));
+}
+
+void check_concurrent_testcase(const testcase_t &tc) {
+    uint8_t buffer[10000] = {0};
+    const uint16_t bufferLen = parseHexString(buffer, sizeof(buffer), tc.blob.c_str());
+
+    // Both modes rendered at the same time from the same buffer, each context keeps its own mode
+    std::vector<std::string> outputs[2];
+    parser_error_t errors[2] = {parser_unexpected_error, parser_unexpected_error};
+    std::vector<std::thread> threads;
+    for (uint8_t expert = 0; expert < 2; expert++) {
+        threads.emplace_back([&, expert] {
+            parser_context_t ctx = {0};
+            auto tx_obj = std::make_unique<parser_tx_t>();
+            errors[expert] = parser_parse(&ctx, buffer, bufferLen, tx_obj.get());
+            ctx.expert = expert;
+            if (errors[expert] == parser_ok) {
+                errors[expert] = parser_validate(&ctx);
+            }
+            if (errors[expert] == parser_ok) {
+                outputs[expert] = dumpUI(&ctx, 39, 39);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(errors[0], parser_ok) << parser_getErrorDescription(errors[0]);
+    ASSERT_EQ(errors[1], parser_ok) << parser_getErrorDescription(errors[1]);
+    EXPECT_EQ(outputs[0], tc.expected);
+    EXPECT_EQ(outputs[1], tc.expected_expert);
+}
@@ -18,6 +18,7 @@
 #include <vector>
 #include <string>
 #include "parser_common.h"
+#include "ui_dump.h"
 
 typedef struct {
     uint64_t index;
@@ -44,8 +45,10 @@ public:
 EXPECT_TRUE(!strcmp(_STR1, _STR2)) << _errorMessage << ", expected: " << _STR2 << ", received: " << _STR1; \
 else FAIL() << "One of the strings is null"; }
 
-std::vector<std::string> dumpUI(parser_context_t *ctx, uint16_t maxKeyLen, uint16_t maxValueLen);
-
 std::vector<testcase_t> GetJsonTestCases(const std::string &jsonFile);
 
 void check_testcase(const testcase_t &tc, bool expert_mode);
+
+void check_incremental_testcase(const testcase_t &tc);
+
+void check_concurrent_testcase(const testcase_t &tc);
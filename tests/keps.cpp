@@ -18,6 +18,7 @@
 #include <iostream>
 #include <vector>
 
+#include "blake2.h"
 #include "crypto.h"
 #include "crypto_helper.h"
 #include "gmock/gmock.h"
@@ -157,3 +158,173 @@ TEST(Keys, COMPUTE_RSK_RK) {
   const string rk_str = toHexString(rk, sizeof(rk));
   EXPECT_EQ(rk_str, values.rk);
 }
+
+TEST(Keys, SIGN_SPENDS_BATCH) {
+  uint8_t ask[32] = {0};
+  uint8_t sighash[32] = {0};
+  parseHexString(ask, sizeof(ask), "0cd47b62dea686adfd1e96f6503216cdf133e575221400fd65eeaa378f3d450b");
+  parseHexString(sighash, sizeof(sighash), "69475d2b9988040d4e76b4dde81954ab54afc54affc6f48e93a618dbc0c21015");
+
+  // Spend 1 uses the vector above, the others only have to agree with the step by step helpers
+  constexpr uint8_t count = 3;
+  uint8_t alphas[count][32] = {0};
+  uint8_t rngs[count][80] = {0};
+  parseHexString(alphas[1], 32, "1f666be29fde619463f42658f1d161a77b0caddf7febbaef33b511756b9d3709");
+  parseHexString(rngs[1], 80,
+                 "05734daa7328fa0c91a33d78b9c256c06d79b4b38fa01658d6e3c39781464323d166c95227c2fe5e"
+                 "121e87f7d5d82f712bf0f7a3fa23585543201936370b4562ae3a6604e1870c67cf232bc48fbe39ba");
+  for (uint8_t i = 0; i < 32; i++) {
+    alphas[0][i] = alphas[1][31 - i];
+    alphas[2][i] = i;
+  }
+  // Keep the alphas below the scalar field modulus
+  alphas[0][31] &= 0x07;
+  alphas[2][31] &= 0x07;
+  for (uint8_t i = 0; i < 80; i++) {
+    rngs[0][i] = rngs[1][i] ^ 0x5a;
+    rngs[2][i] = 3 * i;
+  }
+
+  uint8_t signatures[count][64] = {0};
+  ASSERT_EQ(sign_spends_batch(ask, sighash, alphas[0], rngs[0], count, signatures[0]), parser_ok);
+  EXPECT_EQ(toHexString(signatures[1], 32), values.rbar);
+  EXPECT_EQ(toHexString(signatures[1] + 32, 32), values.sbar);
+
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t rsk[32] = {0};
+    uint8_t data_to_be_signed[64] = {0};
+    ASSERT_EQ(parser_randomized_secret_from_seed(ask, alphas[i], rsk), parser_ok);
+    ASSERT_EQ(parser_scalar_multiplication(rsk, SpendingKeyGenerator, data_to_be_signed), parser_ok);
+    memcpy(data_to_be_signed + 32, sighash, sizeof(sighash));
+
+    uint8_t r[32] = {0};
+    uint8_t rbar[32] = {0};
+    h_star(rngs[i], 80, data_to_be_signed, 64, r);
+    parser_scalar_multiplication(r, SpendingKeyGenerator, rbar);
+
+    uint8_t s[32] = {0};
+    uint8_t sbar[32] = {0};
+    h_star(rbar, 32, data_to_be_signed, 64, s);
+    parser_compute_sbar(s, r, rsk, sbar);
+
+    EXPECT_EQ(toHexString(signatures[i], 32), toHexString(rbar, 32));
+    EXPECT_EQ(toHexString(signatures[i] + 32, 32), toHexString(sbar, 32));
+  }
+}
+
+// Adds the order 2 point (0, -1) to an encoded point: (u, v) becomes (-u, -v)
+static void addTorsionPoint(uint8_t point[KEY_LENGTH]) {
+  // Jubjub base field modulus, little endian
+  static const uint8_t modulus[KEY_LENGTH] = {
+      0x01, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x5b, 0xfe,
+      0xff, 0x02, 0xa4, 0xbd, 0x53, 0x05, 0xd8, 0xa1, 0x09, 0x08, 0xd8,
+      0x39, 0x33, 0x48, 0x7d, 0x9d, 0x29, 0x53, 0xa7, 0xed, 0x73};
+  const uint8_t sign = point[KEY_LENGTH - 1] & 0x80;
+  point[KEY_LENGTH - 1] &= 0x7f;
+
+  int borrow = 0;
+  for (uint8_t i = 0; i < KEY_LENGTH; i++) {
+    const int diff = modulus[i] - point[i] - borrow;
+    point[i] = static_cast<uint8_t>(diff);
+    borrow = diff < 0 ? 1 : 0;
+  }
+  // u is never 0 for the commitments used here, so its sign flips
+  point[KEY_LENGTH - 1] |= sign ^ 0x80;
+}
+
+TEST(ValueCommitment, BatchMatchesSingleChecks) {
+  // Dummy note identifier, its generator hash is a valid point
+  uint8_t identifier[ASSET_IDENTIFIER_LENGTH] = {
+      156, 229, 191, 54,  209, 138, 169, 235, 234, 174, 120,
+      186, 142, 34,  183, 118, 64,  243, 100, 134, 234, 27,
+      248, 27,  36,  245, 9,   146, 30,  110, 203, 169};
+  uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+  ASSERT_EQ(computeValueCommitmentGenerator(identifier, generator), parser_ok);
+
+  // More items than a batch holds, so the batch is flushed on the way
+  constexpr uint8_t count = 2 * VALUE_COMMITMENT_BATCH_SIZE + 1;
+  uint8_t rcv[count][KEY_LENGTH] = {0};
+  uint8_t cv[count][KEY_LENGTH] = {0};
+  uint64_t values[count] = {0};
+  for (uint8_t i = 0; i < count; i++) {
+    uint8_t wide[64] = {0};
+    wide[0] = i + 1;
+    wide[40] = 0x5a ^ i;
+    from_bytes_wide(wide, rcv[i]);
+    values[i] = 1000000ULL * i + 7;
+    ASSERT_EQ(computeValueCommitment(values[i], rcv[i], identifier, cv[i]), parser_ok);
+  }
+
+  value_commitment_batch_t batch = {0};
+  for (uint8_t i = 0; i < count; i++) {
+    ASSERT_EQ(valueCommitmentBatchAdd(&batch, values[i], rcv[i], generator, cv[i]), parser_ok);
+  }
+  EXPECT_EQ(valueCommitmentBatchFlush(&batch), parser_ok);
+
+  // A wrong value in any position makes its batch fail
+  for (uint8_t bad = 0; bad < count; bad++) {
+    parser_error_t err = parser_ok;
+    MEMZERO(&batch, sizeof(batch));
+    for (uint8_t i = 0; i < count && err == parser_ok; i++) {
+      const uint64_t value = (i == bad) ? values[i] + 1 : values[i];
+      err = valueCommitmentBatchAdd(&batch, value, rcv[i], generator, cv[i]);
+    }
+    if (err == parser_ok) {
+      err = valueCommitmentBatchFlush(&batch);
+    }
+    EXPECT_EQ(err, parser_invalid_cv) << "item " << static_cast<int>(bad);
+  }
+
+  // Two commitments swapped between items fail as well
+  MEMZERO(&batch, sizeof(batch));
+  ASSERT_EQ(valueCommitmentBatchAdd(&batch, values[0], rcv[0], generator, cv[1]), parser_ok);
+  ASSERT_EQ(valueCommitmentBatchAdd(&batch, values[1], rcv[1], generator, cv[0]), parser_ok);
+  EXPECT_EQ(valueCommitmentBatchFlush(&batch), parser_invalid_cv);
+
+  // Two commitments shifted by the order 2 point cancel out in the weighted sum, they must be
+  // rejected as outside the prime order subgroup
+  addTorsionPoint(cv[0]);
+  addTorsionPoint(cv[1]);
+  MEMZERO(&batch, sizeof(batch));
+  ASSERT_EQ(valueCommitmentBatchAdd(&batch, values[0], rcv[0], generator, cv[0]), parser_ok);
+  ASSERT_EQ(valueCommitmentBatchAdd(&batch, values[1], rcv[1], generator, cv[1]), parser_ok);
+  EXPECT_EQ(valueCommitmentBatchFlush(&batch), parser_invalid_cv);
+}
+
+TEST(ValueCommitment, GeneratorCache) {
+  uint8_t identifier[ASSET_IDENTIFIER_LENGTH] = {
+      156, 229, 191, 54,  209, 138, 169, 235, 234, 174, 120,
+      186, 142, 34,  183, 118, 64,  243, 100, 134, 234, 27,
+      248, 27,  36,  245, 9,   146, 30,  110, 203, 169};
+
+  crypto_clearGeneratorCache();
+  uint8_t computed[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+  ASSERT_EQ(computeValueCommitmentGenerator(identifier, computed), parser_ok);
+
+  // Served from the cache the second time
+  uint8_t cached[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+  ASSERT_EQ(computeValueCommitmentGenerator(identifier, cached), parser_ok);
+  EXPECT_EQ(toHexString(cached, sizeof(cached)), toHexString(computed, sizeof(computed)));
+
+  // Commitments through the cache and through a compressed generator agree
+  uint8_t rcv[KEY_LENGTH] = {0};
+  rcv[0] = 0x2a;
+  uint8_t cv[KEY_LENGTH] = {0};
+  ASSERT_EQ(computeValueCommitment(42, rcv, identifier, cv), parser_ok);
+
+  uint8_t compressed[KEY_LENGTH] = {0};
+  uint8_t generator[VALUE_COMMITMENT_GENERATOR_LEN] = {0};
+  blake2s_state state;
+  // VALUE_COMMITMENT_GENERATOR_PERSONALIZATION, the header is C only
+  blake2s_init_with_personalization(&state, KEY_LENGTH, (const uint8_t *)"MASP__v_", 8);
+  blake2s_update(&state, identifier, sizeof(identifier));
+  blake2s_final(&state, compressed, KEY_LENGTH);
+  ASSERT_EQ(value_commitment_generator(compressed, generator), parser_ok);
+  EXPECT_EQ(toHexString(generator, sizeof(generator)), toHexString(computed, sizeof(computed)));
+
+  uint8_t convert_cv[KEY_LENGTH] = {0};
+  ASSERT_EQ(computeConvertValueCommitment(42, rcv, compressed, convert_cv), parser_ok);
+  EXPECT_EQ(toHexString(convert_cv, sizeof(convert_cv)), toHexString(cv, sizeof(cv)));
+
+  crypto_clearGeneratorCache();
+}
@@ -19,10 +19,20 @@
 #include <vector>
 #include <iostream>
 #include <cstring>
+#include <memory>
 #include <hexutils.h>
 #include "crypto_helper.h"
 #include "leb128.h"
 #include "bech32.h"
+#include "parser_impl.h"
+#include "parser_impl_masp.h"
+#include "parser_impl_common.h"
+#include "blake2b_template.h"
+#include "tx_hash.h"
+#include "signhash.h"
+#include "blake2.h"
+#include "parser_address.h"
+#include "token_registry.h"
 
 using namespace std;
 struct NamAddress {
@@ -148,3 +158,275 @@ TEST(LEB128, LEB128Encoding) {
                 EXPECT_TRUE(memcmp(testcase.expected.data(), &encoded, bytes) == 0);
         }
 }
+
+static void appendUint32(vector<uint8_t> &buffer, uint32_t value) {
+        for (uint8_t i = 0; i < sizeof(value); i++) {
+                buffer.push_back((value >> (8 * i)) & 0xFF);
+        }
+}
+
+static void appendUint64(vector<uint8_t> &buffer, uint64_t value) {
+        for (uint8_t i = 0; i < sizeof(value); i++) {
+                buffer.push_back((value >> (8 * i)) & 0xFF);
+        }
+}
+
+// MASP builder section without assets and with two zeroed spend descriptions
+static vector<uint8_t> buildMaspBuilderSection(const vector<uint64_t> &spendIndices) {
+        vector<uint8_t> buffer = {DISCRIMINANT_MASP_BUILDER};
+        buffer.insert(buffer.end(), HASH_LEN, 0);   // target hash
+        appendUint32(buffer, 0);                    // asset types
+
+        appendUint32(buffer, spendIndices.size());
+        for (const auto index : spendIndices) {
+                appendUint64(buffer, index);
+        }
+        appendUint32(buffer, 0);                    // converts indices
+        appendUint32(buffer, 0);                    // outputs indices
+
+        appendUint32(buffer, 0);                    // target height
+        appendUint32(buffer, 0);                    // expiry height
+        appendUint32(buffer, 0);                    // transparent inputs
+        appendUint32(buffer, 0);                    // transparent outputs
+        buffer.push_back(0);                        // spend anchor
+        appendUint32(buffer, 0);                    // sapling target height
+        buffer.push_back(0);                        // value sum
+        buffer.push_back(0);                        // convert anchor
+
+        appendUint32(buffer, 2);
+        for (uint8_t i = 0; i < 2; i++) {
+                buffer.insert(buffer.end(), EXTENDED_FVK_LEN + DIVERSIFIER_LEN + NOTE_LEN, 0);
+                buffer.push_back(0);                // merkle path
+                appendUint64(buffer, 0);            // position
+        }
+        appendUint32(buffer, 0);                    // converts
+        appendUint32(buffer, 0);                    // outputs
+        return buffer;
+}
+
+static parser_error_t readMaspBuilderSection(const vector<uint8_t> &buffer, masp_builder_section_t *maspBuilder) {
+        parser_context_t ctx = {buffer.data(), (uint16_t)buffer.size(), 0, nullptr};
+        return readMaspBuilder(&ctx, maspBuilder);
+}
+
+TEST(MaspBuilder, MetadataPermutation) {
+        masp_builder_section_t maspBuilder = {};
+
+        ASSERT_EQ(readMaspBuilderSection(buildMaspBuilderSection({1, 0}), &maspBuilder), parser_ok);
+        EXPECT_EQ(maspBuilder.metadata.spends_forward[0], 1);
+        EXPECT_EQ(maspBuilder.metadata.spends_forward[1], 0);
+        EXPECT_EQ(maspBuilder.metadata.spends_inverse[0], 1);
+        EXPECT_EQ(maspBuilder.metadata.spends_inverse[1], 0);
+        EXPECT_EQ(maspBuilder.metadata.spends_inverse[2], INVALID_METADATA_INDEX);
+        EXPECT_EQ(maspBuilder.builder.sapling_builder.spends_offsets[1], EXTENDED_FVK_LEN + DIVERSIFIER_LEN + NOTE_LEN + 1 + sizeof(uint64_t));
+
+        EXPECT_EQ(readMaspBuilderSection(buildMaspBuilderSection({1, 1}), &maspBuilder), parser_duplicated_field);
+        EXPECT_EQ(readMaspBuilderSection(buildMaspBuilderSection({0, 2}), &maspBuilder), parser_value_out_of_range);
+        EXPECT_EQ(readMaspBuilderSection(buildMaspBuilderSection({0}), &maspBuilder), parser_invalid_number_of_spends);
+}
+
+// Serialized transfer source/target: owner, token and amount. The token is NAM unless unknownToken is set
+static void appendTransferEntry(vector<uint8_t> &buffer, uint8_t owner, bool unknownToken) {
+        if (owner == 0) {
+                buffer.push_back(2);                // MASP internal address
+                buffer.push_back(12);
+        } else {
+                buffer.push_back(0);                // established address
+                buffer.insert(buffer.end(), 20, owner);
+        }
+        uint8_t nam[ADDRESS_LEN_BYTES] = {0};
+        parseHexString(nam, sizeof(nam), "01503d6b0ce56e316df06d2dbfce52c9d48844df4a");
+        nam[ADDRESS_LEN_BYTES - 1] ^= unknownToken;
+        buffer.push_back(0);
+        buffer.insert(buffer.end(), nam + 1, nam + ADDRESS_LEN_BYTES);
+        buffer.insert(buffer.end(), 32, 0);         // amount
+        buffer.push_back(0);                        // denomination
+}
+
+static void expectLayoutItem(const parser_context_t *ctx, uint8_t idx, uint8_t kind, uint8_t field, uint16_t entity) {
+        layout_item_t item = {};
+        ASSERT_EQ(getLayoutItem(ctx, idx, &item), parser_ok) << "item " << (int)idx;
+        EXPECT_EQ(item.kind, kind) << "item " << (int)idx;
+        EXPECT_EQ(item.field, field) << "item " << (int)idx;
+        EXPECT_EQ(item.entity, entity) << "item " << (int)idx;
+}
+
+TEST(DisplayLayout, SourcesAndTargets) {
+        // Known tokens take two screens, unknown ones three. MASP internal owners are not shown
+        vector<uint8_t> sources;
+        appendTransferEntry(sources, 1, false);
+        appendTransferEntry(sources, 0, false);
+        appendTransferEntry(sources, 2, true);
+        vector<uint8_t> targets;
+        appendTransferEntry(targets, 3, true);
+        const uint16_t entryLen = sources.size() / 3;
+
+        auto txObj = make_unique<parser_tx_t>();
+        txObj->typeTx = Transfer;
+        txObj->transfer.sources = {sources.data(), (uint16_t)sources.size()};
+        txObj->transfer.sources_len = 3;
+        txObj->transfer.targets = {targets.data(), (uint16_t)targets.size()};
+        txObj->transfer.targets_len = 1;
+        parser_context_t ctx = {};
+        ctx.tx_obj = txObj.get();
+
+        ASSERT_EQ(buildDisplayLayout(&ctx), parser_ok);
+        ASSERT_EQ(txObj->layout.numItems, 8);
+        expectLayoutItem(&ctx, 0, layout_source, 0, 0);
+        expectLayoutItem(&ctx, 1, layout_source, 1, 0);
+        expectLayoutItem(&ctx, 2, layout_source, 0, 2 * entryLen);
+        expectLayoutItem(&ctx, 4, layout_source, 2, 2 * entryLen);
+        expectLayoutItem(&ctx, 5, layout_target, 0, 0);
+        expectLayoutItem(&ctx, 7, layout_target, 2, 0);
+
+        layout_item_t item = {};
+        EXPECT_EQ(getLayoutItem(&ctx, 8, &item), parser_display_idx_out_of_range);
+
+        // The count is available right after the layout is built, the fee token has no symbol here
+        ctx.expert = false;
+        uint8_t numItems = 0;
+        ASSERT_EQ(getNumItems(&ctx, &numItems), parser_ok);
+        EXPECT_EQ(numItems, TRANSFER_NORMAL_PARAMS + 8 + 1);
+}
+
+TEST(DisplayLayout, MaspSpends) {
+        // Two spends without asset data: three screens each, between the sources and the targets
+        const vector<uint8_t> builder = buildMaspBuilderSection({0, 1});
+        vector<uint8_t> sources;
+        appendTransferEntry(sources, 0, false);
+        vector<uint8_t> targets;
+        appendTransferEntry(targets, 1, false);
+
+        auto txObj = make_unique<parser_tx_t>();
+        ASSERT_EQ(readMaspBuilderSection(builder, &txObj->transaction.sections.maspBuilder), parser_ok);
+        txObj->typeTx = Transfer;
+        txObj->transaction.isMasp = true;
+        txObj->transfer.sources = {sources.data(), (uint16_t)sources.size()};
+        txObj->transfer.sources_len = 1;
+        txObj->transfer.targets = {targets.data(), (uint16_t)targets.size()};
+        txObj->transfer.targets_len = 1;
+        parser_context_t ctx = {};
+        ctx.tx_obj = txObj.get();
+
+        ASSERT_EQ(buildDisplayLayout(&ctx), parser_ok);
+        ASSERT_EQ(txObj->layout.numItems, 8);
+        expectLayoutItem(&ctx, 0, layout_spend, 0, 0);
+        expectLayoutItem(&ctx, 2, layout_spend, 2, 0);
+        expectLayoutItem(&ctx, 3, layout_spend, 0, 1);
+        expectLayoutItem(&ctx, 5, layout_spend, 2, 1);
+        expectLayoutItem(&ctx, 6, layout_target, 0, 0);
+        expectLayoutItem(&ctx, 7, layout_target, 1, 0);
+}
+
+TEST(DisplayLayout, ItemsPastTheTable) {
+        // More screens than MAX_LAYOUT_ITEMS: the ones past the table are resolved by walking the entities
+        const uint16_t numSources = MAX_LAYOUT_ITEMS / 2 + 8;
+        vector<uint8_t> sources;
+        for (uint16_t i = 0; i < numSources; i++) {
+                appendTransferEntry(sources, 1 + (i % 200), false);
+        }
+        vector<uint8_t> targets;
+        appendTransferEntry(targets, 1, true);
+        const uint16_t entryLen = sources.size() / numSources;
+
+        auto txObj = make_unique<parser_tx_t>();
+        txObj->typeTx = Transfer;
+        txObj->transfer.sources = {sources.data(), (uint16_t)sources.size()};
+        txObj->transfer.sources_len = numSources;
+        txObj->transfer.targets = {targets.data(), (uint16_t)targets.size()};
+        txObj->transfer.targets_len = 1;
+        parser_context_t ctx = {};
+        ctx.tx_obj = txObj.get();
+
+        ASSERT_EQ(buildDisplayLayout(&ctx), parser_ok);
+        const uint16_t numItems = 2 * numSources + 3;
+        ASSERT_EQ(txObj->layout.numItems, numItems);
+        for (uint16_t idx = 0; idx < 2 * numSources; idx++) {
+                expectLayoutItem(&ctx, idx, layout_source, idx % 2, (idx / 2) * entryLen);
+        }
+        for (uint8_t field = 0; field < 3; field++) {
+                expectLayoutItem(&ctx, 2 * numSources + field, layout_target, field, 0);
+        }
+
+        // Screens are indexed with 8 bits
+        for (uint16_t i = numSources; i < 130; i++) {
+                appendTransferEntry(sources, 1, false);
+        }
+        txObj->transfer.sources = {sources.data(), (uint16_t)sources.size()};
+        txObj->transfer.sources_len = 130;
+        EXPECT_EQ(buildDisplayLayout(&ctx), parser_unexpected_number_items);
+}
+
+static AddressAlt tokenAddress(const uint8_t *bytes) {
+        AddressAlt token = {};
+        if (bytes[0] == PREFIX_ESTABLISHED) {
+                token.tag = 0;
+                token.Established.hash = {bytes + 1, 20};
+        } else {
+                token.tag = 2;
+                token.Internal.tag = 4;
+                token.Internal.IbcToken.ibcTokenHash = {bytes + 1, 20};
+        }
+        return token;
+}
+
+TEST(Tokens, RegistryLookup) {
+        const tokens_t *tokens = token_registry_mainnet.tokens;
+        ASSERT_GT(token_registry_mainnet.len, 0);
+        for (uint16_t i = 0; i < token_registry_mainnet.len; i++) {
+                if (i > 0) {
+                        EXPECT_LT(memcmp(tokens[i - 1].address, tokens[i].address, ADDRESS_LEN_BYTES), 0);
+                }
+                const AddressAlt token = tokenAddress(tokens[i].address);
+                const char *symbol = nullptr;
+                ASSERT_EQ(readToken(&token, &symbol), parser_ok);
+                EXPECT_STREQ(symbol, tokens[i].symbol);
+        }
+
+        // The registry bytes encode back to the address they were generated from
+        uint8_t nam[ADDRESS_LEN_BYTES] = {0};
+        ASSERT_EQ(parseHexString(nam, sizeof(nam), "01503d6b0ce56e316df06d2dbfce52c9d48844df4a"), sizeof(nam));
+        const AddressAlt namToken = tokenAddress(nam);
+        char address[ADDRESS_LEN_TESTNET + 1] = {0};
+        ASSERT_EQ(crypto_encodeAltAddress(&namToken, address, sizeof(address)), parser_ok);
+        EXPECT_EQ(string(address), "tnam1q9gr66cvu4hrzm0sd5kmlnjje82gs3xlfg3v6nu7");
+        const char *symbol = nullptr;
+        ASSERT_EQ(readToken(&namToken, &symbol), parser_ok);
+        EXPECT_STREQ(symbol, "NAM ");
+
+        nam[ADDRESS_LEN_BYTES - 1] ^= 0x01;
+        const AddressAlt unknownToken = tokenAddress(nam);
+        ASSERT_EQ(readToken(&unknownToken, &symbol), parser_ok);
+        EXPECT_EQ(symbol, nullptr);
+}
+
+TEST(TxHash, TemplateMatchesFreshContext) {
+        const uint8_t input[] = {0x01, 0x02, 0x03, 0x04};
+
+        for (int round = 0; round < 2; round++) {
+                blake2b_template_ctx_t ctx;
+                uint8_t fromTemplate[BLAKE2B_TEMPLATE_OUTPUT_LEN] = {0};
+                ASSERT_EQ(blake2b_template_load(&ctx, BLAKE2B_TEMPLATE_SAPLING_OUTPUTS_MEMOS), zxerr_ok);
+                ASSERT_EQ(blake2b_template_update(&ctx, input, sizeof(input)), zxerr_ok);
+                ASSERT_EQ(blake2b_template_final(&ctx, fromTemplate), zxerr_ok);
+
+                blake2b_state state;
+                uint8_t fresh[BLAKE2B_TEMPLATE_OUTPUT_LEN] = {0};
+                blake2b_init_with_personalization(&state, BLAKE2B_TEMPLATE_OUTPUT_LEN,
+                                                  (const uint8_t *)ZCASH_SAPLING_OUTPUTS_MEMOS_HASH_PERSONALIZATION, PERSONALIZATION_SIZE);
+                blake2b_update(&state, input, sizeof(input));
+                blake2b_final(&state, fresh, BLAKE2B_TEMPLATE_OUTPUT_LEN);
+
+                EXPECT_EQ(memcmp(fromTemplate, fresh, sizeof(fresh)), 0);
+        }
+}
+
+TEST(TxHash, SignatureHashMatchesTxId) {
+        parser_tx_t txObj = {};
+        uint8_t txId[HASH_SIZE] = {0};
+        uint8_t sighash[HASH_SIZE] = {0};
+
+        ASSERT_EQ(tx_hash_txId(&txObj, txId), zxerr_ok);
+        ASSERT_EQ(signature_hash(&txObj, sighash), zxerr_ok);
+        EXPECT_EQ(memcmp(txId, sighash, HASH_SIZE), 0);
+}
@@ -32,3 +32,7 @@ INSTANTIATE_TEST_SUITE_P
 
 TEST_P(JsonTestsA, CheckUIOutput_CurrentTX_Normal) { check_testcase(GetParam(), false); }
 TEST_P(JsonTestsA, CheckUIOutput_CurrentTX_Expert) { check_testcase(GetParam(), true); }
+
+TEST_P(JsonTestsA, CheckIncrementalParse) { check_incremental_testcase(GetParam()); }
+
+TEST_P(JsonTestsA, CheckUIOutput_ConcurrentModes) { check_concurrent_testcase(GetParam()); }
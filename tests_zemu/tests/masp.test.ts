@@ -71,6 +71,36 @@ describe('Masp', function () {
     }
   })
 
+  test.concurrent.each(MASP_MODELS)('Get randomness batch', async function (m) {
+    const sim = new Zemu(m.path)
+    try {
+      await sim.start({ ...defaultOptions, model: m.name })
+      const transport = sim.getTransport()
+      // INS_GET_RAND_BATCH: P1 = kind, P2 = number of items
+      const getBatch = (kind: number, count: number) => transport.send(0x57, 0x0b, kind, count, Buffer.alloc(0), [0x9000, 0x6b00])
+      const returnCode = (resp: Buffer) => resp.readUInt16BE(resp.length - 2)
+
+      const respConvert = await getBatch(2, 7)
+      expect(returnCode(respConvert)).toEqual(0x9000)
+      expect(respConvert.length).toEqual(7 * 32 + 2)
+
+      const respSpend = await getBatch(0, 3)
+      expect(returnCode(respSpend)).toEqual(0x9000)
+      expect(respSpend.length).toEqual(3 * 64 + 2)
+
+      const respOutput = await getBatch(1, 1)
+      expect(returnCode(respOutput)).toEqual(0x9000)
+      expect(respOutput.length).toEqual(64 + 2)
+
+      // More items than fit in one response
+      expect(returnCode(await getBatch(2, 8))).toEqual(0x6b00)
+      expect(returnCode(await getBatch(0, 4))).toEqual(0x6b00)
+      expect(returnCode(await getBatch(1, 0))).toEqual(0x6b00)
+    } finally {
+      await sim.close()
+    }
+  })
+
   test.concurrent.each(MASP_MODELS)('Sign MASP Spends', async function (m) {
     const sim = new Zemu(m.path)
     try {